@@ -45,13 +45,19 @@
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/Band.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/BlockDiagonalMatrix.h>
+#include <blaze/math/CirculantMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constraints.h>
 #include <blaze/math/CustomMatrix.h>
 #include <blaze/math/CustomVector.h>
+#include <blaze/math/DeltaCompressedMatrix.h>
 #include <blaze/math/DiagonalMatrix.h>
+#include <blaze/math/DistanceFlag.h>
+#include <blaze/math/DLPack.h>
 #include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicSparseMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Epsilon.h>
 #include <blaze/math/Functors.h>
@@ -61,13 +67,17 @@
 #include <blaze/math/InitializerMatrix.h>
 #include <blaze/math/InitializerVector.h>
 #include <blaze/math/InversionFlag.h>
+#include <blaze/math/HankelMatrix.h>
 #include <blaze/math/HermitianMatrix.h>
+#include <blaze/math/HODLRMatrix.h>
 #include <blaze/math/HybridMatrix.h>
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/PaddingFlag.h>
+#include <blaze/math/PermutationMatrix.h>
 #include <blaze/math/ReductionFlag.h>
+#include <blaze/math/RefinementFlag.h>
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
@@ -77,7 +87,11 @@
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/StrictlyLowerMatrix.h>
 #include <blaze/math/StrictlyUpperMatrix.h>
+#include <blaze/math/StridedMatrix.h>
+#include <blaze/math/StridedVector.h>
+#include <blaze/math/SymmetricCompressedMatrix.h>
 #include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/ToeplitzMatrix.h>
 #include <blaze/math/Traits.h>
 #include <blaze/math/TransposeFlag.h>
 #include <blaze/math/TypeTraits.h>
@@ -14915,6 +14915,22 @@
 // In the context of C++11 threads, the function will return the previously specified number of
 // threads.
 //
+// The threads are started lazily by the first parallel operation, i.e. a program that never
+// executes an operation in parallel doesn't start any thread. In order to avoid the startup
+// latency in the first parallel operation, the threads can be started explicitly by means of
+// the \c warmUpThreads() function. Additionally, long-running applications can release idle
+// threads via the \c setThreadIdleTimeout() function. Threads that have been idle for the given
+// duration terminate and are restarted on demand by the next parallel operation:
+
+   \code
+   blaze::setThreadIdleTimeout( std::chrono::seconds( 10 ) );  // Terminate idle threads after 10s
+   // ...
+   blaze::warmUpThreads();  // Restart all threads in advance of a latency critical section
+   \endcode
+
+// Please note that the idle timeout requires C++11 threads and has no effect in combination
+// with Boost threads.
+//
 //
 // \n \section cpp_threads_configuration C++11 Thread Configuration
 // <hr>
@@ -14937,6 +14953,54 @@
 // the C++11 thread parallelization.
 //
 //
+// \n \section cpp_threads_executor Executing Operations on an Application Thread Pool
+// <hr>
+//
+// By default, all parallel operations are executed by the built-in thread pool of \b Blaze. In
+// case an application already manages its own thread pool (as for instance a task-based runtime
+// system), the additional threads of \b Blaze compete with the application for the available
+// cores. To avoid this oversubscription, the tasks of all parallel operations can be redirected
+// to the thread pool of the application by means of a custom executor. For that purpose, the
+// application has to derive from the \c blaze::Executor class and to inject the executor via
+// the \c setExecutor() function:
+
+   \code
+   class MyExecutor : public blaze::Executor
+   {
+    public:
+      // Returns the maximum number of concurrently executed tasks
+      size_t concurrency() const override;
+
+      // Returns the number of threads available for an operation started by the calling
+      // thread; returning 1 results in the serial execution on the calling thread
+      size_t available() const override;
+
+      // Executes the tasks task(0) to task(n-1) and blocks until all tasks are completed
+      void execute( size_t n, const std::function<void(size_t)>& task ) override;
+   };
+
+   MyExecutor executor;
+   blaze::setExecutor( executor );   // All parallel operations are executed via the executor
+   // ...
+   blaze::resetExecutor();           // Back to the built-in thread pool
+   \endcode
+
+// Operations started from within a task of a parallel operation are always executed serially.
+// Additionally, it is possible to restrict the number of threads used by the operations of a
+// single thread by means of a parallelism budget. In contrast to \c setNumThreads(), a budget
+// only affects the operations started by the calling thread:
+
+   \code
+   BLAZE_PARALLELISM_BUDGET( 2UL ) {
+      C = A * B;  // Executed by at most two threads
+   }
+   \endcode
+
+// Please note that with the C++11 thread parallelization the serial and parallel sections are
+// specific to the calling thread, i.e. \b Blaze operations can be started concurrently from
+// several threads of the application.
+//
+//
 // \n \section cpp_threads_known_issues Known Issues
 // <hr>
 //
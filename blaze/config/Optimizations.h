@@ -136,6 +136,40 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Configuration switch for the fixed-size small matrix kernels.
+// \ingroup config
+//
+// This configuration switch enables/disables the fixed-size kernels for small dense matrix
+// multiplications. In case the switch is set to 1, the multiplication of two small dense
+// matrices with runtime sizes (as for instance DynamicMatrix) dispatches at runtime into a
+// table of kernels that have been instantiated for the specific small dimensions and are
+// therefore fully unrolled. In case the switch is set to 0, these products are computed by
+// the general small matrix kernels. Note that this switch has no effect in case the optimized
+// kernels are disabled (see BLAZE_USE_OPTIMIZED_KERNELS).
+//
+// Possible settings for the fixed-size kernels:
+//  - Disabled: \b 0
+//  - Enabled : \b 1
+//
+// \note It is possible to (de-)activate the fixed-size kernels via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_USE_FIXED_SIZE_KERNELS=1 ...
+   \endcode
+
+   \code
+   #define BLAZE_USE_FIXED_SIZE_KERNELS 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_FIXED_SIZE_KERNELS
+#define BLAZE_USE_FIXED_SIZE_KERNELS 1
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Configuration switch for the initialization in default constructors.
 // \ingroup config
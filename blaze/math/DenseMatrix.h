@@ -46,15 +46,21 @@
 #include <blaze/math/adaptors/SymmetricMatrix.h>
 #include <blaze/math/adaptors/UpperMatrix.h>
 #include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/AliasedMult.h>
+#include <blaze/math/dense/Covariance.h>
+#include <blaze/math/dense/Distances.h>
 #include <blaze/math/dense/Eigen.h>
 #include <blaze/math/dense/Inversion.h>
+#include <blaze/math/dense/IterativeRefinement.h>
 #include <blaze/math/dense/LLH.h>
 #include <blaze/math/dense/PLLHP.h>
 #include <blaze/math/dense/LQ.h>
 #include <blaze/math/dense/LSE.h>
 #include <blaze/math/dense/LU.h>
+#include <blaze/math/dense/MatrixRoots.h>
 #include <blaze/math/dense/QL.h>
 #include <blaze/math/dense/QR.h>
+#include <blaze/math/dense/RankUpdateAccumulator.h>
 #include <blaze/math/dense/RQ.h>
 #include <blaze/math/dense/SVD.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -91,6 +97,7 @@
 #include <blaze/math/expressions/DMatNoSIMDExpr.h>
 #include <blaze/math/expressions/DMatReduceExpr.h>
 #include <blaze/math/expressions/DMatRepeatExpr.h>
+#include <blaze/math/expressions/DMatRollingExpr.h>
 #include <blaze/math/expressions/DMatScalarDivExpr.h>
 #include <blaze/math/expressions/DMatScalarMultExpr.h>
 #include <blaze/math/expressions/DMatSerialExpr.h>
@@ -62,6 +62,7 @@
 #include <blaze/math/expressions/DVecNoSIMDExpr.h>
 #include <blaze/math/expressions/DVecReduceExpr.h>
 #include <blaze/math/expressions/DVecRepeatExpr.h>
+#include <blaze/math/expressions/DVecRollingExpr.h>
 #include <blaze/math/expressions/DVecScalarDivExpr.h>
 #include <blaze/math/expressions/DVecScalarMultExpr.h>
 #include <blaze/math/expressions/DVecSerialExpr.h>
@@ -0,0 +1,70 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/DistanceFlag.h
+//  \brief Header file for the distance flag enumeration
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISTANCEFLAG_H_
+#define _BLAZE_MATH_DISTANCEFLAG_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  DISTANCE FLAG VALUES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Distance flag.
+// \ingroup math
+//
+// The DistanceFlag type enumeration represents the different distance metrics that are available
+// for the computation of pairwise distances and nearest neighbors (see the pairwiseDistances()
+// and knn() functions). The following flags are available:
+//
+//  - \c euclideanDistance: The Euclidean distance \f$ \|x-y\|_2 \f$.
+//  - \c squaredEuclideanDistance: The squared Euclidean distance \f$ \|x-y\|_2^2 \f$.
+//  - \c cosineDistance: The cosine distance \f$ 1 - \frac{x \cdot y}{\|x\|_2 \|y\|_2} \f$. In
+//          case either of the two vectors is zero, the cosine distance is defined as 1.
+*/
+enum DistanceFlag
+{
+   euclideanDistance        = 0,  //!< Flag for the Euclidean distance.
+   squaredEuclideanDistance = 1,  //!< Flag for the squared Euclidean distance.
+   cosineDistance           = 2   //!< Flag for the cosine distance.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
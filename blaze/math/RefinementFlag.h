@@ -0,0 +1,75 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/RefinementFlag.h
+//  \brief Header file for the refinement flag enumeration
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_REFINEMENTFLAG_H_
+#define _BLAZE_MATH_REFINEMENTFLAG_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  REFINEMENT FLAG VALUES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Refinement flag.
+// \ingroup math
+//
+// The RefinementFlag type enumeration represents the different types of iterative refinement
+// algorithms that are available for the mixed-precision solution of linear systems of equations
+// (see the solveRefined() functions). The following flags are available:
+//
+//  - \c byIR: The classical iterative refinement. The correction of each refinement step is
+//          computed by a forward and back substitution with the single precision LU factors of
+//          the system matrix. This is the fastest variant for well-conditioned systems, but it
+//          only converges in case the condition number of the system matrix is well below the
+//          reciprocal of the single precision unit roundoff.
+//  - \c byGMRESIR: The GMRES-based iterative refinement. The correction equation of each
+//          refinement step is solved by means of GMRES, which is preconditioned by the single
+//          precision LU factors of the system matrix. Each refinement step is more expensive than
+//          in case of \c byIR, but the algorithm also converges for considerably worse conditioned
+//          system matrices.
+*/
+enum RefinementFlag
+{
+   byIR      = 0,  //!< Flag for the classical mixed-precision iterative refinement.
+   byGMRESIR = 1   //!< Flag for the GMRES-based mixed-precision iterative refinement.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
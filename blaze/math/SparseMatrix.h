@@ -113,6 +113,8 @@
 #include <blaze/math/serialization/MatrixSerializer.h>
 #include <blaze/math/smp/DenseMatrix.h>
 #include <blaze/math/smp/SparseMatrix.h>
+#include <blaze/math/sparse/MatrixPowers.h>
+#include <blaze/math/sparse/Prune.h>
 #include <blaze/math/sparse/SparseMatrix.h>
 #include <blaze/math/views/Column.h>
 #include <blaze/math/views/Row.h>
@@ -0,0 +1,491 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/AliasedMult.h
+//  \brief Header file for the aliasing-aware assignment of dense multiplication expressions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_ALIASEDMULT_H_
+#define _BLAZE_MATH_DENSE_ALIASEDMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatSerialExpr.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsColumnVector.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsMatrix.h>
+#include <blaze/math/typetraits/IsMatVecMultExpr.h>
+#include <blaze/math/typetraits/IsRowVector.h>
+#include <blaze/math/typetraits/IsTVecMatMultExpr.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/IsVector.h>
+#include <blaze/math/typetraits/TransposeFlag.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Panel-wise in-place computation of a dense matrix product.
+// \ingroup dense_matrix
+//
+// \param A The target matrix, which is also the aliased operand of the product.
+// \param B The square, non-aliased operand of the product.
+// \return void
+//
+// This function computes \f$ A = A \cdot B \f$ (in case \a ByRows is \a true) or
+// \f$ A = B \cdot A \f$ (in case \a ByRows is \a false) without a temporary of the size of
+// \a A. Since each row (column) of the result only depends on the same row (column) of \a A,
+// the product is computed for one panel of rows (columns) at a time into a small buffer, which
+// is copied back before the next panel is processed. In case SMP is enabled, the panels are
+// distributed evenly among the available threads, each of which uses its own buffer.
+*/
+template< bool ByRows    // Panel orientation
+        , typename MT1   // Type of the target matrix
+        , typename MT2 > // Type of the non-aliased operand
+void panelMultAssign( MT1& A, const MT2& B )
+{
+   using ET = ElementType_t<MT1>;
+
+   const size_t M( ByRows ? A.rows() : A.columns() );
+   const size_t N( ByRows ? A.columns() : A.rows() );
+
+   if( M == 0UL || N == 0UL )
+      return;
+
+   const size_t panel( min( M, max( 16UL, min( 256UL, 262144UL / N ) ) ) );
+   const size_t panels( ( M + panel - 1UL ) / panel );
+
+   const bool parallel( A.rows()*A.columns() >= SMP_DMATDMATMULT_THRESHOLD &&
+                        !isSerialSectionActive() && !isParallelSectionActive() );
+   const size_t threads( parallel ? min( getNumThreads(), panels ) : 1UL );
+
+   const auto compute = [&]( size_t pbegin, size_t pend )
+   {
+      DynamicMatrix<ET,rowMajor> T;
+
+      for( size_t p=pbegin; p<pend; ++p )
+      {
+         const size_t i ( p*panel );
+         const size_t mi( min( panel, M - i ) );
+
+         if( ByRows ) {
+            auto Ap( submatrix( A, i, 0UL, mi, N, unchecked ) );
+            T = serial( Ap * B );
+            Ap = serial( T );
+         }
+         else {
+            auto Ap( submatrix( A, 0UL, i, N, mi, unchecked ) );
+            T = serial( B * Ap );
+            Ap = serial( T );
+         }
+      }
+   };
+
+   if( threads == 1UL ) {
+      compute( 0UL, panels );
+   }
+   else BLAZE_PARALLEL_SECTION
+   {
+      smpFor( threads, [&]( size_t t )
+      {
+         compute( ( t*panels ) / threads, ( ( t+1UL )*panels ) / threads );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of a single block of a triangular matrix/vector product.
+// \ingroup dense_vector
+//
+// \param y The buffer for the resulting block.
+// \param A The square upper or lower triangular matrix.
+// \param x The right-hand side column vector.
+// \param i The index of the first element of the block.
+// \param m The number of elements of the block.
+// \return void
+*/
+template< bool Upper    // Triangular structure of the matrix
+        , typename VT1  // Type of the buffer
+        , typename MT   // Type of the triangular matrix
+        , typename VT2  // Type of the right-hand side vector
+        , EnableIf_t< IsColumnVector_v<VT1> >* = nullptr >
+void triangularBlockMult( VT1& y, const MT& A, const VT2& x, size_t i, size_t m )
+{
+   const size_t N( x.size() );
+
+   if( Upper )
+      y = submatrix( A, i, i, m, N-i, unchecked ) * subvector( x, i, N-i, unchecked );
+   else
+      y = submatrix( A, i, 0UL, m, i+m, unchecked ) * subvector( x, 0UL, i+m, unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of a single block of a triangular vector/matrix product.
+// \ingroup dense_vector
+//
+// \param y The buffer for the resulting block.
+// \param A The square upper or lower triangular matrix.
+// \param x The left-hand side row vector.
+// \param i The index of the first element of the block.
+// \param m The number of elements of the block.
+// \return void
+*/
+template< bool Upper    // Triangular structure of the matrix
+        , typename VT1  // Type of the buffer
+        , typename MT   // Type of the triangular matrix
+        , typename VT2  // Type of the left-hand side vector
+        , EnableIf_t< IsRowVector_v<VT1> >* = nullptr >
+void triangularBlockMult( VT1& y, const MT& A, const VT2& x, size_t i, size_t m )
+{
+   const size_t N( x.size() );
+
+   if( Upper )
+      y = subvector( x, 0UL, i+m, unchecked ) * submatrix( A, 0UL, i, i+m, m, unchecked );
+   else
+      y = subvector( x, i, N-i, unchecked ) * submatrix( A, i, i, N-i, m, unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blockwise in-place computation of a triangular matrix/vector product.
+// \ingroup dense_vector
+//
+// \param A The square upper or lower triangular matrix.
+// \param x The target vector, which is also the aliased operand of the product.
+// \return void
+//
+// This function computes \f$ \vec{x} = A \cdot \vec{x} \f$ (for a column vector \a x) or
+// \f$ \vec{x}^T = \vec{x}^T \cdot A \f$ (for a row vector \a x) for an upper (\a Upper is
+// \a true) or lower (\a Upper is \a false) triangular matrix \a A without a temporary of the
+// size of \a x. The blocks of \a x are processed in an order such that a block is overwritten
+// only after it has been read for the last time, which requires to buffer only the current
+// block of the result. The matrix/vector products of the individual blocks are executed in
+// parallel in case SMP is enabled.
+*/
+template< bool Upper     // Triangular structure of the matrix
+        , typename MT    // Type of the triangular matrix
+        , typename VT >  // Type of the target vector
+void triangularMultAssign( const MT& A, VT& x )
+{
+   constexpr size_t block( 512UL );
+
+   // Top-down processing in case each block only depends on the subsequent elements
+   constexpr bool topDown( Upper == IsColumnVector_v<VT> );
+
+   const size_t N( x.size() );
+
+   DynamicVector< ElementType_t<VT>, TransposeFlag_v<VT> > tmp;
+
+   for( size_t b=0UL; b<N; b+=block )
+   {
+      const size_t m( min( block, N - b ) );
+      const size_t i( topDown ? b : N - b - m );
+
+      triangularBlockMult<Upper>( tmp, A, x, i, m );
+      subvector( x, i, m, unchecked ) = tmp;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend of the aliasing-aware assignment of a matrix expression.
+// \ingroup dense_matrix
+//
+// \param lhs The target dense matrix.
+// \param rhs The right-hand side matrix expression aliasing the target.
+// \return \a false.
+*/
+template< typename MT1  // Type of the target dense matrix
+        , typename MT2  // Type of the right-hand side matrix expression
+        , EnableIf_t< IsMatrix_v<MT2> &&
+                      !( IsMatMatMultExpr_v<MT2> && IsDenseMatrix_v<MT2> ) >* = nullptr >
+bool aliasedAssign_backend( MT1& lhs, const MT2& rhs )
+{
+   MAYBE_UNUSED( lhs, rhs );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aliasing-aware assignment of a dense matrix multiplication expression.
+// \ingroup dense_matrix
+//
+// \param lhs The target dense matrix.
+// \param rhs The right-hand side multiplication expression aliasing the target.
+// \return \a true if the product has been assigned in place, \a false if not.
+//
+// This function handles the assignments \f$ A = A \cdot B \f$ and \f$ A = B \cdot A \f$ for a
+// square matrix \a B that does not alias \a A. All other products are rejected.
+*/
+template< typename MT1  // Type of the target dense matrix
+        , typename MT2  // Type of the right-hand side matrix expression
+        , EnableIf_t< IsMatMatMultExpr_v<MT2> && IsDenseMatrix_v<MT2> >* = nullptr >
+bool aliasedAssign_backend( MT1& lhs, const MT2& rhs )
+{
+   using LT = RemoveCVRef_t< decltype( rhs.leftOperand()  ) >;
+   using RT = RemoveCVRef_t< decltype( rhs.rightOperand() ) >;
+
+   if( rhs.rows() != lhs.rows() || rhs.columns() != lhs.columns() ) {
+      return false;
+   }
+
+   if( IsSame_v<LT,MT1> && rhs.leftOperand().isAliased( &lhs ) &&
+       !rhs.rightOperand().isAliased( &lhs ) )
+   {
+      CompositeType_t<RT> B( rhs.rightOperand() );
+      panelMultAssign<true>( lhs, B );
+      return true;
+   }
+
+   if( IsSame_v<RT,MT1> && rhs.rightOperand().isAliased( &lhs ) &&
+       !rhs.leftOperand().isAliased( &lhs ) )
+   {
+      CompositeType_t<LT> B( rhs.leftOperand() );
+      panelMultAssign<false>( lhs, B );
+      return true;
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend of the aliasing-aware assignment of a vector expression.
+// \ingroup dense_vector
+//
+// \param lhs The target dense vector.
+// \param rhs The right-hand side vector expression aliasing the target.
+// \return \a false.
+*/
+template< typename VT1  // Type of the target dense vector
+        , typename VT2  // Type of the right-hand side vector expression
+        , EnableIf_t< IsVector_v<VT2> &&
+                      !IsMatVecMultExpr_v<VT2> && !IsTVecMatMultExpr_v<VT2> >* = nullptr >
+bool aliasedAssign_backend( VT1& lhs, const VT2& rhs )
+{
+   MAYBE_UNUSED( lhs, rhs );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aliasing-aware assignment of a triangular matrix/vector multiplication expression.
+// \ingroup dense_vector
+//
+// \param lhs The target dense vector.
+// \param rhs The right-hand side multiplication expression aliasing the target.
+// \return \a true if the product has been assigned in place, \a false if not.
+//
+// This function handles the assignment \f$ \vec{x} = A \cdot \vec{x} \f$ for a dense, compile
+// time upper or lower triangular matrix \a A that does not alias \a x. All other products are
+// rejected.
+*/
+template< typename VT1  // Type of the target dense vector
+        , typename VT2  // Type of the right-hand side vector expression
+        , EnableIf_t< IsMatVecMultExpr_v<VT2> >* = nullptr >
+bool aliasedAssign_backend( VT1& lhs, const VT2& rhs )
+{
+   using MT = RemoveCVRef_t< decltype( rhs.leftOperand()  ) >;
+   using VT = RemoveCVRef_t< decltype( rhs.rightOperand() ) >;
+
+   if( !IsDenseMatrix_v<MT> || !( IsUpper_v<MT> || IsLower_v<MT> ) || !IsSame_v<VT,VT1> ||
+       !rhs.rightOperand().isAliased( &lhs ) || rhs.leftOperand().isAliased( &lhs ) ) {
+      return false;
+   }
+
+   CompositeType_t<MT> A( rhs.leftOperand() );
+   triangularMultAssign< IsUpper_v<MT> >( A, lhs );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aliasing-aware assignment of a triangular vector/matrix multiplication expression.
+// \ingroup dense_vector
+//
+// \param lhs The target dense vector.
+// \param rhs The right-hand side multiplication expression aliasing the target.
+// \return \a true if the product has been assigned in place, \a false if not.
+//
+// This function handles the assignment \f$ \vec{x}^T = \vec{x}^T \cdot A \f$ for a dense,
+// compile time upper or lower triangular matrix \a A that does not alias \a x. All other
+// products are rejected.
+*/
+template< typename VT1  // Type of the target dense vector
+        , typename VT2  // Type of the right-hand side vector expression
+        , EnableIf_t< IsTVecMatMultExpr_v<VT2> >* = nullptr >
+bool aliasedAssign_backend( VT1& lhs, const VT2& rhs )
+{
+   using VT = RemoveCVRef_t< decltype( rhs.leftOperand()  ) >;
+   using MT = RemoveCVRef_t< decltype( rhs.rightOperand() ) >;
+
+   if( !IsDenseMatrix_v<MT> || !( IsUpper_v<MT> || IsLower_v<MT> ) || !IsSame_v<VT,VT1> ||
+       !rhs.leftOperand().isAliased( &lhs ) || rhs.rightOperand().isAliased( &lhs ) ) {
+      return false;
+   }
+
+   CompositeType_t<MT> A( rhs.rightOperand() );
+   triangularMultAssign< IsUpper_v<MT> >( A, lhs );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aliasing-aware assignment of a matrix expression to a dense matrix.
+// \ingroup dense_matrix
+//
+// \param lhs The target dense matrix.
+// \param rhs The right-hand side matrix expression, which is known to alias the target.
+// \return \a true if the expression has been assigned in place, \a false if not.
+//
+// This function is used by the assignment operators of dense matrices in case the right-hand
+// side expression aliases the target. For the multiplication expressions \f$ A = A \cdot B \f$
+// and \f$ A = B \cdot A \f$ with a square matrix \a B the product is computed in place with a
+// buffer of a single panel of rows (columns) instead of a temporary of the size of \a A. In case
+// the expression cannot be assigned in place, the function returns \a false and the target
+// remains unchanged. In this case the assignment has to be performed via a temporary.
+*/
+template< typename MT1  // Type of the target dense matrix
+        , bool SO1      // Storage order of the target dense matrix
+        , typename MT2  // Type of the right-hand side matrix expression
+        , bool SO2 >    // Storage order of the right-hand side matrix expression
+bool aliasedAssign( DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   return aliasedAssign_backend( *lhs, *rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aliasing-aware assignment of a vector expression to a dense vector.
+// \ingroup dense_vector
+//
+// \param lhs The target dense vector.
+// \param rhs The right-hand side vector expression, which is known to alias the target.
+// \return \a true if the expression has been assigned in place, \a false if not.
+//
+// This function is used by the assignment operators of dense vectors in case the right-hand
+// side expression aliases the target. For the multiplication expressions
+// \f$ \vec{x} = A \cdot \vec{x} \f$ and \f$ \vec{x}^T = \vec{x}^T \cdot A \f$ with a compile
+// time upper or lower triangular matrix \a A the product is computed in place with a buffer of
+// a single block of \a x. In case the expression cannot be assigned in place, the function
+// returns \a false and the target remains unchanged. In this case the assignment has to be
+// performed via a temporary.
+*/
+template< typename VT1  // Type of the target dense vector
+        , typename VT2  // Type of the right-hand side vector expression
+        , bool TF >     // Transpose flag
+bool aliasedAssign( DenseVector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   return aliasedAssign_backend( *lhs, *rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1728 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BlockDiagonalMatrix.h
+//  \brief Header file for the implementation of a block-diagonal matrix
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BLOCKDIAGONALMATRIX_H_
+#define _BLAZE_MATH_DENSE_BLOCKDIAGONALMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/dense/Inversion.h>
+#include <blaze/math/dense/StructuredIterator.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/lapack/geev.h>
+#include <blaze/math/lapack/gesv.h>
+#include <blaze/math/lapack/heev.h>
+#include <blaze/math/lapack/potrf.h>
+#include <blaze/math/lapack/syev.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup block_diagonal_matrix BlockDiagonalMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a block-diagonal matrix.
+// \ingroup block_diagonal_matrix
+//
+// The BlockDiagonalMatrix class template represents a \f$ N \times N \f$ matrix, which consists
+// of a sequence of square dense blocks of arbitrary size along its diagonal. All elements outside
+// of the diagonal blocks are zero and are not stored. The blocks are stored contiguously in
+// column-major order. The type of the elements and the group tag of the matrix can be specified
+// via the two template parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, typename Tag >
+   class BlockDiagonalMatrix;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BlockDiagonalMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - Tag : optional type parameter to tag the matrix. The default type is \c blaze::Group0.
+//          See \ref grouping_tagging for details.
+//
+// A BlockDiagonalMatrix is created from the sizes of its diagonal blocks. All elements are
+// initially zero. The diagonal blocks are accessed via the block() function, which returns a
+// column-major CustomMatrix referring to the elements of the according block:
+
+   \code
+   using blaze::BlockDiagonalMatrix;
+
+   BlockDiagonalMatrix<double> A{ 3UL, 1UL, 2UL };  // 6x6 matrix with three diagonal blocks
+
+   A.block( 0UL ) = { { 4.0, 1.0, 0.0 }, { 1.0, 4.0, 1.0 }, { 0.0, 1.0, 4.0 } };
+   A.block( 1UL ) = { { 2.0 } };
+   A.block( 2UL ) = { { 3.0, 1.0 }, { 1.0, 3.0 } };
+   \endcode
+
+// Apart from the diagonal blocks, a BlockDiagonalMatrix is a read-only dense matrix, i.e. the
+// elements can only be modified via the blocks. It can be used as operand in all arithmetic
+// operations and can be converted into any other dense or sparse matrix by means of an
+// assignment. Additionally, the following operations are performed block by block by means of
+// the dense kernels of the blocks:
+
+   \code
+   blaze::DynamicVector<double> x( 6UL ), y;
+   blaze::DynamicMatrix<double,blaze::columnMajor> X( 6UL, 4UL ), Y;
+   // ... Initialization
+
+   y = A * x;  // Multiplication with a dense vector
+   Y = A * X;  // Multiplication with a dense matrix
+
+   BlockDiagonalMatrix<double> B( trans( A ) );  // Transpose of all blocks
+   BlockDiagonalMatrix<double> C( inv( A ) );    // Inversion of all blocks
+
+   solve( A, y, x );  // Solution of the linear systems of all blocks
+   llh( A, C );       // Cholesky decomposition of all blocks
+
+   blaze::DynamicVector<double> w;
+   eigen( A, w );  // Eigenvalues of all (symmetric) blocks
+   \endcode
+
+// In case SMP parallelization is enabled, the blocks are distributed among the available threads
+// according to their computational cost: the blocks are processed in order of decreasing size
+// and consecutive small blocks are combined into tasks of similar cost.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+class BlockDiagonalMatrix
+   : public DenseMatrix< BlockDiagonalMatrix<Type,Tag>, false >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This     = BlockDiagonalMatrix<Type,Tag>;  //!< Type of this BlockDiagonalMatrix instance.
+   using BaseType = DenseMatrix<This,false>;        //!< Base type of this BlockDiagonalMatrix.
+
+   //! Result type for expression template evaluations.
+   using ResultType = DynamicMatrix<Type,false,AlignedAllocator<Type>,Tag>;
+
+   //! Result type with opposite storage order for expression template evaluations.
+   using OppositeType = DynamicMatrix<Type,true,AlignedAllocator<Type>,Tag>;
+
+   //! Transpose type for expression template evaluations.
+   using TransposeType = DynamicMatrix<Type,true,AlignedAllocator<Type>,Tag>;
+
+   using ElementType   = Type;         //!< Type of the matrix elements.
+   using TagType       = Tag;          //!< Tag type of this BlockDiagonalMatrix instance.
+   using ReturnType    = const Type&;  //!< Return type for expression template evaluations.
+   using CompositeType = const This&;  //!< Data type for composite expression templates.
+
+   using Reference      = const Type&;  //!< Reference to a non-constant matrix value.
+   using ConstReference = const Type&;  //!< Reference to a constant matrix value.
+   using Pointer        = const Type*;  //!< Pointer to a non-constant matrix value.
+   using ConstPointer   = const Type*;  //!< Pointer to a constant matrix value.
+
+   using Iterator      = StructuredIterator<This>;  //!< Iterator over non-constant elements.
+   using ConstIterator = StructuredIterator<This>;  //!< Iterator over constant elements.
+
+   //! Type of a single diagonal block.
+   using BlockType = CustomMatrix<Type,unaligned,unpadded,columnMajor>;
+
+   //! Type of a single constant diagonal block.
+   using ConstBlockType = CustomMatrix<const Type,unaligned,unpadded,columnMajor>;
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a BlockDiagonalMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = BlockDiagonalMatrix<NewType,Tag>;  //!< The type of the other matrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a BlockDiagonalMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = BlockDiagonalMatrix<Type,Tag>;  //!< The type of the other BlockDiagonalMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. Since the rows of a block-diagonal matrix are not
+       stored contiguously, the \a simdEnabled compilation flag is set to \a false. Note that the
+       block-wise operations of the matrix use the vectorized kernels of the dense blocks. */
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline BlockDiagonalMatrix() noexcept;
+   explicit inline BlockDiagonalMatrix( const std::vector<size_t>& sizes );
+   inline BlockDiagonalMatrix( std::initializer_list<size_t> sizes );
+
+   BlockDiagonalMatrix( const BlockDiagonalMatrix& ) = default;
+   BlockDiagonalMatrix( BlockDiagonalMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~BlockDiagonalMatrix() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+
+   inline BlockType      block( size_t k ) noexcept;
+   inline ConstBlockType block( size_t k ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   BlockDiagonalMatrix& operator=( const BlockDiagonalMatrix& ) = default;
+   BlockDiagonalMatrix& operator=( BlockDiagonalMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline size_t blocks() const noexcept;
+   inline size_t blockSize( size_t k ) const noexcept;
+   inline size_t blockOffset( size_t k ) const noexcept;
+   inline size_t blockIndex( size_t i ) const noexcept;
+   inline void   reset();
+   inline void   swap( BlockDiagonalMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline BlockDiagonalMatrix& transpose();
+   inline BlockDiagonalMatrix& ctranspose();
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Block scheduling functions******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename OP >
+   void forEachBlock( size_t power, bool parallel, OP op ) const;
+   /*! \endcond */
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void initialize( const size_t* first, const size_t* last );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                     //!< The current number of rows and columns of the matrix.
+   std::vector<size_t> offsets_;  //!< The first row/column of each block.
+                                  /*!< The vector contains one additional element for the
+                                       total number of rows and columns. */
+   std::vector<size_t> storage_;  //!< The index of the first element of each block.
+                                  /*!< The vector contains one additional element for the
+                                       total number of stored elements. */
+   DynamicVector<Type> values_;   //!< The elements of the diagonal blocks.
+
+   static const Type zero_;  //!< The zero element.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, typename Tag >
+const Type BlockDiagonalMatrix<Type,Tag>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BlockDiagonalMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline BlockDiagonalMatrix<Type,Tag>::BlockDiagonalMatrix() noexcept
+   : n_      ( 0UL )  // The current number of rows and columns of the matrix
+   , offsets_()       // The first row/column of each block
+   , storage_()       // The index of the first element of each block
+   , values_ ()       // The elements of the diagonal blocks
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a block-diagonal matrix with the given block sizes.
+//
+// \param sizes The sizes of the diagonal blocks.
+//
+// This constructor creates a block-diagonal matrix, whose \a k-th diagonal block is a square
+// matrix with \a sizes[k] rows and columns. All elements of the matrix are initialized to 0.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline BlockDiagonalMatrix<Type,Tag>::BlockDiagonalMatrix( const std::vector<size_t>& sizes )
+   : BlockDiagonalMatrix()
+{
+   initialize( sizes.data(), sizes.data() + sizes.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of the block sizes of a block-diagonal matrix.
+//
+// \param sizes The sizes of the diagonal blocks.
+
+   \code
+   blaze::BlockDiagonalMatrix<double> A{ 3UL, 1UL, 2UL };
+   \endcode
+
+// This constructor creates a block-diagonal matrix, whose \a k-th diagonal block is a square
+// matrix with as many rows and columns as specified by the \a k-th element of the given
+// initializer list. All elements of the matrix are initialized to 0.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline BlockDiagonalMatrix<Type,Tag>::BlockDiagonalMatrix( std::initializer_list<size_t> sizes )
+   : BlockDiagonalMatrix()
+{
+   initialize( sizes.begin(), sizes.end() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices. Note that the
+// function determines the diagonal block of row \a i by means of a binary search.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename BlockDiagonalMatrix<Type,Tag>::ConstReference
+   BlockDiagonalMatrix<Type,Tag>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   const size_t k( blockIndex( i ) );
+   const size_t first( offsets_[k] );
+
+   if( j < first || j >= offsets_[k+1UL] ) {
+      return zero_;
+   }
+
+   return values_[ storage_[k] + (j-first)*(offsets_[k+1UL]-first) + (i-first) ];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename BlockDiagonalMatrix<Type,Tag>::ConstReference
+   BlockDiagonalMatrix<Type,Tag>::at( size_t i, size_t j ) const
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+//
+// This function returns a row iterator to the first element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename BlockDiagonalMatrix<Type,Tag>::ConstIterator
+   BlockDiagonalMatrix<Type,Tag>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+//
+// This function returns a row iterator to the first element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename BlockDiagonalMatrix<Type,Tag>::ConstIterator
+   BlockDiagonalMatrix<Type,Tag>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+//
+// This function returns a row iterator just past the last element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename BlockDiagonalMatrix<Type,Tag>::ConstIterator
+   BlockDiagonalMatrix<Type,Tag>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+//
+// This function returns a row iterator just past the last element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename BlockDiagonalMatrix<Type,Tag>::ConstIterator
+   BlockDiagonalMatrix<Type,Tag>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the \a k-th diagonal block.
+//
+// \param k The index of the block. The index has to be in the range \f$[0..B-1]\f$.
+// \return Column-major dense matrix referring to the elements of the block.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename BlockDiagonalMatrix<Type,Tag>::BlockType
+   BlockDiagonalMatrix<Type,Tag>::block( size_t k ) noexcept
+{
+   BLAZE_USER_ASSERT( k < blocks(), "Invalid block access index" );
+
+   const size_t n( blockSize( k ) );
+   return BlockType( values_.data() + storage_[k], n, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the \a k-th diagonal block.
+//
+// \param k The index of the block. The index has to be in the range \f$[0..B-1]\f$.
+// \return Column-major dense matrix referring to the elements of the block.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename BlockDiagonalMatrix<Type,Tag>::ConstBlockType
+   BlockDiagonalMatrix<Type,Tag>::block( size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < blocks(), "Invalid block access index" );
+
+   const size_t n( blockSize( k ) );
+   return ConstBlockType( values_.data() + storage_[k], n, n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t BlockDiagonalMatrix<Type,Tag>::rows() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t BlockDiagonalMatrix<Type,Tag>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows.
+//
+// \return The spacing between the beginning of two rows.
+//
+// Since the rows of a block-diagonal matrix are not stored explicitly, the spacing is equal to
+// the number of columns.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t BlockDiagonalMatrix<Type,Tag>::spacing() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The number of stored elements of all diagonal blocks.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t BlockDiagonalMatrix<Type,Tag>::capacity() const noexcept
+{
+   return values_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The number of stored elements of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t BlockDiagonalMatrix<Type,Tag>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return blockSize( blockIndex( i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the diagonal blocks.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t BlockDiagonalMatrix<Type,Tag>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t l=0UL; l<values_.size(); ++l ) {
+      if( !isDefault<strict>( values_[l] ) ) {
+         ++nonzeros;
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t BlockDiagonalMatrix<Type,Tag>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t k( blockIndex( i ) );
+   const size_t n( blockSize( k ) );
+   const Type* row( values_.data() + storage_[k] + ( i - offsets_[k] ) );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      if( !isDefault<strict>( row[j*n] ) ) {
+         ++nonzeros;
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of diagonal blocks of the matrix.
+//
+// \return The number of diagonal blocks.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t BlockDiagonalMatrix<Type,Tag>::blocks() const noexcept
+{
+   return offsets_.empty() ? 0UL : offsets_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of the \a k-th diagonal block.
+//
+// \param k The index of the block. The index has to be in the range \f$[0..B-1]\f$.
+// \return The size of the block.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t BlockDiagonalMatrix<Type,Tag>::blockSize( size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < blocks(), "Invalid block access index" );
+   return offsets_[k+1UL] - offsets_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first row/column of the \a k-th diagonal block.
+//
+// \param k The index of the block. The index has to be in the range \f$[0..B-1]\f$.
+// \return The index of the first row and column of the block.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t BlockDiagonalMatrix<Type,Tag>::blockOffset( size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < blocks(), "Invalid block access index" );
+   return offsets_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the diagonal block containing row \a i.
+//
+// \param i The index of the row. The index has to be in the range \f$[0..N-1]\f$.
+// \return The index of the block containing row \a i.
+//
+// The block is determined by means of a binary search in \f$ O(\log B) \f$ operations.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t BlockDiagonalMatrix<Type,Tag>::blockIndex( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const auto pos( std::upper_bound( offsets_.begin(), offsets_.end(), i ) );
+   return static_cast<size_t>( pos - offsets_.begin() ) - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all elements of the diagonal blocks to 0. The block structure of the
+// matrix is not changed.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void BlockDiagonalMatrix<Type,Tag>::reset()
+{
+   using blaze::reset;
+
+   for( size_t l=0UL; l<values_.size(); ++l ) {
+      reset( values_[l] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block-diagonal matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void BlockDiagonalMatrix<Type,Tag>::swap( BlockDiagonalMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( n_, m.n_ );
+   swap( offsets_, m.offsets_ );
+   swap( storage_, m.storage_ );
+   swap( values_, m.values_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the block structure.
+//
+// \param first Pointer to the first block size.
+// \param last Pointer one past the last block size.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void BlockDiagonalMatrix<Type,Tag>::initialize( const size_t* first, const size_t* last )
+{
+   const size_t blocks( static_cast<size_t>( last - first ) );
+
+   offsets_.resize( blocks+1UL );
+   storage_.resize( blocks+1UL );
+
+   offsets_[0UL] = 0UL;
+   storage_[0UL] = 0UL;
+
+   for( size_t k=0UL; k<blocks; ++k ) {
+      offsets_[k+1UL] = offsets_[k] + first[k];
+      storage_[k+1UL] = storage_[k] + first[k]*first[k];
+   }
+
+   n_ = offsets_[blocks];
+
+   values_.resize( storage_[blocks], false );
+   reset();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+//
+// This function transposes all diagonal blocks in-place.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline BlockDiagonalMatrix<Type,Tag>& BlockDiagonalMatrix<Type,Tag>::transpose()
+{
+   using std::swap;
+
+   for( size_t k=0UL; k<blocks(); ++k )
+   {
+      const size_t n( blockSize( k ) );
+      Type* const data( values_.data() + storage_[k] );
+
+      for( size_t j=1UL; j<n; ++j ) {
+         for( size_t i=0UL; i<j; ++i ) {
+            swap( data[i+j*n], data[j+i*n] );
+         }
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+//
+// This function computes the conjugate transpose of all diagonal blocks in-place.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline BlockDiagonalMatrix<Type,Tag>& BlockDiagonalMatrix<Type,Tag>::ctranspose()
+{
+   transpose();
+
+   for( size_t l=0UL; l<values_.size(); ++l ) {
+      conjugate( values_[l] );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockDiagonalMatrix<Type,Tag>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockDiagonalMatrix<Type,Tag>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCK SCHEDULING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given operation to all diagonal blocks.
+//
+// \param power The exponent of the cost model of a single block.
+// \param parallel \a true in case the operation is large enough for an SMP parallel execution.
+// \param op The operation to be applied to each block index.
+// \return void
+//
+// This function calls \a op for the index of every diagonal block. The cost of block \a k is
+// estimated as \f$ n_k^p \f$, where \f$ n_k \f$ is the size of the block and \a p is the given
+// \a power (i.e. 2 for products, 3 for factorizations). In case SMP parallelization is enabled,
+// \a parallel is \a true and no serial or parallel section is active, the blocks are sorted by
+// decreasing cost and partitioned into tasks of similar cost, which are executed in parallel.
+// Large blocks form a task of their own, consecutive small blocks are combined into a single
+// task. Since the largest tasks are started first, the work is balanced among the threads even
+// for strongly varying block sizes. Exceptions thrown by \a op within a parallel task are
+// propagated to the calling thread after all tasks have finished.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< typename OP >   // Type of the block operation
+void BlockDiagonalMatrix<Type,Tag>::forEachBlock( size_t power, bool parallel, OP op ) const
+{
+   const size_t B( blocks() );
+
+   if( !parallel || B < 2UL || getNumThreads() < 2UL ||
+       isSerialSectionActive() || isParallelSectionActive() ) {
+      for( size_t k=0UL; k<B; ++k ) {
+         op( k );
+      }
+      return;
+   }
+
+   std::vector<double> costs( B );
+   std::vector<size_t> order( B );
+   double total( 0.0 );
+
+   for( size_t k=0UL; k<B; ++k ) {
+      costs[k] = std::pow( static_cast<double>( blockSize( k ) ), static_cast<double>( power ) );
+      order[k] = k;
+      total += costs[k];
+   }
+
+   std::stable_sort( order.begin(), order.end(), [&costs]( size_t a, size_t b ) {
+      return costs[a] > costs[b];
+   } );
+
+   const double target( total / static_cast<double>( 4UL*getNumThreads() ) );
+
+   std::vector<size_t> tasks( 1UL, 0UL );
+   double cost( 0.0 );
+
+   for( size_t l=0UL; l<B; ++l ) {
+      cost += costs[order[l]];
+      if( cost >= target || l+1UL == B ) {
+         tasks.push_back( l+1UL );
+         cost = 0.0;
+      }
+   }
+
+   std::vector<std::exception_ptr> errors( tasks.size()-1UL );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpFor( tasks.size()-1UL, [&]( size_t task ) {
+         try {
+            for( size_t l=tasks[task]; l<tasks[task+1UL]; ++l ) {
+               op( order[l] );
+            }
+         }
+         catch( ... ) {
+            errors[task] = std::current_exception();
+         }
+      } );
+   }
+
+   for( const std::exception_ptr& error : errors ) {
+      if( error ) {
+         std::rethrow_exception( error );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCKDIAGONALMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BlockDiagonalMatrix operators */
+//@{
+template< typename Type, typename Tag >
+void reset( BlockDiagonalMatrix<Type,Tag>& m );
+
+template< typename Type, typename Tag >
+bool isIntact( const BlockDiagonalMatrix<Type,Tag>& m ) noexcept;
+
+template< typename Type, typename Tag >
+void swap( BlockDiagonalMatrix<Type,Tag>& a, BlockDiagonalMatrix<Type,Tag>& b ) noexcept;
+
+template< typename Type, typename Tag >
+BlockDiagonalMatrix<Type,Tag> trans( const BlockDiagonalMatrix<Type,Tag>& m );
+
+template< typename Type, typename Tag >
+BlockDiagonalMatrix<Type,Tag> ctrans( const BlockDiagonalMatrix<Type,Tag>& m );
+
+template< typename Type, typename Tag >
+void invert( BlockDiagonalMatrix<Type,Tag>& m );
+
+template< typename Type, typename Tag >
+BlockDiagonalMatrix<Type,Tag> inv( const BlockDiagonalMatrix<Type,Tag>& m );
+
+template< typename Type, typename Tag, typename VT1, typename VT2 >
+void multiply( const BlockDiagonalMatrix<Type,Tag>& A, const DenseVector<VT1,columnVector>& x,
+               DenseVector<VT2,columnVector>& y );
+
+template< typename Type, typename Tag, typename MT1, bool SO1, typename MT2, bool SO2 >
+void multiply( const BlockDiagonalMatrix<Type,Tag>& A, const DenseMatrix<MT1,SO1>& X,
+               DenseMatrix<MT2,SO2>& Y );
+
+template< typename Type, typename Tag, typename VT1, typename VT2 >
+void solve( const BlockDiagonalMatrix<Type,Tag>& A, DenseVector<VT1,columnVector>& x,
+            const DenseVector<VT2,columnVector>& b );
+
+template< typename Type, typename Tag, typename MT1, bool SO1, typename MT2, bool SO2 >
+void solve( const BlockDiagonalMatrix<Type,Tag>& A, DenseMatrix<MT1,SO1>& X,
+            const DenseMatrix<MT2,SO2>& B );
+
+template< typename Type, typename Tag >
+void llh( const BlockDiagonalMatrix<Type,Tag>& A, BlockDiagonalMatrix<Type,Tag>& L );
+
+template< typename Type, typename Tag, typename VT, bool TF >
+void eigen( const BlockDiagonalMatrix<Type,Tag>& A, DenseVector<VT,TF>& w );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given block-diagonal matrix.
+// \ingroup block_diagonal_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void reset( BlockDiagonalMatrix<Type,Tag>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given block-diagonal matrix are intact.
+// \ingroup block_diagonal_matrix
+//
+// \param m The block-diagonal matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the block-diagonal matrix are intact, i.e. if
+// its state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline bool isIntact( const BlockDiagonalMatrix<Type,Tag>& m ) noexcept
+{
+   size_t rows( 0UL ), elements( 0UL );
+
+   for( size_t k=0UL; k<m.blocks(); ++k ) {
+      if( m.blockOffset( k ) != rows ) {
+         return false;
+      }
+      rows     += m.blockSize( k );
+      elements += m.blockSize( k ) * m.blockSize( k );
+   }
+
+   return ( rows == m.rows() && rows == m.columns() && elements == m.capacity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block-diagonal matrices.
+// \ingroup block_diagonal_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void swap( BlockDiagonalMatrix<Type,Tag>& a, BlockDiagonalMatrix<Type,Tag>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the transpose of the given block-diagonal matrix.
+// \ingroup block_diagonal_matrix
+//
+// \param m The block-diagonal matrix to be transposed.
+// \return The transpose of the matrix.
+//
+// This function returns the transpose of the given block-diagonal matrix, i.e. a block-diagonal
+// matrix of the same block structure, whose blocks are the transposed blocks of \a m.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline BlockDiagonalMatrix<Type,Tag> trans( const BlockDiagonalMatrix<Type,Tag>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BlockDiagonalMatrix<Type,Tag> tmp( m );
+   tmp.transpose();
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the conjugate transpose of the given block-diagonal matrix.
+// \ingroup block_diagonal_matrix
+//
+// \param m The block-diagonal matrix to be transposed.
+// \return The conjugate transpose of the matrix.
+//
+// This function returns the conjugate transpose of the given block-diagonal matrix, i.e. a
+// block-diagonal matrix of the same block structure, whose blocks are the conjugate transposed
+// blocks of \a m.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline BlockDiagonalMatrix<Type,Tag> ctrans( const BlockDiagonalMatrix<Type,Tag>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BlockDiagonalMatrix<Type,Tag> tmp( m );
+   tmp.ctranspose();
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of the given block-diagonal matrix.
+// \ingroup block_diagonal_matrix
+//
+// \param m The block-diagonal matrix to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts all diagonal blocks of the given block-diagonal matrix in-place by
+// means of the dense invert() function. In case SMP parallelization is enabled, the blocks are
+// inverted in parallel. In case any block is singular, an exception is thrown.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a m may already have been modified.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+void invert( BlockDiagonalMatrix<Type,Tag>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   m.forEachBlock( 3UL, m.rows()*m.columns() >= SMP_DMATDMATMULT_THRESHOLD, [&m]( size_t k ) {
+      auto B( m.block( k ) );
+      invert( B );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the inverse of the given block-diagonal matrix.
+// \ingroup block_diagonal_matrix
+//
+// \param m The block-diagonal matrix to be inverted.
+// \return The inverse of the matrix.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function returns the inverse of the given block-diagonal matrix, i.e. a block-diagonal
+// matrix of the same block structure, whose blocks are the inverses of the blocks of \a m.
+// In case any block is singular, an exception is thrown.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline BlockDiagonalMatrix<Type,Tag> inv( const BlockDiagonalMatrix<Type,Tag>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BlockDiagonalMatrix<Type,Tag> tmp( m );
+   invert( tmp );
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a block-diagonal matrix with a dense column vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup block_diagonal_matrix
+//
+// \param A The block-diagonal matrix.
+// \param x The right-hand side dense column vector.
+// \param y The resulting dense column vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes the product of the given block-diagonal matrix and the dense column
+// vector \a x block by block by means of the dense matrix/vector multiplication kernels. In case
+// SMP parallelization is enabled, the blocks are processed in parallel. The resulting vector
+// \a y is resized accordingly.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename VT1    // Type of the right-hand side dense vector
+        , typename VT2 >  // Type of the resulting dense vector
+void multiply( const BlockDiagonalMatrix<Type,Tag>& A, const DenseVector<VT1,columnVector>& x,
+               DenseVector<VT2,columnVector>& y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*x).size() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (*x).isAliased( &(*y) ) ) {
+      const ResultType_t<VT1> x2( *x );
+      multiply( A, x2, y );
+      return;
+   }
+
+   CompositeType_t<VT1> x2( *x );
+
+   resize( *y, A.rows(), false );
+
+   A.forEachBlock( 2UL, A.rows() >= SMP_DMATDVECMULT_THRESHOLD, [&A,&x2,&y]( size_t k ) {
+      const size_t offset( A.blockOffset( k ) );
+      const size_t n( A.blockSize( k ) );
+      subvector( *y, offset, n, unchecked ) =
+         serial( A.block( k ) * subvector( x2, offset, n, unchecked ) );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a block-diagonal matrix with a dense matrix (\f$ Y=A*X \f$).
+// \ingroup block_diagonal_matrix
+//
+// \param A The block-diagonal matrix.
+// \param X The right-hand side dense matrix.
+// \param Y The resulting dense matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the product of the given block-diagonal matrix and the dense matrix
+// \a X block by block by means of the dense matrix/matrix multiplication kernels. In case SMP
+// parallelization is enabled, the blocks are processed in parallel. The resulting matrix \a Y
+// is resized accordingly.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT1    // Type of the right-hand side dense matrix
+        , bool SO1        // Storage order of the right-hand side dense matrix
+        , typename MT2    // Type of the resulting dense matrix
+        , bool SO2 >      // Storage order of the resulting dense matrix
+void multiply( const BlockDiagonalMatrix<Type,Tag>& A, const DenseMatrix<MT1,SO1>& X,
+               DenseMatrix<MT2,SO2>& Y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*X).rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (*X).isAliased( &(*Y) ) ) {
+      const ResultType_t<MT1> X2( *X );
+      multiply( A, X2, Y );
+      return;
+   }
+
+   CompositeType_t<MT1> X2( *X );
+
+   const size_t columns( X2.columns() );
+
+   resize( *Y, A.rows(), columns, false );
+
+   A.forEachBlock( 2UL, A.rows()*columns >= SMP_DMATDMATMULT_THRESHOLD,
+                   [&A,&X2,&Y,columns]( size_t k ) {
+      const size_t offset( A.blockOffset( k ) );
+      const size_t n( A.blockSize( k ) );
+      submatrix( *Y, offset, 0UL, n, columns, unchecked ) =
+         serial( A.block( k ) * submatrix( X2, offset, 0UL, n, columns, unchecked ) );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a block-diagonal matrix and a dense
+//        column vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup block_diagonal_matrix
+//
+// \param A The block-diagonal matrix.
+// \param x The right-hand side dense column vector.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename VT >   // Type of the right-hand side dense vector
+inline decltype(auto)
+   operator*( const BlockDiagonalMatrix<Type,Tag>& A, const DenseVector<VT,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = MultTrait_t< Type, ElementType_t<VT> >;
+
+   DynamicVector<ET,columnVector> y;
+   multiply( A, *x, y );
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a block-diagonal matrix and a dense
+//        matrix (\f$ Y=A*X \f$).
+// \ingroup block_diagonal_matrix
+//
+// \param A The block-diagonal matrix.
+// \param X The right-hand side dense matrix.
+// \return The resulting dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT     // Type of the right-hand side dense matrix
+        , bool SO >       // Storage order of the right-hand side dense matrix
+inline decltype(auto)
+   operator*( const BlockDiagonalMatrix<Type,Tag>& A, const DenseMatrix<MT,SO>& X )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = MultTrait_t< Type, ElementType_t<MT> >;
+
+   DynamicMatrix<ET,SO> Y;
+   multiply( A, *X, Y );
+   return Y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system of equations \f$ A\vec{x}=\vec{b} \f$ with a block-diagonal
+//        matrix.
+// \ingroup block_diagonal_matrix
+//
+// \param A The block-diagonal system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function solves the linear systems of all diagonal blocks by means of an LU decomposition
+// of the blocks (LAPACK gesv). In case SMP parallelization is enabled, the blocks are processed
+// in parallel. The given block-diagonal matrix is not modified. In case any block is singular,
+// an exception is thrown. The solution vector \a x is resized accordingly. The element types of
+// \a A, \a x and \a b have to be identical.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void solve( const BlockDiagonalMatrix<Type,Tag>& A, DenseVector<VT1,columnVector>& x,
+            const DenseVector<VT2,columnVector>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*b).size() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   DynamicVector<Type,columnVector> work( serial( *b ) );
+
+   A.forEachBlock( 3UL, A.rows() >= SMP_DMATDVECMULT_THRESHOLD, [&A,&work]( size_t k ) {
+      const size_t n( A.blockSize( k ) );
+      DynamicMatrix<Type,columnMajor> LU( serial( A.block( k ) ) );
+      auto rhs( subvector( work, A.blockOffset( k ), n, unchecked ) );
+      const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[n] );
+      gesv( LU, rhs, ipiv.get() );
+   } );
+
+   resize( *x, A.rows(), false );
+   *x = work;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system of equations \f$ AX=B \f$ with a block-diagonal matrix.
+// \ingroup block_diagonal_matrix
+//
+// \param A The block-diagonal system matrix.
+// \param X The resulting solution matrix.
+// \param B The right-hand side matrix.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function solves the linear systems of all diagonal blocks for all columns of \a B by
+// means of an LU decomposition of the blocks (LAPACK gesv). In case SMP parallelization is
+// enabled, the blocks are processed in parallel. The given block-diagonal matrix is not
+// modified. In case any block is singular, an exception is thrown. The solution matrix \a X is
+// resized accordingly. The element types of \a A, \a X and \a B have to be identical.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT1    // Type of the solution matrix
+        , bool SO1        // Storage order of the solution matrix
+        , typename MT2    // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+void solve( const BlockDiagonalMatrix<Type,Tag>& A, DenseMatrix<MT1,SO1>& X,
+            const DenseMatrix<MT2,SO2>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*B).rows() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   const size_t columns( (*B).columns() );
+
+   DynamicMatrix<Type,columnMajor> work( serial( *B ) );
+
+   A.forEachBlock( 3UL, A.rows()*columns >= SMP_DMATDMATMULT_THRESHOLD,
+                   [&A,&work,columns]( size_t k ) {
+      const size_t n( A.blockSize( k ) );
+      DynamicMatrix<Type,columnMajor> LU( serial( A.block( k ) ) );
+      CustomMatrix<Type,unaligned,unpadded,columnMajor>
+         rhs( work.data() + A.blockOffset( k ), n, columns, work.spacing() );
+      const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[n] );
+      gesv( LU, rhs, ipiv.get() );
+   } );
+
+   resize( *X, A.rows(), columns, false );
+   *X = work;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Cholesky (LLH) decomposition of the given block-diagonal matrix.
+// \ingroup block_diagonal_matrix
+//
+// \param A The block-diagonal matrix to be decomposed.
+// \param L The resulting lower triangular block-diagonal matrix.
+// \return void
+// \exception std::runtime_error Decomposition of singular matrix failed.
+//
+// This function computes the Cholesky decomposition \f$ A = L L^H \f$ of all diagonal blocks
+// of the given symmetric (Hermitian) positive definite block-diagonal matrix. Only the lower
+// part of the blocks is referenced. The resulting matrix \a L has the same block structure as
+// \a A. In case SMP parallelization is enabled, the blocks are decomposed in parallel. In case
+// any block is not positive definite, an exception is thrown.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+void llh( const BlockDiagonalMatrix<Type,Tag>& A, BlockDiagonalMatrix<Type,Tag>& L )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( &A != &L ) {
+      L = A;
+   }
+
+   L.forEachBlock( 3UL, L.rows()*L.columns() >= SMP_DMATDMATMULT_THRESHOLD, [&L]( size_t k ) {
+      auto B( L.block( k ) );
+      potrf( B, 'L' );
+      for( size_t j=1UL; j<B.columns(); ++j ) {
+         for( size_t i=0UL; i<j; ++i ) {
+            reset( B(i,j) );
+         }
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the complex eigenvalues of a general dense block.
+// \ingroup block_diagonal_matrix
+*/
+template< typename MT     // Type of the dense block
+        , bool SO         // Storage order of the dense block
+        , typename VT     // Type of the eigenvalue vector
+        , bool TF >       // Transpose flag of the eigenvalue vector
+inline auto blockEigen( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
+   -> EnableIf_t< IsComplex_v< ElementType_t<VT> > >
+{
+   geev( *A, *w );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the real eigenvalues of a symmetric dense block.
+// \ingroup block_diagonal_matrix
+*/
+template< typename MT     // Type of the dense block
+        , bool SO         // Storage order of the dense block
+        , typename VT     // Type of the eigenvalue vector
+        , bool TF >       // Transpose flag of the eigenvalue vector
+inline auto blockEigen( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
+   -> EnableIf_t< !IsComplex_v< ElementType_t<VT> > && !IsComplex_v< ElementType_t<MT> > >
+{
+   syev( *A, *w, 'N', 'L' );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the real eigenvalues of a Hermitian dense block.
+// \ingroup block_diagonal_matrix
+*/
+template< typename MT     // Type of the dense block
+        , bool SO         // Storage order of the dense block
+        , typename VT     // Type of the eigenvalue vector
+        , bool TF >       // Transpose flag of the eigenvalue vector
+inline auto blockEigen( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
+   -> EnableIf_t< !IsComplex_v< ElementType_t<VT> > && IsComplex_v< ElementType_t<MT> > >
+{
+   heev( *A, *w, 'N', 'L' );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Eigenvalue computation of the given block-diagonal matrix.
+// \ingroup block_diagonal_matrix
+//
+// \param A The given block-diagonal matrix.
+// \param w The resulting vector of eigenvalues.
+// \return void
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes the eigenvalues of all diagonal blocks of the given block-diagonal
+// matrix. The eigenvalues of block \a k are stored in the according range of \a w, which is
+// resized accordingly. The kind of the computation depends on the element type of \a w:
+//
+//  - complex eigenvalues: the blocks are treated as general matrices (LAPACK geev);
+//  - real eigenvalues: the blocks are treated as symmetric (Hermitian) matrices (LAPACK syev or
+//    heev), the eigenvalues of each block are sorted in ascending order. Only the lower part
+//    of the blocks is referenced.
+//
+// In case SMP parallelization is enabled, the blocks are processed in parallel. The given
+// block-diagonal matrix is not modified.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename VT     // Type of the eigenvalue vector
+        , bool TF >       // Transpose flag of the eigenvalue vector
+void eigen( const BlockDiagonalMatrix<Type,Tag>& A, DenseVector<VT,TF>& w )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<VT>;
+
+   DynamicVector<ET,TF> work( A.rows() );
+
+   A.forEachBlock( 3UL, A.rows()*A.columns() >= SMP_DMATDMATMULT_THRESHOLD, [&A,&work]( size_t k ) {
+      const size_t n( A.blockSize( k ) );
+      DynamicMatrix<Type,columnMajor> B( serial( A.block( k ) ) );
+      auto wk( subvector( work, A.blockOffset( k ), n, unchecked ) );
+      blockEigen( B, wk );
+   } );
+
+   resize( *w, A.rows(), false );
+   *w = work;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
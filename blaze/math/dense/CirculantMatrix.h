@@ -0,0 +1,924 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/CirculantMatrix.h
+//  \brief Header file for the implementation of a circulant matrix
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_CIRCULANTMATRIX_H_
+#define _BLAZE_MATH_DENSE_CIRCULANTMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/FFT.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/dense/StructuredIterator.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup circulant_matrix CirculantMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a circulant matrix.
+// \ingroup circulant_matrix
+//
+// The CirculantMatrix class template represents a \f$ N \times N \f$ circulant matrix, i.e. a
+// matrix whose rows are cyclic shifts of the previous row (\f$ A_{ij} = c_{(i-j) \bmod N} \f$).
+// The matrix only stores the \f$ N \f$ elements of its first column. The type of the elements
+// and the group tag of the matrix can be specified via the two template parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, typename Tag >
+   class CirculantMatrix;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CirculantMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - Tag : optional type parameter to tag the matrix. The default type is \c blaze::Group0.
+//          See \ref grouping_tagging for details.
+//
+// A circulant matrix, as for instance the matrix of a cyclic convolution, is created from its
+// first column:
+
+   \code
+   using blaze::CirculantMatrix;
+
+   blaze::DynamicVector<double> c{ 1.0, 2.0, 3.0 };
+
+   CirculantMatrix<double> A( c );  // The 3x3 matrix ( ( 1, 3, 2 ), ( 2, 1, 3 ), ( 3, 2, 1 ) )
+   \endcode
+
+// A CirculantMatrix is a read-only dense matrix, i.e. its elements cannot be modified. It can be
+// used as operand in all arithmetic operations and can be converted into any other dense or
+// sparse matrix by means of an assignment:
+
+   \code
+   blaze::DynamicMatrix<double> D( A );  // Conversion to a general dense matrix
+   \endcode
+
+// The multiplication of a circulant matrix with a dense vector or dense matrix is performed by
+// means of the fast Fourier transform in \f$ O(N \log N) \f$ operations per column. In case
+// SMP parallelization is enabled, the columns of a dense matrix are processed in parallel:
+
+   \code
+   blaze::DynamicVector<double> x( 3UL ), y;
+   // ... Initialization
+
+   y = A * x;  // FFT-based matrix/vector multiplication
+   \endcode
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+class CirculantMatrix
+   : public DenseMatrix< CirculantMatrix<Type,Tag>, false >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This     = CirculantMatrix<Type,Tag>;  //!< Type of this CirculantMatrix instance.
+   using BaseType = DenseMatrix<This,false>;      //!< Base type of this CirculantMatrix instance.
+
+   //! Result type for expression template evaluations.
+   using ResultType = DynamicMatrix<Type,false,AlignedAllocator<Type>,Tag>;
+
+   //! Result type with opposite storage order for expression template evaluations.
+   using OppositeType = DynamicMatrix<Type,true,AlignedAllocator<Type>,Tag>;
+
+   //! Transpose type for expression template evaluations.
+   using TransposeType = DynamicMatrix<Type,true,AlignedAllocator<Type>,Tag>;
+
+   using ElementType   = Type;         //!< Type of the matrix elements.
+   using TagType       = Tag;          //!< Tag type of this CirculantMatrix instance.
+   using ReturnType    = const Type&;  //!< Return type for expression template evaluations.
+   using CompositeType = const This&;  //!< Data type for composite expression templates.
+
+   using Reference      = const Type&;  //!< Reference to a non-constant matrix value.
+   using ConstReference = const Type&;  //!< Reference to a constant matrix value.
+   using Pointer        = const Type*;  //!< Pointer to a non-constant matrix value.
+   using ConstPointer   = const Type*;  //!< Pointer to a constant matrix value.
+
+   using Iterator      = StructuredIterator<This>;  //!< Iterator over non-constant elements.
+   using ConstIterator = StructuredIterator<This>;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CirculantMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = CirculantMatrix<NewType,Tag>;  //!< The type of the other CirculantMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a CirculantMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = CirculantMatrix<Type,Tag>;  //!< The type of the other CirculantMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. Since the elements of a circulant matrix are not
+       stored contiguously, the \a simdEnabled compilation flag is set to \a false. */
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline CirculantMatrix() noexcept;
+
+   template< typename VT, bool TF >
+   explicit inline CirculantMatrix( const DenseVector<VT,TF>& column );
+
+   CirculantMatrix( const CirculantMatrix& ) = default;
+   CirculantMatrix( CirculantMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~CirculantMatrix() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   CirculantMatrix& operator=( const CirculantMatrix& ) = default;
+   CirculantMatrix& operator=( CirculantMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   swap( CirculantMatrix& m ) noexcept;
+
+   inline const DynamicVector<Type>& coefficients() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                          //!< The current number of rows and columns of the matrix.
+   DynamicVector<Type> coefficients_;  //!< The first column of the matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CirculantMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline CirculantMatrix<Type,Tag>::CirculantMatrix() noexcept
+   : n_           ( 0UL )  // The current number of rows and columns of the matrix
+   , coefficients_()       // The defining coefficients of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a circulant matrix.
+//
+// \param column The first column of the matrix.
+//
+// This constructor creates a \f$ N \times N \f$ circulant matrix, whose first column is given
+// by the \a N elements of the given vector.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< typename VT     // Type of the column vector
+        , bool TF >       // Transpose flag of the column vector
+inline CirculantMatrix<Type,Tag>::CirculantMatrix( const DenseVector<VT,TF>& column )
+   : n_           ( (*column).size() )  // The current number of rows and columns of the matrix
+   , coefficients_( (*column).size() )  // The defining coefficients of the matrix
+{
+   for( size_t i=0UL; i<n_; ++i ) {
+      coefficients_[i] = (*column)[i];
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename CirculantMatrix<Type,Tag>::ConstReference
+   CirculantMatrix<Type,Tag>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   return coefficients_[ i >= j ? i-j : i+n_-j ];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename CirculantMatrix<Type,Tag>::ConstReference
+   CirculantMatrix<Type,Tag>::at( size_t i, size_t j ) const
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+//
+// This function returns a row iterator to the first element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename CirculantMatrix<Type,Tag>::ConstIterator
+   CirculantMatrix<Type,Tag>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+//
+// This function returns a row iterator to the first element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename CirculantMatrix<Type,Tag>::ConstIterator
+   CirculantMatrix<Type,Tag>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+//
+// This function returns a row iterator just past the last element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename CirculantMatrix<Type,Tag>::ConstIterator
+   CirculantMatrix<Type,Tag>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+//
+// This function returns a row iterator just past the last element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename CirculantMatrix<Type,Tag>::ConstIterator
+   CirculantMatrix<Type,Tag>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t CirculantMatrix<Type,Tag>::rows() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t CirculantMatrix<Type,Tag>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows.
+//
+// \return The spacing between the beginning of two rows.
+//
+// This function returns the spacing between the beginning of two rows, i.e. the total number
+// of elements of a row. Since the elements of a circulant matrix are not stored explicitly, the
+// spacing is equal to the number of columns.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t CirculantMatrix<Type,Tag>::spacing() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t CirculantMatrix<Type,Tag>::capacity() const noexcept
+{
+   return n_ * n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t CirculantMatrix<Type,Tag>::capacity( size_t i ) const noexcept
+{
+   MAYBE_UNUSED( i );
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the matrix.
+//
+// Every coefficient is counted \a N times, i.e. the function requires \f$ O(N) \f$ operations.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t CirculantMatrix<Type,Tag>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<coefficients_.size(); ++k ) {
+      if( !isDefault<strict>( coefficients_[k] ) ) {
+         nonzeros += n_;
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t CirculantMatrix<Type,Tag>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      if( !isDefault<strict>( (*this)(i,j) ) ) {
+         ++nonzeros;
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two circulant matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void CirculantMatrix<Type,Tag>::swap( CirculantMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( n_, m.n_ );
+   swap( coefficients_, m.coefficients_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the defining coefficients of the circulant matrix.
+//
+// \return The \f$ N \f$ elements of the first column.
+//
+// The element \f$ (i,j) \f$ of the matrix corresponds to the coefficient \f$ (i-j) \bmod N \f$.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline const DynamicVector<Type>& CirculantMatrix<Type,Tag>::coefficients() const noexcept
+{
+   return coefficients_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the foreign expression
+inline bool CirculantMatrix<Type,Tag>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the foreign expression
+inline bool CirculantMatrix<Type,Tag>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CIRCULANTMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CirculantMatrix operators */
+//@{
+template< typename Type, typename Tag >
+bool isIntact( const CirculantMatrix<Type,Tag>& m ) noexcept;
+
+template< typename Type, typename Tag >
+void swap( CirculantMatrix<Type,Tag>& a, CirculantMatrix<Type,Tag>& b ) noexcept;
+
+template< typename Type, typename Tag, typename VT1, typename VT2 >
+void multiply( const CirculantMatrix<Type,Tag>& A, const DenseVector<VT1,columnVector>& x,
+               DenseVector<VT2,columnVector>& y );
+
+template< typename Type, typename Tag, typename MT1, bool SO1, typename MT2, bool SO2 >
+void multiply( const CirculantMatrix<Type,Tag>& A, const DenseMatrix<MT1,SO1>& X,
+               DenseMatrix<MT2,SO2>& Y );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given circulant matrix are intact.
+// \ingroup circulant_matrix
+//
+// \param m The circulant matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the circulant matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it will
+// return \a false.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline bool isIntact( const CirculantMatrix<Type,Tag>& m ) noexcept
+{
+   return ( m.rows() == m.columns() && m.coefficients().size() == m.rows() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two circulant matrices.
+// \ingroup circulant_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void swap( CirculantMatrix<Type,Tag>& a, CirculantMatrix<Type,Tag>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the Toeplitz coefficients of the given circulant matrix.
+// \ingroup circulant_matrix
+//
+// \param A The circulant matrix.
+// \return The \f$ 2N-1 \f$ Toeplitz coefficients of the matrix.
+//
+// This function returns the coefficients \f$ a_k = c_{(k+1) \bmod N} \f$, which represent the
+// given circulant matrix as \f$ N \times N \f$ Toeplitz matrix (\f$ A_{ij} = a_{i-j+N-1} \f$).
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+DynamicVector<Type> circulantCoefficients( const CirculantMatrix<Type,Tag>& A )
+{
+   const size_t n( A.columns() );
+   const DynamicVector<Type>& c( A.coefficients() );
+
+   DynamicVector<Type> a( n > 0UL ? 2UL*n-1UL : 0UL );
+
+   for( size_t k=0UL; k<a.size(); ++k ) {
+      a[k] = c[(k+1UL)%n];
+   }
+
+   return a;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a circulant matrix with a dense column vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup circulant_matrix
+//
+// \param A The circulant matrix.
+// \param x The right-hand side dense column vector.
+// \param y The resulting dense column vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes the product of the given circulant matrix and the dense column vector
+// \a x by means of the fast Fourier transform in \f$ O(N \log N) \f$ operations. The
+// resulting vector \a y is resized accordingly.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename VT1    // Type of the right-hand side dense vector
+        , typename VT2 >  // Type of the resulting dense vector
+void multiply( const CirculantMatrix<Type,Tag>& A, const DenseVector<VT1,columnVector>& x,
+               DenseVector<VT2,columnVector>& y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*x).size() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (*x).isAliased( &(*y) ) ) {
+      const ResultType_t<VT1> x2( *x );
+      multiply( A, x2, y );
+      return;
+   }
+
+   CompositeType_t<VT1> x2( *x );
+
+   resize( *y, A.rows(), false );
+
+   const DynamicVector<Type> a( circulantCoefficients( A ) );
+
+   structuredMultiply( a.data(), A.rows(), A.columns(), false, 1UL,
+                       [&x2]( size_t l, size_t ) -> decltype(auto) { return x2[l]; },
+                       [&y]( size_t i, size_t ) -> decltype(auto) { return (*y)[i]; } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a circulant matrix with a dense matrix (\f$ Y=A*X \f$).
+// \ingroup circulant_matrix
+//
+// \param A The circulant matrix.
+// \param X The right-hand side dense matrix.
+// \param Y The resulting dense matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the product of the given circulant matrix and the dense matrix \a X
+// by means of the fast Fourier transform in \f$ O(N \log N) \f$ operations per column
+// of \a X. The resulting matrix \a Y is resized accordingly.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT1    // Type of the right-hand side dense matrix
+        , bool SO1        // Storage order of the right-hand side dense matrix
+        , typename MT2    // Type of the resulting dense matrix
+        , bool SO2 >      // Storage order of the resulting dense matrix
+void multiply( const CirculantMatrix<Type,Tag>& A, const DenseMatrix<MT1,SO1>& X,
+               DenseMatrix<MT2,SO2>& Y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*X).rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (*X).isAliased( &(*Y) ) ) {
+      const ResultType_t<MT1> X2( *X );
+      multiply( A, X2, Y );
+      return;
+   }
+
+   CompositeType_t<MT1> X2( *X );
+
+   resize( *Y, A.rows(), X2.columns(), false );
+
+   const DynamicVector<Type> a( circulantCoefficients( A ) );
+
+   structuredMultiply( a.data(), A.rows(), A.columns(), false, X2.columns(),
+                       [&X2]( size_t l, size_t j ) -> decltype(auto) { return X2(l,j); },
+                       [&Y]( size_t i, size_t j ) -> decltype(auto) { return (*Y)(i,j); } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a circulant matrix and a dense column
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup circulant_matrix
+//
+// \param A The circulant matrix.
+// \param x The right-hand side dense column vector.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename VT >   // Type of the right-hand side dense vector
+inline decltype(auto)
+   operator*( const CirculantMatrix<Type,Tag>& A, const DenseVector<VT,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = MultTrait_t< Type, ElementType_t<VT> >;
+
+   DynamicVector<ET,columnVector> y;
+   multiply( A, *x, y );
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a circulant matrix and a dense matrix
+//        (\f$ Y=A*X \f$).
+// \ingroup circulant_matrix
+//
+// \param A The circulant matrix.
+// \param X The right-hand side dense matrix.
+// \return The resulting dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT     // Type of the right-hand side dense matrix
+        , bool SO >       // Storage order of the right-hand side dense matrix
+inline decltype(auto)
+   operator*( const CirculantMatrix<Type,Tag>& A, const DenseMatrix<MT,SO>& X )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = MultTrait_t< Type, ElementType_t<MT> >;
+
+   DynamicMatrix<ET,SO> Y;
+   multiply( A, *X, Y );
+   return Y;
+}
+//*************************************************************************************************
+
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,416 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Covariance.h
+//  \brief Header file for the dense covariance and correlation functions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_COVARIANCE_H_
+#define _BLAZE_MATH_DENSE_COVARIANCE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/adaptors/SymmetricMatrix.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/UniformVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatDeclUppExpr.h>
+#include <blaze/math/expressions/DMatDMatSchurExpr.h>
+#include <blaze/math/expressions/DMatDMatSubExpr.h>
+#include <blaze/math/expressions/DMatMeanExpr.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/expressions/DVecExpandExpr.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/expressions/TDMatDMatMultExpr.h>
+#include <blaze/math/expressions/TDVecDMatMultExpr.h>
+#include <blaze/math/expressions/TDVecTDMatMultExpr.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/IsUniform.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/constraints/Complex.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the element type of a covariance matrix.
+// \ingroup dense_matrix
+//
+// Floating point element types are preserved, all other element types result in \c double.
+*/
+template< typename MT >  // Type of the dense matrix
+using CovarianceElement_t =
+   If_t< IsFloatingPoint_v< ElementType_t<MT> >, ElementType_t<MT>, double >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the covariance functions.
+// \ingroup dense_matrix
+//
+// \param X The given dense matrix (one observation per row).
+// \param mu The column means of \a X.
+// \param sw The square roots of the observation weights.
+// \param scale The final scaling factor (the inverse of the normalization).
+// \return The covariance matrix of the columns of \a X.
+//
+// This function accumulates the weighted cross products of the centered observations blockwise.
+// Each block of rows of \a X is centered (and in case of weighted observations scaled by the
+// square roots of the weights) into a small buffer, which is sized to remain in cache. The
+// buffer is immediately consumed by a rank-k update, which is declared upper to restrict the
+// computation to the upper triangle of the result. The centered copy of \a X is therefore never
+// materialized, but the subtraction of the means still happens before the products are formed,
+// which retains the numerical stability of the two-pass algorithm. Both the centering and the
+// rank-k updates are executed in parallel in case SMP is enabled.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename VT1   // Type of the column means
+        , typename VT2 > // Type of the square roots of the weights
+SymmetricMatrix< DynamicMatrix< CovarianceElement_t<MT>, SO > >
+   cov_backend( const DenseMatrix<MT,SO>& X, const VT1& mu, const VT2& sw,
+                CovarianceElement_t<MT> scale )
+{
+   using RT = CovarianceElement_t<MT>;
+
+   const size_t M( (*X).rows()    );
+   const size_t N( (*X).columns() );
+
+   const size_t blocksize( min( M, max( 64UL, min( 1024UL, 131072UL / max( N, 1UL ) ) ) ) );
+
+   DynamicMatrix<RT,SO> C( N, N, RT(0) );
+   DynamicMatrix<RT,rowMajor> Xc;
+
+   for( size_t i=0UL; i<M; i+=blocksize )
+   {
+      const size_t m( min( blocksize, M-i ) );
+
+      if( IsUniform_v<VT2> ) {
+         Xc = submatrix( *X, i, 0UL, m, N ) - expand( mu, m );
+      }
+      else {
+         Xc = expand( subvector( sw, i, m ), N ) %
+              ( submatrix( *X, i, 0UL, m, N ) - expand( mu, m ) );
+      }
+
+      C += declupp( trans( Xc ) * Xc );
+   }
+
+   SymmetricMatrix< DynamicMatrix<RT,SO> > S( N );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      for( size_t k=0UL; k<=j; ++k ) {
+         S(k,j) = C(k,j) * scale;
+      }
+   }
+
+   return S;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion of a covariance matrix into a correlation matrix.
+// \ingroup dense_matrix
+//
+// \param S The covariance matrix, which is overwritten by the correlation matrix.
+// \return void
+//
+// Columns with zero variance result in NaN correlation coefficients.
+*/
+template< typename MT >  // Type of the symmetric matrix
+void cov2cor( MT& S )
+{
+   using RT = ElementType_t<MT>;
+
+   const size_t N( S.rows() );
+
+   DynamicVector<RT,columnVector> d( N );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      d[j] = RT(1) / std::sqrt( S(j,j) );
+   }
+
+   for( size_t j=0UL; j<N; ++j ) {
+      for( size_t k=0UL; k<j; ++k ) {
+         S(k,j) = S(k,j) * d[k] * d[j];
+      }
+      S(j,j) = ( d[j] == d[j] ? RT(1) : d[j] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COVARIANCE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Covariance functions */
+//@{
+template< typename MT, bool SO >
+SymmetricMatrix< DynamicMatrix< CovarianceElement_t<MT>, SO > >
+   cov( const DenseMatrix<MT,SO>& X );
+
+template< typename MT, bool SO, typename VT >
+SymmetricMatrix< DynamicMatrix< CovarianceElement_t<MT>, SO > >
+   cov( const DenseMatrix<MT,SO>& X, const DenseVector<VT,columnVector>& w );
+
+template< typename MT, bool SO >
+SymmetricMatrix< DynamicMatrix< CovarianceElement_t<MT>, SO > >
+   cor( const DenseMatrix<MT,SO>& X );
+
+template< typename MT, bool SO, typename VT >
+SymmetricMatrix< DynamicMatrix< CovarianceElement_t<MT>, SO > >
+   cor( const DenseMatrix<MT,SO>& X, const DenseVector<VT,columnVector>& w );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the covariance matrix of the columns of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param X The given dense matrix (one observation per row, one variable per column).
+// \return The \f$ N \times N \f$ covariance matrix of the \f$ N \f$ columns of \a X.
+// \exception std::invalid_argument Invalid input matrix.
+//
+// This function computes the sample covariance matrix of the columns of the \f$ M \times N \f$
+// dense matrix \a X, i.e. it is equivalent to
+
+   \code
+   const auto Xc( X - expand( mean<columnwise>( X ), rows( X ) ) );
+   const auto C ( trans( Xc ) * Xc / ( rows( X ) - 1 ) );
+   \endcode
+
+// In contrast to this formulation, however, the centered copy of \a X is never materialized.
+// The column means are computed in a single (parallel) pass over \a X, which is followed by a
+// blockwise rank-k update of the centered rows that computes only one triangle of the symmetric
+// result. Example:
+
+   \code
+   blaze::DynamicMatrix<double> X{ { 1.0, 2.0 }, { 2.0, 4.0 }, { 3.0, 7.0 } };
+
+   const blaze::SymmetricMatrix< blaze::DynamicMatrix<double> > C( cov( X ) );
+   // Results in ( ( 1.0 2.5 ) ( 2.5 6.3333 ) )
+   \endcode
+
+// Floating point element types are preserved, for all other element types the covariance matrix
+// is computed in \c double precision. Complex element types are not supported. In case \a X has
+// less than 2 rows, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+SymmetricMatrix< DynamicMatrix< CovarianceElement_t<MT>, SO > >
+   cov( const DenseMatrix<MT,SO>& X )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPLEX_TYPE( ElementType_t<MT> );
+
+   using RT = CovarianceElement_t<MT>;
+
+   const size_t M( (*X).rows() );
+
+   if( M < 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input matrix" );
+   }
+
+   const DynamicVector<RT,rowVector> mu( mean<columnwise>( *X ) );
+
+   return cov_backend( *X, mu, uniform( M, RT(1) ), RT(1) / RT( M-1UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the weighted covariance matrix of the columns of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param X The given dense matrix (one observation per row, one variable per column).
+// \param w The non-negative weights of the \f$ M \f$ observations.
+// \return The \f$ N \times N \f$ weighted covariance matrix of the \f$ N \f$ columns of \a X.
+// \exception std::invalid_argument Invalid input matrix.
+// \exception std::invalid_argument Invalid weight vector.
+//
+// This function computes the unbiased weighted sample covariance matrix of the columns of the
+// \f$ M \times N \f$ dense matrix \a X for the given reliability weights \a w:
+
+   \f[ \mu = \frac{\sum_i w_i x_i}{V_1}, \quad
+       C = \frac{\sum_i w_i (x_i - \mu)^T (x_i - \mu)}{V_1 - V_2 / V_1}, \quad
+       V_1 = \sum_i w_i, \quad V_2 = \sum_i w_i^2, \f]
+
+// where \f$ x_i \f$ denotes the \a i-th row of \a X. For uniform weights the result is identical
+// to the unweighted covariance matrix. As for the unweighted cov() function, the centered rows
+// are processed blockwise and only one triangle of the result is computed. In case \a X has less
+// than 2 rows, a \a std::invalid_argument exception is thrown. In case the size of \a w doesn't
+// match the number of rows of \a X, in case any weight is negative, or in case the normalization
+// \f$ V_1 - V_2 / V_1 \f$ is not positive (for instance if only a single weight is non-zero), a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename VT >  // Type of the weight vector
+SymmetricMatrix< DynamicMatrix< CovarianceElement_t<MT>, SO > >
+   cov( const DenseMatrix<MT,SO>& X, const DenseVector<VT,columnVector>& w )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPLEX_TYPE( ElementType_t<MT> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPLEX_TYPE( ElementType_t<VT> );
+
+   using RT = CovarianceElement_t<MT>;
+
+   const size_t M( (*X).rows() );
+
+   if( M < 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input matrix" );
+   }
+
+   if( (*w).size() != M ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid weight vector" );
+   }
+
+   const DynamicVector<RT,columnVector> w_( *w );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      if( !( w_[i] >= RT(0) ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid weight vector" );
+      }
+   }
+
+   const RT V1( sum( w_ ) );
+   const RT V2( sum( w_ * w_ ) );
+
+   if( !( V1 > RT(0) ) || !( V1 - V2 / V1 > RT(0) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid weight vector" );
+   }
+
+   const DynamicVector<RT,rowVector> mu( ( trans( w_ ) * (*X) ) / V1 );
+   const DynamicVector<RT,columnVector> sw( sqrt( w_ ) );
+
+   return cov_backend( *X, mu, sw, RT(1) / ( V1 - V2 / V1 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the correlation matrix of the columns of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param X The given dense matrix (one observation per row, one variable per column).
+// \return The \f$ N \times N \f$ Pearson correlation matrix of the \f$ N \f$ columns of \a X.
+// \exception std::invalid_argument Invalid input matrix.
+//
+// This function computes the Pearson correlation coefficients of the columns of the given
+// \f$ M \times N \f$ dense matrix \a X by normalizing the covariance matrix computed by cov().
+// Columns with zero variance result in NaN coefficients. In case \a X has less than 2 rows, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+SymmetricMatrix< DynamicMatrix< CovarianceElement_t<MT>, SO > >
+   cor( const DenseMatrix<MT,SO>& X )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   auto S( cov( *X ) );
+   cov2cor( S );
+   return S;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the weighted correlation matrix of the columns of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param X The given dense matrix (one observation per row, one variable per column).
+// \param w The non-negative weights of the \f$ M \f$ observations.
+// \return The \f$ N \times N \f$ weighted correlation matrix of the \f$ N \f$ columns of \a X.
+// \exception std::invalid_argument Invalid input matrix.
+// \exception std::invalid_argument Invalid weight vector.
+//
+// This function computes the weighted Pearson correlation coefficients of the columns of the
+// given \f$ M \times N \f$ dense matrix \a X by normalizing the weighted covariance matrix
+// computed by cov(). Columns with zero variance result in NaN coefficients. The function throws
+// the same exceptions as the weighted cov() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename VT >  // Type of the weight vector
+SymmetricMatrix< DynamicMatrix< CovarianceElement_t<MT>, SO > >
+   cor( const DenseMatrix<MT,SO>& X, const DenseVector<VT,columnVector>& w )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   auto S( cov( *X, *w ) );
+   cov2cor( S );
+   return S;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
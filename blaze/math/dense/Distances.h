@@ -0,0 +1,531 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Distances.h
+//  \brief Header file for the dense pairwise distance and nearest neighbor functions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_DISTANCES_H_
+#define _BLAZE_MATH_DENSE_DISTANCES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/DistanceFlag.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatDMatMultExpr.h>
+#include <blaze/math/expressions/DMatDMatSchurExpr.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
+#include <blaze/math/expressions/DMatSerialExpr.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion of a block of inner products into distances.
+// \ingroup dense_matrix
+//
+// \param G The block of inner products, which is overwritten by the distances.
+// \param xn The row norms of the left-hand side block.
+// \param yn The row norms of the right-hand side block.
+// \param metric The distance metric.
+// \return void
+//
+// For the (squared) Euclidean distance, \a xn and \a yn are expected to contain squared norms,
+// for the cosine distance they are expected to contain the norms.
+*/
+template< typename MT    // Type of the block of inner products
+        , typename VT1   // Type of the left-hand side norms
+        , typename VT2 > // Type of the right-hand side norms
+void distanceEpilogue( MT& G, const VT1& xn, const VT2& yn, DistanceFlag metric )
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t M( G.rows()    );
+   const size_t N( G.columns() );
+
+   switch( metric )
+   {
+      case euclideanDistance:
+         for( size_t i=0UL; i<M; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               G(i,j) = std::sqrt( max( xn[i] + yn[j] - ET(2)*G(i,j), ET(0) ) );
+            }
+         }
+         break;
+
+      case squaredEuclideanDistance:
+         for( size_t i=0UL; i<M; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               G(i,j) = max( xn[i] + yn[j] - ET(2)*G(i,j), ET(0) );
+            }
+         }
+         break;
+
+      case cosineDistance:
+         for( size_t i=0UL; i<M; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               const ET scale( xn[i] * yn[j] );
+               G(i,j) = ( scale != ET(0) ? ET(1) - G(i,j) / scale : ET(1) );
+            }
+         }
+         break;
+
+      default:
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid distance metric provided" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked computation of the pairwise distances between the rows of two dense matrices.
+// \ingroup dense_matrix
+//
+// \param X The left-hand side matrix (one point per row).
+// \param Y The right-hand side matrix (one point per row).
+// \param metric The distance metric.
+// \param op The operation to be applied to each block of distances.
+// \return void
+//
+// This function partitions the distance matrix into blocks of at most 64 rows and 256 columns.
+// Each block is computed by means of a (serial) matrix multiplication into a thread-local buffer,
+// which is immediately converted into distances and passed to the given operation \a op as
+// \c op( i, j, D ), where \a i and \a j are the indices of the first row and column of the block
+// \a D. Thus the full distance matrix is never materialized. The row blocks are distributed
+// evenly among the available threads, i.e. the operation is called concurrently for blocks of
+// different rows, but never for blocks of the same rows.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , typename OP > // Type of the block operation
+void distanceKernel( const MT1& X, const MT2& Y, DistanceFlag metric, OP op )
+{
+   using ET = ElementType_t<MT1>;
+
+   constexpr size_t maxRowBlock   ( 64UL  );
+   constexpr size_t maxColumnBlock( 256UL );
+
+   const size_t M( X.rows()    );
+   const size_t N( Y.rows()    );
+   const size_t K( X.columns() );
+
+   if( M == 0UL || N == 0UL )
+      return;
+
+   DynamicVector<ET,columnVector> xn( sum<rowwise>( X % X ) );
+   DynamicVector<ET,columnVector> yn( sum<rowwise>( Y % Y ) );
+
+   if( metric == cosineDistance ) {
+      xn = sqrt( xn );
+      yn = sqrt( yn );
+   }
+
+   const bool parallel( M*N >= SMP_DMATTDMATMULT_THRESHOLD &&
+                        !isSerialSectionActive() && !isParallelSectionActive() );
+   const size_t requested( parallel ? getNumThreads() : 1UL );
+
+   const size_t rowBlock( min( maxRowBlock, ( M + requested - 1UL ) / requested ) );
+   const size_t columnBlock( min( maxColumnBlock, N ) );
+   const size_t blocks( ( M + rowBlock - 1UL ) / rowBlock );
+   const size_t threads( min( requested, blocks ) );
+
+   const auto compute = [&]( size_t bbegin, size_t bend )
+   {
+      DynamicMatrix<ET,rowMajor> G( rowBlock, columnBlock );
+
+      for( size_t b=bbegin; b<bend; ++b )
+      {
+         const size_t i ( b*rowBlock );
+         const size_t mi( min( rowBlock, M - i ) );
+
+         const auto xb( submatrix( X, i, 0UL, mi, K, unchecked ) );
+         const auto xnb( subvector( xn, i, mi, unchecked ) );
+
+         for( size_t j=0UL; j<N; j+=columnBlock )
+         {
+            const size_t nj( min( columnBlock, N - j ) );
+
+            auto gb( submatrix( G, 0UL, 0UL, mi, nj, unchecked ) );
+            gb = serial( xb * trans( submatrix( Y, j, 0UL, nj, K, unchecked ) ) );
+
+            distanceEpilogue( gb, xnb, subvector( yn, j, nj, unchecked ), metric );
+            op( i, j, gb );
+         }
+      }
+   };
+
+   if( threads == 1UL ) {
+      compute( 0UL, blocks );
+   }
+   else BLAZE_PARALLEL_SECTION
+   {
+      smpFor( threads, [&]( size_t t )
+      {
+         compute( ( t*blocks ) / threads, ( ( t+1UL )*blocks ) / threads );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PAIRWISE DISTANCE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Pairwise distance functions */
+//@{
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void pairwiseDistances( const DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& Y,
+                        DenseMatrix<MT3,SO3>& D, DistanceFlag metric = euclideanDistance );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+DynamicMatrix< ElementType_t<MT1> >
+   pairwiseDistances( const DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& Y,
+                      DistanceFlag metric = euclideanDistance );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void knn( const DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& Y, size_t k,
+          DenseMatrix<MT3,SO3>& indices, DistanceFlag metric = euclideanDistance );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2
+        , typename MT3, bool SO3, typename MT4, bool SO4 >
+void knn( const DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& Y, size_t k,
+          DenseMatrix<MT3,SO3>& indices, DenseMatrix<MT4,SO4>& distances,
+          DistanceFlag metric = euclideanDistance );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the pairwise distances between the rows of two dense matrices.
+// \ingroup dense_matrix
+//
+// \param X The \a m-by-\a k matrix of query points (one point per row).
+// \param Y The \a n-by-\a k matrix of reference points (one point per row).
+// \param D The resulting \a m-by-\a n distance matrix.
+// \param metric The distance metric (Euclidean by default).
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function computes the distance \f$ D(i,j) = d(x_i,y_j) \f$ between each row \f$ x_i \f$
+// of \a X and each row \f$ y_j \f$ of \a Y with respect to the given metric (see
+// \ref blaze::DistanceFlag):
+
+   \code
+   blaze::DynamicMatrix<double> X( 1000UL, 64UL );  // The query points
+   blaze::DynamicMatrix<double> Y( 5000UL, 64UL );  // The reference points
+   // ... Initialization
+
+   blaze::DynamicMatrix<double> D;  // The 1000x5000 distance matrix
+
+   pairwiseDistances( X, Y, D );                            // Euclidean distances
+   pairwiseDistances( X, Y, D, squaredEuclideanDistance );  // Squared Euclidean distances
+   D = pairwiseDistances( X, Y, cosineDistance );           // Cosine distances
+   \endcode
+
+// The distances are computed based on the inner products \f$ x_i \cdot y_j \f$, which are
+// evaluated block-wise by the Blaze matrix multiplication kernels. Each block is converted into
+// distances while it still resides in cache (i.e. by adding the squared row norms and taking the
+// square root), which avoids any temporary matrix of the size of the distance matrix. For large
+// matrices, the computation is parallelized by distributing the rows of \a X among the available
+// threads.
+//
+// \note This function only works for matrices with \c float or \c double element type. The
+// attempt to call the function with matrices of any other element type results in a compile
+// time error!
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2      // Storage order of the right-hand side matrix
+        , typename MT3  // Type of the distance matrix
+        , bool SO3 >    // Storage order of the distance matrix
+void pairwiseDistances( const DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& Y,
+                        DenseMatrix<MT3,SO3>& D, DistanceFlag metric )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT1>, ElementType_t<MT2> );
+
+   if( (*X).columns() != (*Y).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_t<MT1> X_( *X );
+   CompositeType_t<MT2> Y_( *Y );
+   MT3& D_( *D );
+
+   resize( D_, X_.rows(), Y_.rows(), false );
+
+   distanceKernel( X_, Y_, metric, [&D_]( size_t i, size_t j, const auto& block )
+   {
+      submatrix( D_, i, j, block.rows(), block.columns(), unchecked ) = serial( block );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the pairwise distances between the rows of two dense matrices.
+// \ingroup dense_matrix
+//
+// \param X The \a m-by-\a k matrix of query points (one point per row).
+// \param Y The \a n-by-\a k matrix of reference points (one point per row).
+// \param metric The distance metric (Euclidean by default).
+// \return The \a m-by-\a n distance matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function returns the matrix of distances between each row of \a X and each row of \a Y.
+// For more details see the pairwiseDistances() function with explicit distance matrix.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+DynamicMatrix< ElementType_t<MT1> >
+   pairwiseDistances( const DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& Y,
+                      DistanceFlag metric )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicMatrix< ElementType_t<MT1> > D;
+   pairwiseDistances( *X, *Y, D, metric );
+   return D;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the k nearest neighbors of the rows of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param X The \a m-by-\a d matrix of query points (one point per row).
+// \param Y The \a n-by-\a d matrix of reference points (one point per row).
+// \param k The number of nearest neighbors (\f$ 1 \le k \le n \f$).
+// \param indices The resulting \a m-by-\a k matrix of neighbor indices.
+// \param metric The distance metric (Euclidean by default).
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid number of nearest neighbors.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function determines for each row of \a X the indices of the \a k nearest rows of \a Y.
+// For more details see the knn() function with explicit distance matrix.
+*/
+template< typename MT1  // Type of the query matrix
+        , bool SO1      // Storage order of the query matrix
+        , typename MT2  // Type of the reference matrix
+        , bool SO2      // Storage order of the reference matrix
+        , typename MT3  // Type of the index matrix
+        , bool SO3 >    // Storage order of the index matrix
+void knn( const DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& Y, size_t k,
+          DenseMatrix<MT3,SO3>& indices, DistanceFlag metric )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicMatrix< ElementType_t<MT1> > distances;
+   knn( *X, *Y, k, *indices, distances, metric );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the k nearest neighbors of the rows of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param X The \a m-by-\a d matrix of query points (one point per row).
+// \param Y The \a n-by-\a d matrix of reference points (one point per row).
+// \param k The number of nearest neighbors (\f$ 1 \le k \le n \f$).
+// \param indices The resulting \a m-by-\a k matrix of neighbor indices.
+// \param distances The resulting \a m-by-\a k matrix of neighbor distances.
+// \param metric The distance metric (Euclidean by default).
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid number of nearest neighbors.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function determines for each row of \a X the \a k nearest rows of \a Y with respect to
+// the given metric (see \ref blaze::DistanceFlag). The \a i-th row of \a indices contains the
+// row indices of the neighbors of the \a i-th query point in order of increasing distance, the
+// \a i-th row of \a distances contains the according distances. Neighbors with equal distance
+// are ordered by increasing index.
+
+   \code
+   blaze::DynamicMatrix<float> X( 100UL, 128UL );     // The query points
+   blaze::DynamicMatrix<float> Y( 100000UL, 128UL );  // The reference points
+   // ... Initialization
+
+   blaze::DynamicMatrix<size_t> I;  // The indices of the 10 nearest neighbors
+   blaze::DynamicMatrix<float>  D;  // The distances to the 10 nearest neighbors
+
+   knn( X, Y, 10UL, I, D );                  // Euclidean nearest neighbors
+   knn( X, Y, 10UL, I, D, cosineDistance );  // Nearest neighbors in terms of cosine distance
+   \endcode
+
+// The distances are computed block-wise by the Blaze matrix multiplication kernels (see the
+// pairwiseDistances() function) and each block is immediately merged into a bounded max-heap
+// of the current \a k nearest neighbors of each query point. Thus the memory requirement is
+// independent of the number of reference points and the full distance matrix is never
+// materialized. For large matrices, the computation is parallelized by distributing the rows
+// of \a X among the available threads.
+//
+// \note This function only works for matrices with \c float or \c double element type. The
+// attempt to call the function with matrices of any other element type results in a compile
+// time error!
+*/
+template< typename MT1  // Type of the query matrix
+        , bool SO1      // Storage order of the query matrix
+        , typename MT2  // Type of the reference matrix
+        , bool SO2      // Storage order of the reference matrix
+        , typename MT3  // Type of the index matrix
+        , bool SO3      // Storage order of the index matrix
+        , typename MT4  // Type of the distance matrix
+        , bool SO4 >    // Storage order of the distance matrix
+void knn( const DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& Y, size_t k,
+          DenseMatrix<MT3,SO3>& indices, DenseMatrix<MT4,SO4>& distances, DistanceFlag metric )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT1>, ElementType_t<MT2> );
+
+   using ET = ElementType_t<MT1>;
+   using Neighbor = std::pair<ET,size_t>;
+
+   if( (*X).columns() != (*Y).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( k == 0UL || k > (*Y).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of nearest neighbors" );
+   }
+
+   CompositeType_t<MT1> X_( *X );
+   CompositeType_t<MT2> Y_( *Y );
+
+   const size_t M( X_.rows() );
+
+   resize( *indices  , M, k, false );
+   resize( *distances, M, k, false );
+
+   // The Euclidean neighbors are selected based on the squared distances
+   const DistanceFlag selection( metric == euclideanDistance ? squaredEuclideanDistance : metric );
+
+   std::vector<Neighbor> heaps( M*k );
+
+   distanceKernel( X_, Y_, selection, [&heaps,k]( size_t i, size_t j, const auto& block )
+   {
+      for( size_t ii=0UL; ii<block.rows(); ++ii )
+      {
+         const auto first( heaps.begin() + ( i+ii )*k );
+         const auto last ( first + k );
+
+         size_t jj( 0UL );
+
+         // Filling the heap with the first k reference points
+         for( ; j+jj<k && jj<block.columns(); ++jj ) {
+            *( first + j + jj ) = Neighbor( block(ii,jj), j+jj );
+            std::push_heap( first, first + j + jj + 1UL );
+         }
+
+         // Replacing the farthest neighbor in case a nearer reference point is found
+         for( ; jj<block.columns(); ++jj ) {
+            const Neighbor candidate( block(ii,jj), j+jj );
+            if( candidate < *first ) {
+               std::pop_heap( first, last );
+               *( last - 1 ) = candidate;
+               std::push_heap( first, last );
+            }
+         }
+      }
+   } );
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      const auto first( heaps.begin() + i*k );
+      std::sort_heap( first, first + k );
+
+      for( size_t j=0UL; j<k; ++j ) {
+         (*indices)(i,j)   = ( first+j )->second;
+         (*distances)(i,j) = ( metric == euclideanDistance ? std::sqrt( ( first+j )->first )
+                                                           : ( first+j )->first );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
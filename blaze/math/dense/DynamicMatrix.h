@@ -1625,8 +1625,10 @@ inline DynamicMatrix<Type,SO,Alloc,Tag>&
       ctranspose();
    }
    else if( !IsSame_v<MT,IT> && (*rhs).canAlias( this ) ) {
-      DynamicMatrix tmp( *rhs );
-      swap( tmp );
+      if( !aliasedAssign( *this, *rhs ) ) {
+         DynamicMatrix tmp( *rhs );
+         swap( tmp );
+      }
    }
    else {
       resize( (*rhs).rows(), (*rhs).columns(), false );
@@ -4964,8 +4966,10 @@ inline DynamicMatrix<Type,true,Alloc,Tag>&
       ctranspose();
    }
    else if( !IsSame_v<MT,IT> && (*rhs).canAlias( this ) ) {
-      DynamicMatrix tmp( *rhs );
-      swap( tmp );
+      if( !aliasedAssign( *this, *rhs ) ) {
+         DynamicMatrix tmp( *rhs );
+         swap( tmp );
+      }
    }
    else {
       resize( (*rhs).rows(), (*rhs).columns(), false );
@@ -1368,8 +1368,10 @@ inline DynamicVector<Type,TF,Alloc,Tag>&
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
 
    if( (*rhs).canAlias( this ) ) {
-      DynamicVector tmp( *rhs );
-      swap( tmp );
+      if( !aliasedAssign( *this, *rhs ) ) {
+         DynamicVector tmp( *rhs );
+         swap( tmp );
+      }
    }
    else {
       resize( (*rhs).size(), false );
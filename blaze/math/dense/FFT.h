@@ -0,0 +1,358 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/FFT.h
+//  \brief Header file for the FFT-based products of structured dense matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_FFT_H_
+#define _BLAZE_MATH_DENSE_FFT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <utility>
+#include <vector>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS FFTCONVOLUTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cyclic convolution with a fixed kernel by means of radix-2 fast Fourier transforms.
+// \ingroup dense_matrix
+//
+// The FFTConvolution class template computes cyclic convolutions of length \f$ N \f$ with a
+// fixed kernel, where \f$ N \f$ is the smallest power of two that is not smaller than the
+// length of the kernel. The twiddle factors and the transform of the kernel are computed once
+// on construction, each call of the convolve() function performs one forward and one inverse
+// transform. The template parameter \a T specifies the builtin floating point type of the
+// complex computations.
+*/
+template< typename T >  // Builtin floating point type
+class FFTConvolution
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ComplexType = complex<T>;  //!< Complex type of the transformed values.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FFTConvolution class.
+   //
+   // \param kernel Pointer to the first coefficient of the convolution kernel.
+   // \param length The number of coefficients of the convolution kernel.
+   */
+   template< typename Type >  // Type of the kernel coefficients
+   explicit FFTConvolution( const Type* kernel, size_t length )
+      : size_    ( 1UL )  // The length of the transforms
+      , twiddles_()       // The twiddle factors of the transforms
+      , kernel_  ()       // The scaled transform of the kernel
+   {
+      while( size_ < length ) {
+         size_ <<= 1;
+      }
+
+      const double pi( 3.14159265358979323846 );
+
+      twiddles_.resize( size_/2UL );
+      for( size_t k=0UL; k<size_/2UL; ++k ) {
+         const double angle( -2.0 * pi * double( k ) / double( size_ ) );
+         twiddles_[k] = ComplexType( T( std::cos( angle ) ), T( std::sin( angle ) ) );
+      }
+
+      kernel_.resize( size_, ComplexType() );
+      for( size_t k=0UL; k<length; ++k ) {
+         kernel_[k] = ComplexType( kernel[k] );
+      }
+
+      transform( kernel_.data(), false );
+
+      const T scale( T(1) / T( size_ ) );
+      for( ComplexType& value : kernel_ ) {
+         value *= scale;
+      }
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the length of the cyclic convolution.
+   //
+   // \return The length of the transforms.
+   */
+   inline size_t size() const noexcept {
+      return size_;
+   }
+   //**********************************************************************************************
+
+   //**Convolve function***************************************************************************
+   /*!\brief In-place cyclic convolution of the given sequence with the kernel.
+   //
+   // \param x Pointer to the first of size() elements of the sequence.
+   // \return void
+   */
+   inline void convolve( ComplexType* x ) const noexcept
+   {
+      transform( x, false );
+
+      for( size_t k=0UL; k<size_; ++k ) {
+         x[k] = multiply( x[k], kernel_[k] );
+      }
+
+      transform( x, true );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Multiply function***************************************************************************
+   /*!\brief Complex multiplication without the special handling of infinite values.
+   //
+   // \param a The left-hand side complex value.
+   // \param b The right-hand side complex value.
+   // \return The product of the two values.
+   */
+   static inline ComplexType multiply( const ComplexType& a, const ComplexType& b ) noexcept
+   {
+      return ComplexType( a.real()*b.real() - a.imag()*b.imag(),
+                          a.real()*b.imag() + a.imag()*b.real() );
+   }
+   //**********************************************************************************************
+
+   //**Transform function**************************************************************************
+   /*!\brief Unscaled in-place forward or inverse fast Fourier transform.
+   //
+   // \param x Pointer to the first of size() elements of the sequence.
+   // \param inverse \a true for the inverse transform, \a false for the forward transform.
+   // \return void
+   //
+   // This function performs an iterative radix-2 decimation-in-time transform: the sequence is
+   // reordered in bit-reversed order, then \f$ \log_2 N \f$ butterfly passes are performed.
+   */
+   void transform( ComplexType* x, bool inverse ) const noexcept
+   {
+      for( size_t i=1UL, j=0UL; i<size_; ++i ) {
+         size_t bit( size_ >> 1 );
+         for( ; j & bit; bit >>= 1 ) {
+            j ^= bit;
+         }
+         j ^= bit;
+         if( i < j ) {
+            std::swap( x[i], x[j] );
+         }
+      }
+
+      for( size_t length=2UL; length<=size_; length<<=1 )
+      {
+         const size_t half( length/2UL );
+         const size_t stride( size_/length );
+
+         for( size_t i=0UL; i<size_; i+=length ) {
+            for( size_t k=0UL; k<half; ++k ) {
+               const ComplexType& w( twiddles_[k*stride] );
+               const ComplexType v( multiply( x[i+k+half], inverse ? conj( w ) : w ) );
+               x[i+k+half] = x[i+k] - v;
+               x[i+k]     += v;
+            }
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   size_t                   size_;      //!< The length of the transforms.
+   std::vector<ComplexType> twiddles_;  //!< The twiddle factors of the transforms.
+   std::vector<ComplexType> kernel_;    //!< The scaled transform of the kernel.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STRUCTURED MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion of a complex convolution result to the result element type.
+// \ingroup dense_matrix
+*/
+template< typename RET, typename CT, EnableIf_t< IsComplex_v<RET> >* = nullptr >
+inline RET fftResult( const CT& value )
+{
+   return RET( value );
+}
+
+template< typename RET, typename CT, EnableIf_t< !IsComplex_v<RET> >* = nullptr >
+inline RET fftResult( const CT& value )
+{
+   return RET( value.real() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a Toeplitz-structured matrix with a set of dense columns.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first of the \f$ M+N-1 \f$ defining coefficients of the matrix.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param reversed \a true in case the columns of the matrix are stored in reversed order.
+// \param columns The number of right-hand side columns.
+// \param x Accessor to the right-hand side elements: \a x(l,j) returns the element \f$ (l,j) \f$.
+// \param y Accessor to the result elements: \a y(i,j) returns a reference to element \f$ (i,j) \f$.
+// \return void
+//
+// This function computes \f$ y_{ij} = \sum_l a_{i+n-1-l} \tilde{x}_{lj} \f$, where \f$ \tilde{x}
+// \f$ is either \a x or \a x with reversed rows. Toeplitz matrices (\f$ A_{ij} = a_{i-j+n-1} \f$)
+// are represented by \a reversed set to \a false, Hankel matrices (\f$ A_{ij} = a_{i+j} \f$) by
+// \a reversed set to \a true. Every column is computed as linear convolution in
+// \f$ O((M+N) \log(M+N)) \f$ operations by means of a zero-padded cyclic convolution. For real
+// valued products two columns are combined into the real and imaginary part of a single complex
+// convolution. Small matrices and integral element types are multiplied directly. In case SMP
+// parallelization is enabled, the columns are distributed among the threads.
+*/
+template< typename Type   // Type of the matrix coefficients
+        , typename XA     // Type of the right-hand side accessor
+        , typename YA >   // Type of the result accessor
+void structuredMultiply( const Type* a, size_t m, size_t n, bool reversed, size_t columns,
+                         XA x, YA y )
+{
+   using XET = RemoveCVRef_t< decltype( x( 0UL, 0UL ) ) >;
+   using RET = RemoveCVRef_t< decltype( y( 0UL, 0UL ) ) >;
+   using BT  = UnderlyingBuiltin_t<RET>;
+
+   if( m == 0UL || columns == 0UL ) {
+      return;
+   }
+
+   const auto element = [&x,n,reversed]( size_t l, size_t j ) {
+      return x( reversed ? n-1UL-l : l, j );
+   };
+
+   if( !IsFloatingPoint_v<BT> || min( m, n ) < 32UL )
+   {
+      for( size_t j=0UL; j<columns; ++j ) {
+         for( size_t i=0UL; i<m; ++i ) {
+            RET sum{};
+            for( size_t l=0UL; l<n; ++l ) {
+               sum += a[i+n-1UL-l] * element( l, j );
+            }
+            y(i,j) = sum;
+         }
+      }
+      return;
+   }
+
+   using CT = complex< If_t< IsFloatingPoint_v<BT>, BT, double > >;
+
+   const FFTConvolution< UnderlyingBuiltin_t<CT> > convolution( a, m+n-1UL );
+   const size_t size( convolution.size() );
+
+   constexpr bool paired( !IsComplex_v<RET> && !IsComplex_v<XET> );
+   const size_t groups( paired ? ( columns + 1UL ) / 2UL : columns );
+
+   const auto compute = [&]( size_t group )
+   {
+      std::vector<CT> w( size, CT() );
+
+      const size_t j( paired ? 2UL*group : group );
+      const bool second( paired && j+1UL < columns );
+
+      for( size_t l=0UL; l<n; ++l ) {
+         w[l] = second ? CT( real( element( l, j ) ), real( element( l, j+1UL ) ) )
+                       : CT( element( l, j ) );
+      }
+
+      convolution.convolve( w.data() );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         y(i,j) = fftResult<RET>( w[i+n-1UL] );
+      }
+
+      if( second ) {
+         for( size_t i=0UL; i<m; ++i ) {
+            y(i,j+1UL) = RET( w[i+n-1UL].imag() );
+         }
+      }
+   };
+
+   if( groups > 1UL && getNumThreads() > 1UL && m*columns >= SMP_DMATDMATMULT_THRESHOLD &&
+       !isSerialSectionActive() && !isParallelSectionActive() )
+   {
+      BLAZE_PARALLEL_SECTION
+      {
+         smpFor( groups, compute );
+      }
+   }
+   else
+   {
+      for( size_t group=0UL; group<groups; ++group ) {
+         compute( group );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
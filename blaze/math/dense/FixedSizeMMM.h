@@ -0,0 +1,326 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/FixedSizeMMM.h
+//  \brief Header file for the fixed-size dense matrix multiplication kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_FIXEDSIZEMMM_H_
+#define _BLAZE_MATH_DENSE_FIXEDSIZEMMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/functors/AddAssign.h>
+#include <blaze/math/functors/Assign.h>
+#include <blaze/math/functors/SubAssign.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsAdaptor.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsStatic.h>
+#include <blaze/math/typetraits/StorageOrder.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  FIXED-SIZE DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Largest column and inner dimension covered by the fixed-size multiplication kernels.
+// \ingroup dense_matrix
+//
+// The fixed-size kernels are instantiated for all combinations of the number of columns of the
+// row-major target matrix and the inner dimension in the range \f$ [1..FIXEDMMM_MAX_SIZE] \f$.
+// Since the number of instantiated kernels grows quadratically with this value, it is kept small.
+*/
+constexpr size_t FIXEDMMM_MAX_SIZE = 8UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the fixed-size dense matrix multiplication kernels.
+// \ingroup dense_matrix
+//
+// This variable template evaluates to \a true in case the product of the two dense matrices
+// of type \a MT2 and \a MT3 can be assigned to a dense matrix of type \a MT1 by means of the
+// fixed-size kernels, i.e. if all three matrices have the same storage order, provide direct
+// access to their elements of the same vectorizable element type, and at least one of them
+// has runtime sizes.
+*/
+template< typename MT1, typename MT2, typename MT3 >
+constexpr bool UseFixedSizeMMM_v =
+   ( useOptimizedKernels && useFixedSizeKernels &&
+     StorageOrder_v<MT1> == StorageOrder_v<MT2> && StorageOrder_v<MT1> == StorageOrder_v<MT3> &&
+     HasMutableDataAccess_v<MT1> && HasConstDataAccess_v<MT2> && HasConstDataAccess_v<MT3> &&
+     !IsAdaptor_v<MT1> &&
+     !( IsStatic_v<MT1> && IsStatic_v<MT2> && IsStatic_v<MT3> ) &&
+     IsSame_v< ElementType_t<MT1>, ElementType_t<MT2> > &&
+     IsSame_v< ElementType_t<MT1>, ElementType_t<MT3> > &&
+     IsVectorizable_v< ElementType_t<MT1> > &&
+     HasSIMDAdd_v< ElementType_t<MT1>, ElementType_t<MT1> > &&
+     HasSIMDMult_v< ElementType_t<MT1>, ElementType_t<MT1> > );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fixed-size compute kernel for a row-major dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param M The number of rows of \a A and \a C.
+// \param C Pointer to the first element of the row-major target matrix.
+// \param ldc The spacing between two rows of \a C.
+// \param A Pointer to the first element of the row-major left-hand side operand.
+// \param lda The spacing between two rows of \a A.
+// \param B Pointer to the first element of the row-major right-hand side operand.
+// \param ldb The spacing between two rows of \a B.
+// \return void
+//
+// This function computes \f$ C (op)= A*B \f$ for a \f$ M \times K \f$ matrix \a A and a
+// \f$ K \times N \f$ matrix \a B, where the assignment operation is given by \a OP. Since both
+// \a N and \a K are compile time constants, each row of the result is accumulated entirely in
+// registers and all loops except the loop over the rows are unrolled by the compiler. The
+// kernel does not rely on padding and only touches the elements within the given dimensions.
+*/
+template< size_t N     // Number of columns of B and C
+        , size_t K     // Number of columns of A and rows of B
+        , typename OP  // Type of the assignment operation
+        , typename T > // Element type of the matrices
+void fixedmmmKernel( size_t M, T* C, size_t ldc, const T* A, size_t lda, const T* B, size_t ldb )
+{
+   using SIMDType = SIMDTrait_t<T>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+   constexpr size_t NV  ( N / SIMDSIZE );
+   constexpr size_t NR  ( N % SIMDSIZE );
+   constexpr size_t jpos( NV * SIMDSIZE );
+
+   OP op;
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      const T* a( A + i*lda );
+      T* c( C + i*ldc );
+
+      std::array<SIMDType,NV> xmm;
+      std::array<T,NR> rem;
+
+      const SIMDType a1( set( a[0UL] ) );
+      for( size_t v=0UL; v<NV; ++v ) {
+         xmm[v] = a1 * loadu( B + v*SIMDSIZE );
+      }
+      for( size_t r=0UL; r<NR; ++r ) {
+         rem[r] = a[0UL] * B[jpos+r];
+      }
+
+      for( size_t k=1UL; k<K; ++k )
+      {
+         const T* b( B + k*ldb );
+         const SIMDType a2( set( a[k] ) );
+         for( size_t v=0UL; v<NV; ++v ) {
+            xmm[v] += a2 * loadu( b + v*SIMDSIZE );
+         }
+         for( size_t r=0UL; r<NR; ++r ) {
+            rem[r] += a[k] * b[jpos+r];
+         }
+      }
+
+      for( size_t v=0UL; v<NV; ++v ) {
+         if( IsSame_v<OP,Assign> ) {
+            storeu( c + v*SIMDSIZE, xmm[v] );
+         }
+         else {
+            SIMDType tmp( loadu( c + v*SIMDSIZE ) );
+            op( tmp, xmm[v] );
+            storeu( c + v*SIMDSIZE, tmp );
+         }
+      }
+      for( size_t r=0UL; r<NR; ++r ) {
+         op( c[jpos+r], rem[r] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Function pointer type of a fixed-size dense matrix multiplication kernel.
+// \ingroup dense_matrix
+*/
+template< typename T >
+using FixedSizeMMMKernel = void (*)( size_t, T*, size_t, const T*, size_t, const T*, size_t );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the dispatch table of the fixed-size dense matrix multiplication kernels.
+// \ingroup dense_matrix
+//
+// \return Pointer to the first entry of the dispatch table.
+//
+// The kernel for \a N columns and an inner dimension of \a K is stored at the position
+// \f$ (N-1)*FIXEDMMM_MAX_SIZE+(K-1) \f$.
+*/
+template< typename OP, typename T, size_t... Is >
+const FixedSizeMMMKernel<T>* fixedmmmKernels( std::index_sequence<Is...> )
+{
+   static const FixedSizeMMMKernel<T> kernels[] = {
+      &fixedmmmKernel< Is/FIXEDMMM_MAX_SIZE+1UL, Is%FIXEDMMM_MAX_SIZE+1UL, OP, T >...
+   };
+
+   return kernels;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fixed-size dense matrix multiplication (\f$ C (op)= A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \return \a true in case the product has been computed, \a false if not.
+//
+// This function dispatches the given runtime sizes of a small dense matrix multiplication into
+// the table of fixed-size kernels. The assignment operation is given by \a OP (Assign,
+// AddAssign, or SubAssign). In case the number of columns of the target matrix (for row-major
+// matrices) or the number of rows (for column-major matrices) or the inner dimension exceed
+// FIXEDMMM_MAX_SIZE, the function returns \a false and the product has to be computed by
+// another kernel. Column-major matrices are handled via \f$ C^T (op)= B^T*A^T \f$, which
+// corresponds to a row-major multiplication on the same memory. In case the target matrix and
+// the right-hand side operand of this row-major multiplication are padded, the kernel extends
+// into the padding elements, which avoids the scalar remainder loop.
+*/
+template< typename OP     // Type of the assignment operation
+        , typename MT1    // Type of the left-hand side target matrix
+        , bool SO         // Storage order of the target matrix
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3 >  // Type of the right-hand side matrix operand
+inline auto fixedmmm( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B )
+   -> EnableIf_t< UseFixedSizeMMM_v<MT1,MT2,MT3>, bool >
+{
+   BLAZE_INTERNAL_ASSERT( (*C).rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (*C).columns() == B.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( A.columns()    == B.rows()   , "Invalid matrix sizes"      );
+
+   using ET = ElementType_t<MT1>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+   constexpr bool padded( IsPadded_v<MT1> && IsPadded_v< If_t<SO,MT2,MT3> > );
+
+   const size_t M( A.rows()    );
+   const size_t N( B.columns() );
+   const size_t K( A.columns() );
+
+   size_t J( SO ? M : N );
+
+   if( J == 0UL || K == 0UL || J > FIXEDMMM_MAX_SIZE || K > FIXEDMMM_MAX_SIZE )
+      return false;
+
+   if( padded && nextMultiple( J, SIMDSIZE ) <= FIXEDMMM_MAX_SIZE )
+      J = nextMultiple( J, SIMDSIZE );
+
+   const FixedSizeMMMKernel<ET> kernel(
+      fixedmmmKernels<OP,ET>( std::make_index_sequence<FIXEDMMM_MAX_SIZE*FIXEDMMM_MAX_SIZE>() )
+         [(J-1UL)*FIXEDMMM_MAX_SIZE+(K-1UL)] );
+
+   if( SO )
+      kernel( N, (*C).data(), (*C).spacing(), B.data(), B.spacing(), A.data(), A.spacing() );
+   else
+      kernel( M, (*C).data(), (*C).spacing(), A.data(), A.spacing(), B.data(), B.spacing() );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for dense matrix multiplications not covered by the fixed-size kernels.
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \return \a false.
+*/
+template< typename OP     // Type of the assignment operation
+        , typename MT1    // Type of the left-hand side target matrix
+        , bool SO         // Storage order of the target matrix
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3 >  // Type of the right-hand side matrix operand
+inline auto fixedmmm( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B )
+   -> DisableIf_t< UseFixedSizeMMM_v<MT1,MT2,MT3>, bool >
+{
+   MAYBE_UNUSED( C, A, B );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
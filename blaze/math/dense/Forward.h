@@ -124,6 +124,40 @@ template< typename Type                  // Data type of the matrix
              DynamicMatrix<RemoveConst_t<Type>,SO,AlignedAllocator<Type>,Tag> >
 class CustomMatrix;
 
+template< typename Type                   // Data type of the vector
+        , bool TF = defaultTransposeFlag  // Transpose flag
+        , typename Tag = Group0           // Type tag
+        , typename RT =                   // Result type
+             DynamicVector<RemoveConst_t<Type>,TF,AlignedAllocator<Type>,Tag> >
+class StridedVector;
+
+template< typename Type                  // Data type of the matrix
+        , bool SO = defaultStorageOrder  // Storage order
+        , typename Tag = Group0          // Type tag
+        , typename RT =                  // Result type
+             DynamicMatrix<RemoveConst_t<Type>,SO,AlignedAllocator<Type>,Tag> >
+class StridedMatrix;
+
+template< typename Type             // Data type of the matrix
+        , typename Tag = Group0 >   // Type tag
+class HODLRMatrix;
+
+template< typename Type             // Data type of the matrix
+        , typename Tag = Group0 >   // Type tag
+class ToeplitzMatrix;
+
+template< typename Type             // Data type of the matrix
+        , typename Tag = Group0 >   // Type tag
+class HankelMatrix;
+
+template< typename Type             // Data type of the matrix
+        , typename Tag = Group0 >   // Type tag
+class CirculantMatrix;
+
+template< typename Type             // Data type of the matrix
+        , typename Tag = Group0 >   // Type tag
+class BlockDiagonalMatrix;
+
 template< typename Type                   // Data type of the vector
         , bool TF = defaultTransposeFlag  // Transpose flag
         , typename Tag = Group0 >         // Type tag
@@ -0,0 +1,2048 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/HODLRMatrix.h
+//  \brief Header file for the implementation of a hierarchical off-diagonal low-rank matrix
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_HODLRMATRIX_H_
+#define _BLAZE_MATH_DENSE_HODLRMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/dense/QR.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/lapack/geqrf.h>
+#include <blaze/math/lapack/gesdd.h>
+#include <blaze/math/lapack/getrf.h>
+#include <blaze/math/lapack/getrs.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup hodlr_matrix HODLRMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Hierarchical off-diagonal low-rank (HODLR) approximation of a square dense matrix.
+// \ingroup hodlr_matrix
+//
+// The HODLRMatrix class template is a compressed, read-only representation of a square dense
+// matrix whose off-diagonal blocks are numerically low-rank, as for instance the kernel matrices
+// of Gaussian processes or the system matrices of boundary element methods. The type of the
+// elements and the group tag of the matrix can be specified via the two template parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, typename Tag >
+   class HODLRMatrix;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. HODLRMatrix can be used with \c float,
+//          \c double, \c complex<float>, and \c complex<double>.
+//  - Tag : optional type parameter to tag the matrix. The default type is \a blaze::Group0.
+//          See \ref grouping_tagging for details.
+//
+// The index range of the matrix is recursively bisected into a complete binary tree. The
+// diagonal blocks of the leaves (which contain at most \a leafSize rows) are stored as dense
+// matrices, the two off-diagonal blocks of every inner node are stored as low-rank factors
+// \f$ A_{12} \approx U_{12} V_{12}^T \f$ and \f$ A_{21} \approx U_{21} V_{21}^T \f$. The ranks
+// are chosen adaptively such that every off-diagonal block is approximated with the given
+// relative accuracy in the Frobenius norm. In case the ranks are bounded by \f$ k \f$, the
+// matrix requires \f$ O(kN \log N) \f$ memory and the multiplication with a vector requires
+// \f$ O(kN \log N) \f$ operations.
+//
+// A HODLRMatrix can be created from an entry generator, i.e. a function that returns the element
+// \f$ (i,j) \f$ of the matrix. In this case the off-diagonal blocks are compressed by adaptive
+// cross approximation (ACA) with partial pivoting, which only evaluates \f$ O(k(m+n)) \f$ of
+// the elements of a \f$ m \times n \f$ block. Thus the dense matrix is never formed. Since the
+// blocks are compressed in parallel, the generator must be safe to be called concurrently:
+
+   \code
+   using blaze::HODLRMatrix;
+
+   const size_t N( 200000UL );
+   std::vector<double> points( N );
+   // ... Initialization of the (sorted) points
+
+   const auto kernel = [&points]( size_t i, size_t j ) {
+      return std::exp( -std::abs( points[i] - points[j] ) ) + ( i == j ? 1E-2 : 0.0 );
+   };
+
+   HODLRMatrix<double> A( N, kernel, 1E-8 );  // Compression with accuracy 1E-8 and leaf size 64
+   HODLRMatrix<double> B( N, kernel, 1E-6, 128UL );  // Compression with leaf size 128
+   \endcode
+
+// Alternatively, a HODLRMatrix can be created from an existing dense matrix. In this case the
+// off-diagonal blocks are compressed by an adaptive randomized range finder, which is based on
+// dense matrix/dense matrix multiplications with random sample matrices:
+
+   \code
+   blaze::DynamicMatrix<double> K( 4096UL, 4096UL );
+   // ... Initialization
+
+   HODLRMatrix<double> C( K, 1E-10 );
+   \endcode
+
+// In both cases, the ranks of the factors are finally truncated by means of a QR decomposition
+// of both factors and a singular value decomposition of the small core matrix. Note that the
+// quality of the compression depends on the ordering of the indices: for kernel matrices the
+// points should be sorted such that neighboring indices refer to neighboring points (for
+// instance along a space-filling curve).
+//
+// The matrix can be multiplied with dense vectors and dense matrices. After the factorization
+// of the matrix by means of the factorize() function, linear systems can be solved in
+// \f$ O(kN \log N) \f$ operations. The factorization applies the Sherman-Morrison-Woodbury
+// formula recursively and requires \f$ O(k^2 N \log^2 N) \f$ operations:
+
+   \code
+   blaze::DynamicVector<double> x( N ), y, z;
+   blaze::DynamicMatrix<double,blaze::columnMajor> X( N, 16UL ), Y;
+   // ... Initialization
+
+   y = A * x;           // Approximate matrix/vector multiplication
+   multiply( A, x, y ); // In-place approximate matrix/vector multiplication
+   Y = A * X;           // Approximate matrix/matrix multiplication
+
+   A.factorize();       // Approximate factorization of the matrix
+   solve( A, z, y );    // Approximate solution of the linear system A*z=y
+   \endcode
+
+// The leaf blocks are processed by the dense matrix kernels of Blaze. In case SMP parallelization
+// is enabled, the compression, the multiplications, the factorization and the solution are
+// parallelized over the subtrees of the tree, whereas the few large off-diagonal blocks close
+// to the root are processed by the parallel dense matrix kernels.
+//
+// Since the matrix is stored implicitly, HODLRMatrix is not a dense matrix in the sense of the
+// DenseMatrix base class. The matrix() function returns the (approximated) matrix as dense
+// matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+class HODLRMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This        = HODLRMatrix<Type,Tag>;  //!< Type of this HODLRMatrix instance.
+   using ElementType = Type;                   //!< Type of the matrix elements.
+   using TagType     = Tag;                    //!< Tag type of this HODLRMatrix instance.
+
+   //! Type of the (approximated) matrix as dense matrix.
+   using ResultType = DynamicMatrix<Type,columnMajor,AlignedAllocator<Type>,Tag>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline HODLRMatrix();
+
+   template< typename F >
+   inline HODLRMatrix( size_t n, F&& entry, double tolerance=1E-8, size_t leafSize=64UL );
+
+   template< typename MT, bool SO >
+   explicit inline HODLRMatrix( const DenseMatrix<MT,SO>& A,
+                                double tolerance=1E-8, size_t leafSize=64UL );
+
+   HODLRMatrix( const HODLRMatrix& ) = default;
+   HODLRMatrix( HODLRMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~HODLRMatrix() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   HODLRMatrix& operator=( const HODLRMatrix& ) & = default;
+   HODLRMatrix& operator=( HODLRMatrix&& ) & = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Type operator()( size_t i, size_t j ) const;
+   inline Type at( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t levels() const noexcept;
+   inline size_t leafSize() const noexcept;
+   inline double tolerance() const noexcept;
+   inline size_t rank() const noexcept;
+   inline size_t bytes() const noexcept;
+   inline bool   isFactorized() const noexcept;
+   inline void   swap( HODLRMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Factorization functions*********************************************************************
+   /*!\name Factorization functions */
+   //@{
+   void factorize();
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion functions************************************************************************
+   /*!\name Conversion functions */
+   //@{
+   ResultType matrix() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Computation functions***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename VT1, typename VT2 >
+   void apply( const VT1& x, VT2& y ) const;
+
+   template< typename VT >
+   void substitute( VT& x ) const;
+   /*! \endcond */
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using Block = DynamicMatrix<Type,columnMajor>;  //!< Type of the dense blocks and factors.
+   using BT    = UnderlyingBuiltin_t<Type>;        //!< Underlying builtin element type.
+   //**********************************************************************************************
+
+   //**Node****************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief A single node of the cluster tree.
+   //
+   // The leaves store the dense diagonal block \a D, the inner nodes store the low-rank factors
+   // of the off-diagonal blocks \f$ A_{12} \approx U_{12} V_{12}^T \f$ and \f$ A_{21} \approx
+   // U_{21} V_{21}^T \f$. After the factorization, \a LU contains the LU factors of \a D (leaves)
+   // or of the Woodbury core matrix (inner nodes), and \a Y12 and \a Y21 contain the factors
+   // \f$ A_{11}^{-1} U_{12} \f$ and \f$ A_{22}^{-1} U_{21} \f$.
+   */
+   struct Node
+   {
+      size_t begin = 0UL;  //!< The index of the first row/column of the node.
+      size_t size  = 0UL;  //!< The number of rows/columns of the node.
+
+      Block D;                        //!< The dense diagonal block of a leaf.
+      Block U12, V12;                 //!< The factors of the upper off-diagonal block.
+      Block U21, V21;                 //!< The factors of the lower off-diagonal block.
+      Block LU;                       //!< The LU factors of the leaf or the core matrix.
+      Block Y12, Y21;                 //!< The solved factors of the off-diagonal blocks.
+      std::vector<blas_int_t> ipiv;  //!< The pivot indices of the LU factors.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   inline void   initialize( size_t n, double tolerance, size_t leafSize );
+   inline bool   isLeaf( size_t i ) const noexcept;
+   inline size_t firstNode( size_t level ) const noexcept;
+   inline size_t cutLevel() const noexcept;
+   inline bool   isParallel( size_t work ) const noexcept;
+
+   template< typename OP >
+   inline void parallelFor( size_t begin, size_t end, OP op ) const;
+
+   template< typename F >
+   void aca( F& entry, size_t rowBegin, size_t m, size_t colBegin, size_t n,
+             Block& U, Block& V ) const;
+
+   template< typename MT >
+   void randomized( const MT& A, size_t rowBegin, size_t m, size_t colBegin, size_t n,
+                    Block& U, Block& V, size_t seed ) const;
+
+   void recompress( Block& U, Block& V ) const;
+
+   template< bool Serial, typename VT1, typename VT2 >
+   void multiplyCoupling( size_t i, const VT1& x, VT2& y ) const;
+
+   template< bool Serial, typename VT1, typename VT2 >
+   void multiplyNode( size_t i, const VT1& x, VT2& y ) const;
+
+   template< bool Serial >
+   void factorizeCoupling( size_t i );
+
+   template< bool Serial >
+   void factorizeNode( size_t i );
+
+   template< bool Serial, typename VT >
+   void substituteCoupling( size_t i, VT& x, size_t offset ) const;
+
+   template< bool Serial, typename VT >
+   void substituteNode( size_t i, VT& x, size_t offset ) const;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t            n_;           //!< The number of rows and columns of the matrix.
+   size_t            leafSize_;    //!< The maximum number of rows/columns of a leaf.
+   size_t            levels_;      //!< The number of levels of inner nodes.
+   double            tolerance_;   //!< The relative accuracy of the off-diagonal blocks.
+   bool              factorized_;  //!< \a true in case the matrix has been factorized.
+   std::vector<Node> nodes_;       //!< The nodes of the cluster tree in breadth-first order.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a view on the given range of elements of a dense vector.
+// \ingroup hodlr_matrix
+*/
+template< typename VT, bool TF >
+inline decltype(auto) hodlrRows( DenseVector<VT,TF>& v, size_t begin, size_t size )
+{
+   return subvector( *v, begin, size, unchecked );
+}
+
+template< typename VT, bool TF >
+inline decltype(auto) hodlrRows( const DenseVector<VT,TF>& v, size_t begin, size_t size )
+{
+   return subvector( *v, begin, size, unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a view on the given range of rows of a dense matrix.
+// \ingroup hodlr_matrix
+*/
+template< typename MT, bool SO >
+inline decltype(auto) hodlrRows( DenseMatrix<MT,SO>& m, size_t begin, size_t size )
+{
+   return submatrix( *m, begin, 0UL, size, (*m).columns(), unchecked );
+}
+
+template< typename MT, bool SO >
+inline decltype(auto) hodlrRows( const DenseMatrix<MT,SO>& m, size_t begin, size_t size )
+{
+   return submatrix( *m, begin, 0UL, size, (*m).columns(), unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of columns of a dense vector or dense matrix.
+// \ingroup hodlr_matrix
+*/
+template< typename VT, bool TF >
+inline size_t hodlrColumns( const DenseVector<VT,TF>& /*v*/ ) noexcept
+{
+   return 1UL;
+}
+
+template< typename MT, bool SO >
+inline size_t hodlrColumns( const DenseMatrix<MT,SO>& m ) noexcept
+{
+   return (*m).columns();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a temporary with the given number of rows and the columns of the given operand.
+// \ingroup hodlr_matrix
+*/
+template< typename Type, typename VT, bool TF >
+inline DynamicVector<Type> hodlrTemporary( const DenseVector<VT,TF>& /*v*/, size_t rows )
+{
+   return DynamicVector<Type>( rows );
+}
+
+template< typename Type, typename MT, bool SO >
+inline DynamicMatrix<Type,columnMajor> hodlrTemporary( const DenseMatrix<MT,SO>& m, size_t rows )
+{
+   return DynamicMatrix<Type,columnMajor>( rows, (*m).columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Marks the given expression for serial evaluation in case \a Serial is \a true.
+// \ingroup hodlr_matrix
+//
+// The kernels of HODLRMatrix are either executed from within a parallel section (in which case
+// all assignments must be serial) or by the calling thread (in which case the assignments may
+// use the parallel dense matrix kernels).
+*/
+template< bool Serial, typename T, EnableIf_t< Serial >* = nullptr >
+inline decltype(auto) hodlrSerial( const T& expr )
+{
+   return serial( expr );
+}
+
+template< bool Serial, typename T, EnableIf_t< !Serial >* = nullptr >
+inline const T& hodlrSerial( const T& expr )
+{
+   return expr;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a uniformly distributed random number in the range \f$ [-1..1) \f$.
+// \ingroup hodlr_matrix
+*/
+template< typename T, typename G, EnableIf_t< !IsComplex_v<T> >* = nullptr >
+inline T hodlrRandom( G& generator )
+{
+   std::uniform_real_distribution<T> dist( T(-1), T(1) );
+   return dist( generator );
+}
+
+template< typename T, typename G, EnableIf_t< IsComplex_v<T> >* = nullptr >
+inline T hodlrRandom( G& generator )
+{
+   using BT = UnderlyingBuiltin_t<T>;
+   std::uniform_real_distribution<BT> dist( BT(-1), BT(1) );
+   const BT re( dist( generator ) );
+   return T( re, dist( generator ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for HODLRMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline HODLRMatrix<Type,Tag>::HODLRMatrix()
+   : n_         ( 0UL )    // The number of rows and columns of the matrix
+   , leafSize_  ( 64UL )   // The maximum number of rows/columns of a leaf
+   , levels_    ( 0UL )    // The number of levels of inner nodes
+   , tolerance_ ( 1E-8 )   // The relative accuracy of the off-diagonal blocks
+   , factorized_( false )  // true in case the matrix has been factorized
+   , nodes_     ()         // The nodes of the cluster tree in breadth-first order
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compression of the matrix given by an entry generator.
+//
+// \param n The number of rows and columns of the matrix.
+// \param entry The entry generator, which returns the element \f$ (i,j) \f$ for \a entry(i,j).
+// \param tolerance The relative accuracy of the off-diagonal blocks in the Frobenius norm.
+// \param leafSize The maximum number of rows and columns of the dense diagonal blocks.
+// \exception std::invalid_argument Invalid tolerance or leaf size.
+//
+// This constructor compresses the \a n-by-\a n matrix defined by the given entry generator. The
+// dense diagonal blocks are evaluated completely, the off-diagonal blocks are compressed by
+// adaptive cross approximation with partial pivoting. In case SMP parallelization is enabled,
+// the blocks are compressed in parallel and the generator is called concurrently.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< typename F >    // Type of the entry generator
+inline HODLRMatrix<Type,Tag>::HODLRMatrix( size_t n, F&& entry, double tolerance, size_t leafSize )
+   : HODLRMatrix()
+{
+   initialize( n, tolerance, leafSize );
+
+   const auto compress = [this,&entry]( size_t i )
+   {
+      Node& node( nodes_[i] );
+
+      if( isLeaf( i ) ) {
+         node.D.resize( node.size, node.size, false );
+         for( size_t j=0UL; j<node.size; ++j ) {
+            for( size_t k=0UL; k<node.size; ++k ) {
+               node.D(k,j) = entry( node.begin+k, node.begin+j );
+            }
+         }
+      }
+      else {
+         const Node& left ( nodes_[2UL*i+1UL] );
+         const Node& right( nodes_[2UL*i+2UL] );
+         aca( entry, left.begin, left.size, right.begin, right.size, node.U12, node.V12 );
+         aca( entry, right.begin, right.size, left.begin, left.size, node.U21, node.V21 );
+      }
+   };
+
+   if( isParallel( n_ ) ) {
+      parallelFor( 0UL, nodes_.size(), compress );
+   }
+   else {
+      for( size_t i=0UL; i<nodes_.size(); ++i ) {
+         compress( i );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compression of a square dense matrix.
+//
+// \param A The dense matrix to be compressed.
+// \param tolerance The relative accuracy of the off-diagonal blocks in the Frobenius norm.
+// \param leafSize The maximum number of rows and columns of the dense diagonal blocks.
+// \exception std::invalid_argument Invalid non-square matrix.
+// \exception std::invalid_argument Invalid tolerance or leaf size.
+//
+// This constructor compresses the given square dense matrix. The diagonal blocks are copied,
+// the off-diagonal blocks are compressed by an adaptive randomized range finder. In case SMP
+// parallelization is enabled, the blocks are compressed in parallel.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order of the dense matrix
+inline HODLRMatrix<Type,Tag>::HODLRMatrix( const DenseMatrix<MT,SO>& A,
+                                           double tolerance, size_t leafSize )
+   : HODLRMatrix()
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix" );
+   }
+
+   initialize( (*A).rows(), tolerance, leafSize );
+
+   CompositeType_t<MT> B( *A );
+
+   const auto compress = [this,&B]( size_t i )
+   {
+      Node& node( nodes_[i] );
+
+      if( isLeaf( i ) ) {
+         node.D = serial( submatrix( B, node.begin, node.begin, node.size, node.size, unchecked ) );
+      }
+      else {
+         const Node& left ( nodes_[2UL*i+1UL] );
+         const Node& right( nodes_[2UL*i+2UL] );
+         randomized( B, left.begin, left.size, right.begin, right.size,
+                     node.U12, node.V12, 2UL*i+1UL );
+         randomized( B, right.begin, right.size, left.begin, left.size,
+                     node.U21, node.V21, 2UL*i+2UL );
+      }
+   };
+
+   if( isParallel( n_ ) ) {
+      parallelFor( 0UL, nodes_.size(), compress );
+   }
+   else {
+      for( size_t i=0UL; i<nodes_.size(); ++i ) {
+         compress( i );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the (approximated) matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The (approximated) element \f$ (i,j) \f$.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline Type HODLRMatrix<Type,Tag>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   size_t k( 0UL );
+
+   while( !isLeaf( k ) )
+   {
+      const Node& node ( nodes_[k] );
+      const Node& right( nodes_[2UL*k+2UL] );
+
+      const bool lowerRow   ( i >= right.begin );
+      const bool lowerColumn( j >= right.begin );
+
+      if( !lowerRow && lowerColumn ) {
+         return dot( row( node.U12, i-node.begin, unchecked ),
+                     row( node.V12, j-right.begin, unchecked ) );
+      }
+      else if( lowerRow && !lowerColumn ) {
+         return dot( row( node.U21, i-right.begin, unchecked ),
+                     row( node.V21, j-node.begin, unchecked ) );
+      }
+
+      k = 2UL*k + ( lowerRow ? 2UL : 1UL );
+   }
+
+   const Node& leaf( nodes_[k] );
+   return leaf.D( i-leaf.begin, j-leaf.begin );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the (approximated) matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The (approximated) element \f$ (i,j) \f$.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline Type HODLRMatrix<Type,Tag>::at( size_t i, size_t j ) const
+{
+   if( i >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t HODLRMatrix<Type,Tag>::rows() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t HODLRMatrix<Type,Tag>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of levels of inner nodes of the cluster tree.
+//
+// \return The number of levels of inner nodes (0 in case the matrix consists of a single leaf).
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t HODLRMatrix<Type,Tag>::levels() const noexcept
+{
+   return levels_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum number of rows and columns of the dense diagonal blocks.
+//
+// \return The maximum size of the leaves.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t HODLRMatrix<Type,Tag>::leafSize() const noexcept
+{
+   return leafSize_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the relative accuracy of the off-diagonal blocks.
+//
+// \return The relative accuracy in the Frobenius norm.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline double HODLRMatrix<Type,Tag>::tolerance() const noexcept
+{
+   return tolerance_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum rank of all off-diagonal blocks.
+//
+// \return The maximum rank of the off-diagonal blocks.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t HODLRMatrix<Type,Tag>::rank() const noexcept
+{
+   size_t maxRank( 0UL );
+
+   for( const Node& node : nodes_ ) {
+      maxRank = max( maxRank, node.U12.columns(), node.U21.columns() );
+   }
+
+   return maxRank;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes occupied by the compressed matrix.
+//
+// \return The number of bytes of the dense blocks and the low-rank factors.
+//
+// The factors computed by the factorize() function are included.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t HODLRMatrix<Type,Tag>::bytes() const noexcept
+{
+   size_t elements( 0UL );
+
+   for( const Node& node : nodes_ ) {
+      for( const Block* block : { &node.D, &node.U12, &node.V12, &node.U21, &node.V21,
+                                  &node.LU, &node.Y12, &node.Y21 } ) {
+         elements += block->rows() * block->columns();
+      }
+   }
+
+   return elements * sizeof( Type );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix has been factorized.
+//
+// \return \a true in case the matrix has been factorized, \a false if not.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline bool HODLRMatrix<Type,Tag>::isFactorized() const noexcept
+{
+   return factorized_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two HODLR matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void HODLRMatrix<Type,Tag>::swap( HODLRMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( n_, m.n_ );
+   swap( leafSize_, m.leafSize_ );
+   swap( levels_, m.levels_ );
+   swap( tolerance_, m.tolerance_ );
+   swap( factorized_, m.factorized_ );
+   swap( nodes_, m.nodes_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setup of the cluster tree.
+//
+// \param n The number of rows and columns of the matrix.
+// \param tolerance The relative accuracy of the off-diagonal blocks.
+// \param leafSize The maximum number of rows and columns of the leaves.
+// \return void
+// \exception std::invalid_argument Invalid tolerance or leaf size.
+//
+// The index range is bisected until all leaves contain at most \a leafSize indices. Since all
+// leaves are on the same level, node \a i has the children \a 2i+1 and \a 2i+2.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void HODLRMatrix<Type,Tag>::initialize( size_t n, double tolerance, size_t leafSize )
+{
+   if( leafSize == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid leaf size" );
+   }
+
+   if( !( tolerance >= 0.0 ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid tolerance" );
+   }
+
+   n_         = n;
+   leafSize_  = leafSize;
+   tolerance_ = tolerance;
+   levels_    = 0UL;
+
+   while( ( ( n_ - 1UL ) >> levels_ ) + 1UL > leafSize_ && n_ > 0UL ) {
+      ++levels_;
+   }
+
+   nodes_.resize( firstNode( levels_+1UL ) );
+   nodes_[0UL].begin = 0UL;
+   nodes_[0UL].size  = n_;
+
+   for( size_t i=0UL; i<firstNode( levels_ ); ++i ) {
+      const Node& node( nodes_[i] );
+      nodes_[2UL*i+1UL].begin = node.begin;
+      nodes_[2UL*i+1UL].size  = node.size / 2UL;
+      nodes_[2UL*i+2UL].begin = node.begin + node.size / 2UL;
+      nodes_[2UL*i+2UL].size  = node.size - node.size / 2UL;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given node is a leaf.
+//
+// \param i The index of the node.
+// \return \a true in case the node is a leaf, \a false if not.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline bool HODLRMatrix<Type,Tag>::isLeaf( size_t i ) const noexcept
+{
+   return i >= firstNode( levels_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the first node of the given level.
+//
+// \param level The level of the cluster tree (0 for the root).
+// \return The index of the first node of the level.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t HODLRMatrix<Type,Tag>::firstNode( size_t level ) const noexcept
+{
+   return ( 1UL << level ) - 1UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the level at which the cluster tree is split into parallel subtrees.
+//
+// \return The level of the roots of the parallel subtrees.
+//
+// The level is chosen such that there are at least four subtrees per thread, which allows a
+// dynamic load balancing of the subtrees.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t HODLRMatrix<Type,Tag>::cutLevel() const noexcept
+{
+   const size_t threads( getNumThreads() );
+   size_t level( 0UL );
+
+   while( level < levels_ && ( 1UL << level ) < 4UL*threads ) {
+      ++level;
+   }
+
+   return level;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether an operation of the given size should be executed in parallel.
+//
+// \param work The number of elements of the target of the operation.
+// \return \a true in case the operation should be executed in parallel, \a false if not.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline bool HODLRMatrix<Type,Tag>::isParallel( size_t work ) const noexcept
+{
+   return levels_ > 0UL && getNumThreads() > 1UL && work >= SMP_DMATDVECMULT_THRESHOLD &&
+          !isSerialSectionActive() && !isParallelSectionActive();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel execution of the given operation for a range of nodes.
+//
+// \param begin The index of the first node.
+// \param end The index one past the last node.
+// \param op The operation to be executed for every node.
+// \return void
+//
+// The nodes are distributed dynamically among the threads. The operation is executed within
+// a parallel section and therefore must not use any parallel kernel.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< typename OP >   // Type of the operation
+inline void HODLRMatrix<Type,Tag>::parallelFor( size_t begin, size_t end, OP op ) const
+{
+   BLAZE_PARALLEL_SECTION
+   {
+      smpFor( end - begin, [&op,begin]( size_t k ) { op( begin + k ); } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPRESSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Adaptive cross approximation of an off-diagonal block.
+//
+// \param entry The entry generator.
+// \param rowBegin The index of the first row of the block.
+// \param m The number of rows of the block.
+// \param colBegin The index of the first column of the block.
+// \param n The number of columns of the block.
+// \param U The resulting left factor.
+// \param V The resulting right factor.
+// \return void
+//
+// This function computes the factors of the approximation \f$ A \approx U V^T \f$ of the given
+// block by adaptive cross approximation with partial pivoting. In every step, the residual of
+// the pivot row and of the column of its largest element are evaluated and appended to the
+// factors. The next pivot row is the row of the largest element of the new column. The
+// iteration stops as soon as the norms of three consecutive rank-1 terms fall below the
+// tolerance relative to the estimated Frobenius norm of the approximation. Afterwards the rank
+// is truncated by means of the recompress() function. The function is executed within parallel
+// sections and therefore only uses serial kernels.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< typename F >    // Type of the entry generator
+void HODLRMatrix<Type,Tag>::aca( F& entry, size_t rowBegin, size_t m, size_t colBegin, size_t n,
+                                 Block& U, Block& V ) const
+{
+   const size_t maxRank( min( m, n ) );
+
+   std::vector< DynamicVector<Type> > us, vs;
+   std::vector<bool> used( m, false );
+   DynamicVector<Type> r( n ), c( m );
+
+   BT norm2( 0 );
+   size_t pivot( 0UL ), failures( 0UL ), converged( 0UL );
+
+   while( us.size() < maxRank )
+   {
+      used[pivot] = true;
+
+      // Computing the residual of the pivot row
+      for( size_t j=0UL; j<n; ++j ) {
+         r[j] = entry( rowBegin+pivot, colBegin+j );
+      }
+      for( size_t l=0UL; l<us.size(); ++l ) {
+         r -= serial( us[l][pivot] * vs[l] );
+      }
+
+      size_t jmax( 0UL );
+      for( size_t j=1UL; j<n; ++j ) {
+         if( abs( r[j] ) > abs( r[jmax] ) ) jmax = j;
+      }
+
+      // Skipping rows that are already approximated exactly
+      if( isDefault<strict>( r[jmax] ) )
+      {
+         size_t next( pivot );
+         while( next < m && used[next] ) ++next;
+         if( next == m || ++failures > 8UL ) break;
+         pivot = next;
+         continue;
+      }
+
+      r = serial( r * ( Type(1) / r[jmax] ) );
+
+      // Computing the residual of the pivot column
+      for( size_t i=0UL; i<m; ++i ) {
+         c[i] = entry( rowBegin+i, colBegin+jmax );
+      }
+      for( size_t l=0UL; l<us.size(); ++l ) {
+         c -= serial( vs[l][jmax] * us[l] );
+      }
+
+      // Updating the Frobenius norm of the approximation
+      const BT cnorm2( real( ctrans( c ) * c ) );
+      const BT rnorm2( real( ctrans( r ) * r ) );
+
+      BT cross( 0 );
+      for( size_t l=0UL; l<us.size(); ++l ) {
+         cross += real( ( ctrans( us[l] ) * c ) * conj( ctrans( vs[l] ) * r ) );
+      }
+      norm2 += BT(2)*cross + cnorm2*rnorm2;
+
+      us.emplace_back( serial( c ) );
+      vs.emplace_back( serial( r ) );
+
+      // Stopping after three consecutive steps below the tolerance
+      if( cnorm2*rnorm2 > BT( tolerance_*tolerance_ ) * norm2 ) converged = 0UL;
+      else if( ++converged == 3UL ) break;
+
+      // Selecting the next pivot row
+      size_t next( m );
+      for( size_t i=0UL; i<m; ++i ) {
+         if( !used[i] && ( next == m || abs( c[i] ) > abs( c[next] ) ) ) next = i;
+      }
+      if( next == m ) break;
+      pivot = next;
+   }
+
+   const size_t k( us.size() );
+
+   U.resize( m, k, false );
+   V.resize( n, k, false );
+
+   for( size_t l=0UL; l<k; ++l ) {
+      column( U, l, unchecked ) = serial( us[l] );
+      column( V, l, unchecked ) = serial( vs[l] );
+   }
+
+   recompress( U, V );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomized compression of an off-diagonal block of a dense matrix.
+//
+// \param A The dense matrix.
+// \param rowBegin The index of the first row of the block.
+// \param m The number of rows of the block.
+// \param colBegin The index of the first column of the block.
+// \param n The number of columns of the block.
+// \param U The resulting left factor.
+// \param V The resulting right factor.
+// \param seed The seed of the random sample matrices.
+// \return void
+//
+// This function computes the factors of the approximation \f$ A \approx U V^T \f$ of the given
+// block by a randomized range finder: the block is multiplied with a random sample matrix, the
+// result is orthonormalized (\f$ Q \f$), and the block is projected onto its range
+// (\f$ A \approx Q Q^H A \f$). The number of samples is doubled until the error, which is
+// estimated by means of eight random probe vectors, falls below the tolerance relative to
+// the Frobenius norm of the block. Afterwards the rank is truncated by means of the recompress()
+// function. The function is executed within parallel sections and therefore only uses serial
+// kernels.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< typename MT >   // Type of the dense matrix
+void HODLRMatrix<Type,Tag>::randomized( const MT& A, size_t rowBegin, size_t m,
+                                        size_t colBegin, size_t n,
+                                        Block& U, Block& V, size_t seed ) const
+{
+   constexpr size_t probes( 8UL );
+
+   const auto B( submatrix( A, rowBegin, colBegin, m, n, unchecked ) );
+   const size_t mindim( min( m, n ) );
+
+   std::mt19937 generator( static_cast<unsigned int>( seed ) );
+
+   // Variance of the random numbers in [-1..1) (real and imaginary part)
+   const BT variance( IsComplex_v<Type> ? BT(2)/BT(3) : BT(1)/BT(3) );
+
+   const BT normB2( real( sqrNorm( B ) ) );
+
+   if( normB2 == BT(0) ) {
+      U.resize( m, 0UL, false );
+      V.resize( n, 0UL, false );
+      return;
+   }
+
+   Block omega, Q, C, W, R;
+   DynamicVector<Type> tau;
+   size_t k( min( 16UL, mindim ) );
+
+   while( true )
+   {
+      omega.resize( n, k, false );
+      for( size_t j=0UL; j<k; ++j ) {
+         for( size_t i=0UL; i<n; ++i ) {
+            omega(i,j) = hodlrRandom<Type>( generator );
+         }
+      }
+
+      // Orthonormalization of the sample Q = orth( B * omega )
+      Q = serial( B * omega );
+      tau.resize( k, false );
+      geqrf( Q, tau.data() );
+      qr_backend( Q, tau.data() );
+
+      C = serial( ctrans( Q ) * B );
+
+      if( k == mindim ) break;
+
+      // Estimation of the error of the projection
+      W.resize( n, probes, false );
+      for( size_t j=0UL; j<probes; ++j ) {
+         for( size_t i=0UL; i<n; ++i ) {
+            W(i,j) = hodlrRandom<Type>( generator );
+         }
+      }
+
+      R = serial( B * W );
+      R -= serial( Q * ( C * W ) );
+
+      const BT error2( real( sqrNorm( R ) ) / ( variance * BT( probes ) ) );
+      if( error2 <= BT( tolerance_*tolerance_ ) * normB2 ) break;
+
+      k = min( 2UL*k, mindim );
+   }
+
+   U = serial( Q );
+   V = serial( trans( C ) );
+
+   recompress( U, V );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Truncation of the rank of a low-rank approximation.
+//
+// \param U The left factor of the approximation \f$ U V^T \f$.
+// \param V The right factor of the approximation \f$ U V^T \f$.
+// \return void
+//
+// This function computes the QR decompositions \f$ U = Q_U R_U \f$ and \f$ V = Q_V R_V \f$ and
+// the singular value decomposition \f$ R_U R_V^T = W \Sigma Z \f$ and truncates all singular
+// values whose contribution to the Frobenius norm is below the tolerance. The resulting factors
+// are \f$ U = Q_U W_r \Sigma_r \f$ and \f$ V = Q_V Z_r^T \f$. The function is executed within
+// parallel sections and therefore only uses serial kernels.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+void HODLRMatrix<Type,Tag>::recompress( Block& U, Block& V ) const
+{
+   const size_t m( U.rows() );
+   const size_t n( V.rows() );
+   const size_t k( U.columns() );
+
+   if( k == 0UL || k > m || k > n ) {
+      return;
+   }
+
+   DynamicVector<Type> tau( k );
+   Block RU( k, k, Type() ), RV( k, k, Type() );
+
+   geqrf( U, tau.data() );
+   for( size_t j=0UL; j<k; ++j ) {
+      for( size_t i=0UL; i<=j; ++i ) {
+         RU(i,j) = U(i,j);
+      }
+   }
+   qr_backend( U, tau.data() );
+
+   geqrf( V, tau.data() );
+   for( size_t j=0UL; j<k; ++j ) {
+      for( size_t i=0UL; i<=j; ++i ) {
+         RV(i,j) = V(i,j);
+      }
+   }
+   qr_backend( V, tau.data() );
+
+   Block core( serial( RU * trans( RV ) ) ), W, Z;
+   DynamicVector<BT> s;
+
+   gesdd( core, W, s, Z, 'S' );
+
+   BT total( 0 ), tail( 0 );
+   for( size_t l=0UL; l<k; ++l ) {
+      total += s[l] * s[l];
+   }
+
+   size_t r( k );
+   while( r > 0UL && tail + s[r-1UL]*s[r-1UL] <= BT( tolerance_*tolerance_ ) * total ) {
+      --r;
+      tail += s[r] * s[r];
+   }
+
+   for( size_t l=0UL; l<r; ++l ) {
+      for( size_t i=0UL; i<k; ++i ) {
+         W(i,l) *= s[l];
+      }
+   }
+
+   U = serial( U * submatrix( W, 0UL, 0UL, k, r, unchecked ) );
+   V = serial( V * trans( submatrix( Z, 0UL, 0UL, r, k, unchecked ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FACTORIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Approximate factorization of the matrix.
+//
+// \return void
+// \exception std::invalid_argument Singular matrix.
+//
+// This function factorizes the matrix for the solution of linear systems by means of the solve()
+// function. Every leaf is LU decomposed. For every inner node, the off-diagonal blocks are
+// eliminated by the Sherman-Morrison-Woodbury formula
+
+      \f[ \left(\begin{array}{*{2}{c}}
+      A_{11}          & U_{12} V_{12}^T \\
+      U_{21} V_{21}^T & A_{22}          \\
+      \end{array}\right)^{-1} = D^{-1} - D^{-1} W K^{-1} Z^T D^{-1}, \f]
+
+// where \f$ D \f$ is the block diagonal matrix of the two children, \f$ W \f$ and \f$ Z \f$ are
+// composed of the factors, and \f$ K = I + Z^T D^{-1} W \f$ is a small core matrix, which is LU
+// decomposed. The nodes are factorized bottom-up. In case SMP parallelization is enabled, the
+// subtrees are factorized in parallel. In case a leaf or a core matrix is singular, a
+// \a std::invalid_argument exception is thrown and the matrix remains unfactorized.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+void HODLRMatrix<Type,Tag>::factorize()
+{
+   BLAZE_FUNCTION_TRACE;
+
+   factorized_ = false;
+
+   if( n_ == 0UL ) {
+      factorized_ = true;
+      return;
+   }
+
+   if( isParallel( n_ ) )
+   {
+      const size_t cut( cutLevel() );
+
+      parallelFor( firstNode( cut ), firstNode( cut+1UL ), [this]( size_t i ) {
+         factorizeNode<true>( i );
+      } );
+
+      for( size_t level=cut; level-- > 0UL; ) {
+         for( size_t i=firstNode( level ); i<firstNode( level+1UL ); ++i ) {
+            factorizeCoupling<false>( i );
+         }
+      }
+   }
+   else
+   {
+      factorizeNode<true>( 0UL );
+   }
+
+   for( const Node& node : nodes_ ) {
+      for( size_t i=0UL; i<node.LU.rows(); ++i ) {
+         if( isDefault<strict>( node.LU(i,i) ) ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Singular matrix" );
+         }
+      }
+   }
+
+   factorized_ = true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Factorization of the core matrix of an inner node.
+//
+// \param i The index of the inner node.
+// \return void
+//
+// This function expects that both children of the node have already been factorized.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< bool Serial >   // Serial evaluation flag
+void HODLRMatrix<Type,Tag>::factorizeCoupling( size_t i )
+{
+   Node& node( nodes_[i] );
+   const Node& left ( nodes_[2UL*i+1UL] );
+   const Node& right( nodes_[2UL*i+2UL] );
+
+   const size_t k1( node.U12.columns() );
+   const size_t k2( node.U21.columns() );
+
+   node.Y12 = serial( node.U12 );
+   node.Y21 = serial( node.U21 );
+   substituteNode<Serial>( 2UL*i+1UL, node.Y12, left.begin  );
+   substituteNode<Serial>( 2UL*i+2UL, node.Y21, right.begin );
+
+   node.LU.resize( k1+k2, k1+k2, false );
+
+   for( size_t j=0UL; j<k1+k2; ++j ) {
+      for( size_t l=0UL; l<k1+k2; ++l ) {
+         node.LU(l,j) = ( l == j ? Type(1) : Type(0) );
+      }
+   }
+
+   if( k1 > 0UL && k2 > 0UL ) {
+      submatrix( node.LU, 0UL, k1, k1, k2, unchecked ) =
+         hodlrSerial<Serial>( trans( node.V12 ) * node.Y21 );
+      submatrix( node.LU, k1, 0UL, k2, k1, unchecked ) =
+         hodlrSerial<Serial>( trans( node.V21 ) * node.Y12 );
+   }
+
+   node.ipiv.resize( k1+k2 );
+   getrf( node.LU, node.ipiv.data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Factorization of the subtree of the given node.
+//
+// \param i The index of the root of the subtree.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< bool Serial >   // Serial evaluation flag
+void HODLRMatrix<Type,Tag>::factorizeNode( size_t i )
+{
+   if( isLeaf( i ) ) {
+      Node& leaf( nodes_[i] );
+      leaf.LU = serial( leaf.D );
+      leaf.ipiv.resize( leaf.size );
+      getrf( leaf.LU, leaf.ipiv.data() );
+   }
+   else {
+      factorizeNode<Serial>( 2UL*i+1UL );
+      factorizeNode<Serial>( 2UL*i+2UL );
+      factorizeCoupling<Serial>( i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the (approximated) matrix as dense matrix.
+//
+// \return The dense matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+typename HODLRMatrix<Type,Tag>::ResultType HODLRMatrix<Type,Tag>::matrix() const
+{
+   ResultType A( n_, n_ );
+
+   for( size_t i=0UL; i<nodes_.size(); ++i )
+   {
+      const Node& node( nodes_[i] );
+
+      if( isLeaf( i ) ) {
+         submatrix( A, node.begin, node.begin, node.size, node.size, unchecked ) = node.D;
+      }
+      else {
+         const Node& left ( nodes_[2UL*i+1UL] );
+         const Node& right( nodes_[2UL*i+2UL] );
+         submatrix( A, left.begin, right.begin, left.size, right.size, unchecked ) =
+            node.U12 * trans( node.V12 );
+         submatrix( A, right.begin, left.begin, right.size, left.size, unchecked ) =
+            node.U21 * trans( node.V21 );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPUTATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of the matrix with a dense vector or dense matrix (\f$ y+=A*x \f$).
+//
+// \param x The dense vector or dense matrix operand.
+// \param y The target dense vector or dense matrix.
+// \return void
+//
+// In case SMP parallelization is enabled, the off-diagonal blocks of the upper levels of the
+// tree are multiplied by the parallel dense matrix kernels and the subtrees below are processed
+// in parallel.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< typename VT1    // Type of the operand
+        , typename VT2 >  // Type of the target
+void HODLRMatrix<Type,Tag>::apply( const VT1& x, VT2& y ) const
+{
+   if( n_ == 0UL ) {
+      return;
+   }
+
+   if( !isParallel( n_ * hodlrColumns( x ) ) ) {
+      multiplyNode<true>( 0UL, x, y );
+      return;
+   }
+
+   const size_t cut( cutLevel() );
+
+   for( size_t i=0UL; i<firstNode( cut ); ++i ) {
+      multiplyCoupling<false>( i, x, y );
+   }
+
+   parallelFor( firstNode( cut ), firstNode( cut+1UL ), [this,&x,&y]( size_t i ) {
+      multiplyNode<true>( i, x, y );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of the off-diagonal blocks of an inner node.
+//
+// \param i The index of the inner node.
+// \param x The dense vector or dense matrix operand.
+// \param y The target dense vector or dense matrix.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< bool Serial     // Serial evaluation flag
+        , typename VT1    // Type of the operand
+        , typename VT2 >  // Type of the target
+void HODLRMatrix<Type,Tag>::multiplyCoupling( size_t i, const VT1& x, VT2& y ) const
+{
+   const Node& node ( nodes_[i] );
+   const Node& left ( nodes_[2UL*i+1UL] );
+   const Node& right( nodes_[2UL*i+2UL] );
+
+   if( node.U12.columns() > 0UL ) {
+      auto y1( hodlrRows( y, left.begin, left.size ) );
+      y1 += hodlrSerial<Serial>(
+         node.U12 * ( trans( node.V12 ) * hodlrRows( x, right.begin, right.size ) ) );
+   }
+
+   if( node.U21.columns() > 0UL ) {
+      auto y2( hodlrRows( y, right.begin, right.size ) );
+      y2 += hodlrSerial<Serial>(
+         node.U21 * ( trans( node.V21 ) * hodlrRows( x, left.begin, left.size ) ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of the subtree of the given node.
+//
+// \param i The index of the root of the subtree.
+// \param x The dense vector or dense matrix operand.
+// \param y The target dense vector or dense matrix.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< bool Serial     // Serial evaluation flag
+        , typename VT1    // Type of the operand
+        , typename VT2 >  // Type of the target
+void HODLRMatrix<Type,Tag>::multiplyNode( size_t i, const VT1& x, VT2& y ) const
+{
+   if( isLeaf( i ) ) {
+      const Node& leaf( nodes_[i] );
+      auto yi( hodlrRows( y, leaf.begin, leaf.size ) );
+      yi += hodlrSerial<Serial>( leaf.D * hodlrRows( x, leaf.begin, leaf.size ) );
+   }
+   else {
+      multiplyCoupling<Serial>( i, x, y );
+      multiplyNode<Serial>( 2UL*i+1UL, x, y );
+      multiplyNode<Serial>( 2UL*i+2UL, x, y );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solution of a linear system with the factorized matrix (\f$ x=A^{-1}x \f$).
+//
+// \param x The right-hand side dense vector or dense matrix, which is overwritten by the solution.
+// \return void
+//
+// In case SMP parallelization is enabled, the subtrees are processed in parallel and the core
+// matrices of the upper levels of the tree are applied by the parallel dense matrix kernels.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< typename VT >   // Type of the right-hand side
+void HODLRMatrix<Type,Tag>::substitute( VT& x ) const
+{
+   BLAZE_INTERNAL_ASSERT( factorized_, "Unfactorized matrix detected" );
+
+   if( n_ == 0UL ) {
+      return;
+   }
+
+   if( !isParallel( n_ * hodlrColumns( x ) ) ) {
+      substituteNode<true>( 0UL, x, 0UL );
+      return;
+   }
+
+   const size_t cut( cutLevel() );
+
+   parallelFor( firstNode( cut ), firstNode( cut+1UL ), [this,&x]( size_t i ) {
+      substituteNode<true>( i, x, 0UL );
+   } );
+
+   for( size_t level=cut; level-- > 0UL; ) {
+      for( size_t i=firstNode( level ); i<firstNode( level+1UL ); ++i ) {
+         substituteCoupling<false>( i, x, 0UL );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of the Woodbury correction of an inner node.
+//
+// \param i The index of the inner node.
+// \param x The right-hand side, which already contains the solutions of both children.
+// \param offset The index of the row of the node that corresponds to the first row of \a x.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< bool Serial     // Serial evaluation flag
+        , typename VT >   // Type of the right-hand side
+void HODLRMatrix<Type,Tag>::substituteCoupling( size_t i, VT& x, size_t offset ) const
+{
+   const Node& node ( nodes_[i] );
+   const Node& left ( nodes_[2UL*i+1UL] );
+   const Node& right( nodes_[2UL*i+2UL] );
+
+   const size_t k1( node.U12.columns() );
+   const size_t k2( node.U21.columns() );
+
+   if( k1 + k2 == 0UL ) {
+      return;
+   }
+
+   auto x1( hodlrRows( x, left.begin-offset, left.size ) );
+   auto x2( hodlrRows( x, right.begin-offset, right.size ) );
+
+   auto t( hodlrTemporary<Type>( x, k1+k2 ) );
+   hodlrRows( t, 0UL, k1 ) = hodlrSerial<Serial>( trans( node.V12 ) * x2 );
+   hodlrRows( t, k1, k2 ) = hodlrSerial<Serial>( trans( node.V21 ) * x1 );
+
+   getrs( node.LU, t, 'N', node.ipiv.data() );
+
+   x1 -= hodlrSerial<Serial>( node.Y12 * hodlrRows( t, 0UL, k1 ) );
+   x2 -= hodlrSerial<Serial>( node.Y21 * hodlrRows( t, k1, k2 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solution of a linear system with the subtree of the given node.
+//
+// \param i The index of the root of the subtree.
+// \param x The right-hand side, which is overwritten by the solution.
+// \param offset The index of the row of the matrix that corresponds to the first row of \a x.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< bool Serial     // Serial evaluation flag
+        , typename VT >   // Type of the right-hand side
+void HODLRMatrix<Type,Tag>::substituteNode( size_t i, VT& x, size_t offset ) const
+{
+   if( isLeaf( i ) ) {
+      const Node& leaf( nodes_[i] );
+      auto xi( hodlrRows( x, leaf.begin-offset, leaf.size ) );
+      getrs( leaf.LU, xi, 'N', leaf.ipiv.data() );
+   }
+   else {
+      substituteNode<Serial>( 2UL*i+1UL, x, offset );
+      substituteNode<Serial>( 2UL*i+2UL, x, offset );
+      substituteCoupling<Serial>( i, x, offset );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HODLRMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name HODLRMatrix operators */
+//@{
+template< typename Type, typename Tag >
+void swap( HODLRMatrix<Type,Tag>& a, HODLRMatrix<Type,Tag>& b ) noexcept;
+
+template< typename Type, typename Tag, typename VT1, typename VT2 >
+void multiply( const HODLRMatrix<Type,Tag>& A, const DenseVector<VT1,columnVector>& x,
+               DenseVector<VT2,columnVector>& y );
+
+template< typename Type, typename Tag, typename MT1, bool SO1, typename MT2, bool SO2 >
+void multiply( const HODLRMatrix<Type,Tag>& A, const DenseMatrix<MT1,SO1>& X,
+               DenseMatrix<MT2,SO2>& Y );
+
+template< typename Type, typename Tag, typename VT1, typename VT2 >
+void solve( const HODLRMatrix<Type,Tag>& A, DenseVector<VT1,columnVector>& x,
+            const DenseVector<VT2,columnVector>& b );
+
+template< typename Type, typename Tag, typename MT1, bool SO1, typename MT2, bool SO2 >
+void solve( const HODLRMatrix<Type,Tag>& A, DenseMatrix<MT1,SO1>& X,
+            const DenseMatrix<MT2,SO2>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two HODLR matrices.
+// \ingroup hodlr_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type, typename Tag >
+inline void swap( HODLRMatrix<Type,Tag>& a, HODLRMatrix<Type,Tag>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a HODLR matrix with a dense column vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup hodlr_matrix
+//
+// \param A The HODLR matrix.
+// \param x The right-hand side dense column vector.
+// \param y The resulting dense column vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes the product of the given HODLR matrix and the dense column vector
+// \a x in \f$ O(kN \log N) \f$ operations. The resulting vector \a y is resized accordingly.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename VT1    // Type of the right-hand side dense vector
+        , typename VT2 >  // Type of the resulting dense vector
+void multiply( const HODLRMatrix<Type,Tag>& A, const DenseVector<VT1,columnVector>& x,
+               DenseVector<VT2,columnVector>& y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*x).size() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (*x).isAliased( &(*y) ) ) {
+      const DynamicVector<Type> x2( *x );
+      multiply( A, x2, y );
+      return;
+   }
+
+   CompositeType_t<VT1> x2( *x );
+
+   resize( *y, A.rows(), false );
+   reset( *y );
+
+   A.apply( x2, *y );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a HODLR matrix with a dense matrix (\f$ Y=A*X \f$).
+// \ingroup hodlr_matrix
+//
+// \param A The HODLR matrix.
+// \param X The right-hand side dense matrix.
+// \param Y The resulting dense matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the product of the given HODLR matrix and the dense matrix \a X in
+// \f$ O(kNM \log N) \f$ operations, where \a M is the number of columns of \a X. The resulting
+// matrix \a Y is resized accordingly.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT1    // Type of the right-hand side dense matrix
+        , bool SO1        // Storage order of the right-hand side dense matrix
+        , typename MT2    // Type of the resulting dense matrix
+        , bool SO2 >      // Storage order of the resulting dense matrix
+void multiply( const HODLRMatrix<Type,Tag>& A, const DenseMatrix<MT1,SO1>& X,
+               DenseMatrix<MT2,SO2>& Y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*X).rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (*X).isAliased( &(*Y) ) ) {
+      const DynamicMatrix<Type,columnMajor> X2( *X );
+      multiply( A, X2, Y );
+      return;
+   }
+
+   CompositeType_t<MT1> X2( *X );
+
+   resize( *Y, A.rows(), (*X).columns(), false );
+   reset( *Y );
+
+   A.apply( X2, *Y );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a HODLR matrix and a dense column
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup hodlr_matrix
+//
+// \param A The HODLR matrix.
+// \param x The right-hand side dense column vector.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename VT >   // Type of the right-hand side dense vector
+inline decltype(auto)
+   operator*( const HODLRMatrix<Type,Tag>& A, const DenseVector<VT,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = MultTrait_t< Type, ElementType_t<VT> >;
+
+   DynamicVector<ET,columnVector> y;
+   multiply( A, *x, y );
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a HODLR matrix and a dense matrix
+//        (\f$ Y=A*X \f$).
+// \ingroup hodlr_matrix
+//
+// \param A The HODLR matrix.
+// \param X The right-hand side dense matrix.
+// \return The resulting column-major dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT     // Type of the right-hand side dense matrix
+        , bool SO >       // Storage order of the right-hand side dense matrix
+inline decltype(auto)
+   operator*( const HODLRMatrix<Type,Tag>& A, const DenseMatrix<MT,SO>& X )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = MultTrait_t< Type, ElementType_t<MT> >;
+
+   DynamicMatrix<ET,columnMajor> Y;
+   multiply( A, *X, Y );
+   return Y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Approximate solution of a linear system with a factorized HODLR matrix
+//        (\f$ A\vec{x}=\vec{b} \f$).
+// \ingroup hodlr_matrix
+//
+// \param A The factorized HODLR matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Unfactorized matrix.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system with the approximated matrix \a A, which has to be
+// factorized via the factorize() member function, in \f$ O(kN \log N) \f$ operations. The
+// solution vector \a x is resized accordingly.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void solve( const HODLRMatrix<Type,Tag>& A, DenseVector<VT1,columnVector>& x,
+            const DenseVector<VT2,columnVector>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !A.isFactorized() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unfactorized matrix" );
+   }
+
+   if( (*b).size() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   DynamicVector<Type> work( *b );
+   A.substitute( work );
+
+   resize( *x, A.rows(), false );
+   *x = work;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Approximate solution of a linear system with multiple right-hand sides with a
+//        factorized HODLR matrix (\f$ AX=B \f$).
+// \ingroup hodlr_matrix
+//
+// \param A The factorized HODLR matrix.
+// \param X The resulting solution matrix.
+// \param B The right-hand side matrix.
+// \return void
+// \exception std::invalid_argument Unfactorized matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function solves the linear system with the approximated matrix \a A, which has to be
+// factorized via the factorize() member function, for all columns of \a B. The solution matrix
+// \a X is resized accordingly.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT1    // Type of the solution matrix
+        , bool SO1        // Storage order of the solution matrix
+        , typename MT2    // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+void solve( const HODLRMatrix<Type,Tag>& A, DenseMatrix<MT1,SO1>& X,
+            const DenseMatrix<MT2,SO2>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !A.isFactorized() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unfactorized matrix" );
+   }
+
+   if( (*B).rows() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   DynamicMatrix<Type,columnMajor> work( *B );
+   A.substitute( work );
+
+   resize( *X, A.rows(), (*B).columns(), false );
+   *X = work;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,506 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/IterativeRefinement.h
+//  \brief Header file for the mixed-precision iterative refinement of dense linear systems
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_ITERATIVEREFINEMENT_H_
+#define _BLAZE_MATH_DENSE_ITERATIVEREFINEMENT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/LSE.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatDVecMultExpr.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
+#include <blaze/math/expressions/DVecDVecInnerExpr.h>
+#include <blaze/math/expressions/DVecDVecSubExpr.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/expressions/DVecNormExpr.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/expressions/DVecScalarDivExpr.h>
+#include <blaze/math/expressions/DVecScalarMultExpr.h>
+#include <blaze/math/expressions/DVecTransExpr.h>
+#include <blaze/math/lapack/getrf.h>
+#include <blaze/math/lapack/getrs.h>
+#include <blaze/math/RefinementFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Limits.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsComplexDouble.h>
+#include <blaze/util/typetraits/IsDouble.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution with the low precision LU factors of a system matrix.
+// \ingroup dense_matrix
+//
+// \param LU The low precision LU factors of the system matrix (as computed by getrf()).
+// \param ipiv The pivot indices of the LU decomposition.
+// \param v The high precision right-hand side vector, which is overwritten by the solution.
+// \param tmp The low precision work vector.
+// \return void
+//
+// This function solves \f$ LU*y=v \f$ in low precision and stores the result in \a v. In order
+// to protect the low precision substitution from overflow and underflow (which easily happens
+// for the tiny residuals of the last refinement steps) the right-hand side is scaled to unit
+// maximum norm before it is rounded to low precision.
+*/
+template< typename MT    // Type of the low precision LU factors
+        , typename VT1   // Type of the high precision vector
+        , typename VT2 > // Type of the low precision work vector
+void refinementSubstitution( const MT& LU, const blas_int_t* ipiv, VT1& v, VT2& tmp )
+{
+   using BT = UnderlyingBuiltin_t< ElementType_t<VT1> >;
+
+   const BT scale( linfNorm( v ) );
+
+   if( scale == BT() )
+      return;
+
+   tmp = v * ( BT(1) / scale );
+   getrs( LU, tmp, 'N', ipiv );
+   v = tmp;
+   v *= scale;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the correction of a classical iterative refinement step.
+// \ingroup dense_matrix
+//
+// \param A The high precision system matrix.
+// \param LU The low precision LU factors of the system matrix.
+// \param ipiv The pivot indices of the LU decomposition.
+// \param r The current residual, which is overwritten by the correction.
+// \param tmp The low precision work vector.
+// \return void
+//
+// The correction is computed by a single forward and back substitution with the low precision
+// LU factors of the system matrix.
+*/
+template< RefinementFlag RF  // Refinement algorithm
+        , typename MT1       // Type of the high precision system matrix
+        , typename MT2       // Type of the low precision LU factors
+        , typename VT1       // Type of the residual vector
+        , typename VT2       // Type of the low precision work vector
+        , EnableIf_t< RF == byIR >* = nullptr >
+void refinementCorrection( const MT1& A, const MT2& LU, const blas_int_t* ipiv, VT1& r, VT2& tmp )
+{
+   MAYBE_UNUSED( A );
+
+   refinementSubstitution( LU, ipiv, r, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the correction of a GMRES-based iterative refinement step.
+// \ingroup dense_matrix
+//
+// \param A The high precision system matrix.
+// \param LU The low precision LU factors of the system matrix.
+// \param ipiv The pivot indices of the LU decomposition.
+// \param r The current residual, which is overwritten by the correction.
+// \param tmp The low precision work vector.
+// \return void
+//
+// The correction equation \f$ A*d=r \f$ is solved by GMRES, which is left preconditioned by the
+// low precision LU factors of the system matrix. In contrast to the classical refinement the
+// preconditioned operator \f$ (LU)^{-1}*A \f$ is applied in high precision, which is why the
+// correction remains accurate even if the low precision factorization is of poor quality. The
+// Arnoldi basis is orthogonalized by modified Gram-Schmidt and the least squares problem is
+// updated by means of Givens rotations. The number of Krylov vectors is limited to 50.
+*/
+template< RefinementFlag RF  // Refinement algorithm
+        , typename MT1       // Type of the high precision system matrix
+        , typename MT2       // Type of the low precision LU factors
+        , typename VT1       // Type of the residual vector
+        , typename VT2       // Type of the low precision work vector
+        , EnableIf_t< RF == byGMRESIR >* = nullptr >
+void refinementCorrection( const MT1& A, const MT2& LU, const blas_int_t* ipiv, VT1& r, VT2& tmp )
+{
+   using ET = ElementType_t<VT1>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   constexpr size_t maxKrylov( 50UL );
+   constexpr BT tolerance( 1E-10 );
+
+   const size_t N( r.size() );
+   const size_t M( min( N, maxKrylov ) );
+
+   DynamicVector<ET,columnVector> w( r );
+   refinementSubstitution( LU, ipiv, w, tmp );
+
+   const BT beta( real( norm( w ) ) );
+
+   if( beta == BT() ) {
+      reset( r );
+      return;
+   }
+
+   DynamicMatrix<ET,columnMajor> V( N, M+1UL );
+   DynamicMatrix<ET,columnMajor> H( M+1UL, M, ET() );
+   DynamicVector<BT,columnVector> c( M, BT() );
+   DynamicVector<ET,columnVector> s( M, ET() );
+   DynamicVector<ET,columnVector> g( M+1UL, ET() );
+
+   column( V, 0UL ) = w / beta;
+   g[0UL] = beta;
+
+   size_t k( 0UL );
+
+   while( k < M )
+   {
+      // Arnoldi step with the preconditioned operator
+      w = A * column( V, k );
+      refinementSubstitution( LU, ipiv, w, tmp );
+
+      for( size_t i=0UL; i<=k; ++i ) {
+         H(i,k) = trans( conj( column( V, i ) ) ) * w;
+         w -= H(i,k) * column( V, i );
+      }
+
+      const BT hnext( real( norm( w ) ) );
+
+      // Applying the previous Givens rotations to the new column of the Hessenberg matrix
+      for( size_t i=0UL; i<k; ++i ) {
+         const ET h1( H(i,k) );
+         const ET h2( H(i+1UL,k) );
+         H(i    ,k) =  c[i]*h1 + s[i]*h2;
+         H(i+1UL,k) = -conj( s[i] )*h1 + c[i]*h2;
+      }
+
+      // Computing the Givens rotation that eliminates the subdiagonal element
+      const ET  a( H(k,k) );
+      const BT  absa( abs( a ) );
+      const BT  rho( std::sqrt( absa*absa + hnext*hnext ) );
+
+      if( absa == BT() ) {
+         c[k] = BT();
+         s[k] = ET(1);
+         H(k,k) = hnext;
+      }
+      else {
+         const ET phase( a / absa );
+         c[k] = absa / rho;
+         s[k] = phase * ( hnext / rho );
+         H(k,k) = phase * rho;
+      }
+
+      g[k+1UL] = -conj( s[k] ) * g[k];
+      g[k]    *= c[k];
+
+      ++k;
+
+      if( abs( g[k] ) <= tolerance * beta || hnext == BT() || k == M )
+         break;
+
+      column( V, k ) = w / hnext;
+   }
+
+   // Solving the upper triangular least squares system
+   DynamicVector<ET,columnVector> y( k );
+
+   for( size_t i=k; i-- > 0UL; ) {
+      ET tmp2( g[i] );
+      for( size_t j=i+1UL; j<k; ++j ) {
+         tmp2 -= H(i,j) * y[j];
+      }
+      y[i] = tmp2 / H(i,i);
+   }
+
+   r = submatrix( V, 0UL, 0UL, N, k ) * y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUNCTIONS FOR THE MIXED-PRECISION SOLUTION OF LINEAR SYSTEMS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Mixed-precision iterative refinement functions */
+//@{
+template< RefinementFlag RF, typename MT, bool SO, typename VT1, typename VT2 >
+bool solveRefined( const DenseMatrix<MT,SO>& A, DenseVector<VT1,columnVector>& x,
+                   const DenseVector<VT2,columnVector>& b );
+
+template< typename MT, bool SO, typename VT1, typename VT2 >
+bool solveRefined( const DenseMatrix<MT,SO>& A, DenseVector<VT1,columnVector>& x,
+                   const DenseVector<VT2,columnVector>& b );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Mixed-precision solution of the given \f$ N \times N \f$ linear system of equations
+//        (\f$ A*x=b \f$).
+// \ingroup dense_matrix
+//
+// \param A The NxN dense system matrix.
+// \param x The dense solution vector.
+// \param b The N-dimensional dense right-hand side vector.
+// \return \a true in case the solution was computed by refinement, \a false otherwise.
+// \exception std::invalid_argument Invalid non-square system matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function computes the solution of the linear system of equations \f$ A*x=b \f$ with
+// \c double or \c complex<double> precision by means of mixed-precision iterative refinement.
+// The system matrix is decomposed by a single precision LU decomposition, which is roughly
+// twice as fast as the double precision decomposition and dominates the total runtime for large
+// systems. Starting from the single precision solution, the residual \f$ r=b-A*x \f$ is computed
+// in double precision and the solution is refined by the correction \f$ d \f$ of \f$ A*d=r \f$
+// until it is accurate to double precision:
+
+   \code
+   blaze::DynamicMatrix<double> A;  // The square general system matrix
+   blaze::DynamicVector<double> b;  // The right-hand side vector
+   // ... Resizing and initialization
+
+   blaze::DynamicVector<double> x;  // The solution vector
+
+   solveRefined( A, x, b );             // Classical iterative refinement
+   solveRefined<byIR>( A, x, b );       // Classical iterative refinement
+   solveRefined<byGMRESIR>( A, x, b );  // GMRES-based iterative refinement
+   \endcode
+
+// The refinement algorithm is selected by the \c RefinementFlag template argument (see
+// \ref blaze::RefinementFlag). By default, the classical refinement (\c byIR) is used, which
+// computes each correction by substitution with the single precision LU factors. For worse
+// conditioned systems the GMRES-based refinement (\c byGMRESIR) can be selected, which solves
+// the correction equation by GMRES preconditioned with the single precision LU factors.
+//
+// The refinement is stopped successfully as soon as the residual satisfies the LAPACK criterion
+// \f$ \|r\|_\infty \le \|x\|_\infty \|A\|_\infty \epsilon \sqrt{N} \f$. In case the system
+// matrix cannot be represented in single precision, in case the single precision decomposition
+// is singular, or in case the refinement does not halve the residual in every step (which
+// indicates that the system matrix is too ill-conditioned for the selected algorithm), the
+// function falls back to the double precision solve() function. The return value indicates
+// whether the solution was computed by refinement (\a true) or by the fallback (\a false). In
+// both cases \a x contains the double precision solution of the system.
+//
+// The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the size of the right-hand side vector doesn't match the dimensions of the system matrix;
+//  - ... the given system matrix is singular.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function can only be used for dense matrices and vectors with \c double or
+// \c complex<double> element type. The attempt to call the function with matrices and vectors
+// of any other element type results in a compile time error!
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a linker error will be created.
+*/
+template< RefinementFlag RF  // Refinement algorithm
+        , typename MT        // Type of the system matrix
+        , bool SO            // Storage order of the system matrix
+        , typename VT1       // Type of the solution vector
+        , typename VT2 >     // Type of the right-hand side vector
+bool solveRefined( const DenseMatrix<MT,SO>& A, DenseVector<VT1,columnVector>& x,
+                   const DenseVector<VT2,columnVector>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT>, ElementType_t<VT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT>, ElementType_t<VT2> );
+
+   using ET = ElementType_t<MT>;
+   using BT = UnderlyingBuiltin_t<ET>;
+   using LT = If_t< IsComplex_v<ET>, complex<float>, float >;
+
+   BLAZE_STATIC_ASSERT_MSG( IsDouble_v<ET> || IsComplexDouble_v<ET>
+                          , "Mixed-precision refinement requires double precision element type" );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square system matrix provided" );
+   }
+
+   if( (*A).rows() != (*b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   constexpr size_t maxIterations( RF == byIR ? 30UL : 10UL );
+
+   const size_t N( (*A).rows() );
+
+   if( N == 0UL ) {
+      resize( *x, 0UL, false );
+      return true;
+   }
+
+   CompositeType_t<MT>  A_( *A );
+   CompositeType_t<VT2> b_( *b );
+
+   const BT anrm( max( sum<rowwise>( abs( A_ ) ) ) );
+   const BT bnrm( linfNorm( b_ ) );
+
+   // Overflow threshold of the conversion to single precision (see the LAPACK dsgesv function)
+   const BT rmax( std::numeric_limits<float>::max() );
+
+   if( anrm <= rmax && bnrm <= rmax )
+   {
+      DynamicMatrix<LT,columnMajor> LU( A_ );
+      DynamicVector<LT,columnVector> tmp( N );
+      const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[N] );
+
+      getrf( LU, ipiv.get() );
+
+      bool singular( false );
+      for( size_t i=0UL; i<N; ++i ) {
+         if( LU(i,i) == LT() ) {
+            singular = true;
+            break;
+         }
+      }
+
+      if( !singular )
+      {
+         const BT cte( anrm * Limits<BT>::epsilon() * std::sqrt( BT( N ) ) );
+
+         DynamicVector<ET,columnVector> xd( b_ );
+         DynamicVector<ET,columnVector> r( N );
+
+         refinementSubstitution( LU, ipiv.get(), xd, tmp );
+
+         BT previous( Limits<BT>::inf() );
+
+         for( size_t iter=0UL; iter<maxIterations; ++iter )
+         {
+            r = b_ - A_ * xd;
+
+            const BT rnrm( linfNorm( r ) );
+
+            if( rnrm <= linfNorm( xd ) * cte ) {
+               resize( *x, N, false );
+               smpAssign( *x, xd );
+               return true;
+            }
+
+            if( !( rnrm <= BT( 0.5 ) * previous ) )
+               break;
+
+            previous = rnrm;
+
+            refinementCorrection<RF>( A_, LU, ipiv.get(), r, tmp );
+            xd += r;
+         }
+      }
+   }
+
+   solve( A_, *x, b_ );
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Mixed-precision solution of the given \f$ N \times N \f$ linear system of equations
+//        (\f$ A*x=b \f$) by classical iterative refinement.
+// \ingroup dense_matrix
+//
+// \param A The NxN dense system matrix.
+// \param x The dense solution vector.
+// \param b The N-dimensional dense right-hand side vector.
+// \return \a true in case the solution was computed by refinement, \a false otherwise.
+// \exception std::invalid_argument Invalid non-square system matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function is equivalent to \c solveRefined<byIR>(). For more details see the documentation
+// of the solveRefined() function with explicit refinement flag.
+*/
+template< typename MT    // Type of the system matrix
+        , bool SO        // Storage order of the system matrix
+        , typename VT1   // Type of the solution vector
+        , typename VT2 > // Type of the right-hand side vector
+inline bool solveRefined( const DenseMatrix<MT,SO>& A, DenseVector<VT1,columnVector>& x,
+                          const DenseVector<VT2,columnVector>& b )
+{
+   return solveRefined<byIR>( *A, *x, *b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
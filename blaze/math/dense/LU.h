@@ -42,6 +42,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -54,6 +55,7 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/getrf.h>
+#include <blaze/math/sparse/Forward.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/util/algorithms/Min.h>
@@ -84,31 +86,26 @@ void lu( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO1>& L,
 // \ingroup dense_matrix
 //
 // \param A The matrix to be decomposed.
-// \param P The resulting permutation matrix.
-// \return void
+// \return The column indices of the non-zero elements of the rows of the permutation matrix.
 //
 // This function is an auxiliary helper for the dense matrix LU decomposition. It performs an
-// in-place LU decomposition on the given matrix \c A and reconstructs the permutation matrix
-// \c P.
+// in-place LU decomposition on the given matrix \c A and returns the resulting permutation in
+// the form of an index vector \c p, i.e. the element \f$ P_{i,p_i} \f$ of the permutation
+// matrix \c P is 1.
 */
-template< typename MT1  // Type of matrix A
-        , bool SO1      // Storage order of dense matrix A
-        , typename MT2  // Type of matrix P
-        , bool SO2 >    // Storage order of matrix P
-void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
+template< typename MT  // Type of matrix A
+        , bool SO >    // Storage order of dense matrix A
+std::vector<size_t> luPermutation( DenseMatrix<MT,SO>& A )
 {
    using std::swap;
 
-   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
-   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT1> );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
-
-   using ET = ElementType_t<MT2>;
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
 
    const blas_int_t m( numeric_cast<blas_int_t>( (*A).rows()    ) );
    const blas_int_t n( numeric_cast<blas_int_t>( (*A).columns() ) );
    const blas_int_t mindim( min( m, n ) );
-   const blas_int_t size( SO1 ? m : n );
+   const blas_int_t size( SO ? m : n );
 
    const std::unique_ptr<blas_int_t[]> helper( new blas_int_t[mindim + size] );
    blas_int_t* ipiv  ( helper.get() );
@@ -127,16 +124,80 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
       }
    }
 
+   std::vector<size_t> perm( size );
+
+   for( int i=0; i<size; ++i ) {
+      if( SO ) perm[permut[i]] = i;
+      else     perm[i] = permut[i];
+   }
+
+   return perm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the LU decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param P The resulting permutation matrix.
+// \return void
+//
+// This function is an auxiliary helper for the dense matrix LU decomposition. It performs an
+// in-place LU decomposition on the given matrix \c A and reconstructs the permutation matrix
+// \c P.
+*/
+template< typename MT1  // Type of matrix A
+        , bool SO1      // Storage order of dense matrix A
+        , typename MT2  // Type of matrix P
+        , bool SO2 >    // Storage order of matrix P
+void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+
+   using ET = ElementType_t<MT2>;
+
+   const std::vector<size_t> perm( luPermutation( *A ) );
+   const size_t size( perm.size() );
+
    resize( *P, size, size, false );
    reset( *P );
-   for( int i=0; i<size; ++i ) {
-      (*P)( ( SO1 ? permut[i] : i ), ( SO1 ? i : permut[i] ) ) = ET(1);
+   for( size_t i=0UL; i<size; ++i ) {
+      (*P)( i, perm[i] ) = ET(1);
    }
 }
 /*! \endcond */
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the LU decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param P The resulting permutation matrix.
+// \return void
+//
+// This function is an auxiliary helper for the dense matrix LU decomposition. It performs an
+// in-place LU decomposition on the given matrix \c A and stores the resulting permutation in
+// the given PermutationMatrix \c P.
+*/
+template< typename MT     // Type of matrix A
+        , bool SO         // Storage order of dense matrix A
+        , typename Type   // Data type of the permutation matrix
+        , typename Tag >  // Type tag of the permutation matrix
+void lu( DenseMatrix<MT,SO>& A, PermutationMatrix<Type,Tag>& P )
+{
+   P = PermutationMatrix<Type,Tag>( luPermutation( *A ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief LU decomposition of the given dense matrix.
 // \ingroup dense_matrix
@@ -202,6 +263,20 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
    assert( A == P * L * U );
    \endcode
 
+// Alternatively, the permutation can be stored in a PermutationMatrix, which only holds the
+// pivoting indices and allows to apply the permutation in \f$ O(N) \f$ time per vector:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::columnMajor> A, L, U;
+   // ... Resizing and initialization
+
+   blaze::PermutationMatrix<double> P;
+
+   lu( A, L, U, P );  // LU decomposition with a sparse permutation matrix
+
+   assert( A == P * ( L * U ) );
+   \endcode
+
 // \note This function only works for matrices with \c float, \c double, \c complex<float>, or
 // \c complex<double> element type. The attempt to call the function with matrices of any other
 // element type results in a compile time error!
@@ -0,0 +1,617 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MatrixRoots.h
+//  \brief Header file for the dense matrix square roots and the polar decomposition
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MATRIXROOTS_H_
+#define _BLAZE_MATH_DENSE_MATRIXROOTS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Eigen.h>
+#include <blaze/math/dense/SVD.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatDeclHermExpr.h>
+#include <blaze/math/expressions/DMatDMatAddExpr.h>
+#include <blaze/math/expressions/DMatDMatMultExpr.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/expressions/DMatNormExpr.h>
+#include <blaze/math/expressions/DMatScalarDivExpr.h>
+#include <blaze/math/expressions/DMatScalarMultExpr.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/expressions/DVecScalarMultExpr.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/util/Limits.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Convergence control for the Newton-Schulz iterations.
+// \ingroup dense_matrix
+//
+// This class monitors the residual of a Newton-Schulz iteration. The iteration has converged
+// as soon as the residual drops below \f$ N \epsilon \f$. It has failed in case the maximum
+// number of iterations is exceeded or the residual stagnates in the quadratically convergent
+// phase of the iteration, which happens in case rounding errors dominate the residual before
+// the requested accuracy is reached (i.e. for ill-conditioned matrices).
+*/
+template< typename BT >  // Type of the residual
+class NewtonSchulzControl
+{
+ public:
+   //**Type definitions****************************************************************************
+   enum State { iterating, converged, failed };  //!< The possible states of the iteration.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the NewtonSchulzControl class.
+   //
+   // \param n The number of rows/columns of the iterated matrix.
+   */
+   explicit NewtonSchulzControl( size_t n )
+      : tolerance_( BT( n ) * Limits<BT>::epsilon() )  // The convergence tolerance
+      , previous_ ( Limits<BT>::inf() )                 // The residual of the previous iteration
+      , iteration_( 0UL )                               // The number of performed iterations
+   {}
+   //**********************************************************************************************
+
+   //**Update function*****************************************************************************
+   /*!\brief Checks the residual of the current iteration.
+   //
+   // \param residual The residual of the current iteration.
+   // \return The state of the iteration.
+   */
+   State update( BT residual )
+   {
+      if( residual <= tolerance_ )
+         return converged;
+
+      if( ++iteration_ > maxIterations || !( residual < previous_ || previous_ > BT( 0.01 ) ) )
+         return failed;
+
+      previous_ = residual;
+      return iterating;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   static constexpr size_t maxIterations = 100UL;  //!< Maximum number of iterations.
+
+   const BT tolerance_;  //!< The convergence tolerance.
+   BT previous_;         //!< The residual of the previous iteration.
+   size_t iteration_;    //!< The number of performed iterations.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Coupled Newton-Schulz iteration for the square root of a Hermitian positive definite
+//        matrix.
+// \ingroup dense_matrix
+//
+// \param A The Hermitian positive definite matrix.
+// \param Y The resulting square root \f$ A^{1/2} \f$.
+// \param Z The resulting inverse square root \f$ A^{-1/2} \f$.
+// \return \a true in case the iteration converged, \a false if not.
+//
+// This function computes the square root and inverse square root of the given matrix by means
+// of the coupled Newton-Schulz iteration
+
+      \f[ T_k = \frac{1}{2} (3I - Z_k Y_k), \quad Y_{k+1} = Y_k T_k, \quad Z_{k+1} = T_k Z_k, \f]
+
+// with \f$ Y_0 = A/c \f$ and \f$ Z_0 = I \f$, which consists of three matrix multiplications per
+// iteration. The scaling by the Frobenius norm \f$ c = \|A\|_F \f$ moves all eigenvalues into
+// \f$ (0,1] \f$, which guarantees convergence, and the scaling is undone after convergence.
+*/
+template< typename MT1    // Type of the matrix A
+        , typename MT2    // Type of the square root
+        , typename MT3 >  // Type of the inverse square root
+bool newtonSchulzSqrt( const MT1& A, MT2& Y, MT3& Z )
+{
+   using ET = ElementType_t<MT2>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   const size_t N( A.rows() );
+   const BT c( real( norm( A ) ) );
+
+   if( c == BT() )
+      return false;
+
+   MT2 T( N, N ), tmp( N, N );
+   NewtonSchulzControl<BT> control( N );
+
+   Y = A / c;
+   reset( Z );
+   for( size_t i=0UL; i<N; ++i ) {
+      Z(i,i) = ET( 1 );
+   }
+
+   while( true )
+   {
+      T = Z * Y;
+      for( size_t i=0UL; i<N; ++i ) {
+         T(i,i) -= ET( 1 );
+      }
+
+      const auto state( control.update( real( norm( T ) ) ) );
+
+      if( state == NewtonSchulzControl<BT>::converged ) break;
+      if( state == NewtonSchulzControl<BT>::failed    ) return false;
+
+      T *= BT( -0.5 );
+      for( size_t i=0UL; i<N; ++i ) {
+         T(i,i) += ET( 1 );
+      }
+
+      tmp = Y * T;
+      std::swap( Y, tmp );
+      tmp = T * Z;
+      std::swap( Z, tmp );
+   }
+
+   Y = ( Y + ctrans( Y ) ) * ( BT( 0.5 ) * std::sqrt( c ) );
+   Z = ( Z + ctrans( Z ) ) * ( BT( 0.5 ) / std::sqrt( c ) );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Eigenvalue-based computation of a power of a Hermitian positive (semi-)definite matrix.
+// \ingroup dense_matrix
+//
+// \param A The Hermitian positive (semi-)definite matrix.
+// \param S The resulting matrix power \f$ A^p \f$.
+// \param p The power (either \f$ 1/2 \f$ or \f$ -1/2 \f$).
+// \return void
+// \exception std::invalid_argument Invalid indefinite matrix provided.
+// \exception std::runtime_error Inverse square root of singular matrix failed.
+//
+// This function serves as the fallback of the Newton-Schulz iteration for ill-conditioned
+// matrices. It computes \f$ A^p = V \Lambda^p V^H \f$ based on the eigendecomposition of \a A.
+*/
+template< typename MT1    // Type of the matrix A
+        , typename MT2 >  // Type of the matrix power
+void eigenSqrt( const MT1& A, MT2& S, double p )
+{
+   using ET = ElementType_t<MT2>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   const size_t N( A.rows() );
+
+   DynamicMatrix<ET,columnMajor> Atmp( A ), V;
+   DynamicVector<BT,columnVector> w;
+
+   eigen( declherm( Atmp ), w, V );
+
+   const BT tolerance( BT( N ) * Limits<BT>::epsilon() * max( abs( w ) ) );
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      if( w[i] < -tolerance ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid indefinite matrix provided" );
+      }
+
+      if( p < 0.0 && w[i] <= tolerance ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Inverse square root of singular matrix failed" );
+      }
+
+      const BT root( w[i] > BT() ? std::sqrt( w[i] ) : BT() );
+      column( Atmp, i ) = column( V, i ) * ( p < 0.0 ? BT( 1 ) / root : root );
+   }
+
+   S = Atmp * ctrans( V );
+   S = ( S + ctrans( S ) ) * BT( 0.5 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Newton-Schulz iteration for the unitary factor of the polar decomposition.
+// \ingroup dense_matrix
+//
+// \param A The \a m-by-\a n matrix (\f$ m \ge n \f$).
+// \param X The resulting \a m-by-\a n matrix with orthonormal columns.
+// \return \a true in case the iteration converged, \a false if not.
+//
+// This function computes the unitary polar factor of the given matrix by means of the
+// Newton-Schulz iteration \f$ X_{k+1} = \frac{1}{2} X_k (3I - X_k^H X_k) \f$ with
+// \f$ X_0 = A/\|A\|_F \f$, which consists of two matrix multiplications per iteration. The
+// scaling by the Frobenius norm moves all singular values into \f$ (0,1] \f$, which guarantees
+// convergence for matrices of full column rank.
+*/
+template< typename MT1    // Type of the matrix A
+        , typename MT2 >  // Type of the unitary factor
+bool newtonSchulzPolar( const MT1& A, MT2& X )
+{
+   using ET = ElementType_t<MT2>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   const size_t N( A.columns() );
+   const BT c( real( norm( A ) ) );
+
+   if( c == BT() )
+      return false;
+
+   MT2 T( N, N ), tmp;
+   NewtonSchulzControl<BT> control( N );
+
+   X = A / c;
+
+   while( true )
+   {
+      T = ctrans( X ) * X;
+      for( size_t i=0UL; i<N; ++i ) {
+         T(i,i) -= ET( 1 );
+      }
+
+      const auto state( control.update( real( norm( T ) ) ) );
+
+      if( state == NewtonSchulzControl<BT>::converged ) return true;
+      if( state == NewtonSchulzControl<BT>::failed    ) return false;
+
+      T *= BT( -0.5 );
+      for( size_t i=0UL; i<N; ++i ) {
+         T(i,i) += ET( 1 );
+      }
+
+      tmp = X * T;
+      std::swap( X, tmp );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX SQUARE ROOT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Matrix square root functions */
+//@{
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+void matsqrt( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& S );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+void matinvsqrt( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& S );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the square root of the given Hermitian positive semi-definite matrix.
+// \ingroup dense_matrix
+//
+// \param A The given Hermitian positive semi-definite matrix.
+// \param S The resulting square root \f$ A^{1/2} \f$.
+// \return void
+// \exception std::invalid_argument Invalid non-Hermitian matrix provided.
+// \exception std::invalid_argument Invalid indefinite matrix provided.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function computes the principal square root \f$ S=A^{1/2} \f$ of the given Hermitian
+// (i.e. in case of real element types symmetric) positive semi-definite matrix \a A, i.e. the
+// unique Hermitian positive semi-definite matrix \a S with \f$ S*S=A \f$:
+
+   \code
+   blaze::DynamicMatrix<double> A( 5UL, 5UL );  // The symmetric positive definite matrix A
+   // ... Initialization
+
+   blaze::DynamicMatrix<double> S;  // The square root of A
+
+   matsqrt( A, S );
+   \endcode
+
+// The square root is computed by means of the scaled, coupled Newton-Schulz iteration, which
+// is built from matrix multiplications only and therefore benefits from both the vectorization
+// and the parallelization of the Blaze matrix multiplication kernels. In case the iteration
+// does not converge to working precision (which happens for singular or very ill-conditioned
+// matrices), the function falls back to the computation via the eigendecomposition of \a A.
+//
+// The function fails if ...
+//
+//  - ... the given matrix \a A is not a Hermitian matrix;
+//  - ... the given matrix \a A has negative eigenvalues;
+//  - ... the given matrix \a S is a fixed size matrix and the dimensions don't match.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename MT2  // Type of the matrix S
+        , bool SO2 >    // Storage order of the matrix S
+void matsqrt( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& S )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT2> );
+
+   using ET = ElementType_t<MT1>;
+
+   if( !isHermitian<relaxed>( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-Hermitian matrix provided" );
+   }
+
+   const size_t N( (*A).rows() );
+
+   resize( *S, N, N, false );
+
+   DynamicMatrix<ET,SO1> Y( N, N ), Z( N, N );
+
+   if( N > 0UL && !newtonSchulzSqrt( *A, Y, Z ) ) {
+      eigenSqrt( *A, Y, 0.5 );
+   }
+
+   *S = Y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the inverse square root of the given Hermitian positive definite matrix.
+// \ingroup dense_matrix
+//
+// \param A The given Hermitian positive definite matrix.
+// \param S The resulting inverse square root \f$ A^{-1/2} \f$.
+// \return void
+// \exception std::invalid_argument Invalid non-Hermitian matrix provided.
+// \exception std::invalid_argument Invalid indefinite matrix provided.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Inverse square root of singular matrix failed.
+//
+// This function computes the inverse of the principal square root \f$ S=A^{-1/2} \f$ of the
+// given Hermitian (i.e. in case of real element types symmetric) positive definite matrix \a A.
+// A typical application is the whitening of data based on its covariance matrix:
+
+   \code
+   blaze::DynamicMatrix<double> C( 5UL, 5UL );  // The covariance matrix
+   // ... Initialization
+
+   blaze::DynamicMatrix<double> W;  // The whitening matrix
+
+   matinvsqrt( C, W );
+   \endcode
+
+// The inverse square root is computed by means of the scaled, coupled Newton-Schulz iteration,
+// which avoids any matrix inversion or decomposition and is built from matrix multiplications
+// only. In case the iteration does not converge to working precision (which happens for very
+// ill-conditioned matrices), the function falls back to the computation via the eigendecomposition
+// of \a A.
+//
+// The function fails if ...
+//
+//  - ... the given matrix \a A is not a Hermitian matrix;
+//  - ... the given matrix \a A has negative eigenvalues;
+//  - ... the given matrix \a A is singular;
+//  - ... the given matrix \a S is a fixed size matrix and the dimensions don't match.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename MT2  // Type of the matrix S
+        , bool SO2 >    // Storage order of the matrix S
+void matinvsqrt( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& S )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT2> );
+
+   using ET = ElementType_t<MT1>;
+
+   if( !isHermitian<relaxed>( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-Hermitian matrix provided" );
+   }
+
+   const size_t N( (*A).rows() );
+
+   resize( *S, N, N, false );
+
+   DynamicMatrix<ET,SO1> Y( N, N ), Z( N, N );
+
+   if( N > 0UL && !newtonSchulzSqrt( *A, Y, Z ) ) {
+      eigenSqrt( *A, Z, -0.5 );
+   }
+
+   *S = Z;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  POLAR DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Polar decomposition functions */
+//@{
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void polar( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& U, DenseMatrix<MT3,SO3>& H );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Polar decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given \a m-by-\a n matrix (\f$ m \ge n \f$).
+// \param U The resulting \a m-by-\a n matrix with orthonormal columns.
+// \param H The resulting \a n-by-\a n Hermitian positive semi-definite matrix.
+// \return void
+// \exception std::invalid_argument Invalid matrix dimensions provided.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function computes the polar decomposition \f$ A=U*H \f$ of the given \a m-by-\a n matrix
+// \a A, where \a U is a matrix with orthonormal columns (i.e. the unitary matrix closest to \a A)
+// and \a H is the Hermitian positive semi-definite matrix \f$ (A^H A)^{1/2} \f$:
+
+   \code
+   blaze::DynamicMatrix<double> A( 5UL, 3UL );  // The matrix to be orthogonalized
+   // ... Initialization
+
+   blaze::DynamicMatrix<double> U;  // The orthogonal factor
+   blaze::DynamicMatrix<double> H;  // The symmetric positive semi-definite factor
+
+   polar( A, U, H );
+   \endcode
+
+// The unitary factor is computed by means of the scaled Newton-Schulz iteration, which is built
+// from matrix multiplications only and therefore benefits from both the vectorization and the
+// parallelization of the Blaze matrix multiplication kernels. In case the iteration does not
+// converge to working precision (which happens for rank deficient or very ill-conditioned
+// matrices), the function falls back to the computation via the singular value decomposition
+// of \a A.
+//
+// The function fails if ...
+//
+//  - ... the given matrix \a A has more columns than rows;
+//  - ... the given matrix \a U is a fixed size matrix and the dimensions don't match;
+//  - ... the given matrix \a H is a fixed size matrix and the dimensions don't match.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename MT2  // Type of the matrix U
+        , bool SO2      // Storage order of the matrix U
+        , typename MT3  // Type of the matrix H
+        , bool SO3 >    // Storage order of the matrix H
+void polar( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& U, DenseMatrix<MT3,SO3>& H )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT2> );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT3> );
+
+   using ET = ElementType_t<MT1>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   const size_t M( (*A).rows()    );
+   const size_t N( (*A).columns() );
+
+   if( M < N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix dimensions provided" );
+   }
+
+   resize( *U, M, N, false );
+   resize( *H, N, N, false );
+
+   const DynamicMatrix<ET,SO1> Atmp( *A );
+   DynamicMatrix<ET,SO1> X( M, N ), P( N, N );
+
+   if( N == 0UL || newtonSchulzPolar( Atmp, X ) ) {
+      P = ctrans( X ) * Atmp;
+   }
+   else {
+      DynamicMatrix<ET,SO1> W, V, VS( N, N );
+      DynamicVector<BT,columnVector> s;
+
+      svd( Atmp, W, s, V );
+
+      X = W * V;
+      for( size_t i=0UL; i<N; ++i ) {
+         column( VS, i ) = ctrans( row( V, i ) ) * s[i];
+      }
+      P = VS * V;
+   }
+
+   *U = X;
+   *H = ( P + ctrans( P ) ) * BT( 0.5 );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
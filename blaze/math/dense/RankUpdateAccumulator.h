@@ -0,0 +1,748 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/RankUpdateAccumulator.h
+//  \brief Header file for the RankUpdateAccumulator class template
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_RANKUPDATEACCUMULATOR_H_
+#define _BLAZE_MATH_DENSE_RANKUPDATEACCUMULATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/Scalar.h>
+#include <blaze/math/constraints/Transformation.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatScalarMultExpr.h>
+#include <blaze/math/expressions/DVecDVecOuterExpr.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Accumulator for deferred low-rank updates of a dense matrix.
+// \ingroup dense_matrix
+//
+// The RankUpdateAccumulator class template buffers rank-1 and rank-r updates of a dense matrix
+// and applies them in a single matrix/matrix multiplication. Every rank-1 update of the form
+// \f$ A+=\alpha\vec{x}\vec{y}^T \f$ streams the complete matrix \f$ A \f$ from memory. In case
+// several updates are applied in a row (as for instance in online covariance updates or
+// quasi-Newton methods), it is considerably more efficient to collect \f$ k \f$ updates in the
+// two matrices \f$ X=(\alpha_1\vec{x}_1,...,\alpha_k\vec{x}_k) \f$ and \f$ Y=(\vec{y}_1,...,
+// \vec{y}_k) \f$ and to apply them as single rank-k update \f$ A+=XY^T \f$:
+
+   \code
+   blaze::DynamicMatrix<double> A( 500UL, 500UL, 0.0 );
+   blaze::DynamicVector<double> x( 500UL ), y( 500UL );
+
+   {
+      blaze::RankUpdateAccumulator< blaze::DynamicMatrix<double> > acc( A, 32UL );
+
+      for( size_t k=0UL; k<1000UL; ++k ) {
+         // ... Computing the vectors x and y
+         acc += 0.5 * x * trans(y);  // Buffered rank-1 update
+      }
+
+      const double norm = blaze::norm( acc.matrix() );  // Reading flushes all pending updates
+   }  // The destructor flushes all remaining updates
+   \endcode
+
+// The template argument specifies the type of the target matrix, which must be a non-expression
+// dense matrix type. The capacity of the accumulator (i.e. the maximum rank of the buffered
+// update) is specified at construction time. As soon as the capacity is exhausted, all pending
+// updates are applied to the target matrix. Also, every access to the target matrix via the
+// matrix() function and the destruction of the accumulator flush the pending updates. Element
+// reads via the function call operator return the updated value without flushing. In order to
+// guarantee consistent results, the target matrix must not be modified or resized directly
+// (i.e. without calling matrix() first) while updates are pending.
+//
+// In case the application of the pending updates fails (for instance since the target matrix
+// is a symmetric adaptor and the accumulated update is not symmetric), the flush() and matrix()
+// functions and all update functions that trigger a flush propagate the exception and leave all
+// updates pending. Since a destructor must not throw, the destructor swallows any exception and
+// discards the pending updates in this case. Therefore flush() should be called explicitly
+// before the end of the lifetime of the accumulator whenever the update might fail:
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::SymmetricMatrix;
+
+   SymmetricMatrix< DynamicMatrix<double> > S( 500UL );
+   blaze::DynamicVector<double> x( 500UL ), y( 500UL );
+
+   blaze::RankUpdateAccumulator< SymmetricMatrix< DynamicMatrix<double> > > acc( S );
+
+   acc += x * trans(y);
+   acc += y * trans(x);
+
+   acc.flush();  // Throws a std::invalid_argument exception if the update is not symmetric
+   \endcode
+*/
+template< typename MT >  // Type of the target dense matrix
+class RankUpdateAccumulator
+   : private NonCopyable
+{
+ public:
+   //**Type definitions****************************************************************************
+   using MatrixType  = MT;                 //!< Type of the target dense matrix.
+   using ElementType = ElementType_t<MT>;  //!< Type of the matrix elements.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline RankUpdateAccumulator( MT& matrix, size_t capacity = 32UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~RankUpdateAccumulator();
+   //@}
+   //**********************************************************************************************
+
+   //**Access functions****************************************************************************
+   /*!\name Access functions */
+   //@{
+   inline ElementType operator()( size_t i, size_t j ) const;
+   inline MT&         matrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Update functions****************************************************************************
+   /*!\name Update functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   inline void update( const DenseVector<VT1,columnVector>& x,
+                       const DenseVector<VT2,columnVector>& y );
+
+   template< typename ST, typename VT1, typename VT2 >
+   inline void update( ST alpha, const DenseVector<VT1,columnVector>& x,
+                       const DenseVector<VT2,columnVector>& y );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void update( const DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& Y );
+
+   template< typename VT1, typename VT2 >
+   inline RankUpdateAccumulator& operator+=( const DVecDVecOuterExpr<VT1,VT2,Mult>& rhs );
+
+   template< typename VT1, typename VT2 >
+   inline RankUpdateAccumulator& operator-=( const DVecDVecOuterExpr<VT1,VT2,Mult>& rhs );
+
+   template< typename VT1, typename VT2, typename ST >
+   inline RankUpdateAccumulator&
+      operator+=( const DMatScalarMultExpr< DVecDVecOuterExpr<VT1,VT2,Mult>, ST, false >& rhs );
+
+   template< typename VT1, typename VT2, typename ST >
+   inline RankUpdateAccumulator&
+      operator-=( const DMatScalarMultExpr< DVecDVecOuterExpr<VT1,VT2,Mult>, ST, false >& rhs );
+
+   template< typename MT2, bool SO2 >
+   inline RankUpdateAccumulator& operator+=( const Matrix<MT2,SO2>& rhs );
+
+   template< typename MT2, bool SO2 >
+   inline RankUpdateAccumulator& operator-=( const Matrix<MT2,SO2>& rhs );
+
+   inline void flush();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows    () const noexcept;
+   inline size_t columns () const noexcept;
+   inline size_t pending () const noexcept;
+   inline size_t capacity() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   inline void append( const VT1& x, const VT2& y );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MT&    matrix_;  //!< The target dense matrix.
+   size_t size_;    //!< The current number of pending rank-1 updates.
+
+   DynamicMatrix<ElementType,columnMajor> X_;  //!< The left-hand side factors of the updates.
+   DynamicMatrix<ElementType,rowMajor>    Y_;  //!< The transpose right-hand side factors.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE      ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE   ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_TRANSFORMATION_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the RankUpdateAccumulator class template.
+//
+// \param matrix The target dense matrix.
+// \param capacity The maximum number of buffered rank-1 updates.
+// \exception std::invalid_argument Invalid capacity.
+//
+// This constructor initializes an accumulator for the given dense matrix, which buffers up to
+// \a capacity rank-1 updates before applying them to the matrix. In case the given capacity is
+// 0, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the target dense matrix
+inline RankUpdateAccumulator<MT>::RankUpdateAccumulator( MT& matrix, size_t capacity )
+   : matrix_( matrix )                     // The target dense matrix
+   , size_  ( 0UL )                        // The current number of pending rank-1 updates
+   , X_     ( matrix.rows(), capacity )    // The left-hand side factors of the pending updates
+   , Y_     ( capacity, matrix.columns() ) // The transpose right-hand side factors
+{
+   if( capacity == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid capacity for rank update accumulator" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the RankUpdateAccumulator class template.
+//
+// The destructor applies all pending updates to the target matrix. In case the update of the
+// target matrix fails, the exception is swallowed and the pending updates are discarded.
+*/
+template< typename MT >  // Type of the target dense matrix
+inline RankUpdateAccumulator<MT>::~RankUpdateAccumulator()
+{
+   try {
+      flush();
+   }
+   catch( ... ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Read access to the updated matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element including all pending updates.
+//
+// This function returns the current value of the specified element of the target matrix,
+// including the contributions of all pending updates. In contrast to the matrix() function,
+// it does not flush the pending updates.
+*/
+template< typename MT >  // Type of the target dense matrix
+inline typename RankUpdateAccumulator<MT>::ElementType
+   RankUpdateAccumulator<MT>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   ElementType value( matrix_(i,j) );
+
+   for( size_t k=0UL; k<size_; ++k ) {
+      value += X_(i,k) * Y_(k,j);
+   }
+
+   return value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the updated target matrix.
+//
+// \return Reference to the target matrix.
+//
+// This function applies all pending updates and returns a reference to the target matrix.
+*/
+template< typename MT >  // Type of the target dense matrix
+inline MT& RankUpdateAccumulator<MT>::matrix()
+{
+   flush();
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UPDATE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Buffered rank-1 update of the target matrix (\f$ A+=\vec{x}\vec{y}^T \f$).
+//
+// \param x The left-hand side dense vector of the rank-1 update.
+// \param y The right-hand side dense vector of the rank-1 update.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function buffers the rank-1 update \f$ A+=\vec{x}\vec{y}^T \f$ of the target matrix. In
+// case the size of \a x doesn't match the number of rows or the size of \a y doesn't match the
+// number of columns of the target matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the target dense matrix
+template< typename VT1   // Type of the left-hand side dense vector
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void RankUpdateAccumulator<MT>::update( const DenseVector<VT1,columnVector>& x,
+                                               const DenseVector<VT2,columnVector>& y )
+{
+   if( (*x).size() != rows() || (*y).size() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   append( *x, trans( *y ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Buffered scaled rank-1 update of the target matrix (\f$ A+=\alpha\vec{x}\vec{y}^T \f$).
+//
+// \param alpha The scaling factor of the rank-1 update.
+// \param x The left-hand side dense vector of the rank-1 update.
+// \param y The right-hand side dense vector of the rank-1 update.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function buffers the rank-1 update \f$ A+=\alpha\vec{x}\vec{y}^T \f$ of the target
+// matrix. In case the size of \a x doesn't match the number of rows or the size of \a y doesn't
+// match the number of columns of the target matrix, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename MT >  // Type of the target dense matrix
+template< typename ST    // Type of the scalar value
+        , typename VT1   // Type of the left-hand side dense vector
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void RankUpdateAccumulator<MT>::update( ST alpha, const DenseVector<VT1,columnVector>& x,
+                                               const DenseVector<VT2,columnVector>& y )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SCALAR_TYPE( ST );
+
+   if( (*x).size() != rows() || (*y).size() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   append( alpha * (*x), trans( *y ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Buffered rank-r update of the target matrix (\f$ A+=XY^T \f$).
+//
+// \param X The left-hand side \f$ M \times r \f$ factor of the rank-r update.
+// \param Y The right-hand side \f$ N \times r \f$ factor of the rank-r update.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function buffers the rank-r update \f$ A+=XY^T \f$ of the target matrix. In case the
+// rank \a r exceeds the capacity of the accumulator, the pending updates are flushed and the
+// update is applied immediately. In case the number of rows of \a X doesn't match the number
+// of rows of the target matrix, the number of rows of \a Y doesn't match the number of columns
+// of the target matrix, or the number of columns of \a X and \a Y differ, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the target dense matrix
+template< typename MT1   // Type of the left-hand side dense matrix
+        , bool SO1       // Storage order of the left-hand side dense matrix
+        , typename MT2   // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void RankUpdateAccumulator<MT>::update( const DenseMatrix<MT1,SO1>& X,
+                                               const DenseMatrix<MT2,SO2>& Y )
+{
+   if( (*X).rows() != rows() || (*Y).rows() != columns() || (*X).columns() != (*Y).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const size_t rank( (*X).columns() );
+
+   if( rank > capacity() ) {
+      flush();
+      matrix_ += (*X) * trans( *Y );
+      return;
+   }
+
+   if( size_ + rank > capacity() ) {
+      flush();
+   }
+
+   submatrix( X_, 0UL, size_, rows(), rank, unchecked ) = *X;
+   submatrix( Y_, size_, 0UL, rank, columns(), unchecked ) = trans( *Y );
+   size_ += rank;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Buffered addition of an outer product (\f$ A+=\vec{x}\vec{y}^T \f$).
+//
+// \param rhs The outer product to be added.
+// \return Reference to the accumulator.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the number of rows and columns of the outer product don't match the number of rows
+// and columns of the target matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the target dense matrix
+template< typename VT1   // Type of the left-hand side dense vector
+        , typename VT2 > // Type of the right-hand side dense vector
+inline RankUpdateAccumulator<MT>&
+   RankUpdateAccumulator<MT>::operator+=( const DVecDVecOuterExpr<VT1,VT2,Mult>& rhs )
+{
+   if( rhs.rows() != rows() || rhs.columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   append( rhs.leftOperand(), rhs.rightOperand() );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Buffered subtraction of an outer product (\f$ A-=\vec{x}\vec{y}^T \f$).
+//
+// \param rhs The outer product to be subtracted.
+// \return Reference to the accumulator.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the number of rows and columns of the outer product don't match the number of rows
+// and columns of the target matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the target dense matrix
+template< typename VT1   // Type of the left-hand side dense vector
+        , typename VT2 > // Type of the right-hand side dense vector
+inline RankUpdateAccumulator<MT>&
+   RankUpdateAccumulator<MT>::operator-=( const DVecDVecOuterExpr<VT1,VT2,Mult>& rhs )
+{
+   if( rhs.rows() != rows() || rhs.columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   append( -rhs.leftOperand(), rhs.rightOperand() );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Buffered addition of a scaled outer product (\f$ A+=(\vec{x}\vec{y}^T)*\alpha \f$).
+//
+// \param rhs The scaled outer product to be added.
+// \return Reference to the accumulator.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the number of rows and columns of the outer product don't match the number of rows
+// and columns of the target matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the target dense matrix
+template< typename VT1   // Type of the left-hand side dense vector
+        , typename VT2   // Type of the right-hand side dense vector
+        , typename ST >  // Type of the scalar value
+inline RankUpdateAccumulator<MT>&
+   RankUpdateAccumulator<MT>::operator+=(
+      const DMatScalarMultExpr< DVecDVecOuterExpr<VT1,VT2,Mult>, ST, false >& rhs )
+{
+   if( rhs.rows() != rows() || rhs.columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   append( rhs.leftOperand().leftOperand() * rhs.rightOperand(),
+           rhs.leftOperand().rightOperand() );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Buffered subtraction of a scaled outer product (\f$ A-=(\vec{x}\vec{y}^T)*\alpha \f$).
+//
+// \param rhs The scaled outer product to be subtracted.
+// \return Reference to the accumulator.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the number of rows and columns of the outer product don't match the number of rows
+// and columns of the target matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the target dense matrix
+template< typename VT1   // Type of the left-hand side dense vector
+        , typename VT2   // Type of the right-hand side dense vector
+        , typename ST >  // Type of the scalar value
+inline RankUpdateAccumulator<MT>&
+   RankUpdateAccumulator<MT>::operator-=(
+      const DMatScalarMultExpr< DVecDVecOuterExpr<VT1,VT2,Mult>, ST, false >& rhs )
+{
+   if( rhs.rows() != rows() || rhs.columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   append( rhs.leftOperand().leftOperand() * ( -rhs.rightOperand() ),
+           rhs.leftOperand().rightOperand() );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition of a general matrix to the target matrix (\f$ A+=B \f$).
+//
+// \param rhs The matrix to be added.
+// \return Reference to the accumulator.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator flushes all pending updates and adds the given matrix to the target matrix. In
+// case the number of rows and columns of the given matrix don't match the number of rows and
+// columns of the target matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the target dense matrix
+template< typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline RankUpdateAccumulator<MT>&
+   RankUpdateAccumulator<MT>::operator+=( const Matrix<MT2,SO2>& rhs )
+{
+   flush();
+   matrix_ += *rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction of a general matrix from the target matrix (\f$ A-=B \f$).
+//
+// \param rhs The matrix to be subtracted.
+// \return Reference to the accumulator.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator flushes all pending updates and subtracts the given matrix from the target
+// matrix. In case the number of rows and columns of the given matrix don't match the number of
+// rows and columns of the target matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the target dense matrix
+template< typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline RankUpdateAccumulator<MT>&
+   RankUpdateAccumulator<MT>::operator-=( const Matrix<MT2,SO2>& rhs )
+{
+   flush();
+   matrix_ -= *rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application of all pending updates to the target matrix.
+//
+// \return void
+//
+// This function applies all pending updates to the target matrix by means of a single
+// matrix/matrix multiplication \f$ A+=XY^T \f$. In case the update of the target matrix fails
+// (as for instance in case the target matrix is an adaptor, whose invariants would be violated
+// by the update), the exception is propagated to the caller and all updates remain pending.
+*/
+template< typename MT >  // Type of the target dense matrix
+inline void RankUpdateAccumulator<MT>::flush()
+{
+   if( size_ == 0UL )
+      return;
+
+   matrix_ += submatrix( X_, 0UL, 0UL, rows(), size_, unchecked ) *
+              submatrix( Y_, 0UL, 0UL, size_, columns(), unchecked );
+
+   size_ = 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the target matrix.
+//
+// \return The number of rows of the target matrix.
+*/
+template< typename MT >  // Type of the target dense matrix
+inline size_t RankUpdateAccumulator<MT>::rows() const noexcept
+{
+   return X_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the target matrix.
+//
+// \return The number of columns of the target matrix.
+*/
+template< typename MT >  // Type of the target dense matrix
+inline size_t RankUpdateAccumulator<MT>::columns() const noexcept
+{
+   return Y_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of pending rank-1 updates.
+//
+// \return The number of pending rank-1 updates.
+*/
+template< typename MT >  // Type of the target dense matrix
+inline size_t RankUpdateAccumulator<MT>::pending() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum number of buffered rank-1 updates.
+//
+// \return The capacity of the accumulator.
+*/
+template< typename MT >  // Type of the target dense matrix
+inline size_t RankUpdateAccumulator<MT>::capacity() const noexcept
+{
+   return X_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Appends a single rank-1 update to the buffer.
+//
+// \param x The (scaled) left-hand side column vector of the rank-1 update.
+// \param y The right-hand side row vector of the rank-1 update.
+// \return void
+//
+// This function flushes the pending updates in case the capacity of the accumulator is
+// exhausted and appends the given rank-1 update \f$ A+=\vec{x}\vec{y} \f$ to the buffer.
+*/
+template< typename MT >  // Type of the target dense matrix
+template< typename VT1   // Type of the left-hand side column vector
+        , typename VT2 > // Type of the right-hand side row vector
+inline void RankUpdateAccumulator<MT>::append( const VT1& x, const VT2& y )
+{
+   BLAZE_INTERNAL_ASSERT( x.size() == rows()   , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( y.size() == columns(), "Invalid vector size" );
+
+   if( size_ == capacity() ) {
+      flush();
+   }
+
+   column( X_, size_, unchecked ) = x;
+   row   ( Y_, size_, unchecked ) = y;
+   ++size_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,462 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Rolling.h
+//  \brief Header file for the rolling-window kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_ROLLING_H_
+#define _BLAZE_MATH_DENSE_ROLLING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/expressions/DVecMeanExpr.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/expressions/DVecVarExpr.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Min.h>
+#include <blaze/math/shims/Invert.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS ROLLINGSUM
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Kernel for the computation of rolling-window sums.
+// \ingroup dense
+//
+// The RollingSum class implements the computation of the sums of all windows of size \a w of
+// a sequence of values. Each window sum is derived from the previous one by adding the incoming
+// and subtracting the outgoing element. In order to limit the accumulation of rounding errors,
+// the running sum is recomputed from scratch at the beginning of each block of windows.
+*/
+struct RollingSum
+{
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename ET > using Result = ET;  //!< Element type of the rolling-window sums.
+   template< typename ET > using State  = ET;  //!< Type of the running state.
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Evaluate function***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Direct computation of the sum of a single window.
+   //
+   // \param window The window of the sequence.
+   // \return The sum of the window.
+   */
+   template< typename VT >  // Type of the window
+   static inline decltype(auto) evaluate( const VT& window )
+   {
+      return sum( window );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Apply function******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes the window sums in the range \f$[first..last)\f$.
+   //
+   // \param in Access to the \a k-th element of the input sequence.
+   // \param out Access to the \a k-th element of the output sequence.
+   // \param first The index of the first window.
+   // \param last The index one past the last window.
+   // \param w The size of the window.
+   // \return void
+   //
+   // The window starting at index \a k is written to \a out(k). Both \a in and \a out can
+   // either provide scalar values or dense vectors of values, which are processed in lockstep.
+   */
+   template< typename ST     // Type of the running state
+           , typename In     // Type of the input accessor
+           , typename Out >  // Type of the output accessor
+   static void apply( In in, Out out, size_t first, size_t last, size_t w )
+   {
+      const size_t block( max( 8UL*w, 1024UL ) );
+
+      ST s;
+
+      for( size_t b=first; b<last; b+=block )
+      {
+         const size_t end( min( b+block, last ) );
+
+         s = in(b);
+         for( size_t k=1UL; k<w; ++k ) {
+            s += in(b+k);
+         }
+         out(b) = s;
+
+         for( size_t i=b+1UL; i<end; ++i ) {
+            s += in(i+w-1UL);
+            s -= in(i-1UL);
+            out(i) = s;
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ROLLINGMEAN
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Kernel for the computation of rolling-window means.
+// \ingroup dense
+//
+// The RollingMean class implements the computation of the arithmetic means of all windows of
+// size \a w of a sequence of values. The means are derived from the running window sums (see
+// the RollingSum class).
+*/
+struct RollingMean
+{
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Element type of the rolling-window means.
+   template< typename ET >
+   using Result = decltype( std::declval<ET>() * inv( std::declval< UnderlyingBuiltin_t<ET> >() ) );
+
+   //! Type of the running state.
+   template< typename ET >
+   using State = ET;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Evaluate function***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Direct computation of the mean of a single window.
+   //
+   // \param window The window of the sequence.
+   // \return The mean of the window.
+   */
+   template< typename VT >  // Type of the window
+   static inline decltype(auto) evaluate( const VT& window )
+   {
+      return mean( window );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Apply function******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes the window means in the range \f$[first..last)\f$.
+   //
+   // \param in Access to the \a k-th element of the input sequence.
+   // \param out Access to the \a k-th element of the output sequence.
+   // \param first The index of the first window.
+   // \param last The index one past the last window.
+   // \param w The size of the window.
+   // \return void
+   */
+   template< typename ST     // Type of the running state
+           , typename In     // Type of the input accessor
+           , typename Out >  // Type of the output accessor
+   static void apply( In in, Out out, size_t first, size_t last, size_t w )
+   {
+      using BT = UnderlyingBuiltin_t<ST>;
+
+      const auto scale( inv( BT( w ) ) );
+      const size_t block( max( 8UL*w, 1024UL ) );
+
+      ST s;
+
+      for( size_t b=first; b<last; b+=block )
+      {
+         const size_t end( min( b+block, last ) );
+
+         s = in(b);
+         for( size_t k=1UL; k<w; ++k ) {
+            s += in(b+k);
+         }
+         out(b) = s * scale;
+
+         for( size_t i=b+1UL; i<end; ++i ) {
+            s += in(i+w-1UL);
+            s -= in(i-1UL);
+            out(i) = s * scale;
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ROLLINGVAR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Kernel for the computation of rolling-window variances.
+// \ingroup dense
+//
+// The RollingVar class implements the computation of the sample variances of all windows of
+// size \a w of a sequence of values. The mean and the sum of squared deviations are updated
+// by means of the sliding form of Welford's algorithm. At the beginning of each block of windows
+// both quantities are recomputed by means of the numerically stable two-pass algorithm.
+*/
+struct RollingVar
+{
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Element type of the rolling-window variances.
+   template< typename ET >
+   using Result = decltype( std::declval<ET>() * inv( std::declval< UnderlyingBuiltin_t<ET> >() ) );
+
+   //! Type of the running state.
+   template< typename ET >
+   using State = Result<ET>;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Evaluate function***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Direct computation of the variance of a single window.
+   //
+   // \param window The window of the sequence.
+   // \return The variance of the window.
+   */
+   template< typename VT >  // Type of the window
+   static inline decltype(auto) evaluate( const VT& window )
+   {
+      return var( window );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Apply function******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes the window variances in the range \f$[first..last)\f$.
+   //
+   // \param in Access to the \a k-th element of the input sequence.
+   // \param out Access to the \a k-th element of the output sequence.
+   // \param first The index of the first window.
+   // \param last The index one past the last window.
+   // \param w The size of the window (at least 2).
+   // \return void
+   */
+   template< typename ST     // Type of the running state
+           , typename In     // Type of the input accessor
+           , typename Out >  // Type of the output accessor
+   static void apply( In in, Out out, size_t first, size_t last, size_t w )
+   {
+      using BT = UnderlyingBuiltin_t<ST>;
+
+      const auto scale ( inv( BT( w ) ) );
+      const auto scale2( inv( BT( w-1UL ) ) );
+      const size_t block( max( 8UL*w, 1024UL ) );
+
+      ST m, m2, d;
+
+      for( size_t b=first; b<last; b+=block )
+      {
+         const size_t end( min( b+block, last ) );
+
+         m = in(b);
+         for( size_t k=1UL; k<w; ++k ) {
+            m += in(b+k);
+         }
+         m *= scale;
+
+         d = in(b) - m;
+         m2 = d * d;
+         for( size_t k=1UL; k<w; ++k ) {
+            d = in(b+k) - m;
+            m2 += d * d;
+         }
+         out(b) = m2 * scale2;
+
+         for( size_t i=b+1UL; i<end; ++i ) {
+            d = in(i+w-1UL) - in(i-1UL);
+            m2 += d * ( ( in(i+w-1UL) - m ) + ( in(i-1UL) - m ) - d * scale );
+            m += d * scale;
+            out(i) = m2 * scale2;
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ROLLINGEXTREMUM
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Kernel for the computation of rolling-window minima and maxima.
+// \ingroup dense
+//
+// The RollingExtremum class implements the computation of the minima (\a OP = Min) or maxima
+// (\a OP = Max) of all windows of size \a w of a sequence of values by means of the van Herk/
+// Gil-Werman algorithm. The sequence is split into blocks of size \a w and every window is
+// combined from a suffix of one block and a prefix of the next block, which results in at
+// most three applications of \a OP per window, independent of the window size. In contrast
+// to a monotonic deque the algorithm is free of data-dependent branches and can therefore be
+// applied to several sequences at once.
+*/
+template< typename OP >  // Type of the selection operation
+struct RollingExtremum
+{
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename ET > using Result = ET;  //!< Element type of the rolling-window extrema.
+   template< typename ET > using State  = ET;  //!< Type of the running state.
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Evaluate function***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Direct computation of the extremum of a single window.
+   //
+   // \param window The window of the sequence.
+   // \return The extremum of the window.
+   */
+   template< typename VT >  // Type of the window
+   static inline decltype(auto) evaluate( const VT& window )
+   {
+      return reduce( window, OP() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Apply function******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes the window extrema in the range \f$[first..last)\f$.
+   //
+   // \param in Access to the \a k-th element of the input sequence.
+   // \param out Access to the \a k-th element of the output sequence.
+   // \param first The index of the first window.
+   // \param last The index one past the last window.
+   // \param w The size of the window.
+   // \return void
+   */
+   template< typename ST     // Type of the running state
+           , typename In     // Type of the input accessor
+           , typename Out >  // Type of the output accessor
+   static void apply( In in, Out out, size_t first, size_t last, size_t w )
+   {
+      OP op;
+      ST p;
+
+      for( size_t b=first; b<last; b+=w )
+      {
+         const size_t end( min( b+w, last ) );
+
+         // Suffix extrema of the current block
+         if( end == b+w ) {
+            out(end-1UL) = in(end-1UL);
+         }
+         else {
+            p = in(end);
+            for( size_t k=end+1UL; k<b+w; ++k ) {
+               p = op( p, in(k) );
+            }
+            out(end-1UL) = op( in(end-1UL), p );
+         }
+
+         for( size_t i=end-1UL; i>b; --i ) {
+            out(i-1UL) = op( in(i-1UL), out(i) );
+         }
+
+         // Prefix extrema of the subsequent block
+         if( b+1UL < end ) {
+            p = in(b+w);
+            out(b+1UL) = op( out(b+1UL), p );
+            for( size_t i=b+2UL; i<end; ++i ) {
+               p = op( p, in(i+w-1UL) );
+               out(i) = op( out(i), p );
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Kernel for the computation of rolling-window minima.
+// \ingroup dense
+*/
+using RollingMin = RollingExtremum<Min>;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Kernel for the computation of rolling-window maxima.
+// \ingroup dense
+*/
+using RollingMax = RollingExtremum<Max>;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
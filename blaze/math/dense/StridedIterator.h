@@ -0,0 +1,616 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/StridedIterator.h
+//  \brief Header file for the StridedIterator class template
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_STRIDEDITERATOR_H_
+#define _BLAZE_MATH_DENSE_STRIDEDITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a generic iterator for dense vectors and matrices with runtime stride.
+// \ingroup math
+//
+// The StridedIterator represents a generic random-access iterator that traverses a sequence of
+// elements that are \a stride elements apart in memory. It is used for the elements of strided
+// dense vectors and the rows/columns of strided dense matrices. In contrast to the DenseIterator
+// the StridedIterator does not provide any SIMD access since the elements are not contiguous.
+*/
+template< typename Type >  // Type of the elements
+class StridedIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+   using ValueType        = Type;                             //!< Type of the underlying elements.
+   using PointerType      = Type*;                            //!< Pointer return type.
+   using ReferenceType    = Type&;                            //!< Reference return type.
+   using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+   // STL iterator requirements
+   using iterator_category = IteratorCategory;  //!< The iterator category.
+   using value_type        = ValueType;         //!< Type of the underlying elements.
+   using pointer           = PointerType;       //!< Pointer return type.
+   using reference         = ReferenceType;     //!< Reference return type.
+   using difference_type   = DifferenceType;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit constexpr StridedIterator() noexcept;
+   explicit constexpr StridedIterator( Type* ptr, ptrdiff_t stride ) noexcept;
+
+   template< typename Other >
+   constexpr StridedIterator( const StridedIterator<Other>& it ) noexcept;
+
+   StridedIterator( const StridedIterator& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~StridedIterator() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   constexpr StridedIterator& operator+=( ptrdiff_t inc ) noexcept;
+   constexpr StridedIterator& operator-=( ptrdiff_t dec ) noexcept;
+
+   StridedIterator& operator=( const StridedIterator& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Increment/decrement operators***************************************************************
+   /*!\name Increment/decrement operators */
+   //@{
+   constexpr StridedIterator&      operator++()      noexcept;
+   constexpr const StridedIterator operator++( int ) noexcept;
+   constexpr StridedIterator&      operator--()      noexcept;
+   constexpr const StridedIterator operator--( int ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\name Access operators */
+   //@{
+   constexpr ReferenceType operator[]( size_t index ) const noexcept;
+   constexpr ReferenceType operator* () const noexcept;
+   constexpr PointerType   operator->() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   constexpr PointerType base  () const noexcept;
+   constexpr ptrdiff_t   stride() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   PointerType ptr_;     //!< Pointer to the current element.
+   ptrdiff_t   stride_;  //!< Distance between two consecutive elements.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for the StridedIterator class.
+*/
+template< typename Type >  // Type of the elements
+constexpr StridedIterator<Type>::StridedIterator() noexcept
+   : ptr_   ( nullptr )  // Pointer to the current element
+   , stride_( 1L )       // Distance between two consecutive elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the StridedIterator class.
+//
+// \param ptr Pointer to the initial element.
+// \param stride The distance between two consecutive elements.
+*/
+template< typename Type >  // Type of the elements
+constexpr StridedIterator<Type>::StridedIterator( Type* ptr, ptrdiff_t stride ) noexcept
+   : ptr_   ( ptr    )  // Pointer to the current element
+   , stride_( stride )  // Distance between two consecutive elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different StridedIterator instances.
+//
+// \param it The foreign StridedIterator instance to be copied.
+*/
+template< typename Type >   // Type of the elements
+template< typename Other >  // Type of the foreign elements
+constexpr StridedIterator<Type>::StridedIterator( const StridedIterator<Other>& it ) noexcept
+   : ptr_   ( it.base()   )  // Pointer to the current element
+   , stride_( it.stride() )  // Distance between two consecutive elements
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator.
+//
+// \param inc The increment of the iterator.
+// \return Reference to the incremented iterator.
+*/
+template< typename Type >  // Type of the elements
+constexpr StridedIterator<Type>& StridedIterator<Type>::operator+=( ptrdiff_t inc ) noexcept
+{
+   ptr_ += inc * stride_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator.
+//
+// \param dec The decrement of the iterator.
+// \return Reference to the decremented iterator.
+*/
+template< typename Type >  // Type of the elements
+constexpr StridedIterator<Type>& StridedIterator<Type>::operator-=( ptrdiff_t dec ) noexcept
+{
+   ptr_ -= dec * stride_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INCREMENT/DECREMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Pre-increment operator.
+//
+// \return Reference to the incremented iterator.
+*/
+template< typename Type >  // Type of the elements
+constexpr StridedIterator<Type>& StridedIterator<Type>::operator++() noexcept
+{
+   ptr_ += stride_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-increment operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename Type >  // Type of the elements
+constexpr const StridedIterator<Type> StridedIterator<Type>::operator++( int ) noexcept
+{
+   const StridedIterator tmp( *this );
+   ptr_ += stride_;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pre-decrement operator.
+//
+// \return Reference to the decremented iterator.
+*/
+template< typename Type >  // Type of the elements
+constexpr StridedIterator<Type>& StridedIterator<Type>::operator--() noexcept
+{
+   ptr_ -= stride_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-decrement operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename Type >  // Type of the elements
+constexpr const StridedIterator<Type> StridedIterator<Type>::operator--( int ) noexcept
+{
+   const StridedIterator tmp( *this );
+   ptr_ -= stride_;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the underlying elements.
+//
+// \param index Access index.
+// \return Reference to the accessed value.
+*/
+template< typename Type >  // Type of the elements
+constexpr typename StridedIterator<Type>::ReferenceType
+   StridedIterator<Type>::operator[]( size_t index ) const noexcept
+{
+   return ptr_[ static_cast<ptrdiff_t>( index ) * stride_ ];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a reference to the current element.
+//
+// \return Reference to the current element.
+*/
+template< typename Type >  // Type of the elements
+constexpr typename StridedIterator<Type>::ReferenceType
+   StridedIterator<Type>::operator*() const noexcept
+{
+   return *ptr_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the element at the current iterator position.
+//
+// \return Pointer to the element at the current iterator position.
+*/
+template< typename Type >  // Type of the elements
+constexpr typename StridedIterator<Type>::PointerType
+   StridedIterator<Type>::operator->() const noexcept
+{
+   return ptr_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Low-level access to the underlying member of the iterator.
+//
+// \return Pointer to the current element.
+*/
+template< typename Type >  // Type of the elements
+constexpr typename StridedIterator<Type>::PointerType
+   StridedIterator<Type>::base() const noexcept
+{
+   return ptr_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the distance between two consecutive elements.
+//
+// \return The stride of the iterator.
+*/
+template< typename Type >  // Type of the elements
+constexpr ptrdiff_t StridedIterator<Type>::stride() const noexcept
+{
+   return stride_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name StridedIterator operators */
+//@{
+template< typename T1, typename T2 >
+constexpr bool
+   operator==( const StridedIterator<T1>& lhs, const StridedIterator<T2>& rhs ) noexcept;
+
+template< typename T1, typename T2 >
+constexpr bool
+   operator!=( const StridedIterator<T1>& lhs, const StridedIterator<T2>& rhs ) noexcept;
+
+template< typename T1, typename T2 >
+constexpr bool
+   operator<( const StridedIterator<T1>& lhs, const StridedIterator<T2>& rhs ) noexcept;
+
+template< typename T1, typename T2 >
+constexpr bool
+   operator>( const StridedIterator<T1>& lhs, const StridedIterator<T2>& rhs ) noexcept;
+
+template< typename T1, typename T2 >
+constexpr bool
+   operator<=( const StridedIterator<T1>& lhs, const StridedIterator<T2>& rhs ) noexcept;
+
+template< typename T1, typename T2 >
+constexpr bool
+   operator>=( const StridedIterator<T1>& lhs, const StridedIterator<T2>& rhs ) noexcept;
+
+template< typename Type >
+constexpr const StridedIterator<Type>
+   operator+( const StridedIterator<Type>& it, ptrdiff_t inc ) noexcept;
+
+template< typename Type >
+constexpr const StridedIterator<Type>
+   operator+( ptrdiff_t inc, const StridedIterator<Type>& it ) noexcept;
+
+template< typename Type >
+constexpr const StridedIterator<Type>
+   operator-( const StridedIterator<Type>& it, ptrdiff_t dec ) noexcept;
+
+template< typename Type >
+constexpr ptrdiff_t
+   operator-( const StridedIterator<Type>& lhs, const StridedIterator<Type>& rhs ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two StridedIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators refer to the same element, \a false if not.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , typename T2 >  // Element type of the right-hand side iterator
+constexpr bool
+   operator==( const StridedIterator<T1>& lhs, const StridedIterator<T2>& rhs ) noexcept
+{
+   return lhs.base() == rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two StridedIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators don't refer to the same element, \a false if they do.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , typename T2 >  // Element type of the right-hand side iterator
+constexpr bool
+   operator!=( const StridedIterator<T1>& lhs, const StridedIterator<T2>& rhs ) noexcept
+{
+   return lhs.base() != rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between two StridedIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is smaller, \a false if not.
+//
+// Note that the comparison takes the direction of the stride into account, i.e. for a negative
+// stride an iterator is smaller than another iterator if it points to a higher address.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , typename T2 >  // Element type of the right-hand side iterator
+constexpr bool
+   operator<( const StridedIterator<T1>& lhs, const StridedIterator<T2>& rhs ) noexcept
+{
+   return ( lhs.stride() < 0L ) ? ( lhs.base() > rhs.base() ) : ( lhs.base() < rhs.base() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between two StridedIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater, \a false if not.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , typename T2 >  // Element type of the right-hand side iterator
+constexpr bool
+   operator>( const StridedIterator<T1>& lhs, const StridedIterator<T2>& rhs ) noexcept
+{
+   return rhs < lhs;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between two StridedIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is less or equal, \a false if not.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , typename T2 >  // Element type of the right-hand side iterator
+constexpr bool
+   operator<=( const StridedIterator<T1>& lhs, const StridedIterator<T2>& rhs ) noexcept
+{
+   return !( rhs < lhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between two StridedIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , typename T2 >  // Element type of the right-hand side iterator
+constexpr bool
+   operator>=( const StridedIterator<T1>& lhs, const StridedIterator<T2>& rhs ) noexcept
+{
+   return !( lhs < rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between a StridedIterator and an integral value.
+//
+// \param it The iterator to be incremented.
+// \param inc The number of elements the iterator is incremented.
+// \return The incremented iterator.
+*/
+template< typename Type >  // Element type of the iterator
+constexpr const StridedIterator<Type>
+   operator+( const StridedIterator<Type>& it, ptrdiff_t inc ) noexcept
+{
+   return StridedIterator<Type>( it.base() + inc * it.stride(), it.stride() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between an integral value and a StridedIterator.
+//
+// \param inc The number of elements the iterator is incremented.
+// \param it The iterator to be incremented.
+// \return The incremented iterator.
+*/
+template< typename Type >  // Element type of the iterator
+constexpr const StridedIterator<Type>
+   operator+( ptrdiff_t inc, const StridedIterator<Type>& it ) noexcept
+{
+   return StridedIterator<Type>( it.base() + inc * it.stride(), it.stride() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction between a StridedIterator and an integral value.
+//
+// \param it The iterator to be decremented.
+// \param dec The number of elements the iterator is decremented.
+// \return The decremented iterator.
+*/
+template< typename Type >  // Element type of the iterator
+constexpr const StridedIterator<Type>
+   operator-( const StridedIterator<Type>& it, ptrdiff_t dec ) noexcept
+{
+   return StridedIterator<Type>( it.base() - dec * it.stride(), it.stride() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the number of elements between two StridedIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return The number of elements between the two iterators.
+*/
+template< typename Type >  // Element type of the iterator
+constexpr ptrdiff_t
+   operator-( const StridedIterator<Type>& lhs, const StridedIterator<Type>& rhs ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( lhs.stride() == rhs.stride(), "Incompatible iterators detected" );
+   BLAZE_INTERNAL_ASSERT( lhs.stride() != 0L, "Invalid iterator stride detected" );
+   return ( lhs.base() - rhs.base() ) / lhs.stride();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
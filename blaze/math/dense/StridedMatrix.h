@@ -0,0 +1,2484 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/StridedMatrix.h
+//  \brief Header file for the implementation of a strided dense matrix
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_STRIDEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_STRIDEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/SameTag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/dense/StridedIterator.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/CustomOppositeType.h>
+#include <blaze/math/typetraits/CustomTransposeType.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsCustom.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/IsStrided.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup strided_matrix StridedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a dense matrix view on external memory with runtime strides.
+// \ingroup strided_matrix
+//
+// The StridedMatrix class template represents an external array of elements as a native \b Blaze
+// dense matrix. In contrast to the CustomMatrix, which requires the elements of each row (or
+// column) to be contiguous in memory, the elements of a strided matrix are addressed via two
+// arbitrary runtime strides:
+
+                           \f[ A(i,j) = ptr[i \cdot rowStride + j \cdot columnStride]. \f]
+
+// Thus a strided matrix can refer to row-major and column-major arrays, to transposed arrays,
+// to every n-th row/column of an array, or to arrays with negative strides (as for instance
+// reversed NumPy or PyTorch views) without copying any element. As the CustomMatrix, a strided
+// matrix does not perform any kind of memory allocation by itself and does not take
+// responsibility for the given array of elements.
+//
+// The type of the elements, the storage order, the group tag, and the result type of the matrix
+// can be specified via the following four template parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, bool SO, typename Tag, typename RT >
+   class StridedMatrix;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. StridedMatrix can be used with any
+//          non-cv-qualified, non-reference element type.
+//  - SO  : specifies the storage order (\c blaze::rowMajor, \c blaze::columnMajor) of the matrix,
+//          i.e. whether the iterators of the matrix traverse rows or columns. The default value
+//          is \c blaze::defaultStorageOrder.
+//  - Tag : optional type parameter to tag the matrix. The default type is \c blaze::Group0.
+//          See \ref grouping_tagging for details.
+//  - RT  : specifies the resulting type of the matrix. The default is a DynamicMatrix.
+//
+// The following examples give an impression of several possible strided matrices:
+
+   \code
+   using blaze::StridedMatrix;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   std::vector<double> memory( 24UL );
+
+   // 4x6 row-major matrix, directly referring to the given (contiguous) array
+   StridedMatrix<double,rowMajor> A( memory.data(), 4UL, 6UL );
+
+   // 6x4 matrix representing the transpose of A
+   StridedMatrix<double,rowMajor> B( memory.data(), 6UL, 4UL, 1L, 6L );
+
+   // 2x3 matrix referring to every second row and column of A
+   StridedMatrix<double,columnMajor> C( memory.data(), 2UL, 3UL, 12L, 2L );
+
+   // 4x6 matrix referring to A with reversed rows
+   StridedMatrix<double,rowMajor> D( memory.data()+18UL, 4UL, 6UL, -6L, 1L );
+   \endcode
+
+// \n \section stridedmatrix_performance Performance
+//
+// Strided matrices are fully integrated into the expression template framework and can be used
+// in all arithmetic operations. In case one of the two strides is 1 and the other stride prevents
+// any overlap between the rows or columns, the strided matrix is assigned via the vectorized
+// kernels of a CustomMatrix. All other strides result in element-wise kernels. Additionally,
+// strided operands of dense matrix multiplications are fully materialized before the
+// multiplication in order to enable the vectorized and BLAS-based multiplication kernels, i.e.
+// the complete operand is copied into a temporary matrix of its result type. Note that this
+// requires additional memory of the size of the operand and one full pass over its elements.
+//
+// The aliasing detection of a strided matrix is based on the range of memory touched by the
+// matrix, i.e. the range from the lowest to the highest addressed element. Thus an assignment
+// between two strided matrices (or a strided matrix and a contiguous dense matrix) referring to
+// overlapping memory, as for instance an assignment of the transposed or reversed view on the
+// same array of elements, is evaluated via a temporary:
+
+   \code
+   std::vector<int> memory( 9UL );
+   StridedMatrix<int,rowMajor> A( memory.data(), 3UL, 3UL, 3L, 1L );
+   StridedMatrix<int,rowMajor> B( memory.data(), 3UL, 3UL, 1L, 3L );  // Transposed view on A
+
+   A = B;  // Correctly evaluated via a temporary matrix
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+class StridedMatrix
+   : public DenseMatrix< StridedMatrix<Type,SO,Tag,RT>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This     = StridedMatrix<Type,SO,Tag,RT>;  //!< Type of this StridedMatrix instance.
+   using BaseType = DenseMatrix<This,SO>;           //!< Base type of this StridedMatrix instance.
+
+   //! Result type for expression template evaluations.
+   using ResultType = RT;
+
+   //! Result type with opposite storage order for expression template evaluations.
+   using OppositeType = CustomOppositeType_t<RT>;
+
+   //! Transpose type for expression template evaluations.
+   using TransposeType = CustomTransposeType_t<RT>;
+
+   using ElementType   = Type;         //!< Type of the matrix elements.
+   using TagType       = Tag;          //!< Tag type of this StridedMatrix instance.
+   using ReturnType    = const Type&;  //!< Return type for expression template evaluations.
+   using CompositeType = const This&;  //!< Data type for composite expression templates.
+
+   using Reference      = Type&;        //!< Reference to a non-constant matrix value.
+   using ConstReference = const Type&;  //!< Reference to a constant matrix value.
+   using Pointer        = Type*;        //!< Pointer to a non-constant matrix value.
+   using ConstPointer   = const Type*;  //!< Pointer to a constant matrix value.
+
+   using Iterator      = StridedIterator<Type>;        //!< Iterator over non-constant elements.
+   using ConstIterator = StridedIterator<const Type>;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a StridedMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using RRT   = Rebind_t< RT, RemoveConst_t<NewType> >;  //!< The rebound result type.
+      using Other = StridedMatrix<NewType,SO,Tag,RRT>;       //!< The type of the other StridedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a StridedMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using RRT   = Resize_t<RT,NewM,NewN>;          //!< The resized result type.
+      using Other = StridedMatrix<Type,SO,Tag,RRT>;  //!< The type of the other StridedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. Since the elements of a strided matrix are in
+       general not contiguous in memory, the \a simdEnabled compilation flag is set to \a false. */
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline StridedMatrix();
+   inline StridedMatrix( Type* ptr, size_t m, size_t n );
+   inline StridedMatrix( Type* ptr, size_t m, size_t n, ptrdiff_t rowStride, ptrdiff_t columnStride );
+
+   inline StridedMatrix( const StridedMatrix& m );
+   inline StridedMatrix( StridedMatrix&& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~StridedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t i ) noexcept;
+   inline ConstPointer   data  ( size_t i ) const noexcept;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline StridedMatrix& operator=( const Type& set );
+   inline StridedMatrix& operator=( initializer_list< initializer_list<Type> > list );
+
+   template< typename Other, size_t Rows, size_t Cols >
+   inline StridedMatrix& operator=( const Other (&array)[Rows][Cols] );
+
+   inline StridedMatrix& operator=( const StridedMatrix& rhs );
+   inline StridedMatrix& operator=( StridedMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline StridedMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline StridedMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline StridedMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline StridedMatrix& operator%=( const Matrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t    rows() const noexcept;
+   inline size_t    columns() const noexcept;
+   inline ptrdiff_t rowStride() const noexcept;
+   inline ptrdiff_t columnStride() const noexcept;
+   inline size_t    spacing() const noexcept;
+   inline size_t    capacity() const noexcept;
+   inline size_t    capacity( size_t i ) const noexcept;
+   inline size_t    nonZeros() const;
+   inline size_t    nonZeros( size_t i ) const;
+   inline void      reset();
+   inline void      reset( size_t i );
+   inline void      clear();
+   inline void      swap( StridedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline StridedMatrix& transpose();
+   inline StridedMatrix& ctranspose();
+
+   template< typename Other > inline StridedMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Resource management functions***************************************************************
+   /*!\name Resource management functions */
+   //@{
+   inline void reset( Type* ptr, size_t m, size_t n );
+   inline void reset( Type* ptr, size_t m, size_t n, ptrdiff_t rowStride, ptrdiff_t columnStride );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   //! Contiguous row-major view on the array of elements.
+   using RowMajorView = CustomMatrix<Type,unaligned,unpadded,rowMajor,Tag>;
+
+   //! Contiguous column-major view on the array of elements.
+   using ColumnMajorView = CustomMatrix<Type,unaligned,unpadded,columnMajor,Tag>;
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline ptrdiff_t       offset( size_t i, size_t j ) const noexcept;
+   inline bool            hasContiguousRows   () const noexcept;
+   inline bool            hasContiguousColumns() const noexcept;
+   inline RowMajorView    rowMajorView   () const;
+   inline ColumnMajorView columnMajorView() const;
+
+   inline bool overlaps( const void* first, const void* last ) const noexcept;
+
+   template< typename Other >
+   inline bool aliases( const Other* alias, FalseType ) const noexcept;
+
+   template< typename Other >
+   inline bool aliases( const Other* alias, TrueType ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   template< typename Other, bool SO2, typename Tag2, typename RT2 >
+   inline bool canAlias( const StridedMatrix<Other,SO2,Tag2,RT2>* alias ) const noexcept;
+
+   template< typename Other, bool SO2, typename Tag2, typename RT2 >
+   inline bool isAliased( const StridedMatrix<Other,SO2,Tag2,RT2>* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign     ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void assign     ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void schurAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void schurAssign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t    m_;   //!< The current number of rows of the matrix.
+   size_t    n_;   //!< The current number of columns of the matrix.
+   ptrdiff_t rs_;  //!< The distance between two consecutive rows.
+   ptrdiff_t cs_;  //!< The distance between two consecutive columns.
+   Type* v_;       //!< The custom array of elements.
+                   /*!< Access to the matrix element \f$ (i,j) \f$ is gained via
+                        \f$ v_[i \cdot rs_ + j \cdot cs_] \f$. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for StridedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedMatrix<Type,SO,Tag,RT>::StridedMatrix()
+   : m_ ( 0UL )      // The current number of rows of the matrix
+   , n_ ( 0UL )      // The current number of columns of the matrix
+   , rs_( 1L )       // The distance between two consecutive rows
+   , cs_( 1L )       // The distance between two consecutive columns
+   , v_ ( nullptr )  // The custom array of elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$ referring to a contiguous array.
+//
+// \param ptr The array of elements to be used by the matrix.
+// \param m The number of rows of the array of elements.
+// \param n The number of columns of the array of elements.
+// \exception std::invalid_argument Invalid setup of strided matrix.
+//
+// This constructor creates a strided matrix of size \f$ m \times n \f$ referring to the given
+// contiguous array of elements. In case of a row-major matrix the array is interpreted as
+// row-major array (i.e. the row stride is \a n and the column stride is 1), in case of a
+// column-major matrix the array is interpreted as column-major array (i.e. the row stride is 1
+// and the column stride is \a m). In case the given pointer is \c nullptr, a
+// \a std::invalid_argument exception is thrown.
+//
+// \note The strided matrix does \b NOT take responsibility for the given array of elements!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedMatrix<Type,SO,Tag,RT>::StridedMatrix( Type* ptr, size_t m, size_t n )
+   : StridedMatrix( ptr, m, n, ( SO ? 1L : static_cast<ptrdiff_t>( max( n, 1UL ) ) )
+                             , ( SO ? static_cast<ptrdiff_t>( max( m, 1UL ) ) : 1L ) )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$ with the given strides.
+//
+// \param ptr The array of elements to be used by the matrix.
+// \param m The number of rows of the array of elements.
+// \param n The number of columns of the array of elements.
+// \param rowStride The distance between two consecutive rows (in number of elements).
+// \param columnStride The distance between two consecutive columns (in number of elements).
+// \exception std::invalid_argument Invalid setup of strided matrix.
+//
+// This constructor creates a strided matrix of size \f$ m \times n \f$ referring to the given
+// array of elements. The element \f$ (i,j) \f$ of the matrix is located at position
+// \f$ i \cdot rowStride + j \cdot columnStride \f$ of the array. Both strides may be negative,
+// but must not be 0. The constructor fails if ...
+//
+//  - ... the passed pointer is \c nullptr;
+//  - ... any of the two strides is 0.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown.
+//
+// \note The strided matrix does \b NOT take responsibility for the given array of elements!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedMatrix<Type,SO,Tag,RT>::StridedMatrix( Type* ptr, size_t m, size_t n,
+                                                     ptrdiff_t rowStride, ptrdiff_t columnStride )
+   : m_ ( m )             // The current number of rows of the matrix
+   , n_ ( n )             // The current number of columns of the matrix
+   , rs_( rowStride )     // The distance between two consecutive rows
+   , cs_( columnStride )  // The distance between two consecutive columns
+   , v_ ( ptr )           // The custom array of elements
+{
+   if( ptr == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of elements" );
+   }
+
+   if( rowStride == 0L || columnStride == 0L ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid stride detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for StridedMatrix.
+//
+// \param m Matrix to be copied.
+//
+// The copy constructor initializes the strided matrix as an exact copy of the given strided
+// matrix, i.e. both matrices refer to the same array of elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedMatrix<Type,SO,Tag,RT>::StridedMatrix( const StridedMatrix& m )
+   : m_ ( m.m_  )  // The current number of rows of the matrix
+   , n_ ( m.n_  )  // The current number of columns of the matrix
+   , rs_( m.rs_ )  // The distance between two consecutive rows
+   , cs_( m.cs_ )  // The distance between two consecutive columns
+   , v_ ( m.v_  )  // The custom array of elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for StridedMatrix.
+//
+// \param m The matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedMatrix<Type,SO,Tag,RT>::StridedMatrix( StridedMatrix&& m ) noexcept
+   : m_ ( m.m_  )  // The current number of rows of the matrix
+   , n_ ( m.n_  )  // The current number of columns of the matrix
+   , rs_( m.rs_ )  // The distance between two consecutive rows
+   , cs_( m.cs_ )  // The distance between two consecutive columns
+   , v_ ( m.v_  )  // The custom array of elements
+{
+   m.m_  = 0UL;
+   m.n_  = 0UL;
+   m.rs_ = 1L;
+   m.cs_ = 1L;
+   m.v_  = nullptr;
+
+   BLAZE_INTERNAL_ASSERT( m.data() == nullptr, "Invalid data reference detected" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for StridedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedMatrix<Type,SO,Tag,RT>::~StridedMatrix()
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( RT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( RT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE( RT );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::Reference
+   StridedMatrix<Type,SO,Tag,RT>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[offset(i,j)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::ConstReference
+   StridedMatrix<Type,SO,Tag,RT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[offset(i,j)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::Reference
+   StridedMatrix<Type,SO,Tag,RT>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::ConstReference
+   StridedMatrix<Type,SO,Tag,RT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the first element of the matrix.
+//
+// This function returns a pointer to the element \f$ (0,0) \f$ of the strided matrix. Note that
+// in contrast to other dense matrices the elements of a strided matrix are not guaranteed to be
+// stored contiguously. The location of all other elements has to be determined via the
+// rowStride() and columnStride() functions.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::Pointer
+   StridedMatrix<Type,SO,Tag,RT>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the first element of the matrix.
+//
+// This function returns a pointer to the element \f$ (0,0) \f$ of the strided matrix. Note that
+// in contrast to other dense matrices the elements of a strided matrix are not guaranteed to be
+// stored contiguously. The location of all other elements has to be determined via the
+// rowStride() and columnStride() functions.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::ConstPointer
+   StridedMatrix<Type,SO,Tag,RT>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the first element of row/column \a i.
+//
+// This function returns a pointer to the first element of row \a i (in case of a row-major
+// matrix) or column \a i (in case of a column-major matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::Pointer
+   StridedMatrix<Type,SO,Tag,RT>::data( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid dense matrix row/column access index" );
+   return v_ + ( SO ? offset( 0UL, i ) : offset( i, 0UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the first element of row/column \a i.
+//
+// This function returns a pointer to the first element of row \a i (in case of a row-major
+// matrix) or column \a i (in case of a column-major matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::ConstPointer
+   StridedMatrix<Type,SO,Tag,RT>::data( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid dense matrix row/column access index" );
+   return v_ + ( SO ? offset( 0UL, i ) : offset( i, 0UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::Iterator
+   StridedMatrix<Type,SO,Tag,RT>::begin( size_t i ) noexcept
+{
+   return Iterator( data( i ), ( SO ? rs_ : cs_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::ConstIterator
+   StridedMatrix<Type,SO,Tag,RT>::begin( size_t i ) const noexcept
+{
+   return ConstIterator( data( i ), ( SO ? rs_ : cs_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::ConstIterator
+   StridedMatrix<Type,SO,Tag,RT>::cbegin( size_t i ) const noexcept
+{
+   return ConstIterator( data( i ), ( SO ? rs_ : cs_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::Iterator
+   StridedMatrix<Type,SO,Tag,RT>::end( size_t i ) noexcept
+{
+   return begin( i ) + static_cast<ptrdiff_t>( SO ? m_ : n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::ConstIterator
+   StridedMatrix<Type,SO,Tag,RT>::end( size_t i ) const noexcept
+{
+   return cbegin( i ) + static_cast<ptrdiff_t>( SO ? m_ : n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::ConstIterator
+   StridedMatrix<Type,SO,Tag,RT>::cend( size_t i ) const noexcept
+{
+   return cbegin( i ) + static_cast<ptrdiff_t>( SO ? m_ : n_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all matrix elements.
+//
+// \param rhs Scalar value to be assigned to all matrix elements.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedMatrix<Type,SO,Tag,RT>&
+   StridedMatrix<Type,SO,Tag,RT>::operator=( const Type& rhs )
+{
+   for( size_t i=0UL; i<m_; ++i )
+      for( size_t j=0UL; j<n_; ++j )
+         v_[offset(i,j)] = rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Invalid assignment to strided matrix.
+//
+// This assignment operator offers the option to directly assign to all elements of the matrix
+// by means of an initializer list:
+
+   \code
+   int array[9] = { 0, 0, 0,
+                    0, 0, 0,
+                    0, 0, 0 };
+   blaze::StridedMatrix<int,blaze::rowMajor> A( array, 3UL, 3UL, 1L, 3L );
+   A = { { 1, 2, 3 },
+         { 4, 5 },
+         { 7, 8, 9 } };
+   \endcode
+
+// The matrix elements are assigned the values from the given initializer list. Missing values
+// are initialized as default (as e.g. the value 6 in the example). Note that in case the size
+// of the top-level initializer list does not match the number of rows or the size of any nested
+// list exceeds the number of columns, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedMatrix<Type,SO,Tag,RT>&
+   StridedMatrix<Type,SO,Tag,RT>::operator=( initializer_list< initializer_list<Type> > list )
+{
+   if( list.size() != m_ || determineColumns( list ) > n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to strided matrix" );
+   }
+
+   size_t i( 0UL );
+
+   for( const auto& rowList : list ) {
+      size_t j( 0UL );
+      for( const auto& element : rowList ) {
+         v_[offset(i,j)] = element;
+         ++j;
+      }
+      for( ; j<n_; ++j ) {
+         v_[offset(i,j)] = Type();
+      }
+      ++i;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Array assignment to all matrix elements.
+//
+// \param array Static array for the assignment.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid array size.
+//
+// This assignment operator offers the option to directly set all elements of the matrix. Note
+// that the size of the static array must match the size of the strided matrix. Otherwise a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename RT >   // Result type
+template< typename Other  // Data type of the static array
+        , size_t Rows     // Number of rows of the static array
+        , size_t Cols >   // Number of columns of the static array
+inline StridedMatrix<Type,SO,Tag,RT>&
+   StridedMatrix<Type,SO,Tag,RT>::operator=( const Other (&array)[Rows][Cols] )
+{
+   if( m_ != Rows || n_ != Cols ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array size" );
+   }
+
+   for( size_t i=0UL; i<Rows; ++i )
+      for( size_t j=0UL; j<Cols; ++j )
+         v_[offset(i,j)] = array[i][j];
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for StridedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The matrix is initialized as a copy of the given matrix. In case the current sizes of the two
+// matrices don't match, a \a std::invalid_argument exception is thrown. In case the given matrix
+// refers to memory overlapping the memory of this matrix, the assignment is performed via a
+// temporary matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedMatrix<Type,SO,Tag,RT>&
+   StridedMatrix<Type,SO,Tag,RT>::operator=( const StridedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   if( rhs.rows() != m_ || rhs.columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( isAliased( &rhs ) ) {
+      const ResultType tmp( rhs );
+      smpAssign( *this, tmp );
+   }
+   else {
+      smpAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for StridedMatrix.
+//
+// \param rhs Matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedMatrix<Type,SO,Tag,RT>&
+   StridedMatrix<Type,SO,Tag,RT>::operator=( StridedMatrix&& rhs ) noexcept
+{
+   m_  = rhs.m_;
+   n_  = rhs.n_;
+   rs_ = rhs.rs_;
+   cs_ = rhs.cs_;
+   v_  = rhs.v_;
+
+   rhs.m_  = 0UL;
+   rhs.n_  = 0UL;
+   rhs.rs_ = 1L;
+   rhs.cs_ = 1L;
+   rhs.v_  = nullptr;
+
+   BLAZE_INTERNAL_ASSERT( rhs.data() == nullptr, "Invalid data reference detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The matrix is initialized as a copy of the given matrix. In case the current sizes of the two
+// matrices don't match, a \a std::invalid_argument exception is thrown. In case the elements of
+// the strided matrix are contiguous in at least one dimension the assignment is performed via a
+// CustomMatrix view, which enables all vectorized and BLAS-based kernels.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline StridedMatrix<Type,SO,Tag,RT>&
+   StridedMatrix<Type,SO,Tag,RT>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).rows() != m_ || (*rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (*rhs).canAlias( this ) || canAlias( &(*rhs) ) ) {
+      const ResultType_t<MT> tmp( *rhs );
+      smpAssign( *this, tmp );
+   }
+   else if( hasContiguousRows() ) {
+      RowMajorView view( rowMajorView() );
+      view = *rhs;
+   }
+   else if( hasContiguousColumns() ) {
+      ColumnMajorView view( columnMajorView() );
+      view = *rhs;
+   }
+   else {
+      if( IsSparseMatrix_v<MT> )
+         reset();
+      smpAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline StridedMatrix<Type,SO,Tag,RT>&
+   StridedMatrix<Type,SO,Tag,RT>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).rows() != m_ || (*rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (*rhs).canAlias( this ) || canAlias( &(*rhs) ) ) {
+      const ResultType_t<MT> tmp( *rhs );
+      smpAddAssign( *this, tmp );
+   }
+   else if( hasContiguousRows() ) {
+      RowMajorView view( rowMajorView() );
+      view += *rhs;
+   }
+   else if( hasContiguousColumns() ) {
+      ColumnMajorView view( columnMajorView() );
+      view += *rhs;
+   }
+   else {
+      smpAddAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline StridedMatrix<Type,SO,Tag,RT>&
+   StridedMatrix<Type,SO,Tag,RT>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).rows() != m_ || (*rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (*rhs).canAlias( this ) || canAlias( &(*rhs) ) ) {
+      const ResultType_t<MT> tmp( *rhs );
+      smpSubAssign( *this, tmp );
+   }
+   else if( hasContiguousRows() ) {
+      RowMajorView view( rowMajorView() );
+      view -= *rhs;
+   }
+   else if( hasContiguousColumns() ) {
+      ColumnMajorView view( columnMajorView() );
+      view -= *rhs;
+   }
+   else {
+      smpSubAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a matrix (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline StridedMatrix<Type,SO,Tag,RT>&
+   StridedMatrix<Type,SO,Tag,RT>::operator%=( const Matrix<MT,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).rows() != m_ || (*rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (*rhs).canAlias( this ) || canAlias( &(*rhs) ) ) {
+      const ResultType_t<MT> tmp( *rhs );
+      smpSchurAssign( *this, tmp );
+   }
+   else if( hasContiguousRows() ) {
+      RowMajorView view( rowMajorView() );
+      view %= *rhs;
+   }
+   else if( hasContiguousColumns() ) {
+      ColumnMajorView view( columnMajorView() );
+      view %= *rhs;
+   }
+   else {
+      smpSchurAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline size_t StridedMatrix<Type,SO,Tag,RT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline size_t StridedMatrix<Type,SO,Tag,RT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the distance between two consecutive rows of the matrix.
+//
+// \return The row stride of the matrix (in number of elements).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline ptrdiff_t StridedMatrix<Type,SO,Tag,RT>::rowStride() const noexcept
+{
+   return rs_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the distance between two consecutive columns of the matrix.
+//
+// \return The column stride of the matrix (in number of elements).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline ptrdiff_t StridedMatrix<Type,SO,Tag,RT>::columnStride() const noexcept
+{
+   return cs_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows/columns.
+//
+// \return The spacing between the beginning of two rows/columns.
+//
+// This function returns the spacing between the beginning of two rows/columns, i.e. the
+// row stride in case of a row-major matrix and the column stride in case of a column-major
+// matrix. In case the stride is negative, the function returns 0. Note that in contrast to
+// other dense matrices the elements within a row/column are in general not contiguous!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline size_t StridedMatrix<Type,SO,Tag,RT>::spacing() const noexcept
+{
+   const ptrdiff_t stride( SO ? cs_ : rs_ );
+   return ( stride > 0L )?( static_cast<size_t>( stride ) ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline size_t StridedMatrix<Type,SO,Tag,RT>::capacity() const noexcept
+{
+   return m_ * n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline size_t StridedMatrix<Type,SO,Tag,RT>::capacity( size_t i ) const noexcept
+{
+   MAYBE_UNUSED( i );
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+   return ( SO ? m_ : n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the dense matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline size_t StridedMatrix<Type,SO,Tag,RT>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( size_t j=0UL; j<n_; ++j )
+         if( !isDefault<strict>( v_[offset(i,j)] ) )
+            ++nonzeros;
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline size_t StridedMatrix<Type,SO,Tag,RT>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+
+   size_t nonzeros( 0UL );
+
+   for( auto element=cbegin(i); element!=cend(i); ++element )
+      if( !isDefault<strict>( *element ) )
+         ++nonzeros;
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline void StridedMatrix<Type,SO,Tag,RT>::reset()
+{
+   using blaze::clear;
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( size_t j=0UL; j<n_; ++j )
+         clear( v_[offset(i,j)] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline void StridedMatrix<Type,SO,Tag,RT>::reset( size_t i )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+
+   for( auto element=begin(i); element!=end(i); ++element )
+      clear( *element );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline void StridedMatrix<Type,SO,Tag,RT>::clear()
+{
+   m_  = 0UL;
+   n_  = 0UL;
+   rs_ = 1L;
+   cs_ = 1L;
+   v_  = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline void StridedMatrix<Type,SO,Tag,RT>::swap( StridedMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( m_ , m.m_  );
+   swap( n_ , m.n_  );
+   swap( rs_, m.rs_ );
+   swap( cs_, m.cs_ );
+   swap( v_ , m.v_  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the offset of the element \f$ (i,j) \f$ within the array of elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The offset of the element (in number of elements).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline ptrdiff_t StridedMatrix<Type,SO,Tag,RT>::offset( size_t i, size_t j ) const noexcept
+{
+   return static_cast<ptrdiff_t>( i )*rs_ + static_cast<ptrdiff_t>( j )*cs_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the elements of each row are contiguous in memory.
+//
+// \return \a true in case the rows are contiguous and non-overlapping, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline bool StridedMatrix<Type,SO,Tag,RT>::hasContiguousRows() const noexcept
+{
+   return ( m_ != 0UL && n_ != 0UL && cs_ == 1L &&
+            ( m_ == 1UL || rs_ >= static_cast<ptrdiff_t>( n_ ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the elements of each column are contiguous in memory.
+//
+// \return \a true in case the columns are contiguous and non-overlapping, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline bool StridedMatrix<Type,SO,Tag,RT>::hasContiguousColumns() const noexcept
+{
+   return ( m_ != 0UL && n_ != 0UL && rs_ == 1L &&
+            ( n_ == 1UL || cs_ >= static_cast<ptrdiff_t>( m_ ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a row-major CustomMatrix view on the array of elements.
+//
+// \return The row-major view on the matrix.
+//
+// This function must only be called in case the rows of the matrix are contiguous (see the
+// hasContiguousRows() function).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::RowMajorView
+   StridedMatrix<Type,SO,Tag,RT>::rowMajorView() const
+{
+   BLAZE_INTERNAL_ASSERT( hasContiguousRows(), "Non-contiguous rows detected" );
+   return RowMajorView( v_, m_, n_, ( m_ > 1UL ? static_cast<size_t>( rs_ ) : n_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a column-major CustomMatrix view on the array of elements.
+//
+// \return The column-major view on the matrix.
+//
+// This function must only be called in case the columns of the matrix are contiguous (see the
+// hasContiguousColumns() function).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedMatrix<Type,SO,Tag,RT>::ColumnMajorView
+   StridedMatrix<Type,SO,Tag,RT>::columnMajorView() const
+{
+   BLAZE_INTERNAL_ASSERT( hasContiguousColumns(), "Non-contiguous columns detected" );
+   return ColumnMajorView( v_, m_, n_, ( n_ > 1UL ? static_cast<size_t>( cs_ ) : m_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix touches memory in the given range.
+//
+// \param first Pointer to the first byte of the range.
+// \param last Pointer to the last byte of the range (inclusive).
+// \return \a true in case the matrix overlaps the given range, \a false if not.
+//
+// The memory touched by the matrix is the range from its lowest to its highest addressed
+// element, which for negative strides differs from the range starting at the data pointer.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline bool
+   StridedMatrix<Type,SO,Tag,RT>::overlaps( const void* first, const void* last ) const noexcept
+{
+   if( m_ == 0UL || n_ == 0UL )
+      return false;
+
+   const ptrdiff_t rowExtent   ( static_cast<ptrdiff_t>( m_-1UL ) * rs_ );
+   const ptrdiff_t columnExtent( static_cast<ptrdiff_t>( n_-1UL ) * cs_ );
+
+   const char* lower( reinterpret_cast<const char*>(
+      v_ + ( rowExtent < 0L ? rowExtent : 0L ) + ( columnExtent < 0L ? columnExtent : 0L ) ) );
+   const char* upper( reinterpret_cast<const char*>(
+      v_ + ( rowExtent > 0L ? rowExtent : 0L ) + ( columnExtent > 0L ? columnExtent : 0L ) ) );
+   upper += sizeof( Type ) - 1UL;
+
+   return lower <= static_cast<const char*>( last ) && static_cast<const char*>( first ) <= upper;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given non-contiguous data structure.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+template< typename Other >  // Data type of the foreign expression
+inline bool StridedMatrix<Type,SO,Tag,RT>::aliases( const Other* alias, FalseType ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given contiguous dense matrix.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the matrix overlaps the memory of the alias, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+template< typename Other >  // Data type of the foreign expression
+inline bool StridedMatrix<Type,SO,Tag,RT>::aliases( const Other* alias, TrueType ) const noexcept
+{
+   using ET = ElementType_t<Other>;
+
+   const size_t major( IsColumnMajorMatrix_v<Other> ? alias->columns() : alias->rows() );
+   const size_t minor( IsColumnMajorMatrix_v<Other> ? alias->rows() : alias->columns() );
+
+   if( major == 0UL || minor == 0UL )
+      return false;
+
+   const ET* first( alias->data() );
+   const ET* last ( first + ( major-1UL )*alias->spacing() + ( minor-1UL ) );
+
+   return overlaps( first, reinterpret_cast<const char*>( last ) + sizeof( ET ) - 1UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+// \exception std::logic_error Impossible transpose operation.
+//
+// In case the matrix is not a square matrix, a \a std::logic_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedMatrix<Type,SO,Tag,RT>& StridedMatrix<Type,SO,Tag,RT>::transpose()
+{
+   using std::swap;
+
+   if( m_ != n_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "Impossible transpose operation" );
+   }
+
+   for( size_t i=1UL; i<m_; ++i )
+      for( size_t j=0UL; j<i; ++j )
+         swap( v_[offset(i,j)], v_[offset(j,i)] );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+// \exception std::logic_error Impossible transpose operation.
+//
+// In case the matrix is not a square matrix, a \a std::logic_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedMatrix<Type,SO,Tag,RT>& StridedMatrix<Type,SO,Tag,RT>::ctranspose()
+{
+   if( m_ != n_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "Impossible transpose operation" );
+   }
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         cswap( v_[offset(i,j)], v_[offset(j,i)] );
+      }
+      conjugate( v_[offset(i,i)] );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+//
+// This function scales the matrix by applying the given scalar value \a scalar to each element
+// of the matrix. For built-in and \c complex data types it has the same effect as using the
+// multiplication assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+template< typename Other >  // Data type of the scalar value
+inline StridedMatrix<Type,SO,Tag,RT>&
+   StridedMatrix<Type,SO,Tag,RT>::scale( const Other& scalar )
+{
+   for( size_t i=0UL; i<m_; ++i )
+      for( size_t j=0UL; j<n_; ++j )
+         v_[offset(i,j)] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RESOURCE MANAGEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Resets the strided matrix and replaces the array of elements with the given array.
+//
+// \param ptr The array of elements to be used by the matrix.
+// \param m The number of rows of the array of elements.
+// \param n The number of columns of the array of elements.
+// \return void
+// \exception std::invalid_argument Invalid setup of strided matrix.
+//
+// This function resets the strided matrix to the given contiguous array of elements of size
+// \f$ m \times n \f$. In case the given pointer is \c nullptr, a \a std::invalid_argument
+// exception is thrown.
+//
+// \note The strided matrix does NOT take responsibility for the new array of elements!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline void StridedMatrix<Type,SO,Tag,RT>::reset( Type* ptr, size_t m, size_t n )
+{
+   StridedMatrix tmp( ptr, m, n );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the strided matrix and replaces the array of elements with the given array.
+//
+// \param ptr The array of elements to be used by the matrix.
+// \param m The number of rows of the array of elements.
+// \param n The number of columns of the array of elements.
+// \param rowStride The distance between two consecutive rows (in number of elements).
+// \param columnStride The distance between two consecutive columns (in number of elements).
+// \return void
+// \exception std::invalid_argument Invalid setup of strided matrix.
+//
+// This function resets the strided matrix to the given array of elements of size
+// \f$ m \times n \f$ with the given strides. In case the given pointer is \c nullptr or any of
+// the two strides is 0, a \a std::invalid_argument exception is thrown.
+//
+// \note The strided matrix does NOT take responsibility for the new array of elements!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline void StridedMatrix<Type,SO,Tag,RT>::reset( Type* ptr, size_t m, size_t n,
+                                                  ptrdiff_t rowStride, ptrdiff_t columnStride )
+{
+   StridedMatrix tmp( ptr, m, n, rowStride, columnStride );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation. In case the alias is a contiguous dense matrix, the function
+// returns whether the memory of the alias overlaps the memory touched by the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+template< typename Other >  // Data type of the foreign expression
+inline bool StridedMatrix<Type,SO,Tag,RT>::canAlias( const Other* alias ) const noexcept
+{
+   return aliases( alias, BoolConstant< IsDenseMatrix_v<Other> && IsContiguous_v<Other> >() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given strided matrix \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the memory of the two matrices overlaps, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+template< typename Other    // Data type of the foreign strided matrix
+        , bool SO2          // Storage order of the foreign strided matrix
+        , typename Tag2     // Type tag of the foreign strided matrix
+        , typename RT2 >    // Result type of the foreign strided matrix
+inline bool StridedMatrix<Type,SO,Tag,RT>::canAlias(
+   const StridedMatrix<Other,SO2,Tag2,RT2>* alias ) const noexcept
+{
+   return isAliased( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation. In case the alias is a contiguous dense matrix, the function
+// returns whether the memory of the alias overlaps the memory touched by the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+template< typename Other >  // Data type of the foreign expression
+inline bool StridedMatrix<Type,SO,Tag,RT>::isAliased( const Other* alias ) const noexcept
+{
+   return aliases( alias, BoolConstant< IsDenseMatrix_v<Other> && IsContiguous_v<Other> >() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given strided matrix \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the memory of the two matrices overlaps, \a false if not.
+//
+// This function returns whether the memory touched by the given strided matrix, i.e. the range
+// from its lowest to its highest addressed element, overlaps the memory touched by the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+template< typename Other    // Data type of the foreign strided matrix
+        , bool SO2          // Storage order of the foreign strided matrix
+        , typename Tag2     // Type tag of the foreign strided matrix
+        , typename RT2 >    // Result type of the foreign strided matrix
+inline bool StridedMatrix<Type,SO,Tag,RT>::isAliased(
+   const StridedMatrix<Other,SO2,Tag2,RT2>* alias ) const noexcept
+{
+   if( alias->rows() == 0UL || alias->columns() == 0UL )
+      return false;
+
+   const ptrdiff_t rs( alias->rowStride() );
+   const ptrdiff_t cs( alias->columnStride() );
+
+   const ptrdiff_t rowExtent   ( static_cast<ptrdiff_t>( alias->rows()-1UL ) * rs );
+   const ptrdiff_t columnExtent( static_cast<ptrdiff_t>( alias->columns()-1UL ) * cs );
+
+   const Other* first( alias->data() + ( rowExtent    < 0L ? rowExtent    : 0L )
+                                     + ( columnExtent < 0L ? columnExtent : 0L ) );
+   const Other* last ( alias->data() + ( rowExtent    > 0L ? rowExtent    : 0L )
+                                     + ( columnExtent > 0L ? columnExtent : 0L ) );
+
+   return overlaps( first, reinterpret_cast<const char*>( last ) + sizeof( Other ) - 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a false since the elements of a strided matrix are not guaranteed to be contiguous.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline bool StridedMatrix<Type,SO,Tag,RT>::isAligned() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline bool StridedMatrix<Type,SO,Tag,RT>::canSMPAssign() const noexcept
+{
+   return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void StridedMatrix<Type,SO,Tag,RT>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   if( SO2 == rowMajor ) {
+      for( size_t i=0UL; i<m_; ++i )
+         for( size_t j=0UL; j<n_; ++j )
+            v_[offset(i,j)] = (*rhs)(i,j);
+   }
+   else {
+      for( size_t j=0UL; j<n_; ++j )
+         for( size_t i=0UL; i<m_; ++i )
+            v_[offset(i,j)] = (*rhs)(i,j);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void StridedMatrix<Type,SO,Tag,RT>::assign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<( SO2 ? n_ : m_ ); ++i ) {
+      for( auto element=(*rhs).begin(i); element!=(*rhs).end(i); ++element ) {
+         const size_t row   ( SO2 ? element->index() : i );
+         const size_t column( SO2 ? i : element->index() );
+         v_[offset(row,column)] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void StridedMatrix<Type,SO,Tag,RT>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   if( SO2 == rowMajor ) {
+      for( size_t i=0UL; i<m_; ++i )
+         for( size_t j=0UL; j<n_; ++j )
+            v_[offset(i,j)] += (*rhs)(i,j);
+   }
+   else {
+      for( size_t j=0UL; j<n_; ++j )
+         for( size_t i=0UL; i<m_; ++i )
+            v_[offset(i,j)] += (*rhs)(i,j);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void StridedMatrix<Type,SO,Tag,RT>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<( SO2 ? n_ : m_ ); ++i ) {
+      for( auto element=(*rhs).begin(i); element!=(*rhs).end(i); ++element ) {
+         const size_t row   ( SO2 ? element->index() : i );
+         const size_t column( SO2 ? i : element->index() );
+         v_[offset(row,column)] += element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void StridedMatrix<Type,SO,Tag,RT>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   if( SO2 == rowMajor ) {
+      for( size_t i=0UL; i<m_; ++i )
+         for( size_t j=0UL; j<n_; ++j )
+            v_[offset(i,j)] -= (*rhs)(i,j);
+   }
+   else {
+      for( size_t j=0UL; j<n_; ++j )
+         for( size_t i=0UL; i<m_; ++i )
+            v_[offset(i,j)] -= (*rhs)(i,j);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void StridedMatrix<Type,SO,Tag,RT>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<( SO2 ? n_ : m_ ); ++i ) {
+      for( auto element=(*rhs).begin(i); element!=(*rhs).end(i); ++element ) {
+         const size_t row   ( SO2 ? element->index() : i );
+         const size_t column( SO2 ? i : element->index() );
+         v_[offset(row,column)] -= element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void StridedMatrix<Type,SO,Tag,RT>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   if( SO2 == rowMajor ) {
+      for( size_t i=0UL; i<m_; ++i )
+         for( size_t j=0UL; j<n_; ++j )
+            v_[offset(i,j)] *= (*rhs)(i,j);
+   }
+   else {
+      for( size_t j=0UL; j<n_; ++j )
+         for( size_t i=0UL; i<m_; ++i )
+            v_[offset(i,j)] *= (*rhs)(i,j);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void StridedMatrix<Type,SO,Tag,RT>::schurAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   const ResultType tmp( serial( *this ) );
+
+   reset();
+
+   for( size_t i=0UL; i<( SO2 ? n_ : m_ ); ++i ) {
+      for( auto element=(*rhs).begin(i); element!=(*rhs).end(i); ++element ) {
+         const size_t row   ( SO2 ? element->index() : i );
+         const size_t column( SO2 ? i : element->index() );
+         v_[offset(row,column)] = tmp(row,column) * element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STRIDEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name StridedMatrix operators */
+//@{
+template< RelaxationFlag RF, typename Type, bool SO, typename Tag, typename RT >
+bool isDefault( const StridedMatrix<Type,SO,Tag,RT>& m );
+
+template< typename Type, bool SO, typename Tag, typename RT >
+bool isIntact( const StridedMatrix<Type,SO,Tag,RT>& m );
+
+template< typename Type, bool SO, typename Tag, typename RT >
+void swap( StridedMatrix<Type,SO,Tag,RT>& a, StridedMatrix<Type,SO,Tag,RT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given strided matrix is in default state.
+// \ingroup strided_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the strided matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false.
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename Type      // Data type of the matrix
+        , bool SO            // Storage order
+        , typename Tag       // Type tag
+        , typename RT >      // Result type
+inline bool isDefault( const StridedMatrix<Type,SO,Tag,RT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given strided matrix are intact.
+// \ingroup strided_matrix
+//
+// \param m The strided matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the strided matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline bool isIntact( const StridedMatrix<Type,SO,Tag,RT>& m )
+{
+   return ( m.rowStride() != 0L && m.columnStride() != 0L &&
+            ( m.data() != nullptr || m.rows() * m.columns() == 0UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two strided matrices.
+// \ingroup strided_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline void swap( StridedMatrix<Type,SO,Tag,RT>& a, StridedMatrix<Type,SO,Tag,RT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISCUSTOM SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename Tag, typename RT >
+struct IsCustom< StridedMatrix<T,SO,Tag,RT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSTRIDED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename Tag, typename RT >
+struct IsStrided< StridedMatrix<T,SO,Tag,RT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
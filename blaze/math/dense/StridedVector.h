@@ -0,0 +1,2083 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/StridedVector.h
+//  \brief Header file for the implementation of a strided dense vector
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_STRIDEDVECTOR_H_
+#define _BLAZE_MATH_DENSE_STRIDEDVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/SameTag.h>
+#include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/dense/StridedIterator.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/traits/CrossTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/CustomTransposeType.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsCustom.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseVector.h>
+#include <blaze/math/typetraits/IsStrided.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup strided_vector StridedVector
+// \ingroup dense_vector
+*/
+/*!\brief Efficient implementation of a dense vector view on external memory with a runtime stride.
+// \ingroup strided_vector
+//
+// The StridedVector class template represents an external array of elements as a native \b Blaze
+// dense vector. In contrast to the CustomVector, which requires the elements to be contiguous in
+// memory, two consecutive elements of a strided vector are separated by an arbitrary (non-zero,
+// possibly negative) runtime stride:
+
+                              \f[ v[i] = ptr[i \cdot stride]. \f]
+
+// Thus a strided vector can for instance refer to a column of a row-major array, to every n-th
+// element of an array, or to a reversed array without copying any element. As the CustomVector,
+// a strided vector does not perform any kind of memory allocation by itself and does not take
+// responsibility for the given array of elements.
+//
+// The type of the elements, the transpose flag, the group tag, and the result type of the vector
+// can be specified via the following four template parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, bool TF, typename Tag, typename RT >
+   class StridedVector;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the vector elements. StridedVector can be used with any
+//          non-cv-qualified, non-reference element type.
+//  - TF  : specifies whether the vector is a row vector (\c blaze::rowVector) or a column
+//          vector (\c blaze::columnVector). The default value is \c blaze::defaultTransposeFlag.
+//  - Tag : optional type parameter to tag the vector. The default type is \c blaze::Group0.
+//          See \ref grouping_tagging for details.
+//  - RT  : specifies the resulting type of the vector. The default is a DynamicVector.
+//
+// The following example demonstrates the use of strided vectors:
+
+   \code
+   using blaze::StridedVector;
+   using blaze::columnVector;
+
+   std::vector<double> memory( 12UL );
+
+   // Column vector referring to the second column of a row-major 4x3 array
+   StridedVector<double,columnVector> a( memory.data()+1UL, 4UL, 3L );
+
+   // Column vector referring to the first row of the array in reverse order
+   StridedVector<double,columnVector> b( memory.data()+2UL, 3UL, -1L );
+   \endcode
+
+// Strided vectors are fully integrated into the expression template framework and can be used
+// in all arithmetic operations. In case the stride is 1 the strided vector is assigned via the
+// vectorized kernels of a CustomVector, all other strides result in element-wise kernels.
+//
+// The aliasing detection of a strided vector is based on the range of memory touched by the
+// vector, i.e. the range from the lowest to the highest addressed element. Thus an assignment
+// between two strided vectors (or a strided vector and a contiguous dense vector) referring to
+// overlapping memory, as for instance an assignment of the reversed or shifted view on the same
+// array of elements, is evaluated via a temporary:
+
+   \code
+   std::vector<int> memory{ 1, 2, 3, 4, 5, 6 };
+   StridedVector<int,columnVector> a( memory.data(), 6UL, 1L );
+   StridedVector<int,columnVector> b( memory.data()+5UL, 6UL, -1L );  // Reversed view on a
+
+   a = b;  // Correctly evaluated via a temporary vector: ( 6 5 4 3 2 1 )
+   \endcode
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+class StridedVector
+   : public DenseVector< StridedVector<Type,TF,Tag,RT>, TF >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This     = StridedVector<Type,TF,Tag,RT>;  //!< Type of this StridedVector instance.
+   using BaseType = DenseVector<This,TF>;           //!< Base type of this StridedVector instance.
+
+   //! Result type for expression template evaluations.
+   using ResultType = RT;
+
+   //! Transpose type for expression template evaluations.
+   using TransposeType = CustomTransposeType_t<RT>;
+
+   using ElementType   = Type;                   //!< Type of the vector elements.
+   using TagType       = Tag;                    //!< Tag type of this StridedVector instance.
+   using ReturnType    = const Type&;            //!< Return type for expression template evaluations
+   using CompositeType = const StridedVector&;   //!< Data type for composite expression templates.
+
+   using Reference      = Type&;        //!< Reference to a non-constant vector value.
+   using ConstReference = const Type&;  //!< Reference to a constant vector value.
+   using Pointer        = Type*;        //!< Pointer to a non-constant vector value.
+   using ConstPointer   = const Type*;  //!< Pointer to a constant vector value.
+
+   using Iterator      = StridedIterator<Type>;        //!< Iterator over non-constant elements.
+   using ConstIterator = StridedIterator<const Type>;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a StridedVector with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other vector
+   struct Rebind {
+      using RRT   = Rebind_t< RT, RemoveConst_t<NewType> >;  //!< The rebound result type.
+      using Other = StridedVector<NewType,TF,Tag,RRT>;       //!< The type of the other StridedVector.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a StridedVector with a different fixed number of elements.
+   */
+   template< size_t NewN >  // Number of elements of the other vector
+   struct Resize {
+      using RRT   = Resize_t<RT,NewN>;               //!< The resized result type.
+      using Other = StridedVector<Type,TF,Tag,RRT>;  //!< The type of the other StridedVector.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the vector is involved
+       in can be optimized via SIMD operations. Since the elements of a strided vector are in
+       general not contiguous in memory, the \a simdEnabled compilation flag is set to \a false. */
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the vector can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline StridedVector();
+   inline StridedVector( Type* ptr, size_t n );
+   inline StridedVector( Type* ptr, size_t n, ptrdiff_t stride );
+
+   inline StridedVector( const StridedVector& v );
+   inline StridedVector( StridedVector&& v ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~StridedVector();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator[]( size_t index ) noexcept;
+   inline ConstReference operator[]( size_t index ) const noexcept;
+   inline Reference      at( size_t index );
+   inline ConstReference at( size_t index ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Iterator       begin () noexcept;
+   inline ConstIterator  begin () const noexcept;
+   inline ConstIterator  cbegin() const noexcept;
+   inline Iterator       end   () noexcept;
+   inline ConstIterator  end   () const noexcept;
+   inline ConstIterator  cend  () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline StridedVector& operator=( const Type& rhs );
+   inline StridedVector& operator=( initializer_list<Type> list );
+
+   template< typename Other, size_t Dim >
+   inline StridedVector& operator=( const Other (&array)[Dim] );
+
+   inline StridedVector& operator=( const StridedVector& rhs );
+   inline StridedVector& operator=( StridedVector&& rhs ) noexcept;
+
+   template< typename VT > inline StridedVector& operator= ( const Vector<VT,TF>& rhs );
+   template< typename VT > inline StridedVector& operator+=( const Vector<VT,TF>& rhs );
+   template< typename VT > inline StridedVector& operator-=( const Vector<VT,TF>& rhs );
+   template< typename VT > inline StridedVector& operator*=( const Vector<VT,TF>& rhs );
+   template< typename VT > inline StridedVector& operator/=( const DenseVector<VT,TF>& rhs );
+   template< typename VT > inline StridedVector& operator%=( const Vector<VT,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t    size() const noexcept;
+   inline ptrdiff_t stride() const noexcept;
+   inline size_t    capacity() const noexcept;
+   inline size_t    nonZeros() const;
+   inline void      reset();
+   inline void      clear();
+   inline void      swap( StridedVector& v ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   template< typename Other > inline StridedVector& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Resource management functions***************************************************************
+   /*!\name Resource management functions */
+   //@{
+   inline void reset( Type* ptr, size_t n );
+   inline void reset( Type* ptr, size_t n, ptrdiff_t stride );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   //! Contiguous view on the array of elements.
+   using ContiguousView = CustomVector<Type,unaligned,unpadded,TF,Tag>;
+
+   //! Compile time check for dense vectors with contiguous elements (including unaligned
+   //! custom vectors), whose memory range can be checked for overlap.
+   template< typename VT >
+   using HasContiguousRange = BoolConstant< IsDenseVector_v<VT> && !IsStrided_v<VT> &&
+                                            ( IsContiguous_v<VT> || IsCustom_v<VT> ) >;
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool           isContiguous  () const noexcept;
+   inline ContiguousView contiguousView() const;
+
+   inline bool overlaps( const void* first, const void* last ) const noexcept;
+
+   template< typename Other >
+   inline bool aliases( const Other* alias, FalseType ) const noexcept;
+
+   template< typename Other >
+   inline bool aliases( const Other* alias, TrueType ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   template< typename Other, bool TF2, typename Tag2, typename RT2 >
+   inline bool canAlias( const StridedVector<Other,TF2,Tag2,RT2>* alias ) const noexcept;
+
+   template< typename Other, bool TF2, typename Tag2, typename RT2 >
+   inline bool isAliased( const StridedVector<Other,TF2,Tag2,RT2>* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename VT > inline void assign    ( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void assign    ( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline void addAssign ( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void addAssign ( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline void subAssign ( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void subAssign ( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline void multAssign( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void multAssign( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline void divAssign ( const DenseVector <VT,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t    size_;    //!< The size/dimension of the strided vector.
+   ptrdiff_t stride_;  //!< The distance between two consecutive elements.
+   Type* v_;           //!< The custom array of elements.
+                       /*!< Access to the vector element \f$ i \f$ is gained via
+                            \f$ v_[i \cdot stride_] \f$. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for StridedVector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedVector<Type,TF,Tag,RT>::StridedVector()
+   : size_  ( 0UL )      // The size/dimension of the vector
+   , stride_( 1L )       // The distance between two consecutive elements
+   , v_     ( nullptr )  // The custom array of elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a vector of size \a n referring to a contiguous array.
+//
+// \param ptr The array of elements to be used by the vector.
+// \param n The number of array elements to be used by the strided vector.
+// \exception std::invalid_argument Invalid setup of strided vector.
+//
+// This constructor creates a strided vector of size \a n with unit stride. In case the given
+// pointer is \c nullptr, a \a std::invalid_argument exception is thrown.
+//
+// \note The strided vector does \b NOT take responsibility for the given array of elements!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedVector<Type,TF,Tag,RT>::StridedVector( Type* ptr, size_t n )
+   : StridedVector( ptr, n, 1L )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a vector of size \a n with the given stride.
+//
+// \param ptr The array of elements to be used by the vector.
+// \param n The number of array elements to be used by the strided vector.
+// \param stride The distance between two consecutive elements (in number of elements).
+// \exception std::invalid_argument Invalid setup of strided vector.
+//
+// This constructor creates a strided vector of size \a n. The element \f$ i \f$ of the vector
+// is located at position \f$ i \cdot stride \f$ of the given array. The stride may be negative,
+// but must not be 0. The constructor fails if ...
+//
+//  - ... the passed pointer is \c nullptr;
+//  - ... the given stride is 0.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown.
+//
+// \note The strided vector does \b NOT take responsibility for the given array of elements!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedVector<Type,TF,Tag,RT>::StridedVector( Type* ptr, size_t n, ptrdiff_t stride )
+   : size_  ( n )       // The size/dimension of the vector
+   , stride_( stride )  // The distance between two consecutive elements
+   , v_     ( ptr )     // The custom array of elements
+{
+   if( ptr == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of elements" );
+   }
+
+   if( stride == 0L ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid stride detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for StridedVector.
+//
+// \param v Vector to be copied.
+//
+// The copy constructor initializes the strided vector as an exact copy of the given strided
+// vector, i.e. both vectors refer to the same array of elements.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedVector<Type,TF,Tag,RT>::StridedVector( const StridedVector& v )
+   : size_  ( v.size_   )  // The size/dimension of the vector
+   , stride_( v.stride_ )  // The distance between two consecutive elements
+   , v_     ( v.v_      )  // The custom array of elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for StridedVector.
+//
+// \param v The vector to be moved into this instance.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedVector<Type,TF,Tag,RT>::StridedVector( StridedVector&& v ) noexcept
+   : size_  ( v.size_   )  // The size/dimension of the vector
+   , stride_( v.stride_ )  // The distance between two consecutive elements
+   , v_     ( v.v_      )  // The custom array of elements
+{
+   v.size_   = 0UL;
+   v.stride_ = 1L;
+   v.v_      = nullptr;
+
+   BLAZE_INTERNAL_ASSERT( v.data() == nullptr, "Invalid data reference detected" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for StridedVector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedVector<Type,TF,Tag,RT>::~StridedVector()
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( RT );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( RT, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( RT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE( RT );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access index.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedVector<Type,TF,Tag,RT>::Reference
+   StridedVector<Type,TF,Tag,RT>::operator[]( size_t index ) noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
+   return v_[static_cast<ptrdiff_t>( index )*stride_];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access index.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedVector<Type,TF,Tag,RT>::ConstReference
+   StridedVector<Type,TF,Tag,RT>::operator[]( size_t index ) const noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
+   return v_[static_cast<ptrdiff_t>( index )*stride_];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid vector access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access index.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedVector<Type,TF,Tag,RT>::Reference
+   StridedVector<Type,TF,Tag,RT>::at( size_t index )
+{
+   if( index >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+   }
+   return (*this)[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid vector access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access index.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedVector<Type,TF,Tag,RT>::ConstReference
+   StridedVector<Type,TF,Tag,RT>::at( size_t index ) const
+{
+   if( index >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+   }
+   return (*this)[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the vector elements.
+//
+// \return Pointer to the first element of the vector.
+//
+// This function returns a pointer to the first element of the strided vector. Note that in
+// contrast to other dense vectors the elements of a strided vector are not guaranteed to be
+// stored contiguously. The location of all other elements has to be determined via the
+// stride() function.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedVector<Type,TF,Tag,RT>::Pointer
+   StridedVector<Type,TF,Tag,RT>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the vector elements.
+//
+// \return Pointer to the first element of the vector.
+//
+// This function returns a pointer to the first element of the strided vector. Note that in
+// contrast to other dense vectors the elements of a strided vector are not guaranteed to be
+// stored contiguously. The location of all other elements has to be determined via the
+// stride() function.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedVector<Type,TF,Tag,RT>::ConstPointer
+   StridedVector<Type,TF,Tag,RT>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the strided vector.
+//
+// \return Iterator to the first element of the strided vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedVector<Type,TF,Tag,RT>::Iterator
+   StridedVector<Type,TF,Tag,RT>::begin() noexcept
+{
+   return Iterator( v_, stride_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the strided vector.
+//
+// \return Iterator to the first element of the strided vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedVector<Type,TF,Tag,RT>::ConstIterator
+   StridedVector<Type,TF,Tag,RT>::begin() const noexcept
+{
+   return ConstIterator( v_, stride_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the strided vector.
+//
+// \return Iterator to the first element of the strided vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedVector<Type,TF,Tag,RT>::ConstIterator
+   StridedVector<Type,TF,Tag,RT>::cbegin() const noexcept
+{
+   return ConstIterator( v_, stride_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the strided vector.
+//
+// \return Iterator just past the last element of the strided vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedVector<Type,TF,Tag,RT>::Iterator
+   StridedVector<Type,TF,Tag,RT>::end() noexcept
+{
+   return begin() + static_cast<ptrdiff_t>( size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the strided vector.
+//
+// \return Iterator just past the last element of the strided vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedVector<Type,TF,Tag,RT>::ConstIterator
+   StridedVector<Type,TF,Tag,RT>::end() const noexcept
+{
+   return cbegin() + static_cast<ptrdiff_t>( size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the strided vector.
+//
+// \return Iterator just past the last element of the strided vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedVector<Type,TF,Tag,RT>::ConstIterator
+   StridedVector<Type,TF,Tag,RT>::cend() const noexcept
+{
+   return cbegin() + static_cast<ptrdiff_t>( size_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all vector elements.
+//
+// \param rhs Scalar value to be assigned to all vector elements.
+// \return Reference to the assigned vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedVector<Type,TF,Tag,RT>&
+   StridedVector<Type,TF,Tag,RT>::operator=( const Type& rhs )
+{
+   for( size_t i=0UL; i<size_; ++i )
+      (*this)[i] = rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List assignment to all vector elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Invalid assignment to strided vector.
+//
+// This assignment operator offers the option to directly assign to all elements of the vector
+// by means of an initializer list. The vector elements are assigned the values from the given
+// initializer list. Missing values are reset to their default state. Note that in case the size
+// of the initializer list exceeds the size of the vector, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedVector<Type,TF,Tag,RT>&
+   StridedVector<Type,TF,Tag,RT>::operator=( initializer_list<Type> list )
+{
+   if( list.size() > size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to strided vector" );
+   }
+
+   size_t i( 0UL );
+
+   for( const auto& element : list ) {
+      (*this)[i] = element;
+      ++i;
+   }
+
+   for( ; i<size_; ++i ) {
+      (*this)[i] = Type();
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Array assignment to all vector elements.
+//
+// \param array Static array for the assignment.
+// \return Reference to the assigned vector.
+// \exception std::invalid_argument Invalid array size.
+//
+// This assignment operator offers the option to directly set all elements of the vector. Note
+// that the size of the static array must match the size of the strided vector. Otherwise a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename RT >   // Result type
+template< typename Other  // Data type of the static array
+        , size_t Dim >    // Dimension of the static array
+inline StridedVector<Type,TF,Tag,RT>&
+   StridedVector<Type,TF,Tag,RT>::operator=( const Other (&array)[Dim] )
+{
+   if( size_ != Dim ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array size" );
+   }
+
+   for( size_t i=0UL; i<Dim; ++i )
+      (*this)[i] = array[i];
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for StridedVector.
+//
+// \param rhs Vector to be copied.
+// \return Reference to the assigned vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The vector is initialized as a copy of the given vector. In case the current sizes of the two
+// vectors don't match, a \a std::invalid_argument exception is thrown. In case the given vector
+// refers to memory overlapping the memory of this vector, the assignment is performed via a
+// temporary vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedVector<Type,TF,Tag,RT>&
+   StridedVector<Type,TF,Tag,RT>::operator=( const StridedVector& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   if( rhs.size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( isAliased( &rhs ) ) {
+      const ResultType tmp( rhs );
+      smpAssign( *this, tmp );
+   }
+   else {
+      smpAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for StridedVector.
+//
+// \param rhs The vector to be moved into this instance.
+// \return Reference to the assigned vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline StridedVector<Type,TF,Tag,RT>&
+   StridedVector<Type,TF,Tag,RT>::operator=( StridedVector&& rhs ) noexcept
+{
+   size_   = rhs.size_;
+   stride_ = rhs.stride_;
+   v_      = rhs.v_;
+
+   rhs.size_   = 0UL;
+   rhs.stride_ = 1L;
+   rhs.v_      = nullptr;
+
+   BLAZE_INTERNAL_ASSERT( rhs.data() == nullptr, "Invalid data reference detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different vectors.
+//
+// \param rhs Vector to be copied.
+// \return Reference to the assigned vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The vector is initialized as a copy of the given vector. In case the current sizes of the two
+// vectors don't match, a \a std::invalid_argument exception is thrown. In case the stride of the
+// vector is 1 the assignment is performed via a CustomVector view, which enables all vectorized
+// and BLAS-based kernels. In case the given vector refers to memory overlapping the memory of
+// this vector, the assignment is performed via a temporary vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename VT >  // Type of the right-hand side vector
+inline StridedVector<Type,TF,Tag,RT>&
+   StridedVector<Type,TF,Tag,RT>::operator=( const Vector<VT,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+
+   if( (*rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (*rhs).canAlias( this ) || canAlias( &(*rhs) ) ) {
+      const ResultType_t<VT> tmp( *rhs );
+      smpAssign( *this, tmp );
+   }
+   else if( isContiguous() ) {
+      ContiguousView view( contiguousView() );
+      view = *rhs;
+   }
+   else {
+      if( IsSparseVector_v<VT> )
+         reset();
+      smpAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a vector (\f$ \vec{a}+=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be added to the vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename VT >  // Type of the right-hand side vector
+inline StridedVector<Type,TF,Tag,RT>&
+   StridedVector<Type,TF,Tag,RT>::operator+=( const Vector<VT,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+
+   if( (*rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (*rhs).canAlias( this ) || canAlias( &(*rhs) ) ) {
+      const ResultType_t<VT> tmp( *rhs );
+      smpAddAssign( *this, tmp );
+   }
+   else if( isContiguous() ) {
+      ContiguousView view( contiguousView() );
+      view += *rhs;
+   }
+   else {
+      smpAddAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a vector
+//        (\f$ \vec{a}-=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be subtracted from the vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename VT >  // Type of the right-hand side vector
+inline StridedVector<Type,TF,Tag,RT>&
+   StridedVector<Type,TF,Tag,RT>::operator-=( const Vector<VT,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+
+   if( (*rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (*rhs).canAlias( this ) || canAlias( &(*rhs) ) ) {
+      const ResultType_t<VT> tmp( *rhs );
+      smpSubAssign( *this, tmp );
+   }
+   else if( isContiguous() ) {
+      ContiguousView view( contiguousView() );
+      view -= *rhs;
+   }
+   else {
+      smpSubAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a vector
+//        (\f$ \vec{a}*=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be multiplied with the vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename VT >  // Type of the right-hand side vector
+inline StridedVector<Type,TF,Tag,RT>&
+   StridedVector<Type,TF,Tag,RT>::operator*=( const Vector<VT,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( VT, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType_t<VT> );
+
+   using MultType = MultTrait_t< ResultType, ResultType_t<VT> >;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( MultType, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( MultType );
+
+   if( (*rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( IsSparseVector_v<VT> || (*rhs).canAlias( this ) || canAlias( &(*rhs) ) ) {
+      const MultType tmp( *this * (*rhs) );
+      if( IsSparseVector_v<MultType> )
+         reset();
+      smpAssign( *this, tmp );
+   }
+   else if( isContiguous() ) {
+      ContiguousView view( contiguousView() );
+      view *= *rhs;
+   }
+   else {
+      smpMultAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a dense vector (\f$ \vec{a}/=\vec{b} \f$).
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename VT >  // Type of the right-hand side vector
+inline StridedVector<Type,TF,Tag,RT>&
+   StridedVector<Type,TF,Tag,RT>::operator/=( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( VT, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType_t<VT> );
+
+   using DivType = DivTrait_t< ResultType, ResultType_t<VT> >;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( DivType );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( DivType, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( DivType );
+
+   if( (*rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (*rhs).canAlias( this ) || canAlias( &(*rhs) ) ) {
+      const DivType tmp( *this / (*rhs) );
+      smpAssign( *this, tmp );
+   }
+   else if( isContiguous() ) {
+      ContiguousView view( contiguousView() );
+      view /= *rhs;
+   }
+   else {
+      smpDivAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Cross product assignment operator for the multiplication of a vector
+//        (\f$ \vec{a}\times=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector for the cross product.
+// \return Reference to the vector.
+// \exception std::invalid_argument Invalid vector size for cross product.
+//
+// In case the current size of any of the two vectors is not equal to 3, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename VT >  // Type of the right-hand side vector
+inline StridedVector<Type,TF,Tag,RT>&
+   StridedVector<Type,TF,Tag,RT>::operator%=( const Vector<VT,TF>& rhs )
+{
+   using blaze::assign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType_t<VT>, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType_t<VT> );
+
+   using CrossType = CrossTrait_t< ResultType, ResultType_t<VT> >;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( CrossType );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( CrossType, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( CrossType );
+
+   if( size_ != 3UL || (*rhs).size() != 3UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid vector size for cross product" );
+   }
+
+   const CrossType tmp( *this % (*rhs) );
+   assign( *this, tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size/dimension of the vector.
+//
+// \return The size of the vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline size_t StridedVector<Type,TF,Tag,RT>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the distance between two consecutive elements of the vector.
+//
+// \return The stride of the vector (in number of elements).
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline ptrdiff_t StridedVector<Type,TF,Tag,RT>::stride() const noexcept
+{
+   return stride_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the vector.
+//
+// \return The maximum capacity of the vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline size_t StridedVector<Type,TF,Tag,RT>::capacity() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the vector.
+//
+// \return The number of non-zero elements in the vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline size_t StridedVector<Type,TF,Tag,RT>::nonZeros() const
+{
+   size_t nonzeros( 0 );
+
+   for( size_t i=0UL; i<size_; ++i ) {
+      if( !isDefault<strict>( (*this)[i] ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline void StridedVector<Type,TF,Tag,RT>::reset()
+{
+   using blaze::clear;
+   for( size_t i=0UL; i<size_; ++i )
+      clear( (*this)[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the vector.
+//
+// \return void
+//
+// After the clear() function, the size of the vector is 0.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline void StridedVector<Type,TF,Tag,RT>::clear()
+{
+   size_   = 0UL;
+   stride_ = 1L;
+   v_      = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two vectors.
+//
+// \param v The vector to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline void StridedVector<Type,TF,Tag,RT>::swap( StridedVector& v ) noexcept
+{
+   using std::swap;
+
+   swap( size_  , v.size_   );
+   swap( stride_, v.stride_ );
+   swap( v_     , v.v_      );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the elements of the vector are contiguous in memory.
+//
+// \return \a true in case the vector is non-empty and has a unit stride, \a false if not.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline bool StridedVector<Type,TF,Tag,RT>::isContiguous() const noexcept
+{
+   return ( size_ != 0UL && ( stride_ == 1L || size_ == 1UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a CustomVector view on the array of elements.
+//
+// \return The contiguous view on the vector.
+//
+// This function must only be called in case the elements of the vector are contiguous (see the
+// isContiguous() function).
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline typename StridedVector<Type,TF,Tag,RT>::ContiguousView
+   StridedVector<Type,TF,Tag,RT>::contiguousView() const
+{
+   BLAZE_INTERNAL_ASSERT( isContiguous(), "Non-contiguous vector detected" );
+   return ContiguousView( v_, size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector touches memory in the given range.
+//
+// \param first Pointer to the first byte of the range.
+// \param last Pointer to the last byte of the range (inclusive).
+// \return \a true in case the vector overlaps the given range, \a false if not.
+//
+// The memory touched by the vector is the range from its lowest to its highest addressed
+// element, which for negative strides differs from the range starting at the data pointer.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline bool
+   StridedVector<Type,TF,Tag,RT>::overlaps( const void* first, const void* last ) const noexcept
+{
+   if( size_ == 0UL )
+      return false;
+
+   const ptrdiff_t extent( static_cast<ptrdiff_t>( size_-1UL ) * stride_ );
+
+   const char* lower( reinterpret_cast<const char*>( v_ + ( extent < 0L ? extent : 0L ) ) );
+   const char* upper( reinterpret_cast<const char*>( v_ + ( extent > 0L ? extent : 0L ) ) );
+   upper += sizeof( Type ) - 1UL;
+
+   return lower <= static_cast<const char*>( last ) && static_cast<const char*>( first ) <= upper;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is aliased with the given non-contiguous data structure.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+template< typename Other >  // Data type of the foreign expression
+inline bool StridedVector<Type,TF,Tag,RT>::aliases( const Other* alias, FalseType ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is aliased with the given contiguous dense vector.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the vector overlaps the memory of the alias, \a false if not.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+template< typename Other >  // Data type of the foreign expression
+inline bool StridedVector<Type,TF,Tag,RT>::aliases( const Other* alias, TrueType ) const noexcept
+{
+   using ET = ElementType_t<Other>;
+
+   if( alias->size() == 0UL )
+      return false;
+
+   const ET* first( alias->data() );
+   const ET* last ( first + alias->size() - 1UL );
+
+   return overlaps( first, reinterpret_cast<const char*>( last ) + sizeof( ET ) - 1UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scaling of the vector by the scalar value \a scalar (\f$ \vec{a}*=s \f$).
+//
+// \param scalar The scalar value for the vector scaling.
+// \return Reference to the vector.
+//
+// This function scales the vector by applying the given scalar value \a scalar to each element
+// of the vector. For built-in and \c complex data types it has the same effect as using the
+// multiplication assignment operator.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+template< typename Other >  // Data type of the scalar value
+inline StridedVector<Type,TF,Tag,RT>&
+   StridedVector<Type,TF,Tag,RT>::scale( const Other& scalar )
+{
+   for( size_t i=0UL; i<size_; ++i )
+      (*this)[i] *= scalar;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RESOURCE MANAGEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Resets the strided vector and replaces the array of elements with the given array.
+//
+// \param ptr The array of elements to be used by the vector.
+// \param n The number of array elements to be used by the strided vector.
+// \return void
+// \exception std::invalid_argument Invalid setup of strided vector.
+//
+// This function resets the strided vector to the given contiguous array of elements of size
+// \a n. In case the given pointer is \c nullptr, a \a std::invalid_argument exception is thrown.
+//
+// \note The strided vector does NOT take responsibility for the new array of elements!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline void StridedVector<Type,TF,Tag,RT>::reset( Type* ptr, size_t n )
+{
+   StridedVector tmp( ptr, n );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the strided vector and replaces the array of elements with the given array.
+//
+// \param ptr The array of elements to be used by the vector.
+// \param n The number of array elements to be used by the strided vector.
+// \param stride The distance between two consecutive elements (in number of elements).
+// \return void
+// \exception std::invalid_argument Invalid setup of strided vector.
+//
+// This function resets the strided vector to the given array of elements of size \a n with the
+// given stride. In case the given pointer is \c nullptr or the stride is 0, a
+// \a std::invalid_argument exception is thrown.
+//
+// \note The strided vector does NOT take responsibility for the new array of elements!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline void StridedVector<Type,TF,Tag,RT>::reset( Type* ptr, size_t n, ptrdiff_t stride )
+{
+   StridedVector tmp( ptr, n, stride );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address can alias with the vector. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation. In case the alias is a contiguous dense vector, the function
+// returns whether the memory of the alias overlaps the memory touched by the vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+template< typename Other >  // Data type of the foreign expression
+inline bool StridedVector<Type,TF,Tag,RT>::canAlias( const Other* alias ) const noexcept
+{
+   return aliases( alias, HasContiguousRange<Other>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can alias with the given strided vector \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the memory of the two vectors overlaps, \a false if not.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+template< typename Other    // Data type of the foreign strided vector
+        , bool TF2          // Transpose flag of the foreign strided vector
+        , typename Tag2     // Type tag of the foreign strided vector
+        , typename RT2 >    // Result type of the foreign strided vector
+inline bool StridedVector<Type,TF,Tag,RT>::canAlias(
+   const StridedVector<Other,TF2,Tag2,RT2>* alias ) const noexcept
+{
+   return isAliased( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address is aliased with the vector. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation. In case the alias is a contiguous dense vector, the function
+// returns whether the memory of the alias overlaps the memory touched by the vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+template< typename Other >  // Data type of the foreign expression
+inline bool StridedVector<Type,TF,Tag,RT>::isAliased( const Other* alias ) const noexcept
+{
+   return aliases( alias, HasContiguousRange<Other>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is aliased with the given strided vector \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the memory of the two vectors overlaps, \a false if not.
+//
+// This function returns whether the memory touched by the given strided vector, i.e. the range
+// from its lowest to its highest addressed element, overlaps the memory touched by the vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+template< typename Other    // Data type of the foreign strided vector
+        , bool TF2          // Transpose flag of the foreign strided vector
+        , typename Tag2     // Type tag of the foreign strided vector
+        , typename RT2 >    // Result type of the foreign strided vector
+inline bool StridedVector<Type,TF,Tag,RT>::isAliased(
+   const StridedVector<Other,TF2,Tag2,RT2>* alias ) const noexcept
+{
+   if( alias->size() == 0UL )
+      return false;
+
+   const ptrdiff_t extent( static_cast<ptrdiff_t>( alias->size()-1UL ) * alias->stride() );
+
+   const Other* first( alias->data() + ( extent < 0L ? extent : 0L ) );
+   const Other* last ( alias->data() + ( extent > 0L ? extent : 0L ) );
+
+   return overlaps( first, reinterpret_cast<const char*>( last ) + sizeof( Other ) - 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is properly aligned in memory.
+//
+// \return \a false since the elements of a strided vector are not guaranteed to be contiguous.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline bool StridedVector<Type,TF,Tag,RT>::isAligned() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can be used in SMP assignments.
+//
+// \return \a true in case the vector can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the vector can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current size of the
+// vector).
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline bool StridedVector<Type,TF,Tag,RT>::canSMPAssign() const noexcept
+{
+   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename VT >  // Type of the right-hand side dense vector
+inline void StridedVector<Type,TF,Tag,RT>::assign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   for( size_t i=0UL; i<size_; ++i )
+      (*this)[i] = (*rhs)[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void StridedVector<Type,TF,Tag,RT>::assign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   for( auto element=(*rhs).begin(); element!=(*rhs).end(); ++element )
+      (*this)[element->index()] = element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename VT >  // Type of the right-hand side dense vector
+inline void StridedVector<Type,TF,Tag,RT>::addAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   for( size_t i=0UL; i<size_; ++i )
+      (*this)[i] += (*rhs)[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void StridedVector<Type,TF,Tag,RT>::addAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   for( auto element=(*rhs).begin(); element!=(*rhs).end(); ++element )
+      (*this)[element->index()] += element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename VT >  // Type of the right-hand side dense vector
+inline void StridedVector<Type,TF,Tag,RT>::subAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   for( size_t i=0UL; i<size_; ++i )
+      (*this)[i] -= (*rhs)[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void StridedVector<Type,TF,Tag,RT>::subAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   for( auto element=(*rhs).begin(); element!=(*rhs).end(); ++element )
+      (*this)[element->index()] -= element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename VT >  // Type of the right-hand side dense vector
+inline void StridedVector<Type,TF,Tag,RT>::multAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   for( size_t i=0UL; i<size_; ++i )
+      (*this)[i] *= (*rhs)[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the multiplication assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void StridedVector<Type,TF,Tag,RT>::multAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   const ResultType tmp( serial( *this ) );
+
+   reset();
+
+   for( auto element=(*rhs).begin(); element!=(*rhs).end(); ++element )
+      (*this)[element->index()] = tmp[element->index()] * element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the division assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+template< typename VT >  // Type of the right-hand side dense vector
+inline void StridedVector<Type,TF,Tag,RT>::divAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   for( size_t i=0UL; i<size_; ++i )
+      (*this)[i] /= (*rhs)[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STRIDEDVECTOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name StridedVector operators */
+//@{
+template< RelaxationFlag RF, typename Type, bool TF, typename Tag, typename RT >
+bool isDefault( const StridedVector<Type,TF,Tag,RT>& v );
+
+template< typename Type, bool TF, typename Tag, typename RT >
+bool isIntact( const StridedVector<Type,TF,Tag,RT>& v );
+
+template< typename Type, bool TF, typename Tag, typename RT >
+void swap( StridedVector<Type,TF,Tag,RT>& a, StridedVector<Type,TF,Tag,RT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given strided vector is in default state.
+// \ingroup strided_vector
+//
+// \param v The strided vector to be tested for its default state.
+// \return \a true in case the given vector's size is zero, \a false otherwise.
+//
+// This function checks whether the strided vector is in default (constructed) state, i.e. if
+// it's size is 0. In case it is in default state, the function returns \a true, else it will
+// return \a false.
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename Type      // Data type of the vector
+        , bool TF            // Transpose flag
+        , typename Tag       // Type tag
+        , typename RT >      // Result type
+inline bool isDefault( const StridedVector<Type,TF,Tag,RT>& v )
+{
+   return ( v.size() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given strided vector are intact.
+// \ingroup strided_vector
+//
+// \param v The strided vector to be tested.
+// \return \a true in case the given vector's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the strided vector are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline bool isIntact( const StridedVector<Type,TF,Tag,RT>& v )
+{
+   return ( v.stride() != 0L && ( v.data() != nullptr || v.size() == 0UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two strided vectors.
+// \ingroup strided_vector
+//
+// \param a The first vector to be swapped.
+// \param b The second vector to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename Tag   // Type tag
+        , typename RT >  // Result type
+inline void swap( StridedVector<Type,TF,Tag,RT>& a, StridedVector<Type,TF,Tag,RT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISCUSTOM SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF, typename Tag, typename RT >
+struct IsCustom< StridedVector<T,TF,Tag,RT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSTRIDED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF, typename Tag, typename RT >
+struct IsStrided< StridedVector<T,TF,Tag,RT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
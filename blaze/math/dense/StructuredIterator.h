@@ -0,0 +1,577 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/StructuredIterator.h
+//  \brief Header file for the StructuredIterator class template
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_STRUCTUREDITERATOR_H_
+#define _BLAZE_MATH_DENSE_STRUCTUREDITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of an iterator for the rows of structured dense matrices.
+// \ingroup math
+//
+// The StructuredIterator represents a generic random-access iterator over a single row of a
+// structured dense matrix (as for instance ToeplitzMatrix, HankelMatrix, or CirculantMatrix),
+// whose elements are not stored explicitly but are mapped onto a few defining coefficients.
+// The iterator accesses the elements via the function call operator of the matrix.
+*/
+template< typename MT >  // Type of the structured matrix
+class StructuredIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+   using ValueType        = typename MT::ElementType;         //!< Type of the underlying elements.
+   using PointerType      = const ValueType*;                 //!< Pointer return type.
+   using ReferenceType    = const ValueType&;                 //!< Reference return type.
+   using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+   // STL iterator requirements
+   using iterator_category = IteratorCategory;  //!< The iterator category.
+   using value_type        = ValueType;         //!< Type of the underlying elements.
+   using pointer           = PointerType;       //!< Pointer return type.
+   using reference         = ReferenceType;     //!< Reference return type.
+   using difference_type   = DifferenceType;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline StructuredIterator() noexcept;
+   explicit inline StructuredIterator( const MT& matrix, size_t row, size_t column ) noexcept;
+
+   StructuredIterator( const StructuredIterator& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~StructuredIterator() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline StructuredIterator& operator+=( ptrdiff_t inc ) noexcept;
+   inline StructuredIterator& operator-=( ptrdiff_t dec ) noexcept;
+
+   StructuredIterator& operator=( const StructuredIterator& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Increment/decrement operators***************************************************************
+   /*!\name Increment/decrement operators */
+   //@{
+   inline       StructuredIterator& operator++()      noexcept;
+   inline const StructuredIterator  operator++( int ) noexcept;
+   inline       StructuredIterator& operator--()      noexcept;
+   inline const StructuredIterator  operator--( int ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\name Access operators */
+   //@{
+   inline ReferenceType operator[]( size_t index ) const noexcept;
+   inline ReferenceType operator* () const noexcept;
+   inline PointerType   operator->() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const MT* matrix() const noexcept;
+   inline size_t    row   () const noexcept;
+   inline size_t    column() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const MT* matrix_;  //!< The structured matrix to be traversed.
+   size_t    row_;     //!< The index of the traversed row.
+   size_t    column_;  //!< Current column index of the iterator.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for the StructuredIterator class.
+*/
+template< typename MT >  // Type of the structured matrix
+inline StructuredIterator<MT>::StructuredIterator() noexcept
+   : matrix_( nullptr )  // The structured matrix to be traversed
+   , row_   ( 0UL )      // The index of the traversed row
+   , column_( 0UL )      // Current column index of the iterator
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the StructuredIterator class.
+//
+// \param matrix The structured matrix to be traversed.
+// \param row The index of the traversed row.
+// \param column The initial column index of the iterator.
+*/
+template< typename MT >  // Type of the structured matrix
+inline StructuredIterator<MT>::StructuredIterator( const MT& matrix, size_t row, size_t column ) noexcept
+   : matrix_( &matrix )  // The structured matrix to be traversed
+   , row_   ( row )      // The index of the traversed row
+   , column_( column )   // Current column index of the iterator
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator.
+//
+// \param inc The increment of the iterator.
+// \return The incremented iterator.
+*/
+template< typename MT >  // Type of the structured matrix
+inline StructuredIterator<MT>& StructuredIterator<MT>::operator+=( ptrdiff_t inc ) noexcept
+{
+   column_ += inc;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator.
+//
+// \param dec The decrement of the iterator.
+// \return The decremented iterator.
+*/
+template< typename MT >  // Type of the structured matrix
+inline StructuredIterator<MT>& StructuredIterator<MT>::operator-=( ptrdiff_t dec ) noexcept
+{
+   column_ -= dec;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INCREMENT/DECREMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Pre-increment operator.
+//
+// \return Reference to the incremented iterator.
+*/
+template< typename MT >  // Type of the structured matrix
+inline StructuredIterator<MT>& StructuredIterator<MT>::operator++() noexcept
+{
+   ++column_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-increment operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename MT >  // Type of the structured matrix
+inline const StructuredIterator<MT> StructuredIterator<MT>::operator++( int ) noexcept
+{
+   return StructuredIterator( *matrix_, row_, column_++ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pre-decrement operator.
+//
+// \return Reference to the decremented iterator.
+*/
+template< typename MT >  // Type of the structured matrix
+inline StructuredIterator<MT>& StructuredIterator<MT>::operator--() noexcept
+{
+   --column_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-decrement operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename MT >  // Type of the structured matrix
+inline const StructuredIterator<MT> StructuredIterator<MT>::operator--( int ) noexcept
+{
+   return StructuredIterator( *matrix_, row_, column_-- );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the underlying elements.
+//
+// \param index Access index.
+// \return Reference to the accessed value.
+*/
+template< typename MT >  // Type of the structured matrix
+inline typename StructuredIterator<MT>::ReferenceType
+   StructuredIterator<MT>::operator[]( size_t index ) const noexcept
+{
+   return (*matrix_)( row_, column_+index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the element at the current iterator position.
+//
+// \return Reference to the current value.
+*/
+template< typename MT >  // Type of the structured matrix
+inline typename StructuredIterator<MT>::ReferenceType
+   StructuredIterator<MT>::operator*() const noexcept
+{
+   return (*matrix_)( row_, column_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the element at the current iterator position.
+//
+// \return Pointer to the element at the current iterator position.
+*/
+template< typename MT >  // Type of the structured matrix
+inline typename StructuredIterator<MT>::PointerType
+   StructuredIterator<MT>::operator->() const noexcept
+{
+   return &(*matrix_)( row_, column_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the traversed structured matrix.
+//
+// \return Pointer to the traversed matrix.
+*/
+template< typename MT >  // Type of the structured matrix
+inline const MT* StructuredIterator<MT>::matrix() const noexcept
+{
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the index of the traversed row.
+//
+// \return The index of the traversed row.
+*/
+template< typename MT >  // Type of the structured matrix
+inline size_t StructuredIterator<MT>::row() const noexcept
+{
+   return row_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the current column index of the iterator.
+//
+// \return The current column index.
+*/
+template< typename MT >  // Type of the structured matrix
+inline size_t StructuredIterator<MT>::column() const noexcept
+{
+   return column_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name StructuredIterator operators */
+//@{
+template< typename MT >
+bool operator==( const StructuredIterator<MT>& lhs, const StructuredIterator<MT>& rhs ) noexcept;
+
+template< typename MT >
+bool operator!=( const StructuredIterator<MT>& lhs, const StructuredIterator<MT>& rhs ) noexcept;
+
+template< typename MT >
+bool operator<( const StructuredIterator<MT>& lhs, const StructuredIterator<MT>& rhs ) noexcept;
+
+template< typename MT >
+bool operator>( const StructuredIterator<MT>& lhs, const StructuredIterator<MT>& rhs ) noexcept;
+
+template< typename MT >
+bool operator<=( const StructuredIterator<MT>& lhs, const StructuredIterator<MT>& rhs ) noexcept;
+
+template< typename MT >
+bool operator>=( const StructuredIterator<MT>& lhs, const StructuredIterator<MT>& rhs ) noexcept;
+
+template< typename MT >
+const StructuredIterator<MT> operator+( const StructuredIterator<MT>& it, ptrdiff_t inc ) noexcept;
+
+template< typename MT >
+const StructuredIterator<MT> operator+( ptrdiff_t inc, const StructuredIterator<MT>& it ) noexcept;
+
+template< typename MT >
+const StructuredIterator<MT> operator-( const StructuredIterator<MT>& it, ptrdiff_t dec ) noexcept;
+
+template< typename MT >
+ptrdiff_t operator-( const StructuredIterator<MT>& lhs, const StructuredIterator<MT>& rhs ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two StructuredIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators refer to the same element, \a false if not.
+*/
+template< typename MT >  // Type of the structured matrix
+inline bool operator==( const StructuredIterator<MT>& lhs, const StructuredIterator<MT>& rhs ) noexcept
+{
+   return lhs.column() == rhs.column();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two StructuredIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators don't refer to the same element, \a false if they do.
+*/
+template< typename MT >  // Type of the structured matrix
+inline bool operator!=( const StructuredIterator<MT>& lhs, const StructuredIterator<MT>& rhs ) noexcept
+{
+   return lhs.column() != rhs.column();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between two StructuredIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is smaller, \a false if not.
+*/
+template< typename MT >  // Type of the structured matrix
+inline bool operator<( const StructuredIterator<MT>& lhs, const StructuredIterator<MT>& rhs ) noexcept
+{
+   return lhs.column() < rhs.column();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between two StructuredIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater, \a false if not.
+*/
+template< typename MT >  // Type of the structured matrix
+inline bool operator>( const StructuredIterator<MT>& lhs, const StructuredIterator<MT>& rhs ) noexcept
+{
+   return lhs.column() > rhs.column();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between two StructuredIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+*/
+template< typename MT >  // Type of the structured matrix
+inline bool operator<=( const StructuredIterator<MT>& lhs, const StructuredIterator<MT>& rhs ) noexcept
+{
+   return lhs.column() <= rhs.column();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between two StructuredIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+*/
+template< typename MT >  // Type of the structured matrix
+inline bool operator>=( const StructuredIterator<MT>& lhs, const StructuredIterator<MT>& rhs ) noexcept
+{
+   return lhs.column() >= rhs.column();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between a StructuredIterator and an integral value.
+//
+// \param it The iterator to be incremented.
+// \param inc The number of elements the iterator is incremented.
+// \return The incremented iterator.
+*/
+template< typename MT >  // Type of the structured matrix
+inline const StructuredIterator<MT> operator+( const StructuredIterator<MT>& it, ptrdiff_t inc ) noexcept
+{
+   return StructuredIterator<MT>( *it.matrix(), it.row(), it.column() + inc );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between an integral value and a StructuredIterator.
+//
+// \param inc The number of elements the iterator is incremented.
+// \param it The iterator to be incremented.
+// \return The incremented iterator.
+*/
+template< typename MT >  // Type of the structured matrix
+inline const StructuredIterator<MT> operator+( ptrdiff_t inc, const StructuredIterator<MT>& it ) noexcept
+{
+   return StructuredIterator<MT>( *it.matrix(), it.row(), it.column() + inc );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction between a StructuredIterator and an integral value.
+//
+// \param it The iterator to be decremented.
+// \param dec The number of elements the iterator is decremented.
+// \return The decremented iterator.
+*/
+template< typename MT >  // Type of the structured matrix
+inline const StructuredIterator<MT> operator-( const StructuredIterator<MT>& it, ptrdiff_t dec ) noexcept
+{
+   return StructuredIterator<MT>( *it.matrix(), it.row(), it.column() - dec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the number of elements between two iterators.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return The number of elements between the two iterators.
+*/
+template< typename MT >  // Type of the structured matrix
+inline ptrdiff_t operator-( const StructuredIterator<MT>& lhs, const StructuredIterator<MT>& rhs ) noexcept
+{
+   return lhs.column() - rhs.column();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1219 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/ToeplitzMatrix.h
+//  \brief Header file for the implementation of a Toeplitz matrix
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_TOEPLITZMATRIX_H_
+#define _BLAZE_MATH_DENSE_TOEPLITZMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/FFT.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/dense/LSE.h>
+#include <blaze/math/dense/StructuredIterator.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup toeplitz_matrix ToeplitzMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a Toeplitz matrix.
+// \ingroup toeplitz_matrix
+//
+// The ToeplitzMatrix class template represents a \f$ M \times N \f$ Toeplitz matrix, i.e. a
+// matrix with constant diagonals (\f$ A_{ij} = A_{i+1,j+1} \f$). The matrix only stores the
+// \f$ M+N-1 \f$ elements of its first column and its first row. The type of the elements and
+// the group tag of the matrix can be specified via the two template parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, typename Tag >
+   class ToeplitzMatrix;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. ToeplitzMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - Tag : optional type parameter to tag the matrix. The default type is \c blaze::Group0.
+//          See \ref grouping_tagging for details.
+//
+// A Toeplitz matrix is created from its first column and its first row. Since both share the
+// first element, the first elements of the two vectors must be equal. A symmetric Toeplitz
+// matrix, as for instance the autocovariance matrix of a stationary time series, is created
+// from its first column only:
+
+   \code
+   using blaze::ToeplitzMatrix;
+
+   blaze::DynamicVector<double> c{ 4.0, 2.0, 1.0 };
+   blaze::DynamicVector<double> r{ 4.0, -1.0 };
+
+   ToeplitzMatrix<double> A( c, r );  // The 3x2 matrix ( ( 4, -1 ), ( 2, 4 ), ( 1, 2 ) )
+   ToeplitzMatrix<double> B( c );     // The 3x3 matrix ( ( 4, 2, 1 ), ( 2, 4, 2 ), ( 1, 2, 4 ) )
+   \endcode
+
+// A ToeplitzMatrix is a read-only dense matrix, i.e. its elements cannot be modified. It can be
+// used as operand in all arithmetic operations and can be converted into any other dense or
+// sparse matrix by means of an assignment:
+
+   \code
+   blaze::DynamicMatrix<double> D( A );  // Conversion to a general dense matrix
+   \endcode
+
+// The multiplication of a Toeplitz matrix with a dense vector or dense matrix is performed by
+// means of the fast Fourier transform in \f$ O((M+N) \log(M+N)) \f$ operations per column. In
+// case SMP parallelization is enabled, the columns of a dense matrix are processed in parallel.
+// Linear systems with a symmetric Toeplitz matrix are solved by the Levinson-Durbin recursion in
+// \f$ O(N^2) \f$ operations. Systems with a non-symmetric Toeplitz matrix are solved by means of
+// a general dense LU decomposition:
+
+   \code
+   blaze::DynamicVector<double> x( 3UL ), y, z;
+   // ... Initialization
+
+   y = B * x;         // FFT-based matrix/vector multiplication
+   solve( B, z, y );  // Levinson-Durbin recursion
+   \endcode
+
+// Note that the Levinson-Durbin recursion requires all leading principal submatrices to be
+// nonsingular. It is numerically stable for symmetric positive definite matrices.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+class ToeplitzMatrix
+   : public DenseMatrix< ToeplitzMatrix<Type,Tag>, false >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This     = ToeplitzMatrix<Type,Tag>;  //!< Type of this ToeplitzMatrix instance.
+   using BaseType = DenseMatrix<This,false>;     //!< Base type of this ToeplitzMatrix instance.
+
+   //! Result type for expression template evaluations.
+   using ResultType = DynamicMatrix<Type,false,AlignedAllocator<Type>,Tag>;
+
+   //! Result type with opposite storage order for expression template evaluations.
+   using OppositeType = DynamicMatrix<Type,true,AlignedAllocator<Type>,Tag>;
+
+   //! Transpose type for expression template evaluations.
+   using TransposeType = DynamicMatrix<Type,true,AlignedAllocator<Type>,Tag>;
+
+   using ElementType   = Type;         //!< Type of the matrix elements.
+   using TagType       = Tag;          //!< Tag type of this ToeplitzMatrix instance.
+   using ReturnType    = const Type&;  //!< Return type for expression template evaluations.
+   using CompositeType = const This&;  //!< Data type for composite expression templates.
+
+   using Reference      = const Type&;  //!< Reference to a non-constant matrix value.
+   using ConstReference = const Type&;  //!< Reference to a constant matrix value.
+   using Pointer        = const Type*;  //!< Pointer to a non-constant matrix value.
+   using ConstPointer   = const Type*;  //!< Pointer to a constant matrix value.
+
+   using Iterator      = StructuredIterator<This>;  //!< Iterator over non-constant elements.
+   using ConstIterator = StructuredIterator<This>;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a ToeplitzMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = ToeplitzMatrix<NewType,Tag>;  //!< The type of the other ToeplitzMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a ToeplitzMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = ToeplitzMatrix<Type,Tag>;  //!< The type of the other ToeplitzMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. Since the elements of a Toeplitz matrix are not
+       stored contiguously, the \a simdEnabled compilation flag is set to \a false. */
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline ToeplitzMatrix() noexcept;
+
+   template< typename VT, bool TF >
+   explicit inline ToeplitzMatrix( const DenseVector<VT,TF>& column );
+
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   inline ToeplitzMatrix( const DenseVector<VT1,TF1>& column, const DenseVector<VT2,TF2>& row );
+
+   ToeplitzMatrix( const ToeplitzMatrix& ) = default;
+   ToeplitzMatrix( ToeplitzMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~ToeplitzMatrix() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   ToeplitzMatrix& operator=( const ToeplitzMatrix& ) = default;
+   ToeplitzMatrix& operator=( ToeplitzMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline bool   isSymmetric() const;
+   inline void   swap( ToeplitzMatrix& m ) noexcept;
+
+   inline const DynamicVector<Type>& coefficients() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                          //!< The current number of rows of the matrix.
+   size_t n_;                          //!< The current number of columns of the matrix.
+   DynamicVector<Type> coefficients_;  //!< The defining coefficients of the matrix.
+                                       /*!< The element \f$ (i,j) \f$ of the matrix is stored
+                                            at index \f$ i-j+N-1 \f$, i.e. the first row is
+                                            stored in reverse order, followed by the remaining
+                                            elements of the first column. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for ToeplitzMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline ToeplitzMatrix<Type,Tag>::ToeplitzMatrix() noexcept
+   : m_           ( 0UL )  // The current number of rows of the matrix
+   , n_           ( 0UL )  // The current number of columns of the matrix
+   , coefficients_()       // The defining coefficients of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a symmetric Toeplitz matrix.
+//
+// \param column The first column (and first row) of the matrix.
+//
+// This constructor creates a symmetric \f$ N \times N \f$ Toeplitz matrix, whose first column
+// and first row are given by the \a N elements of the given vector.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< typename VT     // Type of the column vector
+        , bool TF >       // Transpose flag of the column vector
+inline ToeplitzMatrix<Type,Tag>::ToeplitzMatrix( const DenseVector<VT,TF>& column )
+   : ToeplitzMatrix( *column, *column )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a general Toeplitz matrix.
+//
+// \param column The first column of the matrix.
+// \param row The first row of the matrix.
+// \exception std::invalid_argument Invalid first row/column.
+//
+// This constructor creates a \f$ M \times N \f$ Toeplitz matrix from its first column (\a M
+// elements) and its first row (\a N elements). In case only one of the two vectors is empty
+// or the first elements of the two vectors differ, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< typename VT1    // Type of the column vector
+        , bool TF1        // Transpose flag of the column vector
+        , typename VT2    // Type of the row vector
+        , bool TF2 >      // Transpose flag of the row vector
+inline ToeplitzMatrix<Type,Tag>::ToeplitzMatrix( const DenseVector<VT1,TF1>& column,
+                                                 const DenseVector<VT2,TF2>& row )
+   : m_           ( (*column).size() )  // The current number of rows of the matrix
+   , n_           ( (*row).size() )     // The current number of columns of the matrix
+   , coefficients_()                    // The defining coefficients of the matrix
+{
+   if( ( m_ == 0UL ) != ( n_ == 0UL ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid empty first row/column" );
+   }
+
+   if( m_ == 0UL ) {
+      return;
+   }
+
+   if( (*column)[0UL] != (*row)[0UL] ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Inconsistent first elements of first row and column" );
+   }
+
+   coefficients_.resize( m_+n_-1UL, false );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      coefficients_[n_-1UL-j] = (*row)[j];
+   }
+   for( size_t i=1UL; i<m_; ++i ) {
+      coefficients_[n_-1UL+i] = (*column)[i];
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename ToeplitzMatrix<Type,Tag>::ConstReference
+   ToeplitzMatrix<Type,Tag>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   return coefficients_[i+n_-1UL-j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename ToeplitzMatrix<Type,Tag>::ConstReference
+   ToeplitzMatrix<Type,Tag>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+//
+// This function returns a row iterator to the first element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename ToeplitzMatrix<Type,Tag>::ConstIterator
+   ToeplitzMatrix<Type,Tag>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+//
+// This function returns a row iterator to the first element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename ToeplitzMatrix<Type,Tag>::ConstIterator
+   ToeplitzMatrix<Type,Tag>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+//
+// This function returns a row iterator just past the last element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename ToeplitzMatrix<Type,Tag>::ConstIterator
+   ToeplitzMatrix<Type,Tag>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+//
+// This function returns a row iterator just past the last element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename ToeplitzMatrix<Type,Tag>::ConstIterator
+   ToeplitzMatrix<Type,Tag>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t ToeplitzMatrix<Type,Tag>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t ToeplitzMatrix<Type,Tag>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows.
+//
+// \return The spacing between the beginning of two rows.
+//
+// This function returns the spacing between the beginning of two rows, i.e. the total number
+// of elements of a row. Since the elements of a Toeplitz matrix are not stored explicitly, the
+// spacing is equal to the number of columns.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t ToeplitzMatrix<Type,Tag>::spacing() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t ToeplitzMatrix<Type,Tag>::capacity() const noexcept
+{
+   return m_ * n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t ToeplitzMatrix<Type,Tag>::capacity( size_t i ) const noexcept
+{
+   MAYBE_UNUSED( i );
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the matrix.
+//
+// Every coefficient is counted with the length of its diagonal, i.e. the function requires
+// \f$ O(M+N) \f$ operations.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t ToeplitzMatrix<Type,Tag>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<coefficients_.size(); ++k ) {
+      if( !isDefault<strict>( coefficients_[k] ) ) {
+         nonzeros += min( k+1UL, m_, n_, m_+n_-1UL-k );
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t ToeplitzMatrix<Type,Tag>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      if( !isDefault<strict>( (*this)(i,j) ) ) {
+         ++nonzeros;
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the Toeplitz matrix is symmetric.
+//
+// \return \a true in case the matrix is square and symmetric, \a false if not.
+//
+// In contrast to the general isSymmetric() function this function only compares the first row
+// and the first column and therefore requires \f$ O(N) \f$ operations.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline bool ToeplitzMatrix<Type,Tag>::isSymmetric() const
+{
+   if( m_ != n_ ) {
+      return false;
+   }
+
+   for( size_t k=1UL; k<n_; ++k ) {
+      if( coefficients_[n_-1UL-k] != coefficients_[n_-1UL+k] ) {
+         return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two Toeplitz matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void ToeplitzMatrix<Type,Tag>::swap( ToeplitzMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( m_, m.m_ );
+   swap( n_, m.n_ );
+   swap( coefficients_, m.coefficients_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the defining coefficients of the Toeplitz matrix.
+//
+// \return The \f$ M+N-1 \f$ defining coefficients.
+//
+// The element \f$ (i,j) \f$ of the matrix corresponds to the coefficient \f$ i-j+N-1 \f$, i.e.
+// the first \a N coefficients contain the first row in reverse order, the remaining \f$ M-1 \f$
+// coefficients contain the remaining elements of the first column.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline const DynamicVector<Type>& ToeplitzMatrix<Type,Tag>::coefficients() const noexcept
+{
+   return coefficients_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the foreign expression
+inline bool ToeplitzMatrix<Type,Tag>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the foreign expression
+inline bool ToeplitzMatrix<Type,Tag>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TOEPLITZMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name ToeplitzMatrix operators */
+//@{
+template< typename Type, typename Tag >
+bool isIntact( const ToeplitzMatrix<Type,Tag>& m ) noexcept;
+
+template< typename Type, typename Tag >
+void swap( ToeplitzMatrix<Type,Tag>& a, ToeplitzMatrix<Type,Tag>& b ) noexcept;
+
+template< typename Type, typename Tag, typename VT1, typename VT2 >
+void multiply( const ToeplitzMatrix<Type,Tag>& A, const DenseVector<VT1,columnVector>& x,
+               DenseVector<VT2,columnVector>& y );
+
+template< typename Type, typename Tag, typename MT1, bool SO1, typename MT2, bool SO2 >
+void multiply( const ToeplitzMatrix<Type,Tag>& A, const DenseMatrix<MT1,SO1>& X,
+               DenseMatrix<MT2,SO2>& Y );
+
+template< typename Type, typename Tag, typename VT1, typename VT2 >
+void solve( const ToeplitzMatrix<Type,Tag>& A, DenseVector<VT1,columnVector>& x,
+            const DenseVector<VT2,columnVector>& b );
+
+template< typename Type, typename Tag, typename MT1, bool SO1, typename MT2, bool SO2 >
+void solve( const ToeplitzMatrix<Type,Tag>& A, DenseMatrix<MT1,SO1>& X,
+            const DenseMatrix<MT2,SO2>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given Toeplitz matrix are intact.
+// \ingroup toeplitz_matrix
+//
+// \param m The Toeplitz matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the Toeplitz matrix are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it will
+// return \a false.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline bool isIntact( const ToeplitzMatrix<Type,Tag>& m ) noexcept
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL && m.coefficients().size() == 0UL ) ||
+          ( m.rows() > 0UL && m.coefficients().size() == m.rows() + m.columns() - 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two Toeplitz matrices.
+// \ingroup toeplitz_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void swap( ToeplitzMatrix<Type,Tag>& a, ToeplitzMatrix<Type,Tag>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a Toeplitz matrix with a dense column vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup toeplitz_matrix
+//
+// \param A The Toeplitz matrix.
+// \param x The right-hand side dense column vector.
+// \param y The resulting dense column vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes the product of the given Toeplitz matrix and the dense column vector
+// \a x by means of the fast Fourier transform in \f$ O((M+N) \log(M+N)) \f$ operations. The
+// resulting vector \a y is resized accordingly.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename VT1    // Type of the right-hand side dense vector
+        , typename VT2 >  // Type of the resulting dense vector
+void multiply( const ToeplitzMatrix<Type,Tag>& A, const DenseVector<VT1,columnVector>& x,
+               DenseVector<VT2,columnVector>& y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*x).size() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (*x).isAliased( &(*y) ) ) {
+      const ResultType_t<VT1> x2( *x );
+      multiply( A, x2, y );
+      return;
+   }
+
+   CompositeType_t<VT1> x2( *x );
+
+   resize( *y, A.rows(), false );
+
+   structuredMultiply( A.coefficients().data(), A.rows(), A.columns(), false, 1UL,
+                       [&x2]( size_t l, size_t ) -> decltype(auto) { return x2[l]; },
+                       [&y]( size_t i, size_t ) -> decltype(auto) { return (*y)[i]; } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a Toeplitz matrix with a dense matrix (\f$ Y=A*X \f$).
+// \ingroup toeplitz_matrix
+//
+// \param A The Toeplitz matrix.
+// \param X The right-hand side dense matrix.
+// \param Y The resulting dense matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the product of the given Toeplitz matrix and the dense matrix \a X
+// by means of the fast Fourier transform in \f$ O((M+N) \log(M+N)) \f$ operations per column
+// of \a X. The resulting matrix \a Y is resized accordingly.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT1    // Type of the right-hand side dense matrix
+        , bool SO1        // Storage order of the right-hand side dense matrix
+        , typename MT2    // Type of the resulting dense matrix
+        , bool SO2 >      // Storage order of the resulting dense matrix
+void multiply( const ToeplitzMatrix<Type,Tag>& A, const DenseMatrix<MT1,SO1>& X,
+               DenseMatrix<MT2,SO2>& Y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*X).rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (*X).isAliased( &(*Y) ) ) {
+      const ResultType_t<MT1> X2( *X );
+      multiply( A, X2, Y );
+      return;
+   }
+
+   CompositeType_t<MT1> X2( *X );
+
+   resize( *Y, A.rows(), X2.columns(), false );
+
+   structuredMultiply( A.coefficients().data(), A.rows(), A.columns(), false, X2.columns(),
+                       [&X2]( size_t l, size_t j ) -> decltype(auto) { return X2(l,j); },
+                       [&Y]( size_t i, size_t j ) -> decltype(auto) { return (*Y)(i,j); } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a Toeplitz matrix and a dense column
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup toeplitz_matrix
+//
+// \param A The Toeplitz matrix.
+// \param x The right-hand side dense column vector.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename VT >   // Type of the right-hand side dense vector
+inline decltype(auto)
+   operator*( const ToeplitzMatrix<Type,Tag>& A, const DenseVector<VT,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = MultTrait_t< Type, ElementType_t<VT> >;
+
+   DynamicVector<ET,columnVector> y;
+   multiply( A, *x, y );
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a Toeplitz matrix and a dense matrix
+//        (\f$ Y=A*X \f$).
+// \ingroup toeplitz_matrix
+//
+// \param A The Toeplitz matrix.
+// \param X The right-hand side dense matrix.
+// \return The resulting dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT     // Type of the right-hand side dense matrix
+        , bool SO >       // Storage order of the right-hand side dense matrix
+inline decltype(auto)
+   operator*( const ToeplitzMatrix<Type,Tag>& A, const DenseMatrix<MT,SO>& X )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = MultTrait_t< Type, ElementType_t<MT> >;
+
+   DynamicMatrix<ET,SO> Y;
+   multiply( A, *X, Y );
+   return Y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Levinson-Durbin recursion for a symmetric Toeplitz system (\f$ T\vec{x}=\vec{b} \f$).
+// \ingroup toeplitz_matrix
+//
+// \param t Pointer to the first of the \a n elements of the first column of the matrix.
+// \param n The number of rows and columns of the matrix.
+// \param x The solution vector, which contains the right-hand side on entry.
+// \param y Workspace for the solution of the Yule-Walker equations.
+// \param v Workspace for the update of the solution.
+// \return void
+// \exception std::invalid_argument Singular leading principal submatrix.
+//
+// This function solves the system with the symmetric Toeplitz matrix \f$ T \f$ by means of the
+// Levinson-Durbin recursion (Golub and Van Loan, Algorithm 4.7.3) in \f$ 4N^2 \f$ operations:
+// the solutions of the systems with the leading principal submatrices of order \f$ k \f$ are
+// updated to order \f$ k+1 \f$ by means of the solutions of the corresponding Yule-Walker
+// equations. In case a leading principal submatrix is singular, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , typename ET >   // Element type of the vectors
+void levinson( const Type* t, size_t n, DynamicVector<ET>& x,
+               DynamicVector<ET>& y, DynamicVector<ET>& v )
+{
+   if( isDefault<strict>( t[0UL] ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Singular leading principal submatrix" );
+   }
+
+   const ET scale( ET(1) / t[0UL] );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      x[i] *= scale;
+   }
+
+   if( n == 1UL ) {
+      return;
+   }
+
+   y.resize( n-1UL, false );
+   v.resize( n-1UL, false );
+
+   const auto r = [t,scale]( size_t k ) { return t[k] * scale; };
+
+   ET alpha( -r(1UL) );
+   ET beta ( 1 );
+
+   y[0UL] = alpha;
+
+   for( size_t k=1UL; k<n; ++k )
+   {
+      beta *= ( ET(1) - alpha*alpha );
+
+      if( isDefault<strict>( beta ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Singular leading principal submatrix" );
+      }
+
+      ET mu( x[k] );
+      for( size_t i=0UL; i<k; ++i ) {
+         mu -= r(i+1UL) * x[k-1UL-i];
+      }
+      mu /= beta;
+
+      for( size_t i=0UL; i<k; ++i ) {
+         v[i] = x[i] + mu * y[k-1UL-i];
+      }
+      for( size_t i=0UL; i<k; ++i ) {
+         x[i] = v[i];
+      }
+      x[k] = mu;
+
+      if( k+1UL < n )
+      {
+         alpha = -r(k+1UL);
+         for( size_t i=0UL; i<k; ++i ) {
+            alpha -= r(i+1UL) * y[k-1UL-i];
+         }
+         alpha /= beta;
+
+         for( size_t i=0UL; i<k; ++i ) {
+            v[i] = y[i] + alpha * y[k-1UL-i];
+         }
+         for( size_t i=0UL; i<k; ++i ) {
+            y[i] = v[i];
+         }
+         y[k] = alpha;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system of equations \f$ A\vec{x}=\vec{b} \f$ with a Toeplitz matrix.
+// \ingroup toeplitz_matrix
+//
+// \param A The square Toeplitz system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Singular leading principal submatrix.
+//
+// In case the given Toeplitz matrix is symmetric, this function solves the system by means of
+// the Levinson-Durbin recursion in \f$ O(N^2) \f$ operations. In case a leading principal
+// submatrix of the matrix is singular, a \a std::invalid_argument exception is thrown. Systems
+// with non-symmetric Toeplitz matrices are solved by the general dense solve() function. The
+// solution vector \a x is resized accordingly.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void solve( const ToeplitzMatrix<Type,Tag>& A, DenseVector<VT1,columnVector>& x,
+            const DenseVector<VT2,columnVector>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<VT1>;
+
+   if( !A.isSymmetric() ) {
+      solve( static_cast< const DenseMatrix<ToeplitzMatrix<Type,Tag>,false>& >( A ), *x, *b );
+      return;
+   }
+
+   if( (*b).size() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   if( A.rows() == 0UL ) {
+      resize( *x, 0UL, false );
+      return;
+   }
+
+   DynamicVector<ET> work( serial( *b ) ), y, v;
+   levinson( A.coefficients().data() + A.columns() - 1UL, A.rows(), work, y, v );
+
+   resize( *x, A.rows(), false );
+   *x = work;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system of equations \f$ AX=B \f$ with a Toeplitz matrix.
+// \ingroup toeplitz_matrix
+//
+// \param A The square Toeplitz system matrix.
+// \param X The resulting solution matrix.
+// \param B The right-hand side matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::invalid_argument Singular leading principal submatrix.
+//
+// In case the given Toeplitz matrix is symmetric, this function solves the system for all
+// columns of \a B by means of the Levinson-Durbin recursion in \f$ O(N^2) \f$ operations per
+// column. In case SMP parallelization is enabled, the columns are solved in parallel. Systems
+// with non-symmetric Toeplitz matrices are solved by the general dense solve() function. The
+// solution matrix \a X is resized accordingly.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT1    // Type of the solution matrix
+        , bool SO1        // Storage order of the solution matrix
+        , typename MT2    // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+void solve( const ToeplitzMatrix<Type,Tag>& A, DenseMatrix<MT1,SO1>& X,
+            const DenseMatrix<MT2,SO2>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT1>;
+
+   if( !A.isSymmetric() ) {
+      solve( static_cast< const DenseMatrix<ToeplitzMatrix<Type,Tag>,false>& >( A ), *X, *B );
+      return;
+   }
+
+   if( (*B).rows() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   const size_t n( A.rows() );
+   const size_t k( (*B).columns() );
+
+   DynamicMatrix<ET,columnMajor> work( serial( *B ) );
+
+   const auto compute = [&A,&work,n]( size_t j )
+   {
+      DynamicVector<ET> x( serial( column( work, j, unchecked ) ) ), y, v;
+      levinson( A.coefficients().data() + n - 1UL, n, x, y, v );
+      column( work, j, unchecked ) = serial( x );
+   };
+
+   if( n > 0UL && k > 1UL && getNumThreads() > 1UL && n*k >= SMP_DMATDMATMULT_THRESHOLD &&
+       !isSerialSectionActive() && !isParallelSectionActive() )
+   {
+      BLAZE_PARALLEL_SECTION
+      {
+         smpFor( k, compute );
+      }
+   }
+   else if( n > 0UL )
+   {
+      for( size_t j=0UL; j<k; ++j ) {
+         compute( j );
+      }
+   }
+
+   resize( *X, n, k, false );
+   *X = work;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,174 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dlpack/DLManagedTensor.h
+//  \brief Header file for the DLPack tensor data structures
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DLPACK_DLMANAGEDTENSOR_H_
+#define _BLAZE_MATH_DLPACK_DLMANAGEDTENSOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdint>
+
+
+//=================================================================================================
+//
+//  DLPACK DATA STRUCTURES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup math_dlpack DLPack interoperability
+// \ingroup math
+//
+// The following data structures are a header-only transcription of the C ABI of the DLPack
+// specification (version 0.8, see https://github.com/dmlc/dlpack). They are binary compatible
+// with the original \c dlpack.h header and use the same include guard. Therefore it does not
+// matter whether the original DLPack header or the Blaze header is included first: in every
+// translation unit only the first definition is active.
+*/
+#ifndef DLPACK_DLPACK_H_
+#define DLPACK_DLPACK_H_
+
+//! The version of the DLPack specification.
+#define DLPACK_VERSION 80
+
+//! The version of the DLPack ABI.
+#define DLPACK_ABI_VERSION 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//*************************************************************************************************
+/*!\brief The device type of a DLPack tensor.
+// \ingroup math_dlpack
+*/
+typedef enum {
+   kDLCPU = 1,           //!< CPU device.
+   kDLCUDA = 2,          //!< CUDA GPU device.
+   kDLCUDAHost = 3,      //!< Pinned CUDA CPU memory.
+   kDLOpenCL = 4,        //!< OpenCL devices.
+   kDLVulkan = 7,        //!< Vulkan buffer for next generation graphics.
+   kDLMetal = 8,         //!< Metal for Apple GPU.
+   kDLVPI = 9,           //!< Verilog simulator buffer.
+   kDLROCM = 10,         //!< ROCm GPUs for AMD GPUs.
+   kDLROCMHost = 11,     //!< Pinned ROCm CPU memory.
+   kDLExtDev = 12,       //!< Reserved extension device type.
+   kDLCUDAManaged = 13,  //!< CUDA managed/unified memory.
+   kDLOneAPI = 14,       //!< Unified shared memory allocated on a oneAPI non-partitioned device.
+   kDLWebGPU = 15,       //!< GPU support for next generation WebGPU standard.
+   kDLHexagon = 16       //!< Qualcomm Hexagon DSP.
+} DLDeviceType;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The device of a DLPack tensor.
+// \ingroup math_dlpack
+*/
+typedef struct {
+   DLDeviceType device_type;  //!< The device type used in the device.
+   int32_t device_id;         //!< The device index.
+} DLDevice;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The type code options of a DLPack data type.
+// \ingroup math_dlpack
+*/
+typedef enum {
+   kDLInt = 0U,           //!< Signed integer.
+   kDLUInt = 1U,          //!< Unsigned integer.
+   kDLFloat = 2U,         //!< IEEE floating point.
+   kDLOpaqueHandle = 3U,  //!< Opaque handle type.
+   kDLBfloat = 4U,        //!< The bfloat16 type.
+   kDLComplex = 5U,       //!< Complex number (C/C++/Python layout: compact struct per complex number).
+   kDLBool = 6U           //!< Boolean.
+} DLDataTypeCode;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The data type of the elements of a DLPack tensor.
+// \ingroup math_dlpack
+*/
+typedef struct {
+   uint8_t code;    //!< Type code of the base type (see DLDataTypeCode).
+   uint8_t bits;    //!< Number of bits of the base type.
+   uint16_t lanes;  //!< Number of lanes in the type (1 for scalar types).
+} DLDataType;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Plain (non-owning) DLPack tensor.
+// \ingroup math_dlpack
+*/
+typedef struct {
+   void* data;             //!< The data pointer (including the byte_offset).
+   DLDevice device;        //!< The device of the tensor.
+   int32_t ndim;           //!< The number of dimensions.
+   DLDataType dtype;       //!< The data type of the elements.
+   int64_t* shape;         //!< The shape of the tensor.
+   int64_t* strides;       //!< The strides of the tensor (in number of elements, can be NULL).
+   uint64_t byte_offset;   //!< The offset in bytes to the beginning pointer to data.
+} DLTensor;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Managed DLPack tensor.
+// \ingroup math_dlpack
+//
+// The managed tensor is the unit of exchange between frameworks. The consumer of a managed
+// tensor calls the \a deleter as soon as it does not require the tensor anymore.
+*/
+typedef struct DLManagedTensor {
+   DLTensor dl_tensor;                            //!< The DLPack tensor.
+   void* manager_ctx;                             //!< The context of the original framework.
+   void (*deleter)(struct DLManagedTensor* self); //!< Destructor of the managed tensor.
+} DLManagedTensor;
+//*************************************************************************************************
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
+//*************************************************************************************************
+
+#endif
@@ -0,0 +1,125 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dlpack/DLPackContext.h
+//  \brief Header file for the context of DLPack tensors exported by Blaze
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DLPACK_DLPACKCONTEXT_H_
+#define _BLAZE_MATH_DLPACK_DLPACKCONTEXT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/dlpack/DLManagedTensor.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Context of a managed DLPack tensor exported by Blaze.
+// \ingroup math_dlpack
+//
+// The context holds the managed tensor itself, the shape and strides arrays referenced by the
+// tensor, and the owner of the memory of the tensor. The owner may be empty in case the memory
+// of the tensor is not owned by the tensor. The \a padded flag states whether the gap between
+// two rows/columns of the tensor consists of Blaze padding elements, which are guaranteed to
+// be zero.
+*/
+struct DLPackContext
+{
+   DLManagedTensor       tensor;      //!< The exported managed tensor.
+   int64_t               shape[2];    //!< The extents of the tensor.
+   int64_t               strides[2];  //!< The strides of the tensor (in number of elements).
+   std::shared_ptr<void> owner;       //!< The owner of the memory of the tensor.
+   bool                  padded;      //!< Flag for zero padding elements between rows/columns.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Deleter of managed DLPack tensors exported by Blaze.
+// \ingroup math_dlpack
+//
+// \param tensor The managed tensor to be destroyed.
+// \return void
+*/
+inline void deleteDLPackContext( DLManagedTensor* tensor )
+{
+   delete static_cast<DLPackContext*>( tensor->manager_ctx );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given managed DLPack tensor has been exported by Blaze with zero
+//        padding elements.
+// \ingroup math_dlpack
+//
+// \param tensor The managed DLPack tensor.
+// \return \a true in case the tensor is known to be zero padded, \a false if not.
+//
+// Tensors exported by Blaze are identified via their deleter. For all foreign tensors the
+// content of the memory between two rows/columns is unknown and this function returns \a false.
+*/
+inline bool isZeroPadded( const DLManagedTensor& tensor ) noexcept
+{
+   return tensor.deleter == &deleteDLPackContext &&
+          static_cast<const DLPackContext*>( tensor.manager_ctx )->padded;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,753 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dlpack/DLPackTensor.h
+//  \brief Header file for the DLPackTensor class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DLPACK_DLPACKTENSOR_H_
+#define _BLAZE_MATH_DLPACK_DLPACKTENSOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/dense/StridedMatrix.h>
+#include <blaze/math/dense/StridedVector.h>
+#include <blaze/math/dlpack/DataTypeMapping.h>
+#include <blaze/math/dlpack/DLManagedTensor.h>
+#include <blaze/math/dlpack/DLPackContext.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Shared handle to an imported DLPack tensor.
+// \ingroup math_dlpack
+//
+// The DLPackTensor class represents a DLPack tensor (see https://github.com/dmlc/dlpack) that
+// has been handed over to Blaze by another framework (e.g. PyTorch, NumPy, or JAX). The handle
+// takes ownership of the given DLManagedTensor and shares it between all copies of the handle.
+// As soon as the last copy is destroyed, the deleter of the managed tensor is called. Vectors
+// and matrices on top of the tensor are created via the vector(), matrix(), customVector(), and
+// customMatrix() member functions. All of them refer to the memory of the tensor without any
+// copy operation and remain valid as long as at least one copy of the handle is alive:
+
+   \code
+   DLManagedTensor* managed = ...;  // For instance received from torch.utils.dlpack.to_dlpack()
+
+   blaze::DLPackTensor tensor( blaze::fromDLPack( managed ) );
+
+   // Strided view on the tensor, works for arbitrary strides
+   blaze::StridedMatrix<float,blaze::rowMajor> A( tensor.matrix<float,blaze::rowMajor>() );
+
+   // Vectorized view on the tensor, requires contiguous rows
+   if( tensor.isContiguous<blaze::rowMajor>() ) {
+      blaze::CustomMatrix<float,blaze::unaligned,blaze::unpadded,blaze::rowMajor> B(
+         tensor.customMatrix<float,blaze::unaligned,blaze::unpadded,blaze::rowMajor>() );
+   }
+   \endcode
+
+// Only one- and two-dimensional tensors in host memory are supported. The strides of the tensor
+// are normalized during the import: in case no strides are given, the compact row-major layout
+// is assumed, and zero strides of dimensions with an extent of 1 are replaced by 1 since Blaze
+// does not accept zero strides. Zero strides of dimensions with larger extents (i.e. broadcast
+// tensors) are preserved and are rejected when a view is created.
+//
+// The isAligned() and isPadded() member functions report whether the alignment and the spacing
+// of the tensor permit the use of aligned and padded custom matrices and vectors, i.e. whether
+// the fully vectorized kernels of Blaze can be used on the tensor. Since Blaze writes to the
+// padding elements of padded custom matrices and vectors, only tensors exported by Blaze from
+// padded data structures (see toDLPack()) are considered padded. A foreign tensor is never
+// considered padded, since the gap between two of its rows/columns may contain data (as for
+// instance in case of a slice of a larger array).
+*/
+class DLPackTensor
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline DLPackTensor( DLManagedTensor* tensor );
+
+   DLPackTensor( const DLPackTensor& ) = default;
+   DLPackTensor( DLPackTensor&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~DLPackTensor() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   DLPackTensor& operator=( const DLPackTensor& ) = default;
+   DLPackTensor& operator=( DLPackTensor&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline DLManagedTensor*  get       () const noexcept;
+   inline void*             data      () const noexcept;
+   inline size_t            dimensions() const noexcept;
+   inline size_t            extent    ( size_t dim ) const noexcept;
+   inline ptrdiff_t         stride    ( size_t dim ) const noexcept;
+   inline const DLDataType& dataType  () const noexcept;
+   inline const DLDevice&   device    () const noexcept;
+   inline long              useCount  () const noexcept;
+
+   template< typename Type >
+   inline bool isType() const noexcept;
+
+   template< bool SO = defaultStorageOrder >
+   inline bool isContiguous() const noexcept;
+
+   template< typename Type, bool SO = defaultStorageOrder >
+   inline bool isAligned() const noexcept;
+
+   template< typename Type, bool SO = defaultStorageOrder >
+   inline bool isPadded() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**View functions******************************************************************************
+   /*!\name View functions */
+   //@{
+   template< typename Type, bool TF = defaultTransposeFlag >
+   inline StridedVector<Type,TF> vector() const;
+
+   template< typename Type, bool SO = defaultStorageOrder >
+   inline StridedMatrix<Type,SO> matrix() const;
+
+   template< typename Type, AlignmentFlag AF, PaddingFlag PF, bool TF = defaultTransposeFlag >
+   inline CustomVector<Type,AF,PF,TF> customVector() const;
+
+   template< typename Type, AlignmentFlag AF, PaddingFlag PF, bool SO = defaultStorageOrder >
+   inline CustomMatrix<Type,AF,PF,SO> customMatrix() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool SO >
+   inline size_t spacing() const noexcept;
+
+   template< typename Type >
+   inline Type* pointer() const;
+
+   template< typename Type, AlignmentFlag AF, PaddingFlag PF, bool TF >
+   inline CustomVector<Type,AF,PF,TF> customVector( FalseType ) const;
+
+   template< typename Type, AlignmentFlag AF, PaddingFlag PF, bool TF >
+   inline CustomVector<Type,AF,PF,TF> customVector( TrueType ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::shared_ptr<DLManagedTensor> tensor_;  //!< The shared managed tensor.
+   size_t    ndim_;                           //!< The number of dimensions of the tensor.
+   size_t    extents_[2];                     //!< The extents of the tensor.
+   ptrdiff_t strides_[2];                     //!< The normalized strides of the tensor.
+   bool      padded_;                         //!< Flag for zero padding elements.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for a DLPackTensor.
+//
+// \param tensor The managed DLPack tensor to be imported.
+// \exception std::invalid_argument Invalid DLPack tensor.
+//
+// This constructor takes ownership of the given managed DLPack tensor. In case the tensor is
+// not a one- or two-dimensional tensor in host memory with scalar elements, a
+// \a std::invalid_argument exception is thrown. In this case the ownership of the tensor remains
+// with the caller, i.e. the deleter of the tensor is not called.
+*/
+inline DLPackTensor::DLPackTensor( DLManagedTensor* tensor )
+   : tensor_ ()             // The shared managed tensor
+   , ndim_   ( 0UL )        // The number of dimensions of the tensor
+   , extents_{ 1UL, 1UL }   // The extents of the tensor
+   , strides_{ 1L, 1L }     // The normalized strides of the tensor
+   , padded_ ( false )      // Flag for zero padding elements
+{
+   if( tensor == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid DLPack tensor" );
+   }
+
+   const DLTensor& dl( tensor->dl_tensor );
+
+   if( dl.ndim < 1 || dl.ndim > 2 ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of dimensions of DLPack tensor" );
+   }
+
+   if( dl.device.device_type != kDLCPU && dl.device.device_type != kDLCUDAHost &&
+       dl.device.device_type != kDLROCMHost ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid device of DLPack tensor" );
+   }
+
+   if( dl.dtype.lanes != 1U || dl.shape == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid DLPack tensor" );
+   }
+
+   ndim_ = static_cast<size_t>( dl.ndim );
+
+   for( size_t i=0UL; i<ndim_; ++i ) {
+      if( dl.shape[i] < 0 ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid extent of DLPack tensor" );
+      }
+      extents_[i] = static_cast<size_t>( dl.shape[i] );
+   }
+
+   if( dl.strides != nullptr ) {
+      for( size_t i=0UL; i<ndim_; ++i ) {
+         strides_[i] = static_cast<ptrdiff_t>( dl.strides[i] );
+         if( strides_[i] == 0L && extents_[i] <= 1UL )
+            strides_[i] = 1L;
+      }
+   }
+   else if( ndim_ == 2UL ) {
+      strides_[0] = static_cast<ptrdiff_t>( max( extents_[1], 1UL ) );
+   }
+
+   padded_ = isZeroPadded( *tensor );
+
+   tensor_.reset( tensor, []( DLManagedTensor* ptr ) {
+      if( ptr->deleter != nullptr )
+         ptr->deleter( ptr );
+   } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the managed DLPack tensor.
+//
+// \return Pointer to the managed DLPack tensor.
+//
+// The ownership of the tensor remains with the handle, i.e. the returned pointer must not be
+// passed to another consumer. In order to share the tensor with another framework, use the
+// toDLPack() function.
+*/
+inline DLManagedTensor* DLPackTensor::get() const noexcept
+{
+   return tensor_.get();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first element of the tensor.
+//
+// \return Pointer to the first element of the tensor (including the byte offset).
+*/
+inline void* DLPackTensor::data() const noexcept
+{
+   const DLTensor& dl( tensor_->dl_tensor );
+   return static_cast<char*>( dl.data ) + dl.byte_offset;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of dimensions of the tensor.
+//
+// \return The number of dimensions of the tensor (either 1 or 2).
+*/
+inline size_t DLPackTensor::dimensions() const noexcept
+{
+   return ndim_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the extent of the given dimension of the tensor.
+//
+// \param dim The dimension of the tensor \f$[0..dimensions()-1]\f$.
+// \return The extent of the given dimension.
+*/
+inline size_t DLPackTensor::extent( size_t dim ) const noexcept
+{
+   BLAZE_USER_ASSERT( dim < ndim_, "Invalid dimension access index" );
+   return extents_[dim];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the normalized stride of the given dimension of the tensor.
+//
+// \param dim The dimension of the tensor \f$[0..dimensions()-1]\f$.
+// \return The stride of the given dimension (in number of elements).
+*/
+inline ptrdiff_t DLPackTensor::stride( size_t dim ) const noexcept
+{
+   BLAZE_USER_ASSERT( dim < ndim_, "Invalid dimension access index" );
+   return strides_[dim];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the data type of the elements of the tensor.
+//
+// \return The DLPack data type of the elements.
+*/
+inline const DLDataType& DLPackTensor::dataType() const noexcept
+{
+   return tensor_->dl_tensor.dtype;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the device of the tensor.
+//
+// \return The DLPack device of the tensor.
+*/
+inline const DLDevice& DLPackTensor::device() const noexcept
+{
+   return tensor_->dl_tensor.device;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of handles sharing the tensor.
+//
+// \return The number of handles sharing the tensor.
+//
+// Note that tensors exported via toDLPack() keep a reference to the tensor as well.
+*/
+inline long DLPackTensor::useCount() const noexcept
+{
+   return tensor_.use_count();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the elements of the tensor are of the given type.
+//
+// \return \a true in case the element type matches, \a false if not.
+*/
+template< typename Type >  // Data type of the elements
+inline bool DLPackTensor::isType() const noexcept
+{
+   return DataTypeMapping<Type>::matches( dataType() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the rows/columns of the tensor are contiguous in memory.
+//
+// \return \a true in case the tensor is contiguous, \a false if not.
+//
+// In case of a two-dimensional tensor this function returns whether the rows (\a SO ==
+// \a rowMajor) or columns (\a SO == \a columnMajor) of the tensor are contiguous and
+// non-overlapping, i.e. whether the tensor can be represented by a CustomMatrix with the given
+// storage order. In case of a one-dimensional tensor it returns whether the elements of the
+// tensor are contiguous.
+*/
+template< bool SO >  // Storage order
+inline bool DLPackTensor::isContiguous() const noexcept
+{
+   if( ndim_ == 1UL ) {
+      return extents_[0] <= 1UL || strides_[0] == 1L;
+   }
+
+   const size_t minor( SO ? 0UL : 1UL );
+   const size_t major( SO ? 1UL : 0UL );
+
+   return ( extents_[minor] <= 1UL || strides_[minor] == 1L ) &&
+          ( extents_[major] <= 1UL ||
+            strides_[major] >= static_cast<ptrdiff_t>( max( extents_[minor], 1UL ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the tensor permits the use of aligned custom vectors/matrices.
+//
+// \return \a true in case an aligned vector/matrix can be used, \a false if not.
+//
+// This function returns whether the tensor is contiguous (see isContiguous()), of the given
+// element type, and whether both the first element and the beginning of each row (\a SO ==
+// \a rowMajor) or column (\a SO == \a columnMajor) are properly aligned for the SIMD kernels
+// of the given element type.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline bool DLPackTensor::isAligned() const noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   return isType<Type>() && isContiguous<SO>() &&
+          checkAlignment( static_cast<const Type*>( data() ) ) &&
+          ( ndim_ == 1UL || spacing<SO>() % SIMDSIZE == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the tensor permits the use of padded custom vectors/matrices.
+//
+// \return \a true in case a padded vector/matrix can be used, \a false if not.
+//
+// This function returns whether the tensor has been exported by Blaze from a padded data
+// structure, whether the tensor is aligned (see isAligned()), and whether the spacing between
+// two rows (\a SO == \a rowMajor) or columns (\a SO == \a columnMajor) is large enough to
+// accommodate the padding elements required by the SIMD kernels. Since a padded custom matrix
+// resets its padding elements and since the SIMD kernels write to them, foreign tensors are
+// never considered padded: the gap between two rows/columns of a foreign tensor may belong to
+// another array. Since the capacity of a one-dimensional tensor is unknown, a one-dimensional
+// tensor is only considered padded in case its size is a multiple of the SIMD width.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline bool DLPackTensor::isPadded() const noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t extent( ( ndim_ == 1UL )?( extents_[0] ):( extents_[SO ? 0UL : 1UL] ) );
+   const size_t capacity( ( ndim_ == 1UL )?( extents_[0] ):( spacing<SO>() ) );
+
+   return padded_ && isAligned<Type,SO>() &&
+          ( !IsVectorizable_v<Type> || capacity >= nextMultiple<size_t>( extent, SIMDSIZE ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the spacing between two rows/columns of a contiguous two-dimensional tensor.
+//
+// \return The spacing between two rows (\a SO == \a rowMajor) or columns (\a SO == \a columnMajor).
+*/
+template< bool SO >  // Storage order
+inline size_t DLPackTensor::spacing() const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( ndim_ == 2UL, "Invalid number of dimensions detected" );
+
+   const size_t minor( SO ? 0UL : 1UL );
+   const size_t major( SO ? 1UL : 0UL );
+
+   return ( extents_[major] > 1UL )
+          ?( static_cast<size_t>( strides_[major] ) )
+          :( extents_[minor] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a typed pointer to the first element of the tensor.
+//
+// \return Pointer to the first element of the tensor.
+// \exception std::invalid_argument Invalid element type.
+*/
+template< typename Type >  // Data type of the elements
+inline Type* DLPackTensor::pointer() const
+{
+   if( !isType<Type>() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid element type of DLPack tensor" );
+   }
+
+   return static_cast<Type*>( data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  VIEW FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a strided vector on top of a one-dimensional tensor.
+//
+// \return The strided vector referring to the elements of the tensor.
+// \exception std::invalid_argument Invalid DLPack tensor.
+//
+// This function creates a strided vector referring to the elements of the tensor. In case the
+// tensor is not one-dimensional or in case the element type does not match, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , bool TF >      // Transpose flag
+inline StridedVector<Type,TF> DLPackTensor::vector() const
+{
+   if( ndim_ != 1UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of dimensions of DLPack tensor" );
+   }
+
+   return StridedVector<Type,TF>( pointer<Type>(), extents_[0], strides_[0] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a strided matrix on top of a two-dimensional tensor.
+//
+// \return The strided matrix referring to the elements of the tensor.
+// \exception std::invalid_argument Invalid DLPack tensor.
+//
+// This function creates a strided matrix referring to the elements of the tensor. The first
+// dimension of the tensor is interpreted as rows, the second dimension as columns. The given
+// storage order does not affect the mapping of the elements, but only the storage order of the
+// resulting matrix type. In case the tensor is not two-dimensional or in case the element type
+// does not match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline StridedMatrix<Type,SO> DLPackTensor::matrix() const
+{
+   if( ndim_ != 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of dimensions of DLPack tensor" );
+   }
+
+   return StridedMatrix<Type,SO>( pointer<Type>(), extents_[0], extents_[1], strides_[0], strides_[1] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a custom vector on top of a contiguous one-dimensional tensor.
+//
+// \return The custom vector referring to the elements of the tensor.
+// \exception std::invalid_argument Invalid DLPack tensor.
+//
+// This function creates a custom vector referring to the elements of the tensor. In case the
+// tensor is not one-dimensional, not contiguous, or in case the element type does not match,
+// a \a std::invalid_argument exception is thrown. The same holds in case a padded vector is
+// requested for a tensor that is not padded (see isPadded()). Additionally, the constructor of
+// the custom vector throws in case the tensor does not satisfy the given alignment flag (see
+// isAligned()).
+*/
+template< typename Type     // Data type of the elements
+        , AlignmentFlag AF  // Alignment flag
+        , PaddingFlag PF    // Padding flag
+        , bool TF >         // Transpose flag
+inline CustomVector<Type,AF,PF,TF> DLPackTensor::customVector() const
+{
+   if( ndim_ != 1UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of dimensions of DLPack tensor" );
+   }
+
+   if( !isContiguous<rowMajor>() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Non-contiguous DLPack tensor" );
+   }
+
+   return customVector<Type,AF,PF,TF>( BoolConstant<PF>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates an unpadded custom vector on top of a contiguous one-dimensional tensor.
+//
+// \return The custom vector referring to the elements of the tensor.
+// \exception std::invalid_argument Invalid DLPack tensor.
+*/
+template< typename Type     // Data type of the elements
+        , AlignmentFlag AF  // Alignment flag
+        , PaddingFlag PF    // Padding flag
+        , bool TF >         // Transpose flag
+inline CustomVector<Type,AF,PF,TF> DLPackTensor::customVector( FalseType ) const
+{
+   return CustomVector<Type,AF,PF,TF>( pointer<Type>(), extents_[0] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a padded custom vector on top of a contiguous one-dimensional tensor.
+//
+// \return The custom vector referring to the elements of the tensor.
+// \exception std::invalid_argument Invalid DLPack tensor.
+*/
+template< typename Type     // Data type of the elements
+        , AlignmentFlag AF  // Alignment flag
+        , PaddingFlag PF    // Padding flag
+        , bool TF >         // Transpose flag
+inline CustomVector<Type,AF,PF,TF> DLPackTensor::customVector( TrueType ) const
+{
+   Type* const ptr( pointer<Type>() );
+
+   if( !isPadded<Type,rowMajor>() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unpadded DLPack tensor" );
+   }
+
+   return CustomVector<Type,AF,PF,TF>( ptr, extents_[0], extents_[0] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a custom matrix on top of a contiguous two-dimensional tensor.
+//
+// \return The custom matrix referring to the elements of the tensor.
+// \exception std::invalid_argument Invalid DLPack tensor.
+//
+// This function creates a custom matrix referring to the elements of the tensor. In case the
+// tensor is not two-dimensional, in case the rows (\a SO == \a rowMajor) or columns (\a SO ==
+// \a columnMajor) of the tensor are not contiguous, or in case the element type does not match,
+// a \a std::invalid_argument exception is thrown. Since a padded custom matrix resets its
+// padding elements, a padded matrix can only be created for tensors that have been exported by
+// Blaze from a padded matrix (see isPadded()). For all other tensors, and in particular for
+// slices of larger arrays, the request of a padded matrix results in a \a std::invalid_argument
+// exception. Additionally, the constructor of the custom matrix throws in case the tensor does
+// not satisfy the given alignment flag (see isAligned()).
+*/
+template< typename Type     // Data type of the elements
+        , AlignmentFlag AF  // Alignment flag
+        , PaddingFlag PF    // Padding flag
+        , bool SO >         // Storage order
+inline CustomMatrix<Type,AF,PF,SO> DLPackTensor::customMatrix() const
+{
+   if( ndim_ != 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of dimensions of DLPack tensor" );
+   }
+
+   if( !isContiguous<SO>() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Non-contiguous DLPack tensor" );
+   }
+
+   Type* const ptr( pointer<Type>() );
+
+   if( PF == padded && !isPadded<Type,SO>() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unpadded DLPack tensor" );
+   }
+
+   return CustomMatrix<Type,AF,PF,SO>( ptr, extents_[0], extents_[1], spacing<SO>() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DLPackTensor functions */
+//@{
+inline DLPackTensor fromDLPack( DLManagedTensor* tensor );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Imports the given managed DLPack tensor.
+// \ingroup math_dlpack
+//
+// \param tensor The managed DLPack tensor to be imported.
+// \return The shared handle to the imported tensor.
+// \exception std::invalid_argument Invalid DLPack tensor.
+//
+// This function takes ownership of the given managed DLPack tensor and returns a shared handle
+// to it (see the DLPackTensor class for details). No element is copied. In case the tensor
+// cannot be represented by a Blaze vector or matrix, a \a std::invalid_argument exception is
+// thrown and the ownership of the tensor remains with the caller.
+*/
+inline DLPackTensor fromDLPack( DLManagedTensor* tensor )
+{
+   return DLPackTensor( tensor );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
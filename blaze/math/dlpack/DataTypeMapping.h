@@ -0,0 +1,206 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dlpack/DataTypeMapping.h
+//  \brief Header file for the mapping between Blaze element types and DLPack data types
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DLPACK_DATATYPEMAPPING_H_
+#define _BLAZE_MATH_DLPACK_DATATYPEMAPPING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dlpack/DLManagedTensor.h>
+#include <blaze/util/typetraits/IsBoolean.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+#include <blaze/util/typetraits/IsSigned.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the DataTypeMapping class template.
+// \ingroup math_dlpack
+*/
+template< bool IsBool, bool IsSignedIntegral, bool IsUnsignedIntegral, bool IsFloatingPoint, bool IsComplex >
+struct DataTypeMappingHelper;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DataTypeMappingHelper for boolean data types.
+// \ingroup math_dlpack
+*/
+template< bool IsSignedIntegral, bool IsUnsignedIntegral >
+struct DataTypeMappingHelper<true,IsSignedIntegral,IsUnsignedIntegral,false,false>
+{
+ public:
+   //**********************************************************************************************
+   static constexpr uint8_t code = kDLBool;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DataTypeMappingHelper for signed integral data types.
+// \ingroup math_dlpack
+*/
+template<>
+struct DataTypeMappingHelper<false,true,false,false,false>
+{
+ public:
+   //**********************************************************************************************
+   static constexpr uint8_t code = kDLInt;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DataTypeMappingHelper for unsigned integral data types.
+// \ingroup math_dlpack
+*/
+template<>
+struct DataTypeMappingHelper<false,false,true,false,false>
+{
+ public:
+   //**********************************************************************************************
+   static constexpr uint8_t code = kDLUInt;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DataTypeMappingHelper for floating-point data types.
+// \ingroup math_dlpack
+*/
+template<>
+struct DataTypeMappingHelper<false,false,false,true,false>
+{
+ public:
+   //**********************************************************************************************
+   static constexpr uint8_t code = kDLFloat;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DataTypeMappingHelper for complex data types.
+// \ingroup math_dlpack
+*/
+template<>
+struct DataTypeMappingHelper<false,false,false,false,true>
+{
+ public:
+   //**********************************************************************************************
+   static constexpr uint8_t code = kDLComplex;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion from a Blaze element type to a DLPack data type.
+// \ingroup math_dlpack
+//
+// This class template converts the given element type into the according DLPack data type.
+// The \a value() member function returns the DLDataType structure representing the given type.
+// Only boolean, integral, floating-point and complex types can be mapped, all other types
+// result in a compilation error.
+*/
+template< typename T >
+struct DataTypeMapping
+{
+ public:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   static constexpr uint8_t code = DataTypeMappingHelper< IsBoolean_v<T>
+                                                        , IsIntegral_v<T> && IsSigned_v<T>
+                                                        , IsIntegral_v<T> && !IsSigned_v<T>
+                                                        , IsFloatingPoint_v<T>
+                                                        , IsComplex_v<T>
+                                                        >::code;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the DLPack data type for the given element type.
+   //
+   // \return The DLPack data type.
+   */
+   static constexpr DLDataType value() noexcept
+   {
+      return DLDataType{ code, static_cast<uint8_t>( sizeof( T ) * 8UL ), 1U };
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the given DLPack data type matches the given element type.
+   //
+   // \param dtype The DLPack data type to be checked.
+   // \return \a true in case the data type matches the element type, \a false if not.
+   */
+   static constexpr bool matches( const DLDataType& dtype ) noexcept
+   {
+      return dtype.code == code && dtype.bits == sizeof( T ) * 8UL && dtype.lanes == 1U;
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,551 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dlpack/ToDLPack.h
+//  \brief Header file for the export of dense vectors and matrices as DLPack tensors
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DLPACK_TODLPACK_H_
+#define _BLAZE_MATH_DLPACK_TODLPACK_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dlpack/DataTypeMapping.h>
+#include <blaze/math/dlpack/DLManagedTensor.h>
+#include <blaze/math/dlpack/DLPackContext.h>
+#include <blaze/math/dlpack/DLPackTensor.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsStrided.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a managed DLPack tensor for the given host memory.
+// \ingroup math_dlpack
+//
+// \param data Pointer to the first element of the tensor.
+// \param dtype The data type of the elements.
+// \param ndim The number of dimensions of the tensor.
+// \param shape The extents of the tensor.
+// \param strides The strides of the tensor (in number of elements).
+// \param owner The owner of the memory of the tensor (may be empty).
+// \param padded \a true in case the gap between two rows/columns consists of zero padding elements.
+// \return The managed DLPack tensor.
+*/
+inline DLManagedTensor* createDLPackTensor( void* data, const DLDataType& dtype, size_t ndim,
+                                            const int64_t* shape, const int64_t* strides,
+                                            std::shared_ptr<void> owner, bool padded )
+{
+   BLAZE_INTERNAL_ASSERT( ndim == 1UL || ndim == 2UL, "Invalid number of dimensions detected" );
+
+   std::unique_ptr<DLPackContext> context( new DLPackContext() );
+
+   for( size_t i=0UL; i<ndim; ++i ) {
+      context->shape[i]   = shape[i];
+      context->strides[i] = strides[i];
+   }
+
+   context->owner  = std::move( owner );
+   context->padded = padded;
+
+   DLTensor& dl( context->tensor.dl_tensor );
+   dl.data        = data;
+   dl.device      = DLDevice{ kDLCPU, 0 };
+   dl.ndim        = static_cast<int32_t>( ndim );
+   dl.dtype       = dtype;
+   dl.shape       = context->shape;
+   dl.strides     = context->strides;
+   dl.byte_offset = 0U;
+
+   context->tensor.manager_ctx = context.get();
+   context->tensor.deleter     = &deleteDLPackContext;
+
+   return &context.release()->tensor;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the DLPack strides of a dense vector with contiguous elements.
+// \ingroup math_dlpack
+//
+// \param dv The dense vector.
+// \return The stride of the vector (in number of elements).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline EnableIf_t< !IsStrided_v<VT>, int64_t >
+   dlpackStride( const DenseVector<VT,TF>& dv ) noexcept
+{
+   MAYBE_UNUSED( dv );
+
+   return 1;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the DLPack strides of a strided dense vector.
+// \ingroup math_dlpack
+//
+// \param dv The strided dense vector.
+// \return The stride of the vector (in number of elements).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline EnableIf_t< IsStrided_v<VT>, int64_t >
+   dlpackStride( const DenseVector<VT,TF>& dv ) noexcept
+{
+   return (*dv).stride();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the DLPack strides of a dense matrix with contiguous rows/columns.
+// \ingroup math_dlpack
+//
+// \param dm The dense matrix.
+// \param strides The resulting row and column stride (in number of elements).
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline EnableIf_t< !IsStrided_v<MT> >
+   dlpackStrides( const DenseMatrix<MT,SO>& dm, int64_t* strides ) noexcept
+{
+   strides[0] = ( SO )?( 1 ):( static_cast<int64_t>( (*dm).spacing() ) );
+   strides[1] = ( SO )?( static_cast<int64_t>( (*dm).spacing() ) ):( 1 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the DLPack strides of a strided dense matrix.
+// \ingroup math_dlpack
+//
+// \param dm The strided dense matrix.
+// \param strides The resulting row and column stride (in number of elements).
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline EnableIf_t< IsStrided_v<MT> >
+   dlpackStrides( const DenseMatrix<MT,SO>& dm, int64_t* strides ) noexcept
+{
+   strides[0] = (*dm).rowStride();
+   strides[1] = (*dm).columnStride();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a managed DLPack tensor referring to the elements of the given dense vector.
+// \ingroup math_dlpack
+//
+// \param dv The dense vector to be exported.
+// \param owner The owner of the memory of the vector (may be empty).
+// \return The managed DLPack tensor.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+DLManagedTensor* exportDLPack( const DenseVector<VT,TF>& dv, std::shared_ptr<void> owner )
+{
+   using ET = RemoveCV_t< ElementType_t<VT> >;
+
+   BLAZE_STATIC_ASSERT_MSG( IsContiguous_v<VT> || IsStrided_v<VT>, "Non-contiguous vector type detected" );
+
+   const int64_t shape  [1] = { static_cast<int64_t>( (*dv).size() ) };
+   const int64_t strides[1] = { dlpackStride( *dv ) };
+
+   return createDLPackTensor( const_cast<ET*>( (*dv).data() ), DataTypeMapping<ET>::value(),
+                              1UL, shape, strides, std::move( owner ),
+                              IsPadded_v<VT> && !IsStrided_v<VT> );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a managed DLPack tensor referring to the elements of the given dense matrix.
+// \ingroup math_dlpack
+//
+// \param dm The dense matrix to be exported.
+// \param owner The owner of the memory of the matrix (may be empty).
+// \return The managed DLPack tensor.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+DLManagedTensor* exportDLPack( const DenseMatrix<MT,SO>& dm, std::shared_ptr<void> owner )
+{
+   using ET = RemoveCV_t< ElementType_t<MT> >;
+
+   BLAZE_STATIC_ASSERT_MSG( IsContiguous_v<MT> || IsStrided_v<MT>, "Non-contiguous matrix type detected" );
+
+   const int64_t shape[2] = { static_cast<int64_t>( (*dm).rows() )
+                            , static_cast<int64_t>( (*dm).columns() ) };
+   int64_t strides[2];
+   dlpackStrides( *dm, strides );
+
+   return createDLPackTensor( const_cast<ET*>( (*dm).data() ), DataTypeMapping<ET>::value(),
+                              2UL, shape, strides, std::move( owner ),
+                              IsPadded_v<MT> && !IsStrided_v<MT> );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DLPack export functions */
+//@{
+template< typename VT, bool TF >
+DLManagedTensor* toDLPack( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+DLManagedTensor* toDLPack( const DenseVector<VT,TF>& dv, std::shared_ptr<void> owner );
+
+template< typename VT, bool TF >
+DLManagedTensor* toDLPack( DenseVector<VT,TF>&& dv );
+
+template< typename VT, bool TF >
+DLManagedTensor* toDLPack( const DenseVector<VT,TF>&& dv );
+
+template< typename MT, bool SO >
+DLManagedTensor* toDLPack( const DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+DLManagedTensor* toDLPack( const DenseMatrix<MT,SO>& dm, std::shared_ptr<void> owner );
+
+template< typename MT, bool SO >
+DLManagedTensor* toDLPack( DenseMatrix<MT,SO>&& dm );
+
+template< typename MT, bool SO >
+DLManagedTensor* toDLPack( const DenseMatrix<MT,SO>&& dm );
+
+inline DLManagedTensor* toDLPack( const DLPackTensor& tensor );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Exports the given dense vector as DLPack tensor without transfer of ownership.
+// \ingroup math_dlpack
+//
+// \param dv The dense vector to be exported.
+// \return The managed DLPack tensor referring to the elements of the vector.
+//
+// This function creates a one-dimensional DLPack tensor referring to the elements of the given
+// dense vector. No element is copied. The vector keeps the ownership of its elements, i.e. the
+// vector has to outlive all uses of the tensor. The given vector type must either have
+// contiguous elements (as for instance DynamicVector or CustomVector) or must be a strided
+// vector, otherwise a compilation error is created.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+DLManagedTensor* toDLPack( const DenseVector<VT,TF>& dv )
+{
+   return exportDLPack( *dv, std::shared_ptr<void>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Exports the given dense vector as DLPack tensor with shared ownership.
+// \ingroup math_dlpack
+//
+// \param dv The dense vector to be exported.
+// \param owner The owner of the memory of the vector.
+// \return The managed DLPack tensor referring to the elements of the vector.
+//
+// This function creates a one-dimensional DLPack tensor referring to the elements of the given
+// dense vector. No element is copied. The tensor keeps a reference to the given owner until
+// its deleter is called. This allows to share a custom vector with another framework, which
+// keeps the underlying memory alive as long as it uses the tensor:
+
+   \code
+   std::shared_ptr<double> memory( new double[100], std::default_delete<double[]>() );
+   blaze::CustomVector<double,blaze::unaligned,blaze::unpadded> a( memory.get(), 100UL );
+
+   DLManagedTensor* tensor = blaze::toDLPack( a, memory );
+   \endcode
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+DLManagedTensor* toDLPack( const DenseVector<VT,TF>& dv, std::shared_ptr<void> owner )
+{
+   return exportDLPack( *dv, std::move( owner ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Exports the given temporary dense vector as DLPack tensor with transfer of ownership.
+// \ingroup math_dlpack
+//
+// \param dv The temporary dense vector to be exported.
+// \return The managed DLPack tensor owning the elements of the vector.
+//
+// This function moves the given temporary dense vector into the resulting DLPack tensor, which
+// takes over the ownership of its elements. Resource owning vectors such as DynamicVector are
+// moved without copying the elements, all other vectors and vector expressions are evaluated
+// into their result type.
+
+   \code
+   blaze::DynamicVector<float> a( 1000UL );
+   // ... Initialization
+
+   DLManagedTensor* tensor = blaze::toDLPack( std::move( a ) );
+   \endcode
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+DLManagedTensor* toDLPack( DenseVector<VT,TF>&& dv )
+{
+   using RT = ResultType_t<VT>;
+
+   std::shared_ptr<RT> owner( std::make_shared<RT>( std::move( *dv ) ) );
+   const RT& result( *owner );
+
+   return exportDLPack( result, std::move( owner ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Exports the given constant temporary dense vector as DLPack tensor.
+// \ingroup math_dlpack
+//
+// \param dv The constant temporary dense vector to be exported.
+// \return The managed DLPack tensor owning a copy of the elements of the vector.
+//
+// This function evaluates the given constant temporary dense vector (as for instance returned by
+// the arithmetic operators of Blaze or by the evaluate() function) into its result type and
+// transfers the ownership of the result to the resulting DLPack tensor. In contrast to the
+// export of a vector lvalue, the tensor therefore does not refer to a destroyed temporary.
+
+   \code
+   blaze::DynamicVector<double> a, b;
+   // ... Resizing and initialization
+
+   DLManagedTensor* tensor = blaze::toDLPack( a + b );
+   \endcode
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+DLManagedTensor* toDLPack( const DenseVector<VT,TF>&& dv )
+{
+   using RT = ResultType_t<VT>;
+
+   std::shared_ptr<RT> owner( std::make_shared<RT>( *dv ) );
+   const RT& result( *owner );
+
+   return exportDLPack( result, std::move( owner ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Exports the given dense matrix as DLPack tensor without transfer of ownership.
+// \ingroup math_dlpack
+//
+// \param dm The dense matrix to be exported.
+// \return The managed DLPack tensor referring to the elements of the matrix.
+//
+// This function creates a two-dimensional DLPack tensor referring to the elements of the given
+// dense matrix. The rows of the matrix are mapped to the first, the columns to the second
+// dimension of the tensor, the storage order and the padding of the matrix are represented by
+// the strides of the tensor. No element is copied. The matrix keeps the ownership of its
+// elements, i.e. the matrix has to outlive all uses of the tensor. The given matrix type must
+// either have contiguous rows/columns (as for instance DynamicMatrix or CustomMatrix) or must
+// be a strided matrix, otherwise a compilation error is created.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+DLManagedTensor* toDLPack( const DenseMatrix<MT,SO>& dm )
+{
+   return exportDLPack( *dm, std::shared_ptr<void>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Exports the given dense matrix as DLPack tensor with shared ownership.
+// \ingroup math_dlpack
+//
+// \param dm The dense matrix to be exported.
+// \param owner The owner of the memory of the matrix.
+// \return The managed DLPack tensor referring to the elements of the matrix.
+//
+// This function creates a two-dimensional DLPack tensor referring to the elements of the given
+// dense matrix. No element is copied. The tensor keeps a reference to the given owner until its
+// deleter is called, which keeps the memory of for instance a custom matrix alive as long as
+// another framework uses the tensor.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+DLManagedTensor* toDLPack( const DenseMatrix<MT,SO>& dm, std::shared_ptr<void> owner )
+{
+   return exportDLPack( *dm, std::move( owner ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Exports the given temporary dense matrix as DLPack tensor with transfer of ownership.
+// \ingroup math_dlpack
+//
+// \param dm The temporary dense matrix to be exported.
+// \return The managed DLPack tensor owning the elements of the matrix.
+//
+// This function moves the given temporary dense matrix into the resulting DLPack tensor, which
+// takes over the ownership of its elements. Resource owning matrices such as DynamicMatrix are
+// moved without copying the elements, all other matrices and matrix expressions are evaluated
+// into their result type.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+DLManagedTensor* toDLPack( DenseMatrix<MT,SO>&& dm )
+{
+   using RT = ResultType_t<MT>;
+
+   std::shared_ptr<RT> owner( std::make_shared<RT>( std::move( *dm ) ) );
+   const RT& result( *owner );
+
+   return exportDLPack( result, std::move( owner ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Exports the given constant temporary dense matrix as DLPack tensor.
+// \ingroup math_dlpack
+//
+// \param dm The constant temporary dense matrix to be exported.
+// \return The managed DLPack tensor owning a copy of the elements of the matrix.
+//
+// This function evaluates the given constant temporary dense matrix (as for instance returned by
+// the arithmetic operators of Blaze or by the evaluate() function) into its result type and
+// transfers the ownership of the result to the resulting DLPack tensor. In contrast to the
+// export of a matrix lvalue, the tensor therefore does not refer to a destroyed temporary.
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+
+   DLManagedTensor* tensor = blaze::toDLPack( A * B );
+   \endcode
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+DLManagedTensor* toDLPack( const DenseMatrix<MT,SO>&& dm )
+{
+   using RT = ResultType_t<MT>;
+
+   std::shared_ptr<RT> owner( std::make_shared<RT>( *dm ) );
+   const RT& result( *owner );
+
+   return exportDLPack( result, std::move( owner ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Exports the given imported DLPack tensor with shared ownership.
+// \ingroup math_dlpack
+//
+// \param tensor The imported DLPack tensor.
+// \return The managed DLPack tensor referring to the elements of the imported tensor.
+//
+// This function creates a new managed DLPack tensor referring to the elements of the given
+// imported tensor. The new tensor shares the ownership of the imported tensor, i.e. the deleter
+// of the imported tensor is called as soon as both all handles and all exported tensors have
+// been released.
+*/
+inline DLManagedTensor* toDLPack( const DLPackTensor& tensor )
+{
+   int64_t shape  [2];
+   int64_t strides[2];
+
+   for( size_t i=0UL; i<tensor.dimensions(); ++i ) {
+      shape  [i] = static_cast<int64_t>( tensor.extent( i ) );
+      strides[i] = static_cast<int64_t>( tensor.stride( i ) );
+   }
+
+   return createDLPackTensor( tensor.data(), tensor.dataType(), tensor.dimensions(),
+                              shape, strides, std::make_shared<DLPackTensor>( tensor ),
+                              isZeroPadded( *tensor.get() ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
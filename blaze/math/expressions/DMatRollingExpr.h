@@ -0,0 +1,883 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DMatRollingExpr.h
+//  \brief Header file for the dense matrix rolling-window expression
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DMATROLLINGEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DMATROLLINGEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Rolling.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DMATROLLINGEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for rolling-window operations on dense matrices.
+// \ingroup dense_matrix_expression
+//
+// The DMatRollingExpr class represents the compile time expression for the application of a
+// rolling-window operation to the rows (\a RF = rowwise) or columns (\a RF = columnwise) of a
+// dense matrix. In case of a row-wise operation the element \f$ (i,j) \f$ of the resulting
+// matrix corresponds to the window of size \a w starting at the \a j-th element of the \a i-th
+// row, in case of a column-wise operation it corresponds to the window starting at the \a i-th
+// element of the \a j-th column.
+//
+// In case the windows are aligned with the storage order of the matrix (i.e. row-wise windows
+// of a row-major matrix or column-wise windows of a column-major matrix), the windows of each
+// row/column are computed one after another. Otherwise the windows of all rows/columns are
+// computed simultaneously by means of SIMD vector operations.
+*/
+template< typename MT      // Type of the dense matrix
+        , typename OP      // Type of the rolling-window operation
+        , ReductionFlag RF  // Reduction flag
+        , bool SO >        // Storage order
+class DMatRollingExpr
+   : public Expression< DenseMatrix< DMatRollingExpr<MT,OP,RF,SO>, SO > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using ET = ElementType_t<MT>;    //!< Element type of the dense matrix expression.
+   using CT = CompositeType_t<MT>;  //!< Composite type of the dense matrix expression.
+
+   //! Type of the running state of the rolling-window operation.
+   using ST = typename OP::template State<ET>;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the computation of the windows along the storage order.
+   /*! In case the windows are aligned with the storage order of the matrix, the \a alongStorage
+       compile time constant expression is set to \a true and the windows of each row/column are
+       computed one after another. Otherwise \a alongStorage is set to \a false and the windows
+       of several rows/columns are computed simultaneously. */
+   static constexpr bool alongStorage = ( ( RF == rowwise ) == ( SO == rowMajor ) );
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of this DMatRollingExpr instance.
+   using This = DMatRollingExpr<MT,OP,RF,SO>;
+
+   //! Base type of this DMatRollingExpr instance.
+   using BaseType = Expression< DenseMatrix<This,SO> >;
+
+   using ElementType   = typename OP::template Result<ET>;  //!< Resulting element type.
+   using ResultType    = DynamicMatrix<ElementType,SO>;     //!< Result type for expression template evaluations.
+   using OppositeType  = OppositeType_t<ResultType>;        //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;       //!< Transpose type for expression template evaluations.
+   using ReturnType    = const ElementType;                 //!< Return type for expression template evaluations.
+
+   //! Data type for composite expression templates.
+   using CompositeType = const ResultType;
+
+   //! Composite type of the dense matrix expression.
+   using Operand = If_t< IsExpression_v<MT>, const MT, const MT& >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DMatRollingExpr class.
+   //
+   // \param dm The dense matrix operand of the rolling-window expression.
+   // \param w The size of the window.
+   */
+   inline DMatRollingExpr( const MT& dm, size_t w ) noexcept
+      : dm_( dm )  // Dense matrix of the rolling-window expression
+      , w_ ( w  )  // The size of the window
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 2D-access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   //
+   // Note that the direct access to an element of the rolling-window expression requires the
+   // evaluation of the complete window.
+   */
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+      if( RF == rowwise )
+         return OP::evaluate( subvector( row( dm_, i, unchecked ), j, w_, unchecked ) );
+      else
+         return OP::evaluate( subvector( column( dm_, j, unchecked ), i, w_, unchecked ) );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid matrix access index.
+   */
+   inline ReturnType at( size_t i, size_t j ) const {
+      if( i >= rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+      }
+      if( j >= columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+      }
+      return (*this)(i,j);
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
+   //
+   // \return The number of rows of the matrix.
+   */
+   inline size_t rows() const noexcept {
+      return ( RF == rowwise )?( dm_.rows() ):( dm_.rows() - w_ + 1UL );
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
+   //
+   // \return The number of columns of the matrix.
+   */
+   inline size_t columns() const noexcept {
+      return ( RF == rowwise )?( dm_.columns() - w_ + 1UL ):( dm_.columns() );
+   }
+   //**********************************************************************************************
+
+   //**Window function*****************************************************************************
+   /*!\brief Returns the size of the window.
+   //
+   // \return The size of the window.
+   */
+   inline size_t window() const noexcept {
+      return w_;
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the dense matrix operand.
+   //
+   // \return The dense matrix operand.
+   */
+   inline Operand operand() const noexcept {
+      return dm_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return dm_.canAlias( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return dm_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand dm_;  //!< Dense matrix of the rolling-window expression.
+   size_t  w_;   //!< The size of the window.
+   //**********************************************************************************************
+
+   //**Compute function****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes a subset of the windows.
+   //
+   // \param C The target dense matrix.
+   // \param A The evaluated dense matrix operand.
+   // \param w The size of the window.
+   // \param begin The first row (\a RF = rowwise) or column (\a RF = columnwise) to compute.
+   // \param end The row/column one past the last row/column to compute.
+   // \param first The index of the first window within each row/column.
+   // \param last The index one past the last window within each row/column.
+   // \return void
+   */
+   template< typename MT1    // Type of the target dense matrix
+           , typename MT2 >  // Type of the dense matrix operand
+   static void compute( MT1& C, const MT2& A, size_t w,
+                        size_t begin, size_t end, size_t first, size_t last )
+   {
+      if( alongStorage && RF == rowwise )
+      {
+         for( size_t i=begin; i<end; ++i ) {
+            OP::template apply<ST>( [&A,i]( size_t k ) { return A(i,k); }
+                                  , [&C,i]( size_t k ) -> decltype(auto) { return C(i,k); }
+                                  , first, last, w );
+         }
+      }
+      else if( alongStorage )
+      {
+         for( size_t j=begin; j<end; ++j ) {
+            OP::template apply<ST>( [&A,j]( size_t k ) { return A(k,j); }
+                                  , [&C,j]( size_t k ) -> decltype(auto) { return C(k,j); }
+                                  , first, last, w );
+         }
+      }
+      else if( RF == rowwise )
+      {
+         const size_t n( end - begin );
+
+         const auto in = [&A,begin,n]( size_t k ) {
+            return subvector( column( A, k, unchecked ), begin, n, unchecked );
+         };
+
+         const auto out = [&C,begin,n]( size_t k ) {
+            return subvector( column( C, k, unchecked ), begin, n, unchecked );
+         };
+
+         OP::template apply< DynamicVector<ST,columnVector> >( in, out, first, last, w );
+      }
+      else
+      {
+         const size_t n( end - begin );
+
+         const auto in = [&A,begin,n]( size_t k ) {
+            return subvector( row( A, k, unchecked ), begin, n, unchecked );
+         };
+
+         const auto out = [&C,begin,n]( size_t k ) {
+            return subvector( row( C, k, unchecked ), begin, n, unchecked );
+         };
+
+         OP::template apply< DynamicVector<ST,rowVector> >( in, out, first, last, w );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense matrices****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix rolling-window operation to a dense matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side rolling-window expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix
+   // rolling-window expression to a dense matrix.
+   */
+   template< typename MT2  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline void assign( DenseMatrix<MT2,SO2>& lhs, const DMatRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      CT A( serial( rhs.dm_ ) );  // Evaluation of the dense matrix operand
+
+      if( RF == rowwise )
+         compute( *lhs, A, rhs.w_, 0UL, rhs.rows(), 0UL, rhs.columns() );
+      else
+         compute( *lhs, A, rhs.w_, 0UL, rhs.columns(), 0UL, rhs.rows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse matrices***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix rolling-window operation to a sparse matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side rolling-window expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix
+   // rolling-window expression to a sparse matrix.
+   */
+   template< typename MT2  // Type of the target sparse matrix
+           , bool SO2 >    // Storage order of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT2,SO2>& lhs, const DMatRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to matrices*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense matrix rolling-window operation to a matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side rolling-window expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a dense matrix
+   // rolling-window expression to a matrix.
+   */
+   template< typename MT2  // Type of the target matrix
+           , bool SO2 >    // Storage order of the target matrix
+   friend inline void addAssign( Matrix<MT2,SO2>& lhs, const DMatRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to matrices**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense matrix rolling-window operation to a matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side rolling-window expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a dense
+   // matrix rolling-window expression to a matrix.
+   */
+   template< typename MT2  // Type of the target matrix
+           , bool SO2 >    // Storage order of the target matrix
+   friend inline void subAssign( Matrix<MT2,SO2>& lhs, const DMatRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to matrices********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of a dense matrix rolling-window operation to a matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side rolling-window expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of a dense
+   // matrix rolling-window expression to a matrix.
+   */
+   template< typename MT2  // Type of the target matrix
+           , bool SO2 >    // Storage order of the target matrix
+   friend inline void schurAssign( Matrix<MT2,SO2>& lhs, const DMatRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( serial( rhs ) );
+      schurAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to matrices*******************************************************
+   // No special implementation for the multiplication assignment to matrices.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense matrix rolling-window operation to a dense matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side rolling-window expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense matrix
+   // rolling-window expression to a dense matrix. In case there are sufficiently many rows
+   // (\a RF = rowwise) or columns (\a RF = columnwise), these are distributed among the
+   // available threads. Otherwise the windows within each row/column are distributed, where
+   // each thread additionally reads the \f$ w-1 \f$ elements that its last window shares with
+   // the range of the subsequent thread.
+   */
+   template< typename MT2  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline void smpAssign( DenseMatrix<MT2,SO2>& lhs, const DMatRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const size_t P( ( RF == rowwise )?( rhs.rows() ):( rhs.columns() ) );
+      const size_t Q( ( RF == rowwise )?( rhs.columns() ):( rhs.rows() ) );
+      const size_t threads( min( getNumThreads(), max( P, Q ) ) );
+
+      if( threads == 1UL || !rhs.canSMPAssign() ||
+          isSerialSectionActive() || isParallelSectionActive() ) {
+         assign( *lhs, rhs );
+         return;
+      }
+
+      CT A( rhs.dm_ );  // Evaluation of the dense matrix operand
+
+      BLAZE_PARALLEL_SECTION
+      {
+         if( P >= threads )
+         {
+            constexpr size_t SIMDSIZE( SIMDTrait<ElementType>::size );
+
+            const size_t addon        ( ( ( P % threads ) != 0UL )? 1UL : 0UL );
+            const size_t equalShare   ( P / threads + addon );
+            const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+            const size_t sizePerThread( ( !alongStorage && rest )
+                                        ?( equalShare - rest + SIMDSIZE )
+                                        :( equalShare ) );
+
+            smpFor( threads, [&]( size_t t )
+            {
+               const size_t begin( t*sizePerThread );
+
+               if( begin >= P )
+                  return;
+
+               compute( *lhs, A, rhs.w_, begin, min( begin+sizePerThread, P ), 0UL, Q );
+            } );
+         }
+         else
+         {
+            const size_t addon        ( ( ( Q % threads ) != 0UL )? 1UL : 0UL );
+            const size_t sizePerThread( Q / threads + addon );
+
+            smpFor( threads, [&]( size_t t )
+            {
+               const size_t first( t*sizePerThread );
+
+               if( first >= Q )
+                  return;
+
+               compute( *lhs, A, rhs.w_, 0UL, P, first, min( first+sizePerThread, Q ) );
+            } );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse matrices***********************************************************
+   // No special implementation for the SMP assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP addition assignment to matrices*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense matrix rolling-window operation to a matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side rolling-window expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a dense
+   // matrix rolling-window expression to a matrix.
+   */
+   template< typename MT2  // Type of the target matrix
+           , bool SO2 >    // Storage order of the target matrix
+   friend inline void smpAddAssign( Matrix<MT2,SO2>& lhs, const DMatRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to matrices******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense matrix rolling-window operation to a matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side rolling-window expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a dense
+   // matrix rolling-window expression to a matrix.
+   */
+   template< typename MT2  // Type of the target matrix
+           , bool SO2 >    // Storage order of the target matrix
+   friend inline void smpSubAssign( Matrix<MT2,SO2>& lhs, const DMatRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to matrices****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP Schur product assignment of a dense matrix rolling-window operation to a matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side rolling-window expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized SMP Schur product assignment of a
+   // dense matrix rolling-window expression to a matrix.
+   */
+   template< typename MT2  // Type of the target matrix
+           , bool SO2 >    // Storage order of the target matrix
+   friend inline void smpSchurAssign( Matrix<MT2,SO2>& lhs, const DMatRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( rhs );
+      smpSchurAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to matrices***************************************************
+   // No special implementation for the SMP multiplication assignment to matrices.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( MT, SO );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the rolling-window functions for dense matrices.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \param w The size of the window.
+// \param wmin The minimum admissible window size.
+// \return The rolling-window expression.
+// \exception std::invalid_argument Invalid window size.
+*/
+template< typename OP      // Type of the rolling-window operation
+        , ReductionFlag RF  // Reduction flag
+        , typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order
+inline decltype(auto) rolling_backend( const DenseMatrix<MT,SO>& dm, size_t w, size_t wmin )
+{
+   BLAZE_STATIC_ASSERT_MSG( RF < 2UL, "Invalid reduction flag" );
+
+   const size_t n( ( RF == rowwise )?( (*dm).columns() ):( (*dm).rows() ) );
+
+   if( w < wmin || w > n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid window size" );
+   }
+
+   using ReturnType = const DMatRollingExpr<MT,OP,RF,SO>;
+   return ReturnType( *dm, w );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the rolling-window sums of the rows or columns of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \param w The size of the window.
+// \return The sums of all windows of size \a w.
+// \exception std::invalid_argument Invalid window size.
+//
+// This function computes the sums of all windows of size \a w of either the rows (\a RF =
+// rowwise) or the columns (\a RF = columnwise) of the given \f$ M \times N \f$ dense matrix
+// \a dm. In case of a row-wise operation the resulting matrix is of size \f$ M \times (N-w+1)
+// \f$, in case of a column-wise operation it is of size \f$ (M-w+1) \times N \f$. Example:
+
+   \code
+   using blaze::rowwise;
+   using blaze::columnwise;
+
+   blaze::DynamicMatrix<int> A{ { 1, 2, 3, 4 }, { 5, 6, 7, 8 } }, B, C;
+
+   B = rollingSum<rowwise>( A, 2UL );     // Results in ( ( 3, 5, 7 ), ( 11, 13, 15 ) )
+   C = rollingSum<columnwise>( A, 2UL );  // Results in ( ( 6, 8, 10, 12 ) )
+   \endcode
+
+// Independent of the window size, each window is computed in constant time. In case the window
+// size is 0 or larger than the size of the rows/columns, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order
+inline decltype(auto) rollingSum( const DenseMatrix<MT,SO>& dm, size_t w )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rolling_backend<RollingSum,RF>( *dm, w, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the rolling-window means of the rows or columns of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \param w The size of the window.
+// \return The arithmetic means of all windows of size \a w.
+// \exception std::invalid_argument Invalid window size.
+//
+// This function computes the arithmetic means of all windows of size \a w of either the rows
+// (\a RF = rowwise) or the columns (\a RF = columnwise) of the given dense matrix \a dm. In
+// case the window size is 0 or larger than the size of the rows/columns, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order
+inline decltype(auto) rollingMean( const DenseMatrix<MT,SO>& dm, size_t w )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rolling_backend<RollingMean,RF>( *dm, w, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the rolling-window minima of the rows or columns of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \param w The size of the window.
+// \return The minima of all windows of size \a w.
+// \exception std::invalid_argument Invalid window size.
+//
+// This function computes the minima of all windows of size \a w of either the rows (\a RF =
+// rowwise) or the columns (\a RF = columnwise) of the given dense matrix \a dm. In case the
+// window size is 0 or larger than the size of the rows/columns, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order
+inline decltype(auto) rollingMin( const DenseMatrix<MT,SO>& dm, size_t w )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rolling_backend<RollingMin,RF>( *dm, w, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the rolling-window maxima of the rows or columns of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \param w The size of the window.
+// \return The maxima of all windows of size \a w.
+// \exception std::invalid_argument Invalid window size.
+//
+// This function computes the maxima of all windows of size \a w of either the rows (\a RF =
+// rowwise) or the columns (\a RF = columnwise) of the given dense matrix \a dm. In case the
+// window size is 0 or larger than the size of the rows/columns, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order
+inline decltype(auto) rollingMax( const DenseMatrix<MT,SO>& dm, size_t w )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rolling_backend<RollingMax,RF>( *dm, w, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the rolling-window variances of the rows or columns of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \param w The size of the window.
+// \return The sample variances of all windows of size \a w.
+// \exception std::invalid_argument Invalid window size.
+//
+// This function computes the sample variances of all windows of size \a w of either the rows
+// (\a RF = rowwise) or the columns (\a RF = columnwise) of the given dense matrix \a dm. In
+// case the window size is smaller than 2 or larger than the size of the rows/columns, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order
+inline decltype(auto) rollingVar( const DenseMatrix<MT,SO>& dm, size_t w )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rolling_backend<RollingVar,RF>( *dm, w, 2UL );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
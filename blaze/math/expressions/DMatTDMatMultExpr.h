@@ -91,6 +91,7 @@
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsStrided.h>
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
@@ -156,12 +157,14 @@ class DMatTDMatMultExpr
 
    //**********************************************************************************************
    //! Compilation switch for the composite type of the left-hand side dense matrix expression.
-   static constexpr bool evaluateLeft = ( IsComputation_v<MT1> || RequiresEvaluation_v<MT1> );
+   static constexpr bool evaluateLeft =
+      ( IsComputation_v<MT1> || RequiresEvaluation_v<MT1> || IsStrided_v<MT1> );
    //**********************************************************************************************
 
    //**********************************************************************************************
    //! Compilation switch for the composite type of the right-hand side dense matrix expression.
-   static constexpr bool evaluateRight = ( IsComputation_v<MT2> || RequiresEvaluation_v<MT2> );
+   static constexpr bool evaluateRight =
+      ( IsComputation_v<MT2> || RequiresEvaluation_v<MT2> || IsStrided_v<MT2> );
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -6669,12 +6672,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
 
    //**********************************************************************************************
    //! Compilation switch for the composite type of the left-hand side dense matrix expression.
-   static constexpr bool evaluateLeft = ( IsComputation_v<MT1> || RequiresEvaluation_v<MT1> );
+   static constexpr bool evaluateLeft =
+      ( IsComputation_v<MT1> || RequiresEvaluation_v<MT1> || IsStrided_v<MT1> );
    //**********************************************************************************************
 
    //**********************************************************************************************
    //! Compilation switch for the composite type of the right-hand side dense matrix expression.
-   static constexpr bool evaluateRight = ( IsComputation_v<MT2> || RequiresEvaluation_v<MT2> );
+   static constexpr bool evaluateRight =
+      ( IsComputation_v<MT2> || RequiresEvaluation_v<MT2> || IsStrided_v<MT2> );
    //**********************************************************************************************
 
    //**********************************************************************************************
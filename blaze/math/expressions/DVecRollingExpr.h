@@ -0,0 +1,808 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DVecRollingExpr.h
+//  \brief Header file for the dense vector rolling-window expression
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DVECROLLINGEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DVECROLLINGEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Rolling.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DVECROLLINGEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for rolling-window operations on dense vectors.
+// \ingroup dense_vector_expression
+//
+// The DVecRollingExpr class represents the compile time expression for the application of a
+// rolling-window operation (as for instance a rolling sum, mean, minimum, maximum or variance)
+// to a dense vector. The \a i-th element of the resulting vector corresponds to the window of
+// size \a w starting at the \a i-th element of the given dense vector.
+*/
+template< typename VT  // Type of the dense vector
+        , typename OP  // Type of the rolling-window operation
+        , bool TF >    // Transpose flag
+class DVecRollingExpr
+   : public Expression< DenseVector< DVecRollingExpr<VT,OP,TF>, TF > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using ET = ElementType_t<VT>;    //!< Element type of the dense vector expression.
+   using CT = CompositeType_t<VT>;  //!< Composite type of the dense vector expression.
+
+   //! Type of the running state of the rolling-window operation.
+   using ST = typename OP::template State<ET>;
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of this DVecRollingExpr instance.
+   using This = DVecRollingExpr<VT,OP,TF>;
+
+   //! Base type of this DVecRollingExpr instance.
+   using BaseType = Expression< DenseVector<This,TF> >;
+
+   using ElementType   = typename OP::template Result<ET>;  //!< Resulting element type.
+   using ResultType    = DynamicVector<ElementType,TF>;     //!< Result type for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;       //!< Transpose type for expression template evaluations.
+   using ReturnType    = const ElementType;                 //!< Return type for expression template evaluations.
+
+   //! Data type for composite expression templates.
+   using CompositeType = const ResultType;
+
+   //! Composite type of the dense vector expression.
+   using Operand = If_t< IsExpression_v<VT>, const VT, const VT& >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DVecRollingExpr class.
+   //
+   // \param dv The dense vector operand of the rolling-window expression.
+   // \param w The size of the window.
+   */
+   inline DVecRollingExpr( const VT& dv, size_t w ) noexcept
+      : dv_( dv )  // Dense vector of the rolling-window expression
+      , w_ ( w  )  // The size of the window
+   {}
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   //
+   // Note that the direct access to an element of the rolling-window expression requires the
+   // evaluation of the complete window.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < size(), "Invalid vector access index" );
+      return OP::evaluate( subvector( dv_, index, w_, unchecked ) );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid vector access index.
+   */
+   inline ReturnType at( size_t index ) const {
+      if( index >= size() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+      }
+      return (*this)[index];
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const noexcept {
+      return dv_.size() - w_ + 1UL;
+   }
+   //**********************************************************************************************
+
+   //**Window function*****************************************************************************
+   /*!\brief Returns the size of the window.
+   //
+   // \return The size of the window.
+   */
+   inline size_t window() const noexcept {
+      return w_;
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the dense vector operand.
+   //
+   // \return The dense vector operand.
+   */
+   inline Operand operand() const noexcept {
+      return dv_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return dv_.canAlias( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return dv_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return ( size() > SMP_DVECASSIGN_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand dv_;  //!< Dense vector of the rolling-window expression.
+   size_t  w_;   //!< The size of the window.
+   //**********************************************************************************************
+
+   //**Compute function****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes the windows in the range \f$[first..last)\f$.
+   //
+   // \param y The target dense vector.
+   // \param x The evaluated dense vector operand.
+   // \param w The size of the window.
+   // \param first The index of the first window.
+   // \param last The index one past the last window.
+   // \return void
+   */
+   template< typename VT1    // Type of the target dense vector
+           , typename VT2 >  // Type of the dense vector operand
+   static void compute( VT1& y, const VT2& x, size_t w, size_t first, size_t last )
+   {
+      OP::template apply<ST>( [&x]( size_t k ) { return x[k]; }
+                            , [&y]( size_t k ) -> decltype(auto) { return y[k]; }
+                            , first, last, w );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense vector rolling-window operation to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side rolling-window expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense vector
+   // rolling-window expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void assign( DenseVector<VT1,TF>& lhs, const DVecRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      CT x( serial( rhs.dv_ ) );  // Evaluation of the dense vector operand
+      compute( *lhs, x, rhs.w_, 0UL, rhs.size() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense vector rolling-window operation to a sparse vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side rolling-window expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense vector
+   // rolling-window expression to a sparse vector.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline void assign( SparseVector<VT1,TF>& lhs, const DVecRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, TF );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to vectors**************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense vector rolling-window operation to a vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side vector.
+   // \param rhs The right-hand side rolling-window expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a dense vector
+   // rolling-window expression to a vector.
+   */
+   template< typename VT1 >  // Type of the target vector
+   friend inline void addAssign( Vector<VT1,TF>& lhs, const DVecRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, TF );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to vectors***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense vector rolling-window operation to a vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side vector.
+   // \param rhs The right-hand side rolling-window expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a dense vector
+   // rolling-window expression to a vector.
+   */
+   template< typename VT1 >  // Type of the target vector
+   friend inline void subAssign( Vector<VT1,TF>& lhs, const DVecRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, TF );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a dense vector rolling-window operation to a vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side vector.
+   // \param rhs The right-hand side rolling-window expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a dense
+   // vector rolling-window expression to a vector.
+   */
+   template< typename VT1 >  // Type of the target vector
+   friend inline void multAssign( Vector<VT1,TF>& lhs, const DVecRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, TF );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Division assignment to vectors**************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Division assignment of a dense vector rolling-window operation to a vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side vector.
+   // \param rhs The right-hand side rolling-window expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized division assignment of a dense vector
+   // rolling-window expression to a vector.
+   */
+   template< typename VT1 >  // Type of the target vector
+   friend inline void divAssign( Vector<VT1,TF>& lhs, const DVecRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, TF );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      divAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense vector rolling-window operation to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side rolling-window expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense vector
+   // rolling-window expression to a dense vector. The windows are distributed among the
+   // available threads, where each thread additionally reads the \f$ w-1 \f$ elements that
+   // its last window shares with the range of the subsequent thread.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void smpAssign( DenseVector<VT1,TF>& lhs, const DVecRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const size_t N( rhs.size() );
+      const size_t threads( min( getNumThreads(), N ) );
+
+      if( threads == 1UL || !rhs.canSMPAssign() ||
+          isSerialSectionActive() || isParallelSectionActive() ) {
+         assign( *lhs, rhs );
+         return;
+      }
+
+      CT x( rhs.dv_ );  // Evaluation of the dense vector operand
+
+      BLAZE_PARALLEL_SECTION
+      {
+         const size_t addon        ( ( ( N % threads ) != 0UL )? 1UL : 0UL );
+         const size_t sizePerThread( N / threads + addon );
+
+         smpFor( threads, [&]( size_t t )
+         {
+            const size_t first( t*sizePerThread );
+
+            if( first >= N )
+               return;
+
+            compute( *lhs, x, rhs.w_, first, min( first+sizePerThread, N ) );
+         } );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse vectors************************************************************
+   // No special implementation for the SMP assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP addition assignment to vectors**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense vector rolling-window operation to a vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side vector.
+   // \param rhs The right-hand side rolling-window expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a dense
+   // vector rolling-window expression to a vector.
+   */
+   template< typename VT1 >  // Type of the target vector
+   friend inline void smpAddAssign( Vector<VT1,TF>& lhs, const DVecRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to vectors*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense vector rolling-window operation to a vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side vector.
+   // \param rhs The right-hand side rolling-window expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a dense
+   // vector rolling-window expression to a vector.
+   */
+   template< typename VT1 >  // Type of the target vector
+   friend inline void smpSubAssign( Vector<VT1,TF>& lhs, const DVecRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP multiplication assignment of a dense vector rolling-window operation to a vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side vector.
+   // \param rhs The right-hand side rolling-window expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized SMP multiplication assignment of a
+   // dense vector rolling-window expression to a vector.
+   */
+   template< typename VT1 >  // Type of the target vector
+   friend inline void smpMultAssign( Vector<VT1,TF>& lhs, const DVecRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpMultAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP division assignment to vectors**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP division assignment of a dense vector rolling-window operation to a vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side vector.
+   // \param rhs The right-hand side rolling-window expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized SMP division assignment of a dense
+   // vector rolling-window expression to a vector.
+   */
+   template< typename VT1 >  // Type of the target vector
+   friend inline void smpDivAssign( Vector<VT1,TF>& lhs, const DVecRollingExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpDivAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( VT, TF );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the rolling-window functions for dense vectors.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param w The size of the window.
+// \param wmin The minimum admissible window size.
+// \return The rolling-window expression.
+// \exception std::invalid_argument Invalid window size.
+*/
+template< typename OP  // Type of the rolling-window operation
+        , typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) rolling_backend( const DenseVector<VT,TF>& dv, size_t w, size_t wmin )
+{
+   if( w < wmin || w > (*dv).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid window size" );
+   }
+
+   using ReturnType = const DVecRollingExpr<VT,OP,TF>;
+   return ReturnType( *dv, w );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the rolling-window sums of the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param w The size of the window \f$[1..N]\f$.
+// \return The sums of all windows of size \a w.
+// \exception std::invalid_argument Invalid window size.
+//
+// This function computes the sums of all windows of size \a w of the given dense vector \a dv.
+// The resulting vector has \f$ N-w+1 \f$ elements, where the \a i-th element corresponds to
+// the window starting at the \a i-th element of \a dv. Example:
+
+   \code
+   blaze::DynamicVector<int> a{ 1, 4, 3, 6, 7 }, b;
+
+   b = rollingSum( a, 3UL );  // Results in ( 8, 13, 16 )
+   \endcode
+
+// Independent of the window size, each window is computed in constant time. In case the window
+// size is 0 or larger than the size of \a dv, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) rollingSum( const DenseVector<VT,TF>& dv, size_t w )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rolling_backend<RollingSum>( *dv, w, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the rolling-window means of the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param w The size of the window \f$[1..N]\f$.
+// \return The arithmetic means of all windows of size \a w.
+// \exception std::invalid_argument Invalid window size.
+//
+// This function computes the arithmetic means of all windows of size \a w of the given dense
+// vector \a dv. Example:
+
+   \code
+   blaze::DynamicVector<int> a{ 1, 4, 3, 6, 7 };
+   blaze::DynamicVector<double> b;
+
+   b = rollingMean( a, 2UL );  // Results in ( 2.5, 3.5, 4.5, 6.5 )
+   \endcode
+
+// In case the window size is 0 or larger than the size of \a dv, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) rollingMean( const DenseVector<VT,TF>& dv, size_t w )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rolling_backend<RollingMean>( *dv, w, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the rolling-window minima of the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param w The size of the window \f$[1..N]\f$.
+// \return The minima of all windows of size \a w.
+// \exception std::invalid_argument Invalid window size.
+//
+// This function computes the minima of all windows of size \a w of the given dense vector
+// \a dv. Example:
+
+   \code
+   blaze::DynamicVector<int> a{ 1, 4, 3, 6, 7 }, b;
+
+   b = rollingMin( a, 2UL );  // Results in ( 1, 3, 3, 6 )
+   \endcode
+
+// In case the window size is 0 or larger than the size of \a dv, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) rollingMin( const DenseVector<VT,TF>& dv, size_t w )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rolling_backend<RollingMin>( *dv, w, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the rolling-window maxima of the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param w The size of the window \f$[1..N]\f$.
+// \return The maxima of all windows of size \a w.
+// \exception std::invalid_argument Invalid window size.
+//
+// This function computes the maxima of all windows of size \a w of the given dense vector
+// \a dv. Example:
+
+   \code
+   blaze::DynamicVector<int> a{ 1, 4, 3, 6, 7 }, b;
+
+   b = rollingMax( a, 2UL );  // Results in ( 4, 4, 6, 7 )
+   \endcode
+
+// In case the window size is 0 or larger than the size of \a dv, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) rollingMax( const DenseVector<VT,TF>& dv, size_t w )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rolling_backend<RollingMax>( *dv, w, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the rolling-window variances of the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param w The size of the window \f$[2..N]\f$.
+// \return The sample variances of all windows of size \a w.
+// \exception std::invalid_argument Invalid window size.
+//
+// This function computes the sample variances of all windows of size \a w of the given dense
+// vector \a dv (see the var() function). Example:
+
+   \code
+   blaze::DynamicVector<int> a{ 1, 4, 3, 6, 7 };
+   blaze::DynamicVector<double> b;
+
+   b = rollingVar( a, 3UL );  // Results in ( 2.3333, 2.3333, 4.3333 )
+   \endcode
+
+// In case the window size is smaller than 2 or larger than the size of \a dv, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) rollingVar( const DenseVector<VT,TF>& dv, size_t w )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return rolling_backend<RollingVar>( *dv, w, 2UL );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -99,6 +99,7 @@ template< typename, bool > class DMatNoAliasExpr;
 template< typename, bool > class DMatNoSIMDExpr;
 template< typename, typename, ReductionFlag > class DMatReduceExpr;
 template< typename, bool, size_t... > class DMatRepeatExpr;
+template< typename, typename, ReductionFlag, bool > class DMatRollingExpr;
 template< typename, typename, bool > class DMatScalarDivExpr;
 template< typename, typename, bool > class DMatScalarMultExpr;
 template< typename, bool > class DMatSerialExpr;
@@ -136,6 +137,7 @@ template< typename, typename, bool > class DVecMapExpr;
 template< typename, bool > class DVecNoAliasExpr;
 template< typename, bool > class DVecNoSIMDExpr;
 template< typename, bool, size_t... > class DVecRepeatExpr;
+template< typename, typename, bool > class DVecRollingExpr;
 template< typename, typename, bool > class DVecScalarDivExpr;
 template< typename, typename, bool > class DVecScalarMultExpr;
 template< typename, bool > class DVecSerialExpr;
@@ -972,6 +974,13 @@ decltype(auto) decldiag( const DenseMatrix<MT,SO>& );
 template< typename MT, bool SO >
 decltype(auto) decldiag( const SparseMatrix<MT,SO>& );
 
+
+template< typename VT1, typename VT2, bool TF >
+bool aliasedAssign( DenseVector<VT1,TF>&, const Vector<VT2,TF>& );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+bool aliasedAssign( DenseMatrix<MT1,SO1>&, const Matrix<MT2,SO2>& );
+
 } // namespace blaze
 
 #endif
@@ -65,6 +65,8 @@
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/SpMM.h>
 #include <blaze/math/traits/DeclDiagTrait.h>
 #include <blaze/math/traits/DeclHermTrait.h>
 #include <blaze/math/traits/DeclLowTrait.h>
@@ -83,6 +85,7 @@
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsTriangular.h>
@@ -168,6 +171,22 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the load-balanced parallel
+       evaluation strategy. In case neither matrix operand requires an intermediate evaluation,
+       no symmetry or triangular structure can be exploited, both operands and the target matrix
+       are SMP-assignable, and the element type of the target matrix is not resizable, the
+       variable will be set to 1, otherwise it will be 0. */
+   template< typename T1 >
+   static constexpr bool UseSMPMergePathAssign_v =
+      ( !evaluateLeft && !evaluateRight && MT1::smpAssignable && MT2::smpAssignable &&
+        !SYM && !HERM && !LOW && !UPP &&
+        IsSMPAssignable_v<T1> && !IsResizable_v< ElementType_t<T1> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -1677,6 +1696,44 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP merge-path assignment to dense matrices*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP merge-path assignment of a sparse matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a sparse matrix-dense
+   // matrix multiplication expression to a dense matrix by means of the load-balanced parallel
+   // kernel (see the smpMergePathMultAssign() function). Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case neither operand
+   // requires an intermediate evaluation.
+   */
+   template< typename MT >  // Type of the target dense matrix
+   friend inline auto smpAssign( DenseMatrix<MT,false>& lhs, const SMatDMatMultExpr& rhs )
+      -> EnableIf_t< UseSMPMergePathAssign_v<MT> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         assign( *lhs, rhs );
+         return;
+      }
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      smpMergePathMultAssign( *lhs, A, B, []( auto& a, const auto& b ){ assign( a, b ); } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-dense matrix multiplication to a sparse matrix
@@ -1760,6 +1817,44 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP merge-path addition assignment to dense matrices****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP merge-path addition assignment of a sparse matrix-dense matrix multiplication to a
+   //        dense matrix (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a sparse
+   // matrix-dense matrix multiplication expression to a dense matrix by means of the load-balanced
+   // parallel kernel (see the smpMergePathMultAssign() function). Due to the explicit application
+   // of the SFINAE principle, this function can only be selected by the compiler in case neither
+   // operand requires an intermediate evaluation.
+   */
+   template< typename MT >  // Type of the target dense matrix
+   friend inline auto smpAddAssign( DenseMatrix<MT,false>& lhs, const SMatDMatMultExpr& rhs )
+      -> EnableIf_t< UseSMPMergePathAssign_v<MT> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         addAssign( *lhs, rhs );
+         return;
+      }
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      smpMergePathMultAssign( *lhs, A, B, []( auto& a, const auto& b ){ addAssign( a, b ); } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse matrices**************************************************
    // No special implementation for the SMP addition assignment to sparse matrices.
    //**********************************************************************************************
@@ -1805,6 +1900,44 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP merge-path subtraction assignment to dense matrices*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP merge-path subtraction assignment of a sparse matrix-dense matrix multiplication
+   //        to a dense matrix (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a sparse
+   // matrix-dense matrix multiplication expression to a dense matrix by means of the load-balanced
+   // parallel kernel (see the smpMergePathMultAssign() function). Due to the explicit application
+   // of the SFINAE principle, this function can only be selected by the compiler in case neither
+   // operand requires an intermediate evaluation.
+   */
+   template< typename MT >  // Type of the target dense matrix
+   friend inline auto smpSubAssign( DenseMatrix<MT,false>& lhs, const SMatDMatMultExpr& rhs )
+      -> EnableIf_t< UseSMPMergePathAssign_v<MT> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         subAssign( *lhs, rhs );
+         return;
+      }
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      smpMergePathMultAssign( *lhs, A, B, []( auto& a, const auto& b ){ subAssign( a, b ); } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse matrices***********************************************
    // No special implementation for the SMP subtraction assignment to sparse matrices.
    //**********************************************************************************************
@@ -56,11 +56,15 @@
 #include <blaze/math/expressions/MatVecMultExpr.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/SpMV.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsIdentity.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsZero.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
@@ -143,6 +147,20 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the load-balanced parallel
+       evaluation strategy. In case neither operand requires an intermediate evaluation, both
+       operands and the target vector are SMP-assignable, and the element type of the target
+       vector is not resizable, the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1 >
+   static constexpr bool UseSMPMergePathAssign_v =
+      ( !useAssign && MT::smpAssignable && VT::smpAssignable &&
+        IsSMPAssignable_v<T1> && !IsResizable_v< ElementType_t<T1> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    //! Type of this SMatDVecMultExpr instance.
@@ -585,6 +603,43 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP merge-path assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP merge-path assignment of a sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a sparse matrix-dense
+   // vector multiplication expression to a dense vector by means of the load-balanced parallel
+   // kernel (see the smpMergePathMultAssign() function). Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case neither operand
+   // requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+      -> EnableIf_t< UseSMPMergePathAssign_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         assign( *lhs, rhs );
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      smpMergePathMultAssign( *lhs, A, x, []( auto& a, const auto& b ){ assign( a, b ); } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse vectors************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-dense vector multiplication to a sparse vector
@@ -658,6 +713,43 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP merge-path addition assignment to dense vectors*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP merge-path addition assignment of a sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a sparse
+   // matrix-dense vector multiplication expression to a dense vector by means of the load-balanced
+   // parallel kernel (see the smpMergePathMultAssign() function). Due to the explicit application
+   // of the SFINAE principle, this function can only be selected by the compiler in case neither
+   // operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpAddAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+      -> EnableIf_t< UseSMPMergePathAssign_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         addAssign( *lhs, rhs );
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      smpMergePathMultAssign( *lhs, A, x, []( auto& a, const auto& b ){ addAssign( a, b ); } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse vectors***************************************************
    // No special implementation for the SMP addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -702,6 +794,43 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP merge-path subtraction assignment to dense vectors**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP merge-path subtraction assignment of a sparse matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a sparse
+   // matrix-dense vector multiplication expression to a dense vector by means of the load-balanced
+   // parallel kernel (see the smpMergePathMultAssign() function). Due to the explicit application
+   // of the SFINAE principle, this function can only be selected by the compiler in case neither
+   // operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpSubAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+      -> EnableIf_t< UseSMPMergePathAssign_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         subAssign( *lhs, rhs );
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      smpMergePathMultAssign( *lhs, A, x, []( auto& a, const auto& b ){ subAssign( a, b ); } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse vectors************************************************
    // No special implementation for the SMP subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -92,6 +92,7 @@
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyTriangular.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsStrided.h>
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
@@ -158,12 +159,14 @@ class TDMatDMatMultExpr
 
    //**********************************************************************************************
    //! Compilation switch for the composite type of the left-hand side dense matrix expression.
-   static constexpr bool evaluateLeft = ( IsComputation_v<MT1> || RequiresEvaluation_v<MT1> );
+   static constexpr bool evaluateLeft =
+      ( IsComputation_v<MT1> || RequiresEvaluation_v<MT1> || IsStrided_v<MT1> );
    //**********************************************************************************************
 
    //**********************************************************************************************
    //! Compilation switch for the composite type of the right-hand side dense matrix expression.
-   static constexpr bool evaluateRight = ( IsComputation_v<MT2> || RequiresEvaluation_v<MT2> );
+   static constexpr bool evaluateRight =
+      ( IsComputation_v<MT2> || RequiresEvaluation_v<MT2> || IsStrided_v<MT2> );
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -7300,12 +7303,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
 
    //**********************************************************************************************
    //! Compilation switch for the composite type of the left-hand side dense matrix expression.
-   static constexpr bool evaluateLeft = ( IsComputation_v<MT1> || RequiresEvaluation_v<MT1> );
+   static constexpr bool evaluateLeft =
+      ( IsComputation_v<MT1> || RequiresEvaluation_v<MT1> || IsStrided_v<MT1> );
    //**********************************************************************************************
 
    //**********************************************************************************************
    //! Compilation switch for the composite type of the right-hand side dense matrix expression.
-   static constexpr bool evaluateRight = ( IsComputation_v<MT2> || RequiresEvaluation_v<MT2> );
+   static constexpr bool evaluateRight =
+      ( IsComputation_v<MT2> || RequiresEvaluation_v<MT2> || IsStrided_v<MT2> );
    //**********************************************************************************************
 
    //**********************************************************************************************
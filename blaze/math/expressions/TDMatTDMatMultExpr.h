@@ -51,6 +51,7 @@
 #include <blaze/math/constraints/Scalar.h>
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dense/FixedSizeMMM.h>
 #include <blaze/math/dense/MMM.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
@@ -58,12 +59,15 @@
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/MatScalarMultExpr.h>
+#include <blaze/math/functors/AddAssign.h>
+#include <blaze/math/functors/Assign.h>
 #include <blaze/math/functors/DeclDiag.h>
 #include <blaze/math/functors/DeclHerm.h>
 #include <blaze/math/functors/DeclLow.h>
 #include <blaze/math/functors/DeclSym.h>
 #include <blaze/math/functors/DeclUpp.h>
 #include <blaze/math/functors/Noop.h>
+#include <blaze/math/functors/SubAssign.h>
 #include <blaze/math/shims/Conjugate.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/shims/Reset.h>
@@ -94,6 +98,7 @@
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyTriangular.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsStrided.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUpper.h>
@@ -162,12 +167,14 @@ class TDMatTDMatMultExpr
 
    //**********************************************************************************************
    //! Compilation switch for the composite type of the left-hand side dense matrix expression.
-   static constexpr bool evaluateLeft = ( IsComputation_v<MT1> || RequiresEvaluation_v<MT1> );
+   static constexpr bool evaluateLeft =
+      ( IsComputation_v<MT1> || RequiresEvaluation_v<MT1> || IsStrided_v<MT1> );
    //**********************************************************************************************
 
    //**********************************************************************************************
    //! Compilation switch for the composite type of the right-hand side dense matrix expression.
-   static constexpr bool evaluateRight = ( IsComputation_v<MT2> || RequiresEvaluation_v<MT2> );
+   static constexpr bool evaluateRight =
+      ( IsComputation_v<MT2> || RequiresEvaluation_v<MT2> || IsStrided_v<MT2> );
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -558,6 +565,9 @@ class TDMatTDMatMultExpr
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      if( !SYM && !HERM && !LOW && !UPP && fixedmmm<Assign>( C, A, B ) )
+         return;
+
       if( ( IsDiagonal_v<MT4> ) ||
           ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
           ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
@@ -2177,6 +2187,9 @@ class TDMatTDMatMultExpr
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      if( !SYM && !HERM && !LOW && !UPP && fixedmmm<AddAssign>( C, A, B ) )
+         return;
+
       if( ( IsDiagonal_v<MT4> ) ||
           ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
           ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
@@ -3316,6 +3329,9 @@ class TDMatTDMatMultExpr
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      if( !SYM && !HERM && !LOW && !UPP && fixedmmm<SubAssign>( C, A, B ) )
+         return;
+
       if( ( IsDiagonal_v<MT4> ) ||
           ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
           ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
@@ -4839,12 +4855,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
 
    //**********************************************************************************************
    //! Compilation switch for the composite type of the left-hand side dense matrix expression.
-   static constexpr bool evaluateLeft = ( IsComputation_v<MT1> || RequiresEvaluation_v<MT1> );
+   static constexpr bool evaluateLeft =
+      ( IsComputation_v<MT1> || RequiresEvaluation_v<MT1> || IsStrided_v<MT1> );
    //**********************************************************************************************
 
    //**********************************************************************************************
    //! Compilation switch for the composite type of the right-hand side dense matrix expression.
-   static constexpr bool evaluateRight = ( IsComputation_v<MT2> || RequiresEvaluation_v<MT2> );
+   static constexpr bool evaluateRight =
+      ( IsComputation_v<MT2> || RequiresEvaluation_v<MT2> || IsStrided_v<MT2> );
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -58,6 +58,8 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/SpMV.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -66,6 +68,7 @@
 #include <blaze/math/typetraits/IsIdentity.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
@@ -133,6 +136,20 @@ class TDVecSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the parallel scatter strategy. In
+       case neither operand requires an intermediate evaluation, both operands and the target
+       vector are SMP-assignable, and the element type of the target vector is not resizable,
+       the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1 >
+   static constexpr bool UseSMPScatterAssign_v =
+      ( !evaluateMatrix && !evaluateVector && MT::smpAssignable && VT::smpAssignable &&
+        IsSMPAssignable_v<T1> && !IsResizable_v< ElementType_t<T1> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    //! Type of this TDVecSMatMultExpr instance.
@@ -651,6 +668,43 @@ class TDVecSMatMultExpr
    }
    //**********************************************************************************************
 
+   //**SMP scatter assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP scatter assignment of a transpose dense vector-sparse matrix multiplication to a
+   //        dense vector (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a transpose dense
+   // vector-sparse matrix multiplication expression to a dense vector by means of the parallel
+   // scatter kernel (see the smpScatterMultAssign() function). Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case neither
+   // operand requires an intermediate evaluation.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline auto smpAssign( DenseVector<VT2,true>& lhs, const TDVecSMatMultExpr& rhs )
+      -> EnableIf_t< UseSMPScatterAssign_v<VT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         assign( *lhs, rhs );
+         return;
+      }
+
+      LT x( rhs.vec_ );  // Evaluation of the left-hand side dense vector operand
+      RT A( rhs.mat_ );  // Evaluation of the right-hand side sparse matrix operand
+
+      smpScatterMultAssign( *lhs, A, x, []( auto& a, const auto& b ){ assign( a, b ); } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse vectors************************************************************
    /*!\brief SMP assignment of a transpose dense vector-sparse matrix multiplication to a sparse
    //        vector (\f$ \vec{y}^T=\vec{x}^T*A \f$).
@@ -720,6 +774,43 @@ class TDVecSMatMultExpr
    }
    //**********************************************************************************************
 
+   //**SMP scatter addition assignment to dense vectors********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP scatter addition assignment of a transpose dense vector-sparse matrix
+   //        multiplication to a dense vector (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a transpose
+   // dense vector-sparse matrix multiplication expression to a dense vector by means of the
+   // parallel scatter kernel (see the smpScatterMultAssign() function). Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler in
+   // case neither operand requires an intermediate evaluation.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline auto smpAddAssign( DenseVector<VT2,true>& lhs, const TDVecSMatMultExpr& rhs )
+      -> EnableIf_t< UseSMPScatterAssign_v<VT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         addAssign( *lhs, rhs );
+         return;
+      }
+
+      LT x( rhs.vec_ );  // Evaluation of the left-hand side dense vector operand
+      RT A( rhs.mat_ );  // Evaluation of the right-hand side sparse matrix operand
+
+      smpScatterMultAssign( *lhs, A, x, []( auto& a, const auto& b ){ addAssign( a, b ); } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse vectors***************************************************
    // No special implementation for the SMP addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -762,6 +853,43 @@ class TDVecSMatMultExpr
    }
    //**********************************************************************************************
 
+   //**SMP scatter subtraction assignment to dense vectors*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP scatter subtraction assignment of a transpose dense vector-sparse matrix
+   //        multiplication to a dense vector (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a transpose
+   // dense vector-sparse matrix multiplication expression to a dense vector by means of the
+   // parallel scatter kernel (see the smpScatterMultAssign() function). Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler in
+   // case neither operand requires an intermediate evaluation.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline auto smpSubAssign( DenseVector<VT2,true>& lhs, const TDVecSMatMultExpr& rhs )
+      -> EnableIf_t< UseSMPScatterAssign_v<VT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         subAssign( *lhs, rhs );
+         return;
+      }
+
+      LT x( rhs.vec_ );  // Evaluation of the left-hand side dense vector operand
+      RT A( rhs.mat_ );  // Evaluation of the right-hand side sparse matrix operand
+
+      smpScatterMultAssign( *lhs, A, x, []( auto& a, const auto& b ){ subAssign( a, b ); } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse vectors************************************************
    // No special implementation for the SMP subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -782,7 +910,7 @@ class TDVecSMatMultExpr
    */
    template< typename VT2 >  // Type of the target dense vector
    friend inline auto smpMultAssign( DenseVector<VT2,true>& lhs, const TDVecSMatMultExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT2> >
+      -> EnableIf_t< UseSMPAssign_v<VT2> || UseSMPScatterAssign_v<VT2> >
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -817,7 +945,7 @@ class TDVecSMatMultExpr
    */
    template< typename VT2 >  // Type of the target dense vector
    friend inline auto smpDivAssign( DenseVector<VT2,true>& lhs, const TDVecSMatMultExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT2> >
+      -> EnableIf_t< UseSMPAssign_v<VT2> || UseSMPScatterAssign_v<VT2> >
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -0,0 +1,326 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Executor.h
+//  \brief Header file for the executor interface of the C++11/Boost thread-based parallelization
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_EXECUTOR_H_
+#define _BLAZE_MATH_SMP_THREADS_EXECUTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <functional>
+#include <blaze/math/Exception.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Suffix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS EXECUTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Interface for the execution of the tasks of the C++11/Boost thread-based parallelization.
+// \ingroup smp
+//
+// The Executor class represents the interface between the C++11/Boost thread-based
+// parallelization of Blaze and the thread pool executing the tasks of parallel operations. By
+// default, all tasks are executed by the built-in thread pool of Blaze, whose size is given by
+// the \c BLAZE_NUM_THREADS environment variable or the setNumThreads() function. Applications
+// that already manage their own thread pool (as for instance a task based runtime system) can
+// derive from the Executor class and inject the resulting executor via the setExecutor()
+// function. In that case all parallel operations are executed on the threads of the application
+// and Blaze does not compete with the application for the available cores:
+
+   \code
+   class MyExecutor : public blaze::Executor
+   {
+    public:
+      size_t concurrency() const override { return pool.size(); }
+
+      size_t available() const override {
+         return pool.isWorkerThread() ? 1UL : pool.size();
+      }
+
+      void execute( size_t n, const std::function<void(size_t)>& task ) override {
+         pool.parallelFor( 0UL, n, task );  // Blocks until all tasks have been completed
+      }
+   };
+
+   MyExecutor executor;
+   blaze::setExecutor( executor );
+
+   // ... All parallel operations are now executed via MyExecutor
+
+   blaze::resetExecutor();
+   \endcode
+
+// An executor has to provide the following three functions:
+//
+//  - \c concurrency(): Returns the maximum number of tasks that can be executed concurrently.
+//  - \c available(): Returns the number of threads available for a parallel operation started
+//    by the calling thread. The default implementation returns the result of \c concurrency().
+//    In case the calling thread is a worker of an already saturated thread pool, this function
+//    should return 1, which results in the serial execution of the operation on the calling
+//    thread.
+//  - \c execute(): Executes the \a n given tasks \a task(0) to \a task(n-1) concurrently and
+//    blocks until all tasks have been completed. The calling thread may participate in the
+//    execution of the tasks.
+//
+// Note that the executor has to be thread-safe since parallel operations may be started from
+// several threads concurrently. Also note that the executor must remain valid until it is
+// replaced by means of the setExecutor() or resetExecutor() functions.
+*/
+class Executor
+{
+ public:
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   virtual ~Executor() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   virtual size_t concurrency() const = 0;
+   virtual size_t available  () const;
+   virtual void   execute    ( size_t n, const std::function<void(size_t)>& task ) = 0;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads available for a parallel operation.
+//
+// \return The number of threads available for the calling thread.
+//
+// The default implementation returns the maximum number of concurrently executed tasks.
+*/
+inline size_t Executor::available() const
+{
+   return concurrency();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS PARALLELISMBUDGET
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Section to restrict the number of threads of parallel operations.
+// \ingroup smp
+//
+// The ParallelismBudget class is an auxiliary helper class for the \a BLAZE_PARALLELISM_BUDGET
+// macro. It provides the functionality to restrict the number of threads used for the parallel
+// operations executed by the current thread.
+*/
+template< typename T >
+class ParallelismBudget
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline ParallelismBudget( size_t budget );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ParallelismBudget();
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator bool() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t previous_;  //!< The parallelism budget of the enclosing section.
+
+   static thread_local size_t budget_;  //!< The parallelism budget of the current thread.
+                                        /*!< The budget is 0 in case no restriction is active. */
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend size_t getParallelismBudget();
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+thread_local size_t ParallelismBudget<T>::budget_ = 0UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the ParallelismBudget class.
+//
+// \param budget The maximum number of threads \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid parallelism budget.
+//
+// In case the budget is specified within another budget section, the smaller of both budgets
+// is active.
+*/
+template< typename T >
+inline ParallelismBudget<T>::ParallelismBudget( size_t budget )
+   : previous_( budget_ )  // The parallelism budget of the enclosing section
+{
+   if( budget == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid parallelism budget" );
+   }
+
+   budget_ = ( previous_ == 0UL )?( budget ):( min( previous_, budget ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor of the ParallelismBudget class.
+*/
+template< typename T >
+inline ParallelismBudget<T>::~ParallelismBudget()
+{
+   budget_ = previous_;  // Restoring the budget of the enclosing section
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion operator to \a bool.
+//
+// The conversion operator always returns \a true.
+*/
+template< typename T >
+inline ParallelismBudget<T>::operator bool() const
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PARALLELISMBUDGET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name ParallelismBudget functions */
+//@{
+inline size_t getParallelismBudget();
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the active parallelism budget of the calling thread.
+// \ingroup smp
+//
+// \return The maximum number of threads of parallel operations, 0 in case of no restriction.
+*/
+inline size_t getParallelismBudget()
+{
+   return ParallelismBudget<int>::budget_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PARALLELISM BUDGET MACRO
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Section to restrict the number of threads of parallel operations.
+// \ingroup smp
+//
+// This macro provides the option to restrict the number of threads used by all parallel
+// operations started by the current thread within the section. In contrast to the
+// setNumThreads() function, the budget only affects the calling thread, i.e. parallel
+// operations started concurrently by other threads are not affected:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C;
+   // ... Resizing and initialization
+
+   BLAZE_PARALLELISM_BUDGET( 2UL ) {
+      C = A * B;  // Executed by at most 2 threads
+   }
+   \endcode
+
+// Parallelism budgets can be nested, in which case the smallest budget is active. In case the
+// specified budget is 0, a \a std::invalid_argument exception is thrown. Note that the budget is
+// only available for the C++11 and Boost thread-based parallelization.
+*/
+#define BLAZE_PARALLELISM_BUDGET( BUDGET ) \
+   if( blaze::ParallelismBudget<int> BLAZE_JOIN( parallelismBudget, __LINE__ ) = ( BUDGET ) )
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
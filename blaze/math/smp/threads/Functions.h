@@ -40,7 +40,9 @@
 // Includes
 //*************************************************************************************************
 
+#include <chrono>
 #include <blaze/math/Exception.h>
+#include <blaze/math/smp/threads/Executor.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
@@ -64,6 +66,8 @@ namespace blaze {
 // \return The number of threads used for thread parallel operations.
 //
 // Via this function the number of threads used for thread parallel operations can be queried.
+// The number of threads is given by the active executor (see setExecutor()) and is restricted
+// by the active parallelism budget of the calling thread (see \c BLAZE_PARALLELISM_BUDGET).
 */
 BLAZE_ALWAYS_INLINE size_t getNumThreads()
 {
@@ -84,7 +88,9 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 //
 // Via this function the maximum number of threads for thread parallel operations can be specified.
 // Note that the given \a number must be in the range \f$[1..\infty)\f$. In case an invalid
-// number of threads is specified, a \a std::invalid_argument exception is thrown.
+// number of threads is specified, a \a std::invalid_argument exception is thrown. Also note
+// that the function changes the size of the built-in thread pool, i.e. it has no effect on an
+// executor injected via setExecutor().
 */
 BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 {
@@ -98,6 +104,86 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Starts all threads used for thread parallel operations.
+// \ingroup smp
+//
+// \return void
+//
+// The threads of the built-in thread pool are started lazily by the first parallel operation.
+// Via this function the thread pool can be started explicitly, for instance at the beginning of
+// a latency critical section. Additionally, all threads that have been terminated due to the
+// idle timeout (see setThreadIdleTimeout()) are restarted. Note that the function has no effect
+// on an executor injected via setExecutor().
+*/
+BLAZE_ALWAYS_INLINE void warmUpThreads()
+{
+   TheThreadBackend::warmup();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the idle timeout of the threads used for thread parallel operations.
+// \ingroup smp
+//
+// \param timeout The idle timeout, zero to keep idle threads alive.
+// \return void
+//
+// Via this function it is possible to specify a duration after which idle threads of the
+// built-in thread pool terminate. This does not change the number of threads used for thread
+// parallel operations: terminated threads are restarted on demand by the next parallel
+// operation or explicitly via warmUpThreads(). By default, idle threads are kept alive. Note
+// that the function has no effect on an executor injected via setExecutor().
+
+   \code
+   blaze::setThreadIdleTimeout( std::chrono::seconds( 10 ) );
+   \endcode
+*/
+BLAZE_ALWAYS_INLINE void setThreadIdleTimeout( std::chrono::milliseconds timeout )
+{
+   TheThreadBackend::setIdleTimeout( timeout );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the executor for thread parallel operations.
+// \ingroup smp
+//
+// \param executor The executor to be used for all thread parallel operations.
+// \return void
+//
+// Via this function the tasks of all thread parallel operations can be redirected from the
+// built-in thread pool to the thread pool of the application (see the Executor class). The
+// given executor has to remain valid until it is replaced by another call to setExecutor() or
+// by a call to resetExecutor(). Note that the executor must not be replaced while any parallel
+// operation is executed.
+*/
+BLAZE_ALWAYS_INLINE void setExecutor( Executor& executor )
+{
+   TheThreadBackend::setExecutor( &executor );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the executor for thread parallel operations to the built-in thread pool.
+// \ingroup smp
+//
+// \return void
+//
+// Via this function any executor injected via setExecutor() is removed and all thread parallel
+// operations are again executed by the built-in thread pool. Note that the executor must not
+// be reset while any parallel operation is executed.
+*/
+BLAZE_ALWAYS_INLINE void resetExecutor()
+{
+   TheThreadBackend::setExecutor( nullptr );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
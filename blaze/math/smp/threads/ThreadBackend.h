@@ -50,11 +50,19 @@
 #  include <boost/thread/thread.hpp>
 #endif
 
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
+#include <functional>
+#include <utility>
+#include <vector>
 #include <blaze/math/constraints/Expression.h>
+#include <blaze/math/smp/threads/Executor.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/constraints/Const.h>
+#include <blaze/util/MaybeUnused.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/ThreadPool.h>
 #include <blaze/util/Types.h>
@@ -75,7 +83,16 @@ namespace blaze {
 //
 // The ThreadBackend class template represents the backend system for the C++11 and Boost
 // thread-based parallelization. It provides the functionality to manage a pool of active
-// threads and to schedule (compound) assignment tasks for execution.\n
+// threads and to schedule (compound) assignment tasks for execution. The scheduled tasks are
+// collected per calling thread and executed by the active executor (see the Executor class)
+// as soon as the wait() function is called. By default, the executor is the built-in thread
+// pool, but it can be replaced by an executor of the application via setExecutor(). Tasks
+// scheduled from within an executed task as well as single tasks are executed directly on the
+// calling thread.\n
+// The built-in thread pool is created lazily by the first parallel operation (or explicitly via
+// warmup()), i.e. programs that never execute a parallel operation don't start any thread. Via
+// setIdleTimeout() it is possible to terminate the threads of the pool after a period of
+// inactivity; terminated threads are restarted on demand by the next parallel operation.\n
 // This class must \b NOT be used explicitly! It is reserved for internal use only. Using
 // this class explicitly might result in erroneous results and/or in undefined behavior.
 */
@@ -89,9 +106,14 @@ class ThreadBackend
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   static inline size_t size  ();
-   static inline void   resize( size_t n, bool block=false );
-   static inline void   wait  ();
+   static inline size_t    size          ();
+   static inline size_t    running       ();
+   static inline void      resize        ( size_t n, bool block=false );
+   static inline void      warmup        ();
+   static inline void      setIdleTimeout( std::chrono::milliseconds timeout );
+   static inline void      wait          ();
+   static inline Executor& executor      () noexcept;
+   static inline void      setExecutor   ( Executor* executor ) noexcept;
    //@}
    //**********************************************************************************************
 
@@ -100,6 +122,9 @@ class ThreadBackend
    //@{
    template< typename Target, typename Source, typename OP >
    static inline void schedule( Target& target, const Source& source, OP op );
+
+   template< typename Task >
+   static inline void schedule( Task task );
    //@}
    //**********************************************************************************************
 
@@ -149,22 +174,94 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Private class PoolExecutor******************************************************************
+   /*!\brief Executor for the execution of tasks by the built-in thread pool.
+   */
+   class PoolExecutor : public Executor
+   {
+    public:
+      //**Utility functions************************************************************************
+      /*!\brief Returns the number of threads of the built-in thread pool.
+      //
+      // \return The number of threads of the thread pool.
+      */
+      size_t concurrency() const override {
+         return size_.load( std::memory_order_relaxed );
+      }
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Executes the given tasks by means of the built-in thread pool.
+      //
+      // \param n The number of tasks to be executed.
+      // \param task The task operation, called once for every index in the range \f$[0..n)\f$.
+      // \return void
+      //
+      // This function blocks until the \a n given tasks have been completed. Since the thread
+      // pool is shared by all calling threads, the function waits for the completion of its own
+      // tasks only and not for the tasks scheduled by concurrent parallel operations.
+      */
+      void execute( size_t n, const std::function<void(size_t)>& task ) override {
+         MT mutex;
+         CT completed;
+         size_t remaining( n );
+
+         auto& pool( threadpool() );
+         for( size_t i=0UL; i<n; ++i ) {
+            pool.schedule( [&task,&mutex,&completed,&remaining,i]()
+            {
+               task( i );
+
+               LT lock( mutex );
+               if( --remaining == 0UL ) {
+                  completed.notify_all();
+               }
+            } );
+         }
+
+         LT lock( mutex );
+         while( remaining > 0UL ) {
+            completed.wait( lock );
+         }
+      }
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Batch   = std::vector< std::function<void()> >;  //!< Type of the scheduled tasks.
+   using Pool    = ThreadPool<TT,MT,LT,CT>;               //!< Type of the built-in thread pool.
+   using Timeout = std::chrono::milliseconds::rep;        //!< Type of the idle timeout.
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
    static inline size_t initPool();
+   static inline Pool&  threadpool();
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
-                                                /*!< It is initialized with the number of threads
-                                                     specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
-                                                     explicitly resized to arbitrary numbers of
-                                                     threads. */
+   static std::atomic<size_t>  size_;     //!< The size of the built-in thread pool.
+                                          /*!< It is initialized with the number of threads
+                                               specified via the environment variable
+                                               \c BLAZE_NUM_THREADS. However, it can be
+                                               explicitly resized to arbitrary numbers of
+                                               threads. */
+   static std::atomic<Timeout> timeout_;  //!< The idle timeout of the threads in milliseconds.
+   static std::atomic<bool>    created_;  //!< Flag for the creation of the built-in thread pool.
+
+   static PoolExecutor poolExecutor_;         //!< The executor of the built-in thread pool.
+   static std::atomic<Executor*> executor_;   //!< The active executor of the backend system.
+                                              /*!< In case no executor has been injected via
+                                                   setExecutor() the built-in thread pool is
+                                                   used. */
+
+   static thread_local Batch batch_;          //!< The tasks scheduled by the current thread.
+   static thread_local bool  executing_;      //!< Flag for threads executing a scheduled task.
    //@}
    //**********************************************************************************************
 };
@@ -183,7 +280,25 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+std::atomic<size_t> ThreadBackend<TT,MT,LT,CT>::size_( initPool() );
+
+template< typename TT, typename MT, typename LT, typename CT >
+std::atomic<typename ThreadBackend<TT,MT,LT,CT>::Timeout> ThreadBackend<TT,MT,LT,CT>::timeout_( 0 );
+
+template< typename TT, typename MT, typename LT, typename CT >
+std::atomic<bool> ThreadBackend<TT,MT,LT,CT>::created_( false );
+
+template< typename TT, typename MT, typename LT, typename CT >
+typename ThreadBackend<TT,MT,LT,CT>::PoolExecutor ThreadBackend<TT,MT,LT,CT>::poolExecutor_;
+
+template< typename TT, typename MT, typename LT, typename CT >
+std::atomic<Executor*> ThreadBackend<TT,MT,LT,CT>::executor_( nullptr );
+
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local typename ThreadBackend<TT,MT,LT,CT>::Batch ThreadBackend<TT,MT,LT,CT>::batch_;
+
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local bool ThreadBackend<TT,MT,LT,CT>::executing_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -198,9 +313,14 @@ ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Returns the total number of threads managed by the thread backend system.
+/*!\brief Returns the number of threads available for a parallel operation.
+//
+// \return The number of threads available for the calling thread.
 //
-// \return The total number of threads of the thread backend system.
+// This function returns the number of threads available for a parallel operation started by
+// the calling thread. The number is given by the active executor and is restricted by the
+// active parallelism budget of the calling thread (see \c BLAZE_PARALLELISM_BUDGET). In case
+// the calling thread is executing a scheduled task, the function returns 1.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -208,7 +328,39 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 {
-   return threadpool_.size();
+   if( executing_ )
+      return 1UL;
+
+   const size_t available( executor().available() );
+   const size_t budget   ( getParallelismBudget() );
+
+   return max( ( budget == 0UL )?( available ):( min( available, budget ) ), 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of currently running threads of the built-in thread pool.
+//
+// \return The number of running threads.
+//
+// This function returns the number of threads of the built-in thread pool that are currently
+// running. In case the thread pool has not been created yet, the function returns 0 and does
+// not create the thread pool. Threads that have been terminated due to the idle timeout (see
+// setIdleTimeout()) are not counted.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::running()
+{
+   if( !created_.load() )
+      return 0UL;
+
+   return threadpool().running();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -228,7 +380,8 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 // removed from the backend system, otherwise new threads are added to the backend system. In
 // case an invalid number of threads is specified, an \a std::invalid_argument exception is
 // thrown. Via the \a block flag it is possible to block the function until the desired
-// number of threads is available.
+// number of threads is available. In case the thread pool has not been created yet, only the
+// size of the future thread pool is adapted and no thread is started.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -236,7 +389,59 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 {
-   return threadpool_.resize( n, block );
+   size_.store( n );
+
+   if( created_.load() ) {
+      threadpool().resize( n, block );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Starts all threads of the built-in thread pool.
+//
+// \return void
+//
+// This function creates the built-in thread pool (in case it has not been created yet) and
+// restarts all threads that have been terminated due to the idle timeout. Thus the startup
+// latency of the threads is not incurred by the next parallel operation.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::warmup()
+{
+   threadpool().warmup();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the idle timeout of the threads of the built-in thread pool.
+//
+// \param timeout The new idle timeout, zero to keep idle threads alive.
+// \return void
+//
+// This function sets the duration after which idle threads of the built-in thread pool
+// terminate. Terminated threads are restarted on demand by the next parallel operation.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::setIdleTimeout( std::chrono::milliseconds timeout )
+{
+   timeout_.store( timeout.count() );
+
+   if( created_.load() ) {
+      threadpool().setIdleTimeout( timeout );
+   }
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -248,7 +453,10 @@ inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function executes all tasks scheduled by the calling thread and blocks until all tasks
+// have been completed. In case only a single task has been scheduled or in case the calling
+// thread is itself executing a scheduled task, the tasks are executed directly on the calling
+// thread. Otherwise the tasks are passed to the active executor.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -256,7 +464,63 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::wait()
 {
-   threadpool_.wait();
+   Batch batch;
+   batch.swap( batch_ );
+
+   const auto run = [&batch]( size_t i )
+   {
+      const bool executing( executing_ );
+      executing_ = true;
+      batch[i]();
+      executing_ = executing;
+   };
+
+   if( batch.size() == 1UL || executing_ ) {
+      for( size_t i=0UL; i<batch.size(); ++i ) {
+         run( i );
+      }
+   }
+   else if( !batch.empty() ) {
+      executor().execute( batch.size(), run );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the active executor of the thread backend system.
+//
+// \return Reference to the active executor.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline Executor& ThreadBackend<TT,MT,LT,CT>::executor() noexcept
+{
+   Executor* executor( executor_.load( std::memory_order_acquire ) );
+   return ( executor != nullptr )?( *executor ):( poolExecutor_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the active executor of the thread backend system.
+//
+// \param executor Pointer to the new executor, \c nullptr for the built-in thread pool.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::setExecutor( Executor* executor ) noexcept
+{
+   executor_.store( executor, std::memory_order_release );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -279,7 +543,8 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 // \param op The (compound) assignment operation.
 // \return void
 //
-// This function schedules a (compound) assignment of the two given operands for execution.
+// This function schedules a (compound) assignment of the two given operands for execution. The
+// assignment is executed by the next call to the wait() function.
 */
 template< typename TT      // Type of the encapsulated thread
         , typename MT      // Type of the synchronization mutex
@@ -291,7 +556,30 @@ template< typename Target  // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source& source, OP op )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source,OP>( target, source, op ) );
+   batch_.emplace_back( Assigner<Target,Source,OP>( target, source, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given task for execution.
+//
+// \param task The task to be executed.
+// \return void
+//
+// This function schedules the given task, i.e. a function or functor without arguments, for
+// execution. The task is executed by the next call to the wait() function.
+*/
+template< typename TT      // Type of the encapsulated thread
+        , typename MT      // Type of the synchronization mutex
+        , typename LT      // Type of the mutex lock
+        , typename CT >    // Type of the condition variable
+template< typename Task >  // Type of the task
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( Task task )
+{
+   batch_.emplace_back( std::move( task ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -338,6 +626,44 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the built-in thread pool.
+//
+// \return Reference to the built-in thread pool.
+//
+// This function returns the built-in thread pool of the backend system. The thread pool is
+// created by the first call with the current size and idle timeout of the backend system.
+// The creation is published via the \a created_ flag by the thread-safe initialization of a
+// function-local static. Since resize() and setIdleTimeout() store the new setting before
+// reading the flag and the pool is configured again after the flag has been set, a setting
+// that is changed concurrently to the creation of the pool is never lost.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::Pool& ThreadBackend<TT,MT,LT,CT>::threadpool()
+{
+   static Pool pool( max( size_.load(), size_t(1) )
+                   , std::chrono::milliseconds( timeout_.load() ) );
+
+   static const bool created = []()
+   {
+      created_.store( true );
+      pool.resize( max( size_.load(), size_t(1) ) );
+      pool.setIdleTimeout( std::chrono::milliseconds( timeout_.load() ) );
+      return true;
+   }();
+
+   MAYBE_UNUSED( created );
+
+   return pool;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,1273 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/DeltaCompressedMatrix.h
+//  \brief Implementation of a read-only sparse matrix with delta-compressed indices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_DELTACOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_DELTACOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/SameTag.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/SmallArray.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup delta_compressed_matrix DeltaCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-only sparse matrix with delta-compressed indices.
+// \ingroup delta_compressed_matrix
+//
+// The DeltaCompressedMatrix class template is an immutable sparse matrix format for memory
+// bound sparse matrix/dense vector and sparse matrix/dense matrix multiplications. The type of
+// the elements, the storage order, and the group tag of the matrix can be specified via the
+// three template parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, bool SO, typename Tag >
+   class DeltaCompressedMatrix;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. DeltaCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::defaultStorageOrder.
+//  - Tag : optional type parameter to tag the matrix. The default type is \a blaze::Group0.
+//          See \ref grouping_tagging for details.
+//
+// A DeltaCompressedMatrix is created from any dense or sparse matrix and cannot be modified
+// afterwards. In contrast to CompressedMatrix, which stores a full \a size_t index for every
+// non-zero element, the indices of every row (in case of a row-major matrix) or column (in
+// case of a column-major matrix) are stored as differences to the previous index. The first
+// index of a row/column is stored as variable length integer, all following differences use
+// the smallest fixed byte width (1, 2, 4, or 8 bytes) that fits the largest difference of the
+// row/column. Therefore the width has to be determined only once per row/column and the
+// decoding of the indices is free of branches. Optionally the values are deduplicated: in
+// case the matrix contains at most 256 distinct values, every non-zero element only stores a
+// single byte code into a table of the distinct values. For a typical sparse matrix of double
+// precision values this reduces the memory traffic of a multiplication from 16 bytes to about
+// 9 bytes per non-zero element, and to about 2 bytes per non-zero element in case of
+// deduplicated values:
+
+   \code
+   using blaze::rowMajor;
+   using blaze::columnVector;
+
+   blaze::CompressedMatrix<double,rowMajor> A( 10000UL, 10000UL );
+   // ... Initialization
+
+   const blaze::DeltaCompressedMatrix<double,rowMajor> B( A );  // Compressing the matrix
+
+   B.nonZeros();  // Returns the number of non-zero elements of the matrix
+   B.bytes();     // Returns the number of bytes occupied by the matrix
+   B(2,5);        // Read access to element (2,5)
+
+   blaze::DynamicVector<double,columnVector> x( 10000UL ), y;
+   blaze::DynamicMatrix<double,rowMajor> X( 10000UL, 8UL ), Y;
+   // ... Initialization
+
+   y = B * x;           // Sparse matrix/dense vector multiplication
+   multiply( B, x, y ); // In-place sparse matrix/dense vector multiplication
+   Y = B * X;           // Sparse matrix/dense matrix multiplication
+   multiply( B, X, Y ); // In-place sparse matrix/dense matrix multiplication
+   \endcode
+
+// Since the indices of the non-zero elements are not stored explicitly, DeltaCompressedMatrix
+// does not provide iterators and is not a sparse matrix in the sense of the SparseMatrix base
+// class. Instead, the forEach() function decodes a single row/column and passes all non-zero
+// elements to the given function. For all other operations the matrix() function returns the
+// decompressed CompressedMatrix:
+
+   \code
+   B.forEach( 2UL, []( size_t j, const double& value ) { ... } );  // Traversing row 2
+   blaze::CompressedMatrix<double,rowMajor> C( B.matrix() );       // Decompressing the matrix
+   \endcode
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+class DeltaCompressedMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This        = DeltaCompressedMatrix<Type,SO,Tag>;  //!< Type of this instance.
+   using ResultType  = CompressedMatrix<Type,SO,Tag>;       //!< Type of the decompressed matrix.
+   using ElementType = Type;                                //!< Type of the matrix elements.
+   using TagType     = Tag;                                 //!< Tag type of this instance.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline DeltaCompressedMatrix();
+
+   template< typename MT, bool SO2 >
+   explicit inline DeltaCompressedMatrix( const Matrix<MT,SO2>& m, bool deduplicate=true );
+
+   DeltaCompressedMatrix( const DeltaCompressedMatrix& ) = default;
+   DeltaCompressedMatrix( DeltaCompressedMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~DeltaCompressedMatrix() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   DeltaCompressedMatrix& operator=( const DeltaCompressedMatrix& ) & = default;
+   DeltaCompressedMatrix& operator=( DeltaCompressedMatrix&& ) & = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Type operator()( size_t i, size_t j ) const;
+   inline Type at( size_t i, size_t j ) const;
+
+   template< typename F >
+   inline void forEach( size_t i, F&& f ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline bool   isDeduplicated() const noexcept;
+   inline size_t bytes() const noexcept;
+   inline void   swap( DeltaCompressedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion functions************************************************************************
+   /*!\name Conversion functions */
+   //@{
+   inline ResultType matrix() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename UT, bool DD, typename F >
+   inline void decode( size_t i, F& f ) const;
+
+   template< typename UT >
+   static inline void appendDelta( std::vector<uint8_t>& indices, size_t delta );
+
+   inline void deduplicate();
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t               m_;        //!< The current number of rows of the matrix.
+   size_t               n_;        //!< The current number of columns of the matrix.
+   std::vector<size_t>  begin_;    //!< The position of the first element of each row/column.
+   std::vector<size_t>  offset_;   //!< The position of the encoded indices of each row/column.
+   std::vector<uint8_t> indices_;  //!< The encoded indices of the non-zero elements.
+   std::vector<Type>    values_;   //!< The non-zero elements or the table of distinct values.
+   std::vector<uint8_t> codes_;    //!< The codes of the non-zero elements in case of deduplication.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for DeltaCompressedMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DeltaCompressedMatrix<Type,SO,Tag>::DeltaCompressedMatrix()
+   : m_      ( 0UL )           // The current number of rows of the matrix
+   , n_      ( 0UL )           // The current number of columns of the matrix
+   , begin_  ( 1UL, 0UL )      // The position of the first element of each row/column
+   , offset_ ( 1UL, 0UL )      // The position of the encoded indices of each row/column
+   , indices_()                // The encoded indices of the non-zero elements
+   , values_ ()                // The non-zero elements or the table of distinct values
+   , codes_  ()                // The codes of the non-zero elements in case of deduplication
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compression of a dense or sparse matrix.
+//
+// \param m Matrix to be compressed.
+// \param deduplicate \a true to store the values as codes into a table of distinct values.
+//
+// This constructor compresses the non-zero elements of the given matrix. In case \a deduplicate
+// is \a true, the element type is trivially copyable, and the matrix contains at most 256
+// distinct values (in terms of their bitwise representation), the values are stored as single
+// byte codes. In case the deduplication would not reduce the memory footprint of the matrix,
+// the values are stored as is.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the foreign matrix
+        , bool SO2 >      // Storage order of the foreign matrix
+inline DeltaCompressedMatrix<Type,SO,Tag>::DeltaCompressedMatrix( const Matrix<MT,SO2>& m,
+                                                                  bool deduplicate )
+   : m_      ( (*m).rows() )     // The current number of rows of the matrix
+   , n_      ( (*m).columns() )  // The current number of columns of the matrix
+   , begin_  ()                  // The position of the first element of each row/column
+   , offset_ ()                  // The position of the encoded indices of each row/column
+   , indices_()                  // The encoded indices of the non-zero elements
+   , values_ ()                  // The non-zero elements or the table of distinct values
+   , codes_  ()                  // The codes of the non-zero elements in case of deduplication
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   const CompressedMatrix<Type,SO,Tag> tmp( *m );
+   const size_t N( SO ? n_ : m_ );
+
+   begin_.resize( N+1UL );
+   offset_.resize( N+1UL );
+   values_.reserve( tmp.nonZeros() );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      begin_[k]  = values_.size();
+      offset_[k] = indices_.size();
+
+      const auto end( tmp.end(k) );
+      auto element( tmp.begin(k) );
+
+      if( element == end )
+         continue;
+
+      // Determining the smallest width that fits all differences of the row/column
+      size_t maxDelta( 0UL ), previous( element->index() );
+      for( auto next=element; next!=end; ++next ) {
+         maxDelta = max( maxDelta, next->index() - previous );
+         previous = next->index();
+      }
+
+      const size_t width( ( maxDelta <= 0xFFUL )?( 1UL ):
+                          ( maxDelta <= 0xFFFFUL )?( 2UL ):
+                          ( maxDelta <= 0xFFFFFFFFUL )?( 4UL ):( 8UL ) );
+
+      indices_.push_back( static_cast<uint8_t>( width ) );
+
+      // Encoding the first index as variable length integer
+      size_t first( element->index() );
+      while( first >= 0x80UL ) {
+         indices_.push_back( static_cast<uint8_t>( first | 0x80UL ) );
+         first >>= 7UL;
+      }
+      indices_.push_back( static_cast<uint8_t>( first ) );
+      values_.push_back( element->value() );
+
+      // Encoding the remaining indices as fixed width differences
+      size_t index( element->index() );
+
+      for( ++element; element!=end; ++element )
+      {
+         const size_t delta( element->index() - index );
+
+         switch( width ) {
+            case 1UL: appendDelta<uint8_t >( indices_, delta ); break;
+            case 2UL: appendDelta<uint16_t>( indices_, delta ); break;
+            case 4UL: appendDelta<uint32_t>( indices_, delta ); break;
+            default : appendDelta<uint64_t>( indices_, delta ); break;
+         }
+
+         index = element->index();
+         values_.push_back( element->value() );
+      }
+   }
+
+   begin_[N]  = values_.size();
+   offset_[N] = indices_.size();
+
+   if( deduplicate ) {
+      this->deduplicate();
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function decodes the according row (in case of a row-major matrix) or column (in case
+// of a column-major matrix) and therefore has linear complexity in the number of non-zero
+// elements of the row/column. It only performs an index check in case BLAZE_USER_ASSERT() is
+// active. In contrast, the at() function is guaranteed to perform a check of the given access
+// indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline Type DeltaCompressedMatrix<Type,SO,Tag>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t index( SO ? i : j );
+   Type result{};
+
+   forEach( SO ? j : i, [index,&result]( size_t k, const Type& value ) {
+      if( k == index ) result = value;
+   } );
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline Type DeltaCompressedMatrix<Type,SO,Tag>::at( size_t i, size_t j ) const
+{
+   if( i >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Traversal of the non-zero elements of a row/column.
+//
+// \param i The row/column index.
+// \param f The function to be called for every non-zero element.
+// \return void
+//
+// This function decodes the non-zero elements of row \a i in case the storage flag is set to
+// \a rowMajor and of column \a i in case the storage flag is set to \a columnMajor and calls
+// the given function with the index and the value of every non-zero element in ascending
+// order of the indices:
+
+   \code
+   blaze::DeltaCompressedMatrix<double,blaze::rowMajor> A( ... );
+
+   double sum( 0.0 );
+   A.forEach( 2UL, [&sum]( size_t j, const double& value ) { sum += value; } );
+   \endcode
+
+// The byte width of the index differences is determined once for the entire row/column, such
+// that the actual decoding loop is free of branches.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename F >    // Type of the function
+inline void DeltaCompressedMatrix<Type,SO,Tag>::forEach( size_t i, F&& f ) const
+{
+   BLAZE_USER_ASSERT( i < begin_.size()-1UL, "Invalid row/column access index" );
+
+   if( begin_[i] == begin_[i+1UL] )
+      return;
+
+   const bool dd( !codes_.empty() );
+
+   switch( indices_[offset_[i]] ) {
+      case 1UL: dd ? decode<uint8_t ,true>( i, f ) : decode<uint8_t ,false>( i, f ); break;
+      case 2UL: dd ? decode<uint16_t,true>( i, f ) : decode<uint16_t,false>( i, f ); break;
+      case 4UL: dd ? decode<uint32_t,true>( i, f ) : decode<uint32_t,false>( i, f ); break;
+      default : dd ? decode<uint64_t,true>( i, f ) : decode<uint64_t,false>( i, f ); break;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DeltaCompressedMatrix<Type,SO,Tag>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DeltaCompressedMatrix<Type,SO,Tag>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements in the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DeltaCompressedMatrix<Type,SO,Tag>::nonZeros() const noexcept
+{
+   return begin_.back();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DeltaCompressedMatrix<Type,SO,Tag>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < begin_.size()-1UL, "Invalid row/column access index" );
+   return begin_[i+1UL] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the values of the matrix are stored as codes into a table of values.
+//
+// \return \a true in case the values are deduplicated, \a false if not.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline bool DeltaCompressedMatrix<Type,SO,Tag>::isDeduplicated() const noexcept
+{
+   return !codes_.empty();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes occupied by the matrix.
+//
+// \return The total number of bytes of the matrix including all dynamically allocated memory.
+//
+// This function can be used to compare the memory footprint of the compressed matrix to the
+// memory footprint of the according CompressedMatrix, which requires approximately
+// \f$ (M+1) \cdot 8 + nonZeros() \cdot ( 8 + sizeof(Type) ) \f$ bytes (in case of a row-major
+// matrix).
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DeltaCompressedMatrix<Type,SO,Tag>::bytes() const noexcept
+{
+   return sizeof( This ) + ( begin_.size() + offset_.size() ) * sizeof( size_t ) +
+          indices_.size() + values_.size() * sizeof( Type ) + codes_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DeltaCompressedMatrix<Type,SO,Tag>::swap( DeltaCompressedMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( m_, m.m_ );
+   swap( n_, m.n_ );
+   begin_.swap( m.begin_ );
+   offset_.swap( m.offset_ );
+   indices_.swap( m.indices_ );
+   values_.swap( m.values_ );
+   codes_.swap( m.codes_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Decoding of a single row/column with fixed index difference width.
+//
+// \param i The index of the row/column.
+// \param f The function to be called for every non-zero element.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename UT     // Unsigned type of the index differences
+        , bool DD         // Deduplication flag
+        , typename F >    // Type of the function
+inline void DeltaCompressedMatrix<Type,SO,Tag>::decode( size_t i, F& f ) const
+{
+   const size_t kbegin( begin_[i] );
+   const size_t kend  ( begin_[i+1UL] );
+
+   const uint8_t* data( indices_.data() + offset_[i] + 1UL );
+
+   size_t index( 0UL );
+   for( size_t shift=0UL; ; shift+=7UL ) {
+      const uint8_t byte( *data++ );
+      index |= static_cast<size_t>( byte & 0x7FU ) << shift;
+      if( !( byte & 0x80U ) ) break;
+   }
+
+   f( index, ( DD ? values_[codes_[kbegin]] : values_[kbegin] ) );
+
+   for( size_t k=kbegin+1UL; k<kend; ++k, data+=sizeof(UT) ) {
+      UT delta;
+      std::memcpy( &delta, data, sizeof(UT) );
+      index += delta;
+      f( index, ( DD ? values_[codes_[k]] : values_[k] ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Appending an index difference of fixed width to the encoded indices.
+//
+// \param indices The encoded indices.
+// \param delta The index difference to be appended.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename UT >   // Unsigned type of the index differences
+inline void DeltaCompressedMatrix<Type,SO,Tag>::appendDelta( std::vector<uint8_t>& indices,
+                                                             size_t delta )
+{
+   const UT value( static_cast<UT>( delta ) );
+   const size_t size( indices.size() );
+
+   indices.resize( size+sizeof(UT) );
+   std::memcpy( indices.data()+size, &value, sizeof(UT) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Replacing the values of the matrix by codes into a table of distinct values.
+//
+// \return void
+//
+// The values are compared by means of their bitwise representation, i.e. the table preserves
+// the exact representation of all values (including signed zeros and NaN values). In case the
+// matrix contains more than 256 distinct values or the codes would not reduce the memory
+// footprint of the matrix, the values remain unchanged.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DeltaCompressedMatrix<Type,SO,Tag>::deduplicate()
+{
+   if( !std::is_trivially_copyable<Type>::value || sizeof( Type ) == 1UL )
+      return;
+
+   const auto less = []( const Type& a, const Type& b ) {
+      return std::memcmp( &a, &b, sizeof( Type ) ) < 0;
+   };
+
+   std::vector<Type> table;
+
+   for( const Type& value : values_ )
+   {
+      const auto pos( std::lower_bound( table.begin(), table.end(), value, less ) );
+
+      if( pos == table.end() || less( value, *pos ) ) {
+         if( table.size() == 256UL ) return;
+         table.insert( pos, value );
+      }
+   }
+
+   if( table.size() * sizeof( Type ) + values_.size() >= values_.size() * sizeof( Type ) )
+      return;
+
+   std::vector<uint8_t> codes( values_.size() );
+
+   for( size_t k=0UL; k<values_.size(); ++k ) {
+      const auto pos( std::lower_bound( table.begin(), table.end(), values_[k], less ) );
+      codes[k] = static_cast<uint8_t>( pos - table.begin() );
+   }
+
+   values_.swap( table );
+   codes_.swap( codes );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the decompressed matrix.
+//
+// \return The decompressed CompressedMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DeltaCompressedMatrix<Type,SO,Tag>::ResultType
+   DeltaCompressedMatrix<Type,SO,Tag>::matrix() const
+{
+   const size_t N( begin_.size()-1UL );
+
+   ResultType tmp( m_, n_, nonZeros() );
+
+   for( size_t k=0UL; k<N; ++k ) {
+      forEach( k, [&tmp,k]( size_t index, const Type& value ) {
+         tmp.append( ( SO ? index : k ), ( SO ? k : index ), value );
+      } );
+      tmp.finalize( k );
+   }
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DELTA-COMPRESSED SPARSE MATRIX/DENSE VECTOR MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial kernel for the multiplication of a delta-compressed matrix and a dense vector.
+// \ingroup delta_compressed_matrix
+//
+// \param A The delta-compressed matrix operand.
+// \param x The dense vector operand.
+// \param y The target dense vector.
+// \param kbegin The index of the first row/column to be processed.
+// \param kend The index one past the last row/column to be processed.
+// \return void
+//
+// This function computes the elements \f$ [kbegin..kend) \f$ of the target vector \a y. It
+// handles the multiplication of a row-major matrix and a dense column vector as well as the
+// multiplication of a dense row vector and a column-major matrix, i.e. every element of \a y
+// is the dot product of a single row/column of \a A and the vector \a x.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename VT1    // Type of the dense vector operand
+        , typename VT2 >  // Type of the target dense vector
+void deltaCompressedGather( const DeltaCompressedMatrix<Type,SO,Tag>& A, const VT1& x, VT2& y,
+                            size_t kbegin, size_t kend )
+{
+   using ET = ElementType_t<VT2>;
+
+   for( size_t k=kbegin; k<kend; ++k )
+   {
+      ET sum{};
+
+      A.forEach( k, [&x,&sum]( size_t index, const Type& value ) {
+         if( SO ) sum += x[index] * value;
+         else     sum += value * x[index];
+      } );
+
+      y[k] = sum;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial kernel for the transpose multiplication of a delta-compressed matrix and a
+//        dense vector.
+// \ingroup delta_compressed_matrix
+//
+// \param A The delta-compressed matrix operand.
+// \param x The dense vector operand.
+// \param y The target dense vector.
+// \return void
+//
+// This function handles the multiplication of a dense row vector and a row-major matrix as
+// well as the multiplication of a column-major matrix and a dense column vector, i.e. every
+// row/column of \a A is scaled by a single element of \a x and scattered into \a y. The
+// target vector \a y is expected to be reset.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename VT1    // Type of the dense vector operand
+        , typename VT2 >  // Type of the target dense vector
+void deltaCompressedScatter( const DeltaCompressedMatrix<Type,SO,Tag>& A, const VT1& x, VT2& y )
+{
+   const size_t N( SO ? A.columns() : A.rows() );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      const auto xk( x[k] );
+
+      A.forEach( k, [&xk,&y]( size_t index, const Type& value ) {
+         if( SO ) y[index] += value * xk;
+         else     y[index] += xk * value;
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a delta-compressed matrix and a dense vector.
+// \ingroup delta_compressed_matrix
+//
+// \param A The delta-compressed matrix operand.
+// \param x The dense vector operand.
+// \param y The target dense vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes the product of the matrix \a A and the dense column vector \a x
+// (\f$ \vec{y}=A*\vec{x} \f$) or the product of the dense row vector \a x and the matrix \a A
+// (\f$ \vec{y}^T=\vec{x}^T*A \f$) and assigns it to the dense vector \a y, which is resized
+// if necessary:
+
+   \code
+   blaze::DeltaCompressedMatrix<double,blaze::rowMajor> A( ... );
+   blaze::DynamicVector<double,blaze::columnVector> x( A.columns() ), y;
+   blaze::DynamicVector<double,blaze::rowVector> u( A.rows() ), v;
+   // ... Initialization
+
+   multiply( A, x, y );  // Computes y = A * x
+   multiply( A, u, v );  // Computes v = u * A
+   \endcode
+
+// The rows/columns of the matrix are decoded on the fly, i.e. the indices are never stored in
+// decompressed form. In case SMP parallelization is enabled, the matrix is sufficiently large,
+// and every element of \a y is computed from a single row/column of \a A (i.e. in case of a
+// row-major matrix and a column vector or a column-major matrix and a row vector), the
+// rows/columns are distributed among the threads such that all threads process approximately
+// the same number of non-zero elements. The transpose products are computed serially.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename VT1    // Type of the dense vector operand
+        , typename VT2    // Type of the target dense vector
+        , bool TF >       // Transpose flag of the vectors
+void multiply( const DeltaCompressedMatrix<Type,SO,Tag>& A,
+               const DenseVector<VT1,TF>& x, DenseVector<VT2,TF>& y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*x).size() != ( TF ? A.rows() : A.columns() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   if( (*x).isAliased( &(*y) ) ) {
+      const ResultType_t<VT1> tmp( *x );
+      multiply( A, tmp, y );
+      return;
+   }
+
+   const size_t N( TF ? A.columns() : A.rows() );
+
+   resize( *y, N, false );
+
+   CompositeType_t<VT1> x2( *x );
+
+   if( SO != TF ) {
+      reset( *y );
+      deltaCompressedScatter( A, x2, *y );
+      return;
+   }
+
+   const size_t threads( min( getNumThreads(), max( N, 1UL ) ) );
+
+   if( threads == 1UL || N < SMP_SMATDVECMULT_THRESHOLD ||
+       isSerialSectionActive() || isParallelSectionActive() ) {
+      deltaCompressedGather( A, x2, *y, 0UL, N );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      // Distributing the rows/columns such that all threads process the same number of elements
+      SmallArray<size_t,64UL> bounds( threads+1UL, N );
+      bounds[0UL] = 0UL;
+
+      const size_t share( A.nonZeros() / threads + 1UL );
+      size_t k( 0UL ), processed( 0UL );
+
+      for( size_t t=1UL; t<threads; ++t ) {
+         while( k < N && processed < t*share ) {
+            processed += A.nonZeros( k );
+            ++k;
+         }
+         bounds[t] = k;
+      }
+
+      smpFor( threads, [&]( size_t t )
+      {
+         deltaCompressedGather( A, x2, *y, bounds[t], bounds[t+1UL] );
+      } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a delta-compressed matrix and a
+//        dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup delta_compressed_matrix
+//
+// \param A The delta-compressed matrix operand.
+// \param x The dense vector operand.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator immediately evaluates the product of the matrix and the dense vector by means
+// of the multiply() function.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename VT >   // Type of the dense vector operand
+inline DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector >
+   operator*( const DeltaCompressedMatrix<Type,SO,Tag>& A, const DenseVector<VT,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector > y;
+   multiply( A, x, y );
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a transpose dense vector and a
+//        delta-compressed matrix (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+// \ingroup delta_compressed_matrix
+//
+// \param x The transpose dense vector operand.
+// \param A The delta-compressed matrix operand.
+// \return The resulting transpose dense vector.
+// \exception std::invalid_argument Vector and matrix sizes do not match.
+//
+// This operator immediately evaluates the product of the dense vector and the matrix by means
+// of the multiply() function.
+*/
+template< typename VT     // Type of the dense vector operand
+        , typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DynamicVector< MultTrait_t< ElementType_t<VT>, Type >, rowVector >
+   operator*( const DenseVector<VT,rowVector>& x, const DeltaCompressedMatrix<Type,SO,Tag>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicVector< MultTrait_t< ElementType_t<VT>, Type >, rowVector > y;
+   multiply( A, x, y );
+   return y;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DELTA-COMPRESSED SPARSE MATRIX/DENSE MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial kernel for the multiplication of a row-major delta-compressed matrix and a
+//        dense matrix.
+// \ingroup delta_compressed_matrix
+//
+// \param A The row-major delta-compressed matrix operand.
+// \param X The dense matrix operand.
+// \param Y The target dense matrix.
+// \param ibegin The index of the first row to be processed.
+// \param iend The index one past the last row to be processed.
+// \return void
+//
+// This function computes the rows \f$ [ibegin..iend) \f$ of the target matrix \a Y, which is
+// expected to be reset. Every row of \a Y is accumulated by means of vectorized additions of
+// the scaled rows of \a X, i.e. every row of \a A is decoded only once.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT1    // Type of the dense matrix operand
+        , typename MT2 >  // Type of the target dense matrix
+void deltaCompressedMultiply( const DeltaCompressedMatrix<Type,rowMajor,Tag>& A, const MT1& X,
+                              MT2& Y, size_t ibegin, size_t iend )
+{
+   for( size_t i=ibegin; i<iend; ++i )
+   {
+      auto yi( row( Y, i, unchecked ) );
+
+      A.forEach( i, [&X,&yi]( size_t k, const Type& value ) {
+         addAssign( yi, value * row( X, k, unchecked ) );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial kernel for the multiplication of a column-major delta-compressed matrix and a
+//        dense matrix.
+// \ingroup delta_compressed_matrix
+//
+// \param A The column-major delta-compressed matrix operand.
+// \param X The dense matrix operand.
+// \param Y The target dense matrix.
+// \param ibegin Unused.
+// \param iend Unused.
+// \return void
+//
+// This function scatters the scaled rows of \a X into the target matrix \a Y, which is
+// expected to be reset.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT1    // Type of the dense matrix operand
+        , typename MT2 >  // Type of the target dense matrix
+void deltaCompressedMultiply( const DeltaCompressedMatrix<Type,columnMajor,Tag>& A, const MT1& X,
+                              MT2& Y, size_t /*ibegin*/, size_t /*iend*/ )
+{
+   for( size_t k=0UL; k<A.columns(); ++k )
+   {
+      const auto xk( row( X, k, unchecked ) );
+
+      A.forEach( k, [&xk,&Y]( size_t i, const Type& value ) {
+         auto yi( row( Y, i, unchecked ) );
+         addAssign( yi, value * xk );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a delta-compressed matrix and a dense matrix (\f$ Y=A*X \f$).
+// \ingroup delta_compressed_matrix
+//
+// \param A The delta-compressed matrix operand.
+// \param X The dense matrix operand.
+// \param Y The target dense matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the product of the matrix \a A and the dense matrix \a X and assigns
+// it to the dense matrix \a Y, which is resized if necessary. The rows of \a Y are computed by
+// means of vectorized additions of the scaled rows of \a X, therefore the best performance is
+// achieved for row-major dense matrices. In case SMP parallelization is enabled, \a A is a
+// row-major matrix, and the target matrix is sufficiently large, the rows of \a A are
+// distributed among the threads such that all threads process approximately the same number
+// of non-zero elements.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename MT1    // Type of the dense matrix operand
+        , bool SO1        // Storage order of the dense matrix operand
+        , typename MT2    // Type of the target dense matrix
+        , bool SO2 >      // Storage order of the target dense matrix
+void multiply( const DeltaCompressedMatrix<Type,SO,Tag>& A,
+               const DenseMatrix<MT1,SO1>& X, DenseMatrix<MT2,SO2>& Y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*X).rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (*X).isAliased( &(*Y) ) ) {
+      const ResultType_t<MT1> tmp( *X );
+      multiply( A, tmp, Y );
+      return;
+   }
+
+   const size_t M( A.rows() );
+
+   resize( *Y, M, (*X).columns(), false );
+   reset( *Y );
+
+   CompositeType_t<MT1> X2( *X );
+
+   const size_t threads( min( getNumThreads(), max( M, 1UL ) ) );
+
+   if( SO || threads == 1UL || M*(*X).columns() < SMP_SMATDMATMULT_THRESHOLD ||
+       isSerialSectionActive() || isParallelSectionActive() ) {
+      deltaCompressedMultiply( A, X2, *Y, 0UL, M );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      // Distributing the rows such that all threads process the same number of elements
+      SmallArray<size_t,64UL> bounds( threads+1UL, M );
+      bounds[0UL] = 0UL;
+
+      const size_t share( A.nonZeros() / threads + 1UL );
+      size_t i( 0UL ), processed( 0UL );
+
+      for( size_t t=1UL; t<threads; ++t ) {
+         while( i < M && processed < t*share ) {
+            processed += A.nonZeros( i );
+            ++i;
+         }
+         bounds[t] = i;
+      }
+
+      smpFor( threads, [&]( size_t t )
+      {
+         deltaCompressedMultiply( A, X2, *Y, bounds[t], bounds[t+1UL] );
+      } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a delta-compressed matrix and a
+//        dense matrix (\f$ Y=A*X \f$).
+// \ingroup delta_compressed_matrix
+//
+// \param A The delta-compressed matrix operand.
+// \param X The dense matrix operand.
+// \return The resulting row-major dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator immediately evaluates the product of the two matrices by means of the
+// multiply() function.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename MT     // Type of the dense matrix operand
+        , bool SO2 >      // Storage order of the dense matrix operand
+inline DynamicMatrix< MultTrait_t< Type, ElementType_t<MT> >, rowMajor >
+   operator*( const DeltaCompressedMatrix<Type,SO,Tag>& A, const DenseMatrix<MT,SO2>& X )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicMatrix< MultTrait_t< Type, ElementType_t<MT> >, rowMajor > Y;
+   multiply( A, X, Y );
+   return Y;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DELTACOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DeltaCompressedMatrix operators */
+//@{
+template< typename Type, bool SO, typename Tag >
+void swap( DeltaCompressedMatrix<Type,SO,Tag>& a, DeltaCompressedMatrix<Type,SO,Tag>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two delta-compressed matrices.
+// \ingroup delta_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void swap( DeltaCompressedMatrix<Type,SO,Tag>& a,
+                  DeltaCompressedMatrix<Type,SO,Tag>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
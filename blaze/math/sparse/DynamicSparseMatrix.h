@@ -0,0 +1,3090 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/DynamicSparseMatrix.h
+//  \brief Implementation of a sparse MxN matrix with individually growing rows/columns
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_DYNAMICSPARSEMATRIX_H_
+#define _BLAZE_MATH_SPARSE_DYNAMICSPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/SameTag.h>
+#include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/typetraits/HighType.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsStrictlyLower.h>
+#include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/IsZero.h>
+#include <blaze/math/typetraits/LowType.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/SameSize.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/SmallArray.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup dynamic_sparse_matrix DynamicSparseMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a \f$ M \times N \f$ sparse matrix for incremental updates.
+// \ingroup dynamic_sparse_matrix
+//
+// The DynamicSparseMatrix class template is the representation of an arbitrary sized sparse
+// matrix, which is optimized for the frequent insertion and removal of individual elements. The
+// type of the elements, the storage order, and the group tag of the matrix can be specified via
+// the three template parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, bool SO, typename Tag >
+   class DynamicSparseMatrix;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. DynamicSparseMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::defaultStorageOrder.
+//  - Tag : optional type parameter to tag the matrix. The default type is \a blaze::Group0.
+//          See \ref grouping_tagging for details.
+//
+// In contrast to CompressedMatrix, which stores all non-zero elements in a single contiguous
+// array, DynamicSparseMatrix stores every row (in case of a row-major matrix) or every column
+// (in case of a column-major matrix) in an individually allocated array with a separate
+// capacity. Whenever a row/column runs out of capacity, only this row/column is reallocated,
+// with a geometrically growing capacity. Therefore inserting or erasing an element costs
+// \f$ O(nnz_i) \f$ operations in the length of the affected row/column instead of
+// \f$ O(nnz) \f$ in the total number of non-zero elements, and append() never requires a
+// previous reserve() or finalize() call:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::DynamicSparseMatrix<double,rowMajor> A( 10000UL, 10000UL );
+
+   A.reserve( 5UL, 8UL );   // Reserving space for 8 non-zero elements in row 5
+   A(5,3) = 1.0;            // Inserting an element only touches row 5
+   A.set( 7, 0, -2.0 );     // Inserting or modifying an element in row 7
+   A.insert( 7, 9, 3.0 );   // Inserting an element into row 7
+   A.append( 9, 4, 1.5 );   // Appending to row 9; the capacity grows on demand
+   A.erase( 5, 3 );         // Erasing an element only touches row 5
+   \endcode
+
+// DynamicSparseMatrix can be used in all expressions in combination with all other dense and
+// sparse vectors and matrices. For the repeated use as read-only operand, for instance in an
+// iterative solver, the compact() function converts the matrix into a tight CompressedMatrix
+// (in parallel in case SMP parallelization is enabled):
+
+   \code
+   blaze::DynamicVector<double> x( 10000UL ), y;
+   // ... Initialization
+
+   y = A * x;  // Direct use of the dynamic sparse matrix in a matrix/vector multiplication
+
+   const blaze::CompressedMatrix<double,rowMajor> B( A.compact() );
+   y = B * x;  // Use of the compacted, read-only representation
+   \endcode
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+class DynamicSparseMatrix
+   : public SparseMatrix< DynamicSparseMatrix<Type,SO,Tag>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   using ElementBase  = ValueIndexPair<Type>;  //!< Base class for the sparse matrix element.
+   using IteratorBase = ElementBase*;          //!< Iterator over non-constant base elements.
+   //**********************************************************************************************
+
+   //**Private class Element***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Value-index-pair for the DynamicSparseMatrix class template.
+   //
+   // This struct grants access to the data members of the base class and adapts the copy and
+   // move semantics of the value-index-pair.
+   */
+   struct Element
+      : public ElementBase
+   {
+      //**Constructors*****************************************************************************
+      Element() = default;
+      Element( const Element& rhs ) = default;
+      Element( Element&& rhs ) = default;
+      //*******************************************************************************************
+
+      //**Assignment operators*********************************************************************
+      inline Element& operator=( const Element& rhs )
+      {
+         this->value_ = rhs.value_;
+         return *this;
+      }
+
+      inline Element& operator=( Element&& rhs )
+      {
+         this->value_ = std::move( rhs.value_ );
+         return *this;
+      }
+
+      template< typename Other >
+      inline auto operator=( const Other& rhs )
+         -> EnableIf_t< IsSparseElement_v<Other>, Element& >
+      {
+         this->value_ = rhs.value();
+         return *this;
+      }
+
+      template< typename Other >
+      inline auto operator=( Other&& rhs )
+         -> EnableIf_t< IsSparseElement_v< RemoveReference_t<Other> > &&
+                        IsRValueReference_v<Other&&>, Element& >
+      {
+         this->value_ = std::move( rhs.value() );
+         return *this;
+      }
+
+      template< typename Other >
+      inline auto operator=( const Other& v )
+         -> EnableIf_t< !IsSparseElement_v<Other>, Element& >
+      {
+         this->value_ = v;
+         return *this;
+      }
+
+      template< typename Other >
+      inline auto operator=( Other&& v )
+         -> EnableIf_t< !IsSparseElement_v< RemoveReference_t<Other> > &&
+                        IsRValueReference_v<Other&&>, Element& >
+      {
+         this->value_ = std::move( v );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      friend class DynamicSparseMatrix;
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This       = DynamicSparseMatrix<Type,SO,Tag>;  //!< Type of this DynamicSparseMatrix instance.
+   using BaseType   = SparseMatrix<This,SO>;             //!< Base type of this DynamicSparseMatrix instance.
+   using ResultType = This;                              //!< Result type for expression template evaluations.
+
+   //! Result type with opposite storage order for expression template evaluations.
+   using OppositeType = DynamicSparseMatrix<Type,!SO,Tag>;
+
+   //! Transpose type for expression template evaluations.
+   using TransposeType = DynamicSparseMatrix<Type,!SO,Tag>;
+
+   //! Type of the tight, read-only representation of the matrix (see compact()).
+   using CompactType = CompressedMatrix<Type,SO,Tag>;
+
+   using ElementType    = Type;                     //!< Type of the sparse matrix elements.
+   using TagType        = Tag;                      //!< Tag type of this DynamicSparseMatrix instance.
+   using ReturnType     = const Type&;              //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;              //!< Data type for composite expression templates.
+   using Reference      = MatrixAccessProxy<This>;  //!< Reference to a sparse matrix value.
+   using ConstReference = const Type&;              //!< Reference to a constant sparse matrix value.
+   using Iterator       = Element*;                 //!< Iterator over non-constant elements.
+   using ConstIterator  = const Element*;           //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a DynamicSparseMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = DynamicSparseMatrix<NewType,SO,Tag>;  //!< The type of the other DynamicSparseMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a DynamicSparseMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = DynamicSparseMatrix<Type,SO,Tag>;  //!< The type of the other DynamicSparseMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline DynamicSparseMatrix();
+   inline DynamicSparseMatrix( size_t m, size_t n );
+   inline DynamicSparseMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+   inline DynamicSparseMatrix( initializer_list< initializer_list<Type> > list );
+
+   inline DynamicSparseMatrix( const DynamicSparseMatrix& sm );
+   inline DynamicSparseMatrix( DynamicSparseMatrix&& sm ) noexcept;
+
+   template< typename MT, bool SO2 > inline DynamicSparseMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline DynamicSparseMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~DynamicSparseMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline DynamicSparseMatrix& operator=( initializer_list< initializer_list<Type> > list ) &;
+   inline DynamicSparseMatrix& operator=( const DynamicSparseMatrix& rhs ) &;
+   inline DynamicSparseMatrix& operator=( DynamicSparseMatrix&& rhs ) & noexcept;
+
+   template< typename MT, bool SO2 > inline DynamicSparseMatrix& operator= ( const DenseMatrix<MT,SO2>&  rhs ) &;
+   template< typename MT, bool SO2 > inline DynamicSparseMatrix& operator= ( const SparseMatrix<MT,SO2>& rhs ) &;
+   template< typename MT, bool SO2 > inline DynamicSparseMatrix& operator+=( const Matrix<MT,SO2>& rhs ) &;
+   template< typename MT, bool SO2 > inline DynamicSparseMatrix& operator-=( const Matrix<MT,SO2>& rhs ) &;
+   template< typename MT, bool SO2 > inline DynamicSparseMatrix& operator%=( const DenseMatrix<MT,SO2>&  rhs ) &;
+   template< typename MT, bool SO2 > inline DynamicSparseMatrix& operator%=( const SparseMatrix<MT,SO2>& rhs ) &;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear();
+          void   resize ( size_t m, size_t n, bool preserve=true );
+   inline void   reserve( size_t nonzeros );
+   inline void   reserve( size_t i, size_t nonzeros );
+   inline void   trim   ();
+   inline void   trim   ( size_t i );
+   inline void   shrinkToFit();
+   inline void   swap( DynamicSparseMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline Iterator set     ( size_t i, size_t j, const Type& value );
+   inline Iterator insert  ( size_t i, size_t j, const Type& value );
+   inline void     append  ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void     finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Erase functions*****************************************************************************
+   /*!\name Erase functions */
+   //@{
+   inline void     erase( size_t i, size_t j );
+   inline Iterator erase( size_t i, Iterator pos );
+   inline Iterator erase( size_t i, Iterator first, Iterator last );
+
+   template< typename Pred >
+   inline void erase( Pred predicate );
+
+   template< typename Pred >
+   inline void erase( size_t i, Iterator first, Iterator last, Pred predicate );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline DynamicSparseMatrix& transpose();
+   inline DynamicSparseMatrix& ctranspose();
+
+   template< typename Other > inline DynamicSparseMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion functions************************************************************************
+   /*!\name Conversion functions */
+   //@{
+   CompactType compact() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign     ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT >           inline void assign     ( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT >           inline void assign     ( const SparseMatrix<MT,!SO>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void schurAssign( const DenseMatrix<MT,SO2>&  rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t lists() const noexcept;
+   inline size_t extendCapacity( size_t k ) const noexcept;
+          void   reserveElements( size_t k, size_t nonzeros );
+
+   inline Iterator     castDown( IteratorBase it ) const noexcept;
+   inline IteratorBase castUp  ( Iterator     it ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   Iterator insert( Iterator pos, size_t k, size_t index, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;         //!< The current number of rows of the sparse matrix.
+   size_t n_;         //!< The current number of columns of the sparse matrix.
+   size_t capacity_;  //!< The current capacity of the pointer arrays.
+   Iterator* begin_;  //!< Pointers to the first non-zero element of each row/column.
+   Iterator* end_;    //!< Pointers one past the last non-zero element of each row/column.
+   Iterator* last_;   //!< Pointers one past the last reserved element of each row/column.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_HAVE_SAME_SIZE       ( ElementBase, Element );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+const Type DynamicSparseMatrix<Type,SO,Tag>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for DynamicSparseMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DynamicSparseMatrix<Type,SO,Tag>::DynamicSparseMatrix()
+   : m_       ( 0UL )      // The current number of rows of the sparse matrix
+   , n_       ( 0UL )      // The current number of columns of the sparse matrix
+   , capacity_( 0UL )      // The current capacity of the pointer arrays
+   , begin_   ( nullptr )  // Pointers to the first non-zero element of each row/column
+   , end_     ( nullptr )  // Pointers one past the last non-zero element of each row/column
+   , last_    ( nullptr )  // Pointers one past the last reserved element of each row/column
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DynamicSparseMatrix<Type,SO,Tag>::DynamicSparseMatrix( size_t m, size_t n )
+   : m_       ( m )                            // The current number of rows of the sparse matrix
+   , n_       ( n )                            // The current number of columns of the sparse matrix
+   , capacity_( SO ? n : m )                   // The current capacity of the pointer arrays
+   , begin_   ( new Iterator[3UL*capacity_] )  // Pointers to the first non-zero element of each row/column
+   , end_     ( begin_+capacity_ )             // Pointers one past the last non-zero element of each row/column
+   , last_    ( end_+capacity_ )               // Pointers one past the last reserved element of each row/column
+{
+   std::fill( begin_, begin_+3UL*capacity_, nullptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The initial capacity of each row/column of the matrix.
+//
+// The matrix is initialized to the zero matrix and reserves the given capacity for each
+// row/column. In case the storage order is set to \a rowMajor the size of the vector must be
+// \a m, in case the storage order is set to \a columnMajor the size of the vector must be
+// \a n.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DynamicSparseMatrix<Type,SO,Tag>::DynamicSparseMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : DynamicSparseMatrix( m, n )
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == lists(), "Size of capacity vector and number of rows/columns don't match" );
+
+   for( size_t k=0UL; k<lists(); ++k ) {
+      reserve( k, nonzeros[k] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+//
+// This constructor provides the option to explicitly initialize the elements of the matrix by
+// means of an initializer list:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::DynamicSparseMatrix<int,rowMajor> A{ { 1, 0, 3 },
+                                               { 0, 5 },
+                                               { 7, 0, 9 } };
+   \endcode
+
+// The matrix is sized according to the size of the initializer list and all its elements are
+// initialized by the non-zero values of the given initializer list. Missing values are
+// initialized as default (as e.g. the value 6 in the example).
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DynamicSparseMatrix<Type,SO,Tag>::DynamicSparseMatrix( initializer_list< initializer_list<Type> > list )
+   : DynamicSparseMatrix( list.size(), determineColumns( list ) )
+{
+   size_t i( 0UL );
+
+   for( const auto& rowList : list )
+   {
+      size_t j( 0UL );
+
+      for( const Type& element : rowList ) {
+         if( !isDefault<strict>( element ) )
+            append( i, j, element );
+         ++j;
+      }
+
+      ++i;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for DynamicSparseMatrix.
+//
+// \param sm Sparse matrix to be copied.
+//
+// The copy constructor allocates each row/column with exactly the required capacity, i.e. the
+// free capacity of \a sm is not copied.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DynamicSparseMatrix<Type,SO,Tag>::DynamicSparseMatrix( const DynamicSparseMatrix& sm )
+   : DynamicSparseMatrix( sm.m_, sm.n_ )
+{
+   for( size_t k=0UL; k<lists(); ++k ) {
+      reserveElements( k, sm.nonZeros( k ) );
+      end_[k] = castDown( std::copy( sm.begin_[k], sm.end_[k], castUp( begin_[k] ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for DynamicSparseMatrix.
+//
+// \param sm The sparse matrix to be moved into this instance.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DynamicSparseMatrix<Type,SO,Tag>::DynamicSparseMatrix( DynamicSparseMatrix&& sm ) noexcept
+   : m_       ( sm.m_ )         // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )         // The current number of columns of the sparse matrix
+   , capacity_( sm.capacity_ )  // The current capacity of the pointer arrays
+   , begin_   ( sm.begin_ )     // Pointers to the first non-zero element of each row/column
+   , end_     ( sm.end_ )       // Pointers one past the last non-zero element of each row/column
+   , last_    ( sm.last_ )      // Pointers one past the last reserved element of each row/column
+{
+   sm.m_        = 0UL;
+   sm.n_        = 0UL;
+   sm.capacity_ = 0UL;
+   sm.begin_    = nullptr;
+   sm.end_      = nullptr;
+   sm.last_     = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the foreign dense matrix
+        , bool SO2 >      // Storage order of the foreign dense matrix
+inline DynamicSparseMatrix<Type,SO,Tag>::DynamicSparseMatrix( const DenseMatrix<MT,SO2>& dm )
+   : DynamicSparseMatrix( (*dm).rows(), (*dm).columns() )
+{
+   using blaze::assign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   assign( *this, *dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the foreign sparse matrix
+        , bool SO2 >      // Storage order of the foreign sparse matrix
+inline DynamicSparseMatrix<Type,SO,Tag>::DynamicSparseMatrix( const SparseMatrix<MT,SO2>& sm )
+   : DynamicSparseMatrix( (*sm).rows(), (*sm).columns() )
+{
+   using blaze::assign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   assign( *this, *sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for DynamicSparseMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DynamicSparseMatrix<Type,SO,Tag>::~DynamicSparseMatrix()
+{
+   for( size_t k=0UL; k<capacity_; ++k ) {
+      deallocate( begin_[k] );
+   }
+   delete[] begin_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the accessed value at position (\a i,\a j). In case the
+// sparse matrix does not yet store an element at position (\a i,\a j) , a new element is
+// inserted into the sparse matrix. Note that this function only performs an index check in
+// case BLAZE_USER_ASSERT() is active. In contrast, the at() function is guaranteed to perform a
+// check of the given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::Reference
+   DynamicSparseMatrix<Type,SO,Tag>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::ConstReference
+   DynamicSparseMatrix<Type,SO,Tag>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end_[SO ? j : i] )
+      return zero_;
+   else
+      return pos->value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// This function returns a reference to the accessed value at position (\a i,\a j). In case the
+// sparse matrix does not yet store an element at position (\a i,\a j) , a new element is
+// inserted into the sparse matrix. In contrast to the function call operator this function
+// always performs a check of the given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::Reference
+   DynamicSparseMatrix<Type,SO,Tag>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::ConstReference
+   DynamicSparseMatrix<Type,SO,Tag>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::Iterator
+   DynamicSparseMatrix<Type,SO,Tag>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lists(), "Invalid sparse matrix row/column access index" );
+   return begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::ConstIterator
+   DynamicSparseMatrix<Type,SO,Tag>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lists(), "Invalid sparse matrix row/column access index" );
+   return begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::ConstIterator
+   DynamicSparseMatrix<Type,SO,Tag>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lists(), "Invalid sparse matrix row/column access index" );
+   return begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::Iterator
+   DynamicSparseMatrix<Type,SO,Tag>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lists(), "Invalid sparse matrix row/column access index" );
+   return end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::ConstIterator
+   DynamicSparseMatrix<Type,SO,Tag>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lists(), "Invalid sparse matrix row/column access index" );
+   return end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::ConstIterator
+   DynamicSparseMatrix<Type,SO,Tag>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lists(), "Invalid sparse matrix row/column access index" );
+   return end_[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+//
+// This assignment operator offers the option to directly assign to all elements of the matrix
+// by means of an initializer list:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::DynamicSparseMatrix<int,rowMajor> A;
+   A = { { 1, 2, 3 },
+         { 4, 5 },
+         { 7, 8, 9 } };
+   \endcode
+
+// The matrix is resized according to the given initializer list and all its elements are
+// assigned the values from the given initializer list. Missing values are considered to
+// be default values.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DynamicSparseMatrix<Type,SO,Tag>&
+   DynamicSparseMatrix<Type,SO,Tag>::operator=( initializer_list< initializer_list<Type> > list ) &
+{
+   resize( list.size(), determineColumns( list ), false );
+
+   size_t i( 0UL );
+
+   for( const auto& rowList : list )
+   {
+      size_t j( 0UL );
+
+      for( const Type& element : rowList ) {
+         if( !isDefault<strict>( element ) )
+            append( i, j, element );
+         ++j;
+      }
+
+      ++i;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for DynamicSparseMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+//
+// The sparse matrix is resized according to the given sparse matrix and initialized as a copy
+// of this matrix. The capacity of all rows/columns that are large enough to hold the copied
+// elements is reused.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DynamicSparseMatrix<Type,SO,Tag>&
+   DynamicSparseMatrix<Type,SO,Tag>::operator=( const DynamicSparseMatrix& rhs ) &
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.m_, rhs.n_, false );
+
+   for( size_t k=0UL; k<lists(); ++k ) {
+      reserve( k, rhs.nonZeros( k ) );
+      end_[k] = castDown( std::copy( rhs.begin_[k], rhs.end_[k], castUp( begin_[k] ) ) );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for DynamicSparseMatrix.
+//
+// \param rhs The sparse matrix to be moved into this instance.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DynamicSparseMatrix<Type,SO,Tag>&
+   DynamicSparseMatrix<Type,SO,Tag>::operator=( DynamicSparseMatrix&& rhs ) & noexcept
+{
+   for( size_t k=0UL; k<capacity_; ++k ) {
+      deallocate( begin_[k] );
+   }
+   delete[] begin_;
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   begin_    = rhs.begin_;
+   end_      = rhs.end_;
+   last_     = rhs.last_;
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.begin_    = nullptr;
+   rhs.end_      = nullptr;
+   rhs.last_     = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline DynamicSparseMatrix<Type,SO,Tag>&
+   DynamicSparseMatrix<Type,SO,Tag>::operator=( const DenseMatrix<MT,SO2>& rhs ) &
+{
+   using blaze::assign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).canAlias( this ) ) {
+      DynamicSparseMatrix tmp( *rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (*rhs).rows(), (*rhs).columns(), false );
+      assign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse matrices.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the right-hand side sparse matrix
+        , bool SO2 >      // Storage order of the right-hand side sparse matrix
+inline DynamicSparseMatrix<Type,SO,Tag>&
+   DynamicSparseMatrix<Type,SO,Tag>::operator=( const SparseMatrix<MT,SO2>& rhs ) &
+{
+   using blaze::assign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).canAlias( this ) ) {
+      DynamicSparseMatrix tmp( *rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (*rhs).rows(), (*rhs).columns(), false );
+
+      if( !IsZero_v<MT> ) {
+         assign( *this, *rhs );
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline DynamicSparseMatrix<Type,SO,Tag>&
+   DynamicSparseMatrix<Type,SO,Tag>::operator+=( const Matrix<MT,SO2>& rhs ) &
+{
+   using blaze::addAssign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).rows() != m_ || (*rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( !IsZero_v<MT> ) {
+      addAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline DynamicSparseMatrix<Type,SO,Tag>&
+   DynamicSparseMatrix<Type,SO,Tag>::operator-=( const Matrix<MT,SO2>& rhs ) &
+{
+   using blaze::subAssign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).rows() != m_ || (*rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( !IsZero_v<MT> ) {
+      subAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a dense matrix
+//        (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline DynamicSparseMatrix<Type,SO,Tag>&
+   DynamicSparseMatrix<Type,SO,Tag>::operator%=( const DenseMatrix<MT,SO2>& rhs ) &
+{
+   using blaze::schurAssign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).rows() != m_ || (*rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (*rhs).canAlias( this ) ) {
+      DynamicSparseMatrix tmp( *this % (*rhs) );
+      swap( tmp );
+   }
+   else {
+      CompositeType_t<MT> tmp( *rhs );
+      schurAssign( *this, tmp );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a sparse matrix
+//        (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the right-hand side sparse matrix
+        , bool SO2 >      // Storage order of the right-hand side sparse matrix
+inline DynamicSparseMatrix<Type,SO,Tag>&
+   DynamicSparseMatrix<Type,SO,Tag>::operator%=( const SparseMatrix<MT,SO2>& rhs ) &
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).rows() != m_ || (*rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( !IsZero_v<MT> ) {
+      DynamicSparseMatrix tmp( *this % (*rhs) );
+      swap( tmp );
+   }
+   else {
+      reset();
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DynamicSparseMatrix<Type,SO,Tag>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DynamicSparseMatrix<Type,SO,Tag>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+//
+// This function returns the sum of the capacities of all rows/columns.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DynamicSparseMatrix<Type,SO,Tag>::capacity() const noexcept
+{
+   size_t total( 0UL );
+
+   for( size_t k=0UL; k<lists(); ++k )
+      total += capacity( k );
+
+   return total;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DynamicSparseMatrix<Type,SO,Tag>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lists(), "Invalid row/column access index" );
+   return last_[i] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DynamicSparseMatrix<Type,SO,Tag>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<lists(); ++k )
+      nonzeros += nonZeros( k );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DynamicSparseMatrix<Type,SO,Tag>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lists(), "Invalid row/column access index" );
+   return end_[i] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// Note that the capacity of all rows/columns remains unchanged.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DynamicSparseMatrix<Type,SO,Tag>::reset()
+{
+   for( size_t k=0UL; k<lists(); ++k )
+      end_[k] = begin_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DynamicSparseMatrix<Type,SO,Tag>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lists(), "Invalid row/column access index" );
+   end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0 and all rows/columns have
+// been released.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DynamicSparseMatrix<Type,SO,Tag>::clear()
+{
+   resize( 0UL, 0UL, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the sparse matrix.
+//
+// \param m The new number of rows of the sparse matrix.
+// \param n The new number of columns of the sparse matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. Rows/columns
+// that are removed from the matrix are released, all new rows/columns are initially empty and
+// don't allocate any memory. The capacity of all remaining rows/columns is preserved. Note that
+// this function may invalidate all existing views (submatrices, rows, columns, ...) on the
+// matrix if it is used to shrink the matrix. Additionally, the resize operation potentially
+// changes all matrix elements. In order to preserve the old matrix values, the \a preserve flag
+// can be set to \a true.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+void DynamicSparseMatrix<Type,SO,Tag>::resize( size_t m, size_t n, bool preserve )
+{
+   const size_t oldLists( lists() );
+   const size_t newLists( SO ? n : m );
+   const size_t oldSize ( SO ? m_ : n_ );
+   const size_t newSize ( SO ? m : n );
+
+   if( m == m_ && n == n_ ) {
+      if( !preserve ) reset();
+      return;
+   }
+
+   // Releasing all rows/columns that are removed from the matrix
+   for( size_t k=newLists; k<oldLists; ++k ) {
+      deallocate( begin_[k] );
+      begin_[k] = end_[k] = last_[k] = nullptr;
+   }
+
+   // Extending the pointer arrays
+   if( newLists > capacity_ )
+   {
+      Iterator* newBegin( new Iterator[3UL*newLists] );
+      Iterator* newEnd  ( newBegin+newLists );
+      Iterator* newLast ( newEnd+newLists );
+
+      std::fill( newBegin, newBegin+3UL*newLists, nullptr );
+      std::copy( begin_, begin_+oldLists, newBegin );
+      std::copy( end_  , end_  +oldLists, newEnd   );
+      std::copy( last_ , last_ +oldLists, newLast  );
+
+      delete[] begin_;
+
+      begin_    = newBegin;
+      end_      = newEnd;
+      last_     = newLast;
+      capacity_ = newLists;
+   }
+
+   const size_t kend( min( oldLists, newLists ) );
+
+   if( !preserve ) {
+      for( size_t k=0UL; k<kend; ++k )
+         end_[k] = begin_[k];
+   }
+   else if( newSize < oldSize ) {
+      for( size_t k=0UL; k<kend; ++k ) {
+         end_[k] = std::lower_bound( begin_[k], end_[k], newSize,
+                                     []( const Element& element, size_t index )
+                                     {
+                                        return element.index() < index;
+                                     } );
+      }
+   }
+
+   m_ = m;
+   n_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeros The new minimum capacity of the sparse matrix.
+// \return void
+//
+// This function increases the capacity of the sparse matrix to at least \a nonzeros elements.
+// Since the elements are stored per row/column, the requested capacity is distributed evenly
+// among all rows/columns, i.e. every row/column is guaranteed to provide at least
+// \f$ \lceil nonzeros / M \rceil \f$ (row-major) or \f$ \lceil nonzeros / N \rceil \f$
+// (column-major) elements. The current values of the matrix and the capacity of the individual
+// rows/columns are preserved. In order to reserve capacity for a specific row/column, the
+// reserve() function for individual rows/columns should be preferred.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DynamicSparseMatrix<Type,SO,Tag>::reserve( size_t nonzeros )
+{
+   if( lists() == 0UL || nonzeros <= capacity() )
+      return;
+
+   const size_t share( ( nonzeros + lists() - 1UL ) / lists() );
+
+   for( size_t k=0UL; k<lists(); ++k )
+      reserve( k, share );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the sparse matrix.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+//
+// This function increases the capacity of row/column \a i of the sparse matrix to at least
+// \a nonzeros elements. The current values of the sparse matrix and all other individual
+// row/column capacities are preserved. In case the storage order is set to \a rowMajor, the
+// function reserves capacity for row \a i and the index has to be in the range \f$[0..M-1]\f$.
+// In case the storage order is set to \a columnMajor, the function reserves capacity for
+// column \a i and the index has to be in the range \f$[0..N-1]\f$.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DynamicSparseMatrix<Type,SO,Tag>::reserve( size_t i, size_t nonzeros )
+{
+   BLAZE_USER_ASSERT( i < lists(), "Invalid row/column access index" );
+
+   if( nonzeros > capacity( i ) )
+      reserveElements( i, nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+//
+// The trim() function can be used to reverse the effect of all row/column-specific reserve()
+// calls and of the geometric growth of the rows/columns. The function removes all excessive
+// capacity from all rows (in case of a rowMajor matrix) or columns (in case of a columnMajor
+// matrix). Note that this function does not remove the overall capacity but only reallocates
+// the individual rows/columns that have free capacity left.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DynamicSparseMatrix<Type,SO,Tag>::trim()
+{
+   for( size_t k=0UL; k<lists(); ++k )
+      trim( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity of a specific row/column of the sparse matrix.
+//
+// \param i The index of the row/column to be trimmed (\f$[0..M-1]\f$ or \f$[0..N-1]\f$).
+// \return void
+//
+// This function can be used to reverse the effect of a row/column-specific reserve() call and
+// of the geometric growth of the row/column. It removes all excessive capacity from the
+// specified row (in case of a rowMajor matrix) or column (in case of a columnMajor matrix).
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DynamicSparseMatrix<Type,SO,Tag>::trim( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lists(), "Invalid row/column access index" );
+
+   if( end_[i] != last_[i] )
+      reserveElements( i, nonZeros( i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+//
+// This function minimizes the capacity of the matrix by removing unused capacity from all
+// rows/columns. Please note that in case a reallocation occurs, all iterators (including end()
+// iterators), all pointers and references to elements of the matrix are invalidated.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DynamicSparseMatrix<Type,SO,Tag>::shrinkToFit()
+{
+   trim();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DynamicSparseMatrix<Type,SO,Tag>::swap( DynamicSparseMatrix& sm ) noexcept
+{
+   using std::swap;
+
+   swap( m_, sm.m_ );
+   swap( n_, sm.n_ );
+   swap( capacity_, sm.capacity_ );
+   swap( begin_, sm.begin_ );
+   swap( end_  , sm.end_   );
+   swap( last_ , sm.last_  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the sparse matrix.
+//
+// \return The number of rows (row-major) or columns (column-major) of the sparse matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DynamicSparseMatrix<Type,SO,Tag>::lists() const noexcept
+{
+   return ( SO ? n_ : m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating a new capacity for the given row/column of the sparse matrix.
+//
+// \param k The index of the row/column.
+// \return The new row/column capacity.
+//
+// This function calculates a new capacity for the given row/column based on the current
+// capacity. The capacity grows geometrically in order to provide an amortized constant cost
+// for the insertion of new elements.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DynamicSparseMatrix<Type,SO,Tag>::extendCapacity( size_t k ) const noexcept
+{
+   size_t nonzeros( 2UL*capacity( k ) );
+   nonzeros = blaze::max( nonzeros, 4UL );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity( k ), "Invalid capacity value" );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reallocating the given row/column of the sparse matrix.
+//
+// \param k The index of the row/column.
+// \param nonzeros The new capacity of the row/column.
+// \return void
+//
+// This function reallocates row/column \a k with exactly the given capacity. The capacity is
+// required to be larger than or equal to the current number of non-zero elements of the
+// row/column. In case the capacity is 0, the memory of the row/column is released.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+void DynamicSparseMatrix<Type,SO,Tag>::reserveElements( size_t k, size_t nonzeros )
+{
+   BLAZE_INTERNAL_ASSERT( k < lists(), "Invalid row/column access index" );
+   BLAZE_INTERNAL_ASSERT( nonzeros >= nonZeros( k ), "Invalid capacity value" );
+
+   Iterator newBegin( nullptr );
+   Iterator newEnd  ( nullptr );
+
+   if( nonzeros > 0UL ) {
+      newBegin = allocate<Element>( nonzeros );
+      newEnd   = castDown( std::move( castUp( begin_[k] ), castUp( end_[k] ), castUp( newBegin ) ) );
+   }
+
+   deallocate( begin_[k] );
+
+   begin_[k] = newBegin;
+   end_  [k] = newEnd;
+   last_ [k] = newBegin + nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a down-cast of the given iterator.
+//
+// \return The casted iterator.
+//
+// This function performs a down-cast of the given iterator to base elements to an iterator to
+// derived elements.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::Iterator
+   DynamicSparseMatrix<Type,SO,Tag>::castDown( IteratorBase it ) const noexcept
+{
+   return static_cast<Iterator>( it );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs an up-cast of the given iterator.
+//
+// \return The casted iterator.
+//
+// This function performs an up-cast of the given iterator to derived elements to an iterator
+// to base elements.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::IteratorBase
+   DynamicSparseMatrix<Type,SO,Tag>::castUp( Iterator it ) const noexcept
+{
+   return static_cast<IteratorBase>( it );
+}
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting an element of the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the sparse matrix. In case the sparse matrix
+// already contains an element with row index \a i and column index \a j its value is modified,
+// else a new element with the given \a value is inserted. The insertion only affects row \a i
+// (in case of a row-major matrix) or column \a j (in case of a column-major matrix).
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::Iterator
+   DynamicSparseMatrix<Type,SO,Tag>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k    ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end_[k] && pos->index_ == index ) {
+       pos->value() = value;
+       return pos;
+   }
+   else return insert( pos, k, index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid sparse matrix access index.
+//
+// This function inserts a new element into the sparse matrix. However, duplicate elements are
+// not allowed. In case the sparse matrix already contains an element with row index \a i and
+// column index \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::Iterator
+   DynamicSparseMatrix<Type,SO,Tag>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k    ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end_[k] && pos->index_ == index ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   return insert( pos, k, index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the sparse matrix.
+//
+// \param pos The position of the new element.
+// \param k The index of the row/column of the new element.
+// \param index The index of the new element within the row/column.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+//
+// In case row/column \a k has no free capacity left, only this row/column is reallocated with
+// a geometrically increased capacity. All other rows/columns remain unaffected.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+typename DynamicSparseMatrix<Type,SO,Tag>::Iterator
+   DynamicSparseMatrix<Type,SO,Tag>::insert( Iterator pos, size_t k, size_t index, const Type& value )
+{
+   if( end_[k] != last_[k] ) {
+      std::move_backward( castUp( pos ), castUp( end_[k] ), castUp( end_[k]+1UL ) );
+      pos->value_ = value;
+      pos->index_ = index;
+      ++end_[k];
+
+      return pos;
+   }
+   else {
+      const size_t newCapacity( extendCapacity( k ) );
+
+      Iterator newBegin( allocate<Element>( newCapacity ) );
+
+      Iterator tmp = castDown( std::move( castUp( begin_[k] ), castUp( pos ), castUp( newBegin ) ) );
+      tmp->value_ = value;
+      tmp->index_ = index;
+      Iterator newEnd = castDown( std::move( castUp( pos ), castUp( end_[k] ), castUp( tmp+1UL ) ) );
+
+      deallocate( begin_[k] );
+
+      begin_[k] = newBegin;
+      end_  [k] = newEnd;
+      last_ [k] = newBegin + newCapacity;
+
+      return tmp;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row/column of the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a sparse matrix with elements. It appends
+// a new element to the end of the specified row/column. In contrast to CompressedMatrix the
+// row/column is automatically extended in case its capacity is exhausted. However, it is still
+// necessary that the index of the new element is strictly larger than the largest index of
+// non-zero elements in the specified row/column of the sparse matrix. Ignoring this
+// precondition results in undefined behavior! The optional \a check parameter specifies
+// whether the new value should be tested for a default value. If the new value is a default
+// value (for instance 0 in case of an integral element type) the value is not appended. Per
+// default the values are not tested.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DynamicSparseMatrix<Type,SO,Tag>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   const size_t k    ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   BLAZE_USER_ASSERT( begin_[k] == end_[k] || index > ( end_[k]-1UL )->index_, "Index is not strictly increasing" );
+
+   if( check && isDefault<strict>( value ) )
+      return;
+
+   if( end_[k] == last_[k] )
+      reserveElements( k, extendCapacity( k ) );
+
+   end_[k]->value_ = value;
+   end_[k]->index_ = index;
+   ++end_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row/column.
+//
+// \param i The index of the row/column to be finalized \f$[0..M-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// Since all rows/columns of a DynamicSparseMatrix are stored independently of each other, the
+// function has no effect and is provided for compatibility with CompressedMatrix only.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DynamicSparseMatrix<Type,SO,Tag>::finalize( size_t i )
+{
+   MAYBE_UNUSED( i );
+
+   BLAZE_USER_ASSERT( i < lists(), "Invalid row/column access index" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERASE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function erases an element from the sparse matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DynamicSparseMatrix<Type,SO,Tag>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+
+   const Iterator pos( find( i, j ) );
+   if( pos != end_[k] )
+      end_[k] = castDown( std::move( castUp( pos+1 ), castUp( end_[k] ), castUp( pos ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row/column index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases an element from the sparse matrix. In case the storage order is set
+// to \a rowMajor the function erases an element from row \a i, in case the storage flag is set
+// to \a columnMajor the function erases an element from column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::Iterator
+   DynamicSparseMatrix<Type,SO,Tag>::erase( size_t i, Iterator pos )
+{
+   BLAZE_USER_ASSERT( i < lists(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( pos >= begin_[i] && pos <= end_[i], "Invalid sparse matrix iterator" );
+
+   if( pos != end_[i] )
+      end_[i] = castDown( std::move( castUp( pos+1 ), castUp( end_[i] ), castUp( pos ) ) );
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the sparse matrix.
+//
+// \param i The row/column index of the elements to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases a range of elements from the sparse matrix. In case the storage order
+// is set to \a rowMajor the function erases a range of elements from row \a i, in case the storage
+// flag is set to \a columnMajor the function erases a range of elements from column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::Iterator
+   DynamicSparseMatrix<Type,SO,Tag>::erase( size_t i, Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( i < lists()  , "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"          );
+   BLAZE_USER_ASSERT( first >= begin_[i] && first <= end_[i], "Invalid sparse matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin_[i] && last  <= end_[i], "Invalid sparse matrix iterator" );
+
+   if( first != last )
+      end_[i] = castDown( std::move( castUp( last ), castUp( end_[i] ), castUp( first ) ) );
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing specific elements from the sparse matrix.
+//
+// \param predicate The unary predicate for the element selection.
+// \return void.
+//
+// This function erases specific elements from the sparse matrix. The elements are selected
+// by the given unary predicate \a predicate, which is expected to accept a single argument of
+// the type of the elements and to be pure. The following example demonstrates how to remove
+// all elements that are smaller than a certain threshold value:
+
+   \code
+   blaze::DynamicSparseMatrix<double,blaze::rowMajor> A;
+   // ... Resizing and initialization
+
+   A.erase( []( double value ){ return value < 1E-8; } );
+   \endcode
+
+// \note The predicate is required to be pure, i.e. to produce deterministic results for elements
+// with the same value. The attempt to use an impure predicate leads to undefined behavior!
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO          // Storage order
+        , typename Tag >   // Type tag
+template< typename Pred >  // Type of the unary predicate
+inline void DynamicSparseMatrix<Type,SO,Tag>::erase( Pred predicate )
+{
+   for( size_t k=0UL; k<lists(); ++k ) {
+      end_[k] = castDown( std::remove_if( castUp( begin_[k] ), castUp( end_[k] ),
+                                          [predicate=predicate]( const ElementBase& element) {
+                                             return predicate( element.value() );
+                                          } ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing specific elements from a range of the sparse matrix.
+//
+// \param i The row/column index of the elements to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param first Iterator to first element of the range.
+// \param last Iterator just past the last element of the range.
+// \param predicate The unary predicate for the element selection.
+// \return void
+//
+// This function erases specific elements from a range of elements of the sparse matrix. The
+// elements are selected by the given unary predicate \a predicate, which is expected to accept
+// a single argument of the type of the elements and to be pure. In case the storage order is
+// set to \a rowMajor the function erases a range of elements from row \a i, in case the storage
+// flag is set to \a columnMajor the function erases a range of elements from column \a i.
+//
+// \note The predicate is required to be pure, i.e. to produce deterministic results for elements
+// with the same value. The attempt to use an impure predicate leads to undefined behavior!
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO          // Storage order
+        , typename Tag >   // Type tag
+template< typename Pred >  // Type of the unary predicate
+inline void DynamicSparseMatrix<Type,SO,Tag>::erase( size_t i, Iterator first, Iterator last, Pred predicate )
+{
+   BLAZE_USER_ASSERT( i < lists()  , "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"          );
+   BLAZE_USER_ASSERT( first >= begin_[i] && first <= end_[i], "Invalid sparse matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin_[i] && last  <= end_[i], "Invalid sparse matrix iterator" );
+
+   const auto pos = std::remove_if( castUp( first ), castUp( last ),
+                                    [predicate=predicate]( const ElementBase& element ) {
+                                       return predicate( element.value() );
+                                    } );
+
+   end_[i] = castDown( std::move( castUp( last ), castUp( end_[i] ), pos ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned sparse matrix iterator is subject to
+// invalidation due to inserting operations via the function call operator, the set() function
+// or the insert() function!
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::Iterator
+   DynamicSparseMatrix<Type,SO,Tag>::find( size_t i, size_t j )
+{
+   return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned sparse matrix iterator is subject to
+// invalidation due to inserting operations via the function call operator, the set() function
+// or the insert() function!
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::ConstIterator
+   DynamicSparseMatrix<Type,SO,Tag>::find( size_t i, size_t j ) const
+{
+   const size_t k( SO ? j : i );
+
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end_[k] && pos->index_ == ( SO ? i : j ) )
+      return pos;
+   else return end_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less than the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less than the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned sparse matrix iterator
+// is subject to invalidation due to inserting operations via the function call operator, the
+// set() function or the insert() function!
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::Iterator
+   DynamicSparseMatrix<Type,SO,Tag>::lowerBound( size_t i, size_t j )
+{
+   return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less than the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less than the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned sparse matrix iterator
+// is subject to invalidation due to inserting operations via the function call operator, the
+// set() function or the insert() function!
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::ConstIterator
+   DynamicSparseMatrix<Type,SO,Tag>::lowerBound( size_t i, size_t j ) const
+{
+   const size_t k( SO ? j : i );
+
+   BLAZE_USER_ASSERT( k < lists(), "Invalid row/column access index" );
+
+   return std::lower_bound( begin_[k], end_[k], ( SO ? i : j ),
+                            []( const Element& element, size_t index )
+                            {
+                               return element.index() < index;
+                            } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater than the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater than the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned sparse matrix iterator
+// is subject to invalidation due to inserting operations via the function call operator, the
+// set() function or the insert() function!
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::Iterator
+   DynamicSparseMatrix<Type,SO,Tag>::upperBound( size_t i, size_t j )
+{
+   return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater than the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater than the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned sparse matrix iterator
+// is subject to invalidation due to inserting operations via the function call operator, the
+// set() function or the insert() function!
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename DynamicSparseMatrix<Type,SO,Tag>::ConstIterator
+   DynamicSparseMatrix<Type,SO,Tag>::upperBound( size_t i, size_t j ) const
+{
+   const size_t k( SO ? j : i );
+
+   BLAZE_USER_ASSERT( k < lists(), "Invalid row/column access index" );
+
+   return std::upper_bound( begin_[k], end_[k], ( SO ? i : j ),
+                            []( size_t index, const Element& element )
+                            {
+                               return index < element.index();
+                            } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DynamicSparseMatrix<Type,SO,Tag>& DynamicSparseMatrix<Type,SO,Tag>::transpose()
+{
+   DynamicSparseMatrix tmp( trans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DynamicSparseMatrix<Type,SO,Tag>& DynamicSparseMatrix<Type,SO,Tag>::ctranspose()
+{
+   DynamicSparseMatrix tmp( ctrans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the sparse matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the sparse matrix.
+//
+// This function scales the matrix by applying the given scalar value \a scalar to each element
+// of the matrix. For built-in and \c complex data types it has the same effect as using the
+// multiplication assignment operator:
+
+   \code
+   blaze::DynamicSparseMatrix<int> A;
+   // ... Resizing and initialization
+   A *= 4;        // Scaling of the matrix
+   A.scale( 4 );  // Same effect as above
+   \endcode
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the scalar value
+inline DynamicSparseMatrix<Type,SO,Tag>& DynamicSparseMatrix<Type,SO,Tag>::scale( const Other& scalar )
+{
+   for( size_t k=0UL; k<lists(); ++k )
+      for( auto element=begin_[k]; element!=end_[k]; ++element )
+         element->value_ *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion of the sparse matrix into a tight CompressedMatrix.
+//
+// \return The compressed representation of the sparse matrix.
+//
+// This function converts the sparse matrix into a CompressedMatrix with the same storage order,
+// which stores all non-zero elements in a single contiguous array without any free capacity.
+// The compressed representation is the preferable operand in case the matrix is used for many
+// computations without further modification (as for instance in an iterative solver):
+
+   \code
+   blaze::DynamicSparseMatrix<double,blaze::rowMajor> A( 10000UL, 10000UL );
+   // ... Incremental assembly of the matrix
+
+   const blaze::CompressedMatrix<double,blaze::rowMajor> B( A.compact() );
+   \endcode
+
+// In case SMP parallelization is enabled, the rows/columns are copied in parallel. For that
+// purpose, the rows/columns are distributed among the threads such that all threads copy
+// approximately the same number of non-zero elements.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+typename DynamicSparseMatrix<Type,SO,Tag>::CompactType
+   DynamicSparseMatrix<Type,SO,Tag>::compact() const
+{
+   const size_t N( lists() );
+
+   std::vector<size_t> nonzeros( N );
+   size_t total( 0UL );
+
+   for( size_t k=0UL; k<N; ++k ) {
+      nonzeros[k] = nonZeros( k );
+      total += nonzeros[k];
+   }
+
+   CompactType tmp( m_, n_, nonzeros );
+
+   const auto copy = [&]( size_t kbegin, size_t kend )
+   {
+      for( size_t k=kbegin; k<kend; ++k ) {
+         for( auto element=begin_[k]; element!=end_[k]; ++element ) {
+            tmp.append( ( SO ? element->index_ : k ), ( SO ? k : element->index_ ), element->value_ );
+         }
+      }
+   };
+
+   const size_t threads( min( getNumThreads(), max( N, 1UL ) ) );
+
+   if( threads == 1UL || isSerialSectionActive() || isParallelSectionActive() ) {
+      copy( 0UL, N );
+   }
+   else BLAZE_PARALLEL_SECTION
+   {
+      // Distributing the rows/columns such that all threads copy the same number of elements
+      SmallArray<size_t,64UL> bounds( threads+1UL, N );
+      bounds[0UL] = 0UL;
+
+      const size_t share( total / threads + 1UL );
+      size_t k( 0UL ), count( 0UL );
+
+      for( size_t t=1UL; t<threads; ++t ) {
+         while( k < N && count < t*share ) {
+            count += nonzeros[k];
+            ++k;
+         }
+         bounds[t] = k;
+      }
+
+      smpFor( threads, [&]( size_t t )
+      {
+         copy( bounds[t], bounds[t+1UL] );
+      } );
+   }
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the foreign expression
+inline bool DynamicSparseMatrix<Type,SO,Tag>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the foreign expression
+inline bool DynamicSparseMatrix<Type,SO,Tag>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline bool DynamicSparseMatrix<Type,SO,Tag>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline void DynamicSparseMatrix<Type,SO,Tag>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   constexpr bool leading ( SO ? IsLower_v<MT> : IsUpper_v<MT> );
+   constexpr bool trailing( SO ? IsUpper_v<MT> : IsLower_v<MT> );
+   constexpr bool strictlyLeading ( SO ? IsStrictlyLower_v<MT> : IsStrictlyUpper_v<MT> );
+   constexpr bool strictlyTrailing( SO ? IsStrictlyUpper_v<MT> : IsStrictlyLower_v<MT> );
+
+   const size_t size( SO ? m_ : n_ );
+
+   for( size_t k=0UL; k<lists(); ++k )
+   {
+      end_[k] = begin_[k];
+
+      const size_t ibegin( ( leading )
+                           ?( strictlyLeading ? k+1UL : k )
+                           :( 0UL ) );
+      const size_t iend  ( ( trailing )
+                           ?( strictlyTrailing ? k : k+1UL )
+                           :( size ) );
+
+      for( size_t index=ibegin; index<iend; ++index )
+      {
+         if( end_[k] == last_[k] )
+            reserveElements( k, extendCapacity( k ) );
+
+         end_[k]->value_ = ( SO ? (*rhs)(index,k) : (*rhs)(k,index) );
+
+         if( !isDefault<strict>( end_[k]->value_ ) ) {
+            end_[k]->index_ = index;
+            ++end_[k];
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with the same storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT >   // Type of the right-hand side sparse matrix
+inline void DynamicSparseMatrix<Type,SO,Tag>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+
+   for( size_t k=0UL; k<lists(); ++k )
+   {
+      reserve( k, (*rhs).nonZeros( k ) );
+
+      for( auto element=(*rhs).begin(k); element!=(*rhs).end(k); ++element )
+      {
+         if( end_[k] == last_[k] )
+            reserveElements( k, extendCapacity( k ) );
+
+         end_[k]->value_ = element->value();
+         end_[k]->index_ = element->index();
+         ++end_[k];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with opposite storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT >   // Type of the right-hand side sparse matrix
+inline void DynamicSparseMatrix<Type,SO,Tag>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+
+   const size_t size( SO ? m_ : n_ );
+
+   // Counting the number of elements per row/column
+   std::vector<size_t> lengths( lists(), 0UL );
+   for( size_t l=0UL; l<size; ++l ) {
+      for( auto element=(*rhs).begin(l); element!=(*rhs).end(l); ++element )
+         ++lengths[element->index()];
+   }
+
+   // Reserving the exact capacity of all rows/columns
+   for( size_t k=0UL; k<lists(); ++k ) {
+      reserve( k, lengths[k] );
+   }
+
+   // Appending the elements to the rows/columns of the sparse matrix
+   for( size_t l=0UL; l<size; ++l ) {
+      for( auto element=(*rhs).begin(l); element!=(*rhs).end(l); ++element ) {
+         const size_t k( element->index() );
+         end_[k]->value_ = element->value();
+         end_[k]->index_ = l;
+         ++end_[k];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline void DynamicSparseMatrix<Type,SO,Tag>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   DynamicSparseMatrix tmp( serial( *this + (*rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the right-hand side sparse matrix
+        , bool SO2 >      // Storage order of the right-hand side sparse matrix
+inline void DynamicSparseMatrix<Type,SO,Tag>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   DynamicSparseMatrix tmp( serial( *this + (*rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline void DynamicSparseMatrix<Type,SO,Tag>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   DynamicSparseMatrix tmp( serial( *this - (*rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the right-hand side sparse matrix
+        , bool SO2 >      // Storage order of the right-hand sparse matrix
+inline void DynamicSparseMatrix<Type,SO,Tag>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   DynamicSparseMatrix tmp( serial( *this - (*rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline void DynamicSparseMatrix<Type,SO,Tag>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( MT );
+
+   for( size_t k=0UL; k<lists(); ++k ) {
+      for( auto element=begin_[k]; element!=end_[k]; ++element )
+         element->value_ *= ( SO ? (*rhs)(element->index_,k) : (*rhs)(k,element->index_) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  DYNAMICSPARSEMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DynamicSparseMatrix operators */
+//@{
+template< RelaxationFlag RF, typename Type, bool SO, typename Tag >
+bool isDefault( const DynamicSparseMatrix<Type,SO,Tag>& m );
+
+template< typename Type, bool SO, typename Tag >
+bool isIntact( const DynamicSparseMatrix<Type,SO,Tag>& m );
+
+template< typename Type, bool SO, typename Tag >
+void swap( DynamicSparseMatrix<Type,SO,Tag>& a, DynamicSparseMatrix<Type,SO,Tag>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given dynamic sparse matrix is in default state.
+// \ingroup dynamic_sparse_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the dynamic sparse matrix is in default (constructed) state,
+// i.e. if it's number of rows and columns is 0. In case it is in default state, the function
+// returns \a true, else it will return \a false. The following example demonstrates the use
+// of the \a isDefault() function:
+
+   \code
+   blaze::DynamicSparseMatrix<int> A;
+   // ... Resizing and initialization
+   if( isDefault( A ) ) { ... }
+   \endcode
+
+// Optionally, it is possible to switch between strict semantics (blaze::strict) and relaxed
+// semantics (blaze::relaxed):
+
+   \code
+   if( isDefault<relaxed>( A ) ) { ... }
+   \endcode
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename Type      // Data type of the matrix
+        , bool SO            // Storage order
+        , typename Tag >     // Type tag
+inline bool isDefault( const DynamicSparseMatrix<Type,SO,Tag>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given dynamic sparse matrix are intact.
+// \ingroup dynamic_sparse_matrix
+//
+// \param m The dynamic sparse matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the dynamic sparse matrix are intact, i.e. if
+// its state is valid. In case the invariants are intact, the function returns \a true, else
+// it will return \a false. The following example demonstrates the use of the \a isIntact()
+// function:
+
+   \code
+   blaze::DynamicSparseMatrix<int> A;
+   // ... Resizing and initialization
+   if( isIntact( A ) ) { ... }
+   \endcode
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline bool isIntact( const DynamicSparseMatrix<Type,SO,Tag>& m )
+{
+   const size_t lists( SO ? m.columns() : m.rows() );
+
+   for( size_t k=0UL; k<lists; ++k ) {
+      if( m.nonZeros( k ) > m.capacity( k ) )
+         return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two dynamic sparse matrices.
+// \ingroup dynamic_sparse_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void swap( DynamicSparseMatrix<Type,SO,Tag>& a, DynamicSparseMatrix<Type,SO,Tag>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HIGHTYPE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename Tag, typename T2 >
+struct HighType< DynamicSparseMatrix<T1,SO,Tag>, DynamicSparseMatrix<T2,SO,Tag> >
+{
+   using Type = DynamicSparseMatrix< typename HighType<T1,T2>::Type, SO, Tag >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOWTYPE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename Tag, typename T2 >
+struct LowType< DynamicSparseMatrix<T1,SO,Tag>, DynamicSparseMatrix<T2,SO,Tag> >
+{
+   using Type = DynamicSparseMatrix< typename LowType<T1,T2>::Type, SO, Tag >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -63,11 +63,30 @@ template< typename Type                  // Data type of the matrix
         , typename Tag = Group0 >        // Type tag
 class CompressedMatrix;
 
+template< typename Type                  // Data type of the matrix
+        , bool SO = defaultStorageOrder  // Storage order
+        , typename Tag = Group0 >        // Type tag
+class DeltaCompressedMatrix;
+
+template< typename Type                  // Data type of the matrix
+        , bool SO = defaultStorageOrder  // Storage order
+        , typename Tag = Group0 >        // Type tag
+class DynamicSparseMatrix;
+
 template< typename Type                  // Data type of the matrix
         , bool SO = defaultStorageOrder  // Storage order
         , typename Tag = Group0 >        // Type tag
 class IdentityMatrix;
 
+template< typename Type            // Data type of the matrix
+        , typename Tag = Group0 >  // Type tag
+class PermutationMatrix;
+
+template< typename Type                  // Data type of the matrix
+        , bool SO = defaultStorageOrder  // Storage order
+        , typename Tag = Group0 >        // Type tag
+class SymmetricCompressedMatrix;
+
 template< typename Type                   // Data type of the vector
         , bool TF = defaultTransposeFlag  // Transpose flag
         , typename Tag = Group0 >         // Type tag
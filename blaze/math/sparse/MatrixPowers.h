@@ -0,0 +1,905 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/MatrixPowers.h
+//  \brief Header file for the communication-avoiding sparse matrix powers kernel
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_MATRIXPOWERS_H_
+#define _BLAZE_MATH_SPARSE_MATRIXPOWERS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/SmallArray.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS KRYLOVBASIS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Coefficients of the polynomial basis of a matrix powers kernel.
+// \ingroup sparse_matrix
+//
+// The KrylovBasis class template represents the coefficients of a polynomial basis of the Krylov
+// subspace \f$ \mathcal{K}_{s+1}(A,\vec{x}) \f$ as computed by the matrixPowers() function. The
+// basis vectors are defined by the three-term recurrence
+
+      \f[ \vec{v}_0 = \vec{x}, \qquad
+          \vec{v}_{k+1} = \frac{1}{\gamma_k} \left( (A - \alpha_k I) \vec{v}_k
+                                                    - \beta_k \vec{v}_{k-1} \right), \f]
+
+// where \f$ \beta_0 \f$ is ignored. The number of coefficients determines the number \a s of
+// matrix-vector products. The following bases can be created by means of the according
+// functions:
+
+   \code
+   using blaze::KrylovBasis;
+
+   KrylovBasis<double> monomial ( blaze::monomialBasis<double>( 8UL ) );       // A^k x
+   KrylovBasis<double> newton   ( blaze::newtonBasis( shifts ) );              // (A-theta_k I) v_k
+   KrylovBasis<double> chebyshev( blaze::chebyshevBasis( 0.1, 10.0, 8UL ) );  // T_k(A) x
+   \endcode
+
+// Whereas the monomial basis quickly becomes numerically linearly dependent, the Newton basis
+// (with Leja ordered Ritz values as shifts) and the Chebyshev basis (scaled to an interval
+// containing the spectrum of \a A) provide well-conditioned bases for s-step Krylov methods and
+// polynomial preconditioners.
+*/
+template< typename Type >  // Data type of the coefficients
+class KrylovBasis
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline KrylovBasis( std::vector<Type> alpha, std::vector<Type> beta, std::vector<Type> gamma );
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline size_t      size () const noexcept;
+   inline const Type& alpha( size_t k ) const noexcept;
+   inline const Type& beta ( size_t k ) const noexcept;
+   inline const Type& gamma( size_t k ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<Type> alpha_;  //!< The shifts of the recurrence.
+   std::vector<Type> beta_;   //!< The coefficients of the second to last basis vector.
+   std::vector<Type> gamma_;  //!< The scaling factors of the recurrence.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a polynomial basis with the given recurrence coefficients.
+//
+// \param alpha The shifts \f$ \alpha_k \f$ of the recurrence.
+// \param beta The coefficients \f$ \beta_k \f$ of the second to last basis vector.
+// \param gamma The (non-zero) scaling factors \f$ \gamma_k \f$ of the recurrence.
+// \exception std::invalid_argument Invalid basis coefficients.
+//
+// In case the three coefficient vectors have different sizes or any of the scaling factors is
+// zero, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the coefficients
+inline KrylovBasis<Type>::KrylovBasis( std::vector<Type> alpha, std::vector<Type> beta,
+                                       std::vector<Type> gamma )
+   : alpha_( std::move( alpha ) )  // The shifts of the recurrence
+   , beta_ ( std::move( beta  ) )  // The coefficients of the second to last basis vector
+   , gamma_( std::move( gamma ) )  // The scaling factors of the recurrence
+{
+   if( alpha_.size() != beta_.size() || alpha_.size() != gamma_.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid basis coefficients" );
+   }
+
+   for( const Type& g : gamma_ ) {
+      if( isDefault<strict>( g ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid basis coefficients" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of matrix-vector products of the basis.
+//
+// \return The number of recurrence steps \a s.
+*/
+template< typename Type >  // Data type of the coefficients
+inline size_t KrylovBasis<Type>::size() const noexcept
+{
+   return alpha_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the shift of the \a k-th recurrence step.
+//
+// \param k The index of the recurrence step. The index has to be in the range \f$[0..s-1]\f$.
+// \return The shift \f$ \alpha_k \f$.
+*/
+template< typename Type >  // Data type of the coefficients
+inline const Type& KrylovBasis<Type>::alpha( size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < size(), "Invalid recurrence step" );
+   return alpha_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the coefficient of the second to last basis vector of the \a k-th step.
+//
+// \param k The index of the recurrence step. The index has to be in the range \f$[0..s-1]\f$.
+// \return The coefficient \f$ \beta_k \f$.
+*/
+template< typename Type >  // Data type of the coefficients
+inline const Type& KrylovBasis<Type>::beta( size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < size(), "Invalid recurrence step" );
+   return beta_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the scaling factor of the \a k-th recurrence step.
+//
+// \param k The index of the recurrence step. The index has to be in the range \f$[0..s-1]\f$.
+// \return The scaling factor \f$ \gamma_k \f$.
+*/
+template< typename Type >  // Data type of the coefficients
+inline const Type& KrylovBasis<Type>::gamma( size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < size(), "Invalid recurrence step" );
+   return gamma_[k];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KRYLOVBASIS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name KrylovBasis functions */
+//@{
+template< typename Type >
+KrylovBasis<Type> monomialBasis( size_t s );
+
+template< typename Type >
+KrylovBasis<Type> newtonBasis( const std::vector<Type>& shifts );
+
+template< typename Type >
+KrylovBasis<Type> chebyshevBasis( Type lower, Type upper, size_t s );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the monomial basis \f$ \vec{x}, A\vec{x}, \ldots, A^s\vec{x} \f$.
+// \ingroup sparse_matrix
+//
+// \param s The number of matrix-vector products.
+// \return The monomial basis.
+*/
+template< typename Type >  // Data type of the coefficients
+inline KrylovBasis<Type> monomialBasis( size_t s )
+{
+   return KrylovBasis<Type>( std::vector<Type>( s, Type(0) ), std::vector<Type>( s, Type(0) ),
+                             std::vector<Type>( s, Type(1) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the Newton basis for the given shifts.
+// \ingroup sparse_matrix
+//
+// \param shifts The shifts \f$ \theta_k \f$ of the Newton basis.
+// \return The Newton basis.
+//
+// This function creates the Newton basis \f$ \vec{v}_{k+1} = (A - \theta_k I) \vec{v}_k \f$.
+// The number of matrix-vector products corresponds to the number of given shifts. Typically
+// the shifts are Leja ordered Ritz values of \a A.
+*/
+template< typename Type >  // Data type of the coefficients
+inline KrylovBasis<Type> newtonBasis( const std::vector<Type>& shifts )
+{
+   const size_t s( shifts.size() );
+
+   return KrylovBasis<Type>( shifts, std::vector<Type>( s, Type(0) ),
+                             std::vector<Type>( s, Type(1) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the Chebyshev basis for the given interval.
+// \ingroup sparse_matrix
+//
+// \param lower The lower bound of the interval.
+// \param upper The upper bound of the interval.
+// \param s The number of matrix-vector products.
+// \return The Chebyshev basis.
+// \exception std::invalid_argument Invalid Chebyshev interval.
+//
+// This function creates the basis \f$ \vec{v}_k = T_k( (A - cI) / d ) \vec{x} \f$ of Chebyshev
+// polynomials of the first kind, which are scaled and shifted to the interval \f$ [l..u] \f$
+// (\f$ c = (u+l)/2 \f$, \f$ d = (u-l)/2 \f$). In case \a upper is not larger than \a lower, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the coefficients
+inline KrylovBasis<Type> chebyshevBasis( Type lower, Type upper, size_t s )
+{
+   if( !( lower < upper ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid Chebyshev interval" );
+   }
+
+   const Type center( ( upper + lower ) / Type(2) );
+   const Type width ( ( upper - lower ) / Type(2) );
+
+   std::vector<Type> beta ( s, width / Type(2) );
+   std::vector<Type> gamma( s, width / Type(2) );
+
+   if( s > 0UL ) {
+      beta [0] = Type(0);
+      gamma[0] = width;
+   }
+
+   return KrylovBasis<Type>( std::vector<Type>( s, center ), std::move( beta ),
+                             std::move( gamma ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX POWERS KERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Matrix powers functions */
+//@{
+template< typename MT1, bool SO1, typename VT, typename MT2, bool SO2 >
+void matrixPowers( const SparseMatrix<MT1,SO1>& A, const DenseVector<VT,columnVector>& x,
+                   DenseMatrix<MT2,SO2>& V, size_t s );
+
+template< typename MT1, bool SO1, typename VT, typename MT2, bool SO2, typename Type >
+void matrixPowers( const SparseMatrix<MT1,SO1>& A, const DenseVector<VT,columnVector>& x,
+                   DenseMatrix<MT2,SO2>& V, const KrylovBasis<Type>& basis );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row block of a matrix powers kernel including its ghost zone.
+// \ingroup sparse_matrix
+//
+// The rows of the block are stored first in the \a rows vector, followed by the ghost rows in
+// the order of increasing distance. The first \a sizes[k-1] rows are required to compute the
+// \a k-th basis vector on the block.
+*/
+struct MatrixPowersBlock
+{
+   std::vector<size_t> rows;   //!< The global indices of the rows of the block and its ghost zone.
+   std::vector<size_t> sizes;  //!< The number of rows per recurrence step.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the ghost zone of a row block of the given row-major sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The row-major sparse matrix.
+// \param block The row block to be set up.
+// \param begin The index of the first row of the block.
+// \param end The index one past the last row of the block.
+// \param s The number of recurrence steps.
+// \param pos Auxiliary index map of size \a N, whose elements are all \a N.
+// \param limit The maximum number of non-zero elements to be processed for the block.
+// \return \a true in case the work of the block does not exceed the limit, \a false if it does.
+//
+// This function determines all rows that are required to compute \a s basis vectors on the rows
+// \f$ [begin..end) \f$ of \a A: The \a s-th basis vector requires the \f$ (s-1) \f$-th basis
+// vector on all column indices of the block rows, which in turn requires the \f$ (s-2) \f$-th
+// basis vector on their neighbors, and so on. In case the accumulated number of non-zero
+// elements of the resulting computation exceeds \a limit, the function returns \a false.
+*/
+template< typename MT >  // Type of the row-major sparse matrix
+bool setupMatrixPowersBlock( const MT& A, MatrixPowersBlock& block, size_t begin, size_t end,
+                             size_t s, std::vector<size_t>& pos, size_t limit )
+{
+   const size_t N( A.rows() );
+
+   block.rows.clear();
+   block.sizes.assign( s, 0UL );
+
+   size_t work( 0UL );
+
+   for( size_t i=begin; i<end; ++i ) {
+      pos[i] = block.rows.size();
+      block.rows.push_back( i );
+   }
+
+   block.sizes[s-1UL] = block.rows.size();
+
+   for( size_t k=s-1UL; k>0UL; --k )
+   {
+      const size_t first( ( k+1UL < s )?( block.sizes[k+1UL] ):( 0UL ) );
+
+      for( size_t t=first; t<block.sizes[k]; ++t ) {
+         for( auto element=A.begin(block.rows[t]); element!=A.end(block.rows[t]); ++element ) {
+            const size_t j( element->index() );
+            if( pos[j] == N ) {
+               pos[j] = block.rows.size();
+               block.rows.push_back( j );
+            }
+         }
+      }
+
+      block.sizes[k-1UL] = block.rows.size();
+   }
+
+   bool success( true );
+
+   for( size_t k=0UL; k<s && success; ++k ) {
+      for( size_t t=0UL; t<block.sizes[k]; ++t ) {
+         work += A.nonZeros( block.rows[t] );
+      }
+      success = ( work <= limit );
+   }
+
+   for( size_t i : block.rows ) {
+      pos[i] = N;
+   }
+
+   return success;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Thread-local workspace of the matrix powers kernel.
+// \ingroup sparse_matrix
+*/
+template< typename ET1    // Element type of the sparse matrix
+        , typename ET2 >  // Element type of the basis vectors
+struct MatrixPowersWorkspace
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for a workspace for a matrix with \a n rows.
+   //
+   // \param n The number of rows of the sparse matrix.
+   */
+   explicit inline MatrixPowersWorkspace( size_t n )
+      : pos( n, n )  // Auxiliary index map from global to local row indices
+   {}
+   //**********************************************************************************************
+
+   std::vector<size_t> pos;      //!< Auxiliary index map from global to local row indices.
+   std::vector<size_t> offsets;  //!< The offsets of the rows of the local block matrix.
+   std::vector<size_t> indices;  //!< The local column indices of the local block matrix.
+   std::vector<ET1>    values;   //!< The non-zero elements of the local block matrix.
+   std::vector<ET2>    vectors;  //!< The local basis vectors.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes all basis vectors on a single row block of the matrix powers kernel.
+// \ingroup sparse_matrix
+//
+// \param A The row-major sparse matrix.
+// \param x The initial vector.
+// \param V The target matrix of basis vectors.
+// \param basis The coefficients of the polynomial basis.
+// \param block The row block including its ghost zone.
+// \param ws The thread-local workspace.
+// \return void
+//
+// This function computes all \a s basis vectors on the rows of the given block. The first
+// matrix-vector product streams the rows of the block and its ghost zone from \a A and at the
+// same time copies them into a local block matrix with local column indices. All remaining
+// products are computed on the local block matrix and the local basis vectors, which reside
+// in cache. The ghost zone is recomputed redundantly by every block that depends on it.
+*/
+template< typename MT1     // Type of the row-major sparse matrix
+        , typename VT      // Type of the initial vector
+        , typename MT2     // Type of the target matrix
+        , typename Type    // Data type of the basis coefficients
+        , typename WS >    // Type of the workspace
+void computeMatrixPowersBlock( const MT1& A, const VT& x, MT2& V, const KrylovBasis<Type>& basis,
+                               const MatrixPowersBlock& block, WS& ws )
+{
+   using ET = ElementType_t<MT2>;
+
+   const size_t N( A.rows() );
+   const size_t s( basis.size() );
+   const size_t m( block.sizes[0] );
+   const size_t local( ( s > 1UL )?( block.sizes[1] ):( 0UL ) );
+   const size_t owned( block.sizes[s-1UL] );
+
+   for( size_t t=0UL; t<m; ++t ) {
+      ws.pos[block.rows[t]] = t;
+   }
+
+   ws.vectors.resize( s*m );
+   ws.offsets.resize( local+1UL );
+   ws.indices.clear();
+   ws.values.clear();
+
+   // Computing the first basis vector and setting up the local block matrix
+   {
+      const bool shift( !isDefault<strict>( basis.alpha(0UL) ) );
+
+      ws.offsets[0] = 0UL;
+
+      for( size_t t=0UL; t<m; ++t )
+      {
+         const size_t i( block.rows[t] );
+
+         ET sum{};
+
+         for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+            sum += element->value() * x[element->index()];
+         }
+
+         if( t < local ) {
+            for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+               ws.indices.push_back( ws.pos[element->index()] );
+               ws.values.push_back( element->value() );
+            }
+            ws.offsets[t+1UL] = ws.indices.size();
+         }
+
+         if( shift ) {
+            sum -= basis.alpha(0UL) * x[i];
+         }
+
+         ws.vectors[t] = sum / basis.gamma(0UL);
+      }
+   }
+
+   // Computing all remaining basis vectors on the local block matrix
+   for( size_t k=1UL; k<s; ++k )
+   {
+      ET* const current( ws.vectors.data() + k*m );
+      const ET* const previous( current - m );
+      const ET* const second( ( k > 1UL )?( current - 2UL*m ):( nullptr ) );
+
+      const bool shift( !isDefault<strict>( basis.alpha(k) ) );
+      const bool recur( !isDefault<strict>( basis.beta(k) ) );
+
+      for( size_t t=0UL; t<block.sizes[k]; ++t )
+      {
+         ET sum{};
+
+         for( size_t e=ws.offsets[t]; e<ws.offsets[t+1UL]; ++e ) {
+            sum += ws.values[e] * previous[ws.indices[e]];
+         }
+
+         if( shift ) {
+            sum -= basis.alpha(k) * previous[t];
+         }
+
+         if( recur ) {
+            sum -= basis.beta(k) * ( ( k > 1UL )?( second[t] ):( ET( x[block.rows[t]] ) ) );
+         }
+
+         current[t] = sum / basis.gamma(k);
+      }
+   }
+
+   for( size_t t=0UL; t<owned; ++t )
+   {
+      const size_t i( block.rows[t] );
+
+      V(i,0UL) = x[i];
+      for( size_t k=0UL; k<s; ++k ) {
+         V(i,k+1UL) = ws.vectors[k*m+t];
+      }
+   }
+
+   for( size_t t=0UL; t<m; ++t ) {
+      ws.pos[block.rows[t]] = N;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the basis vectors by means of successive sparse matrix/vector products.
+// \ingroup sparse_matrix
+//
+// \param A The row-major sparse matrix.
+// \param x The initial vector.
+// \param V The target matrix of basis vectors.
+// \param basis The coefficients of the polynomial basis.
+// \return void
+//
+// This function is the fallback of the matrix powers kernel for matrices whose ghost zones are
+// too large to gain from the blocking. It streams the matrix once for each basis vector.
+*/
+template< typename MT1     // Type of the row-major sparse matrix
+        , typename VT      // Type of the initial vector
+        , typename MT2     // Type of the target matrix
+        , typename Type >  // Data type of the basis coefficients
+void computeMatrixPowersSuccessively( const MT1& A, const VT& x, MT2& V,
+                                      const KrylovBasis<Type>& basis )
+{
+   using ET = ElementType_t<MT2>;
+
+   DynamicVector<ET,columnVector> tmp;
+
+   column( V, 0UL, unchecked ) = x;
+
+   for( size_t k=0UL; k<basis.size(); ++k )
+   {
+      tmp = A * column( V, k, unchecked );
+
+      if( !isDefault<strict>( basis.alpha(k) ) ) {
+         tmp -= basis.alpha(k) * column( V, k, unchecked );
+      }
+
+      if( k > 0UL && !isDefault<strict>( basis.beta(k) ) ) {
+         tmp -= basis.beta(k) * column( V, k-1UL, unchecked );
+      }
+
+      column( V, k+1UL, unchecked ) = tmp / basis.gamma(k);
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the matrix powers kernel for row-major sparse matrices.
+// \ingroup sparse_matrix
+//
+// \param A The row-major sparse matrix.
+// \param x The initial vector.
+// \param V The target matrix of basis vectors.
+// \param basis The coefficients of the polynomial basis.
+// \return void
+//
+// This function partitions the rows of \a A into blocks, whose non-zero elements fit into
+// the cache, and computes the ghost zone of every block. In case the ghost zones increase the
+// total work by at most a factor of 2, all basis vectors are computed block by block. Otherwise
+// the function falls back to successive sparse matrix/vector products. In case SMP
+// parallelization is enabled, the blocks are distributed among the threads.
+*/
+template< typename MT1     // Type of the row-major sparse matrix
+        , typename VT      // Type of the initial vector
+        , typename MT2     // Type of the target matrix
+        , bool SO          // Storage order of the target matrix
+        , typename Type >  // Data type of the basis coefficients
+void matrixPowers_backend( const SparseMatrix<MT1,rowMajor>& A, const VT& x,
+                           DenseMatrix<MT2,SO>& V, const KrylovBasis<Type>& basis )
+{
+   using ET = ElementType_t<MT2>;
+
+   const size_t N( (*A).rows() );
+   const size_t s( basis.size() );
+
+   if( N == 0UL )
+      return;
+
+   if( s == 0UL ) {
+      column( *V, 0UL, unchecked ) = x;
+      return;
+   }
+
+   const size_t threads( ( isSerialSectionActive() || isParallelSectionActive() ||
+                           (*A).nonZeros() < SMP_SMATDVECMULT_THRESHOLD )
+                         ?( 1UL ):( min( getNumThreads(), N ) ) );
+
+   // Partitioning the rows into blocks of approximately equal numbers of non-zero elements
+   const size_t bytes( sizeof(ET) + sizeof(size_t) );
+   const size_t share( max( min( cacheSize / ( 4UL*bytes ), (*A).nonZeros() / threads ), 1UL ) );
+
+   std::vector<size_t> bounds( 1UL, 0UL );
+
+   for( size_t i=0UL, nonzeros=0UL; i<N; ++i ) {
+      nonzeros += (*A).nonZeros( i );
+      if( nonzeros >= share || i+1UL == N ) {
+         bounds.push_back( i+1UL );
+         nonzeros = 0UL;
+      }
+   }
+
+   const size_t blocks( bounds.size() - 1UL );
+   const size_t tasks ( min( threads, blocks ) );
+
+   std::vector<MatrixPowersBlock> setup( blocks );
+   SmallArray<bool,64UL> success( tasks, true );
+
+   const auto prepare = [&]( size_t task )
+   {
+      std::vector<size_t> pos( N, N );
+
+      for( size_t b=task*blocks/tasks; b<(task+1UL)*blocks/tasks && success[task]; ++b )
+      {
+         size_t nonzeros( 0UL );
+         for( size_t i=bounds[b]; i<bounds[b+1UL]; ++i ) {
+            nonzeros += (*A).nonZeros( i );
+         }
+
+         const size_t limit( 2UL*s*max( nonzeros, bounds[b+1UL]-bounds[b] ) );
+
+         success[task] = setupMatrixPowersBlock( *A, setup[b], bounds[b], bounds[b+1UL],
+                                                 s, pos, limit );
+      }
+   };
+
+   const auto compute = [&]( size_t task )
+   {
+      MatrixPowersWorkspace< ElementType_t<MT1>, ET > ws( N );
+
+      for( size_t b=task*blocks/tasks; b<(task+1UL)*blocks/tasks; ++b ) {
+         computeMatrixPowersBlock( *A, x, *V, basis, setup[b], ws );
+      }
+   };
+
+   if( tasks == 1UL ) {
+      prepare( 0UL );
+   }
+   else BLAZE_PARALLEL_SECTION {
+      smpFor( tasks, prepare );
+   }
+
+   for( size_t t=0UL; t<tasks; ++t ) {
+      if( !success[t] ) {
+         computeMatrixPowersSuccessively( *A, x, *V, basis );
+         return;
+      }
+   }
+
+   if( tasks == 1UL ) {
+      compute( 0UL );
+   }
+   else BLAZE_PARALLEL_SECTION {
+      smpFor( tasks, compute );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the matrix powers kernel for column-major sparse matrices.
+// \ingroup sparse_matrix
+//
+// \param A The column-major sparse matrix.
+// \param x The initial vector.
+// \param V The target matrix of basis vectors.
+// \param basis The coefficients of the polynomial basis.
+// \return void
+//
+// Since the matrix powers kernel requires row-wise access to \a A, this function converts the
+// column-major matrix into a row-major matrix before computing the basis vectors.
+*/
+template< typename MT1     // Type of the column-major sparse matrix
+        , typename VT      // Type of the initial vector
+        , typename MT2     // Type of the target matrix
+        , bool SO          // Storage order of the target matrix
+        , typename Type >  // Data type of the basis coefficients
+void matrixPowers_backend( const SparseMatrix<MT1,columnMajor>& A, const VT& x,
+                           DenseMatrix<MT2,SO>& V, const KrylovBasis<Type>& basis )
+{
+   const CompressedMatrix< ElementType_t<MT1>, rowMajor > tmp( *A );
+   matrixPowers_backend( tmp, x, V, basis );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Communication-avoiding computation of the given polynomial basis of a Krylov subspace.
+// \ingroup sparse_matrix
+//
+// \param A The square sparse matrix.
+// \param x The initial vector.
+// \param V The resulting \f$ N \times (s+1) \f$ matrix of basis vectors.
+// \param basis The coefficients of the polynomial basis.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function computes the \f$ s+1 \f$ basis vectors \f$ \vec{v}_0, \ldots, \vec{v}_s \f$
+// of the Krylov subspace \f$ \mathcal{K}_{s+1}(A,\vec{x}) \f$ that are defined by the given
+// polynomial basis (see KrylovBasis) and stores them in the columns of \a V:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   blaze::DynamicVector<double,blaze::columnVector> x;
+   // ... Resizing and initialization
+
+   blaze::DynamicMatrix<double,blaze::columnMajor> V;
+
+   matrixPowers( A, x, V, blaze::chebyshevBasis( 0.1, 8.0, 6UL ) );  // V(:,k) = T_k(A) x
+   \endcode
+
+// In contrast to \a s successive sparse matrix/vector products, which stream the complete
+// matrix \a s times, the matrix powers kernel partitions \a A into row blocks whose non-zero
+// elements fit into the cache. For every block, the function determines the ghost zone, i.e.
+// the rows whose intermediate basis vector elements the block depends on, and computes all
+// \a s basis vectors on the block and its ghost zone in a row while they reside in cache. For
+// memory-bound matrices with local connectivity (as for instance discretizations of partial
+// differential equations) this reduces the data movement by up to a factor of \a s at the
+// price of the redundant computation on the ghost zones. In case the ghost zones would more
+// than double the work, the function falls back to successive sparse matrix/vector products.
+// In case SMP parallelization is enabled, the row blocks are distributed among the threads.
+// Note that column-major matrices are converted to row-major matrices first.
+*/
+template< typename MT1     // Type of the sparse matrix
+        , bool SO1         // Storage order of the sparse matrix
+        , typename VT      // Type of the initial vector
+        , typename MT2     // Type of the target matrix
+        , bool SO2         // Storage order of the target matrix
+        , typename Type >  // Data type of the basis coefficients
+void matrixPowers( const SparseMatrix<MT1,SO1>& A, const DenseVector<VT,columnVector>& x,
+                   DenseMatrix<MT2,SO2>& V, const KrylovBasis<Type>& basis )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*A).rows() != (*A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (*x).size() != (*A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   if( (*x).isAliased( &(*V) ) ) {
+      const ResultType_t<VT> tmp( *x );
+      matrixPowers( A, tmp, V, basis );
+      return;
+   }
+
+   CompositeType_t<MT1> A2( *A );
+   CompositeType_t<VT>  x2( *x );
+
+   resize( *V, (*A).rows(), basis.size()+1UL, false );
+
+   matrixPowers_backend( A2, x2, *V, basis );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Communication-avoiding computation of the monomial basis \f$ [\vec{x}, A\vec{x},
+//        \ldots, A^s\vec{x}] \f$.
+// \ingroup sparse_matrix
+//
+// \param A The square sparse matrix.
+// \param x The initial vector.
+// \param V The resulting \f$ N \times (s+1) \f$ matrix of basis vectors.
+// \param s The number of matrix-vector products.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function computes the monomial basis \f$ [\vec{x}, A\vec{x}, \ldots, A^s\vec{x}] \f$ by
+// means of the communication-avoiding matrix powers kernel and stores the basis vectors in the
+// columns of \a V:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   blaze::DynamicVector<double,blaze::columnVector> x;
+   // ... Resizing and initialization
+
+   blaze::DynamicMatrix<double,blaze::columnMajor> V;
+
+   matrixPowers( A, x, V, 4UL );  // V = [ x, A*x, A^2*x, A^3*x, A^4*x ]
+   \endcode
+
+// For details about the kernel see the matrixPowers() function for general polynomial bases.
+*/
+template< typename MT1  // Type of the sparse matrix
+        , bool SO1      // Storage order of the sparse matrix
+        , typename VT   // Type of the initial vector
+        , typename MT2  // Type of the target matrix
+        , bool SO2 >    // Storage order of the target matrix
+inline void matrixPowers( const SparseMatrix<MT1,SO1>& A, const DenseVector<VT,columnVector>& x,
+                          DenseMatrix<MT2,SO2>& V, size_t s )
+{
+   matrixPowers( A, x, V, monomialBasis< ElementType_t<MT2> >( s ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
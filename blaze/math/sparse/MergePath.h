@@ -0,0 +1,189 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/MergePath.h
+//  \brief Header file for the merge-path partitioning of row-major sparse matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_MERGEPATH_H_
+#define _BLAZE_MATH_SPARSE_MERGEPATH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/constraints/RowMajorMatrix.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/SmallArray.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MERGE-PATH PARTITIONING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel computation of the row offsets of a row-major sparse matrix for an unbalanced
+//        distribution of non-zero elements.
+// \ingroup sparse_matrix
+//
+// \param A The row-major sparse matrix.
+// \param threads The number of threads.
+// \param rowsPerThread The number of rows per thread of the plain row split.
+// \param offsets The row offsets of \a A (resized to \a A.rows()+1).
+// \return \a true in case the row offsets have been computed, \a false if not.
+//
+// This function determines whether the plain row split, which assigns \a rowsPerThread rows to
+// every thread, distributes the non-zero elements of \a A reasonably evenly among the threads.
+// In this case the function returns \a false and leaves the \a offsets untouched. Otherwise it
+// computes the exclusive prefix sum of the number of non-zero elements per row, i.e. row \a i of
+// \a A contains the non-zero elements in the range \f$ [offsets[i]..offsets[i+1]) \f$, and
+// returns \a true. The row offsets are the input of the mergePathSearch() function.
+//
+// The function runs on top of the smpFor() function and must therefore be called within a
+// parallel section, but outside of any parallel task.
+*/
+template< typename MT    // Type of the row-major sparse matrix
+        , typename OT >  // Type of the offset vector
+bool computeMergePathOffsets( const MT& A, size_t threads, size_t rowsPerThread, OT& offsets )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT );
+
+   const size_t M( A.rows() );
+
+   SmallArray<size_t,64UL> counts( threads, 0UL );
+
+   smpFor( threads, [&]( size_t t )
+   {
+      const size_t begin( min( t*rowsPerThread, M ) );
+      const size_t end  ( min( begin+rowsPerThread, M ) );
+
+      size_t count( 0UL );
+      for( size_t i=begin; i<end; ++i ) {
+         count += A.nonZeros( i );
+      }
+      counts[t] = count;
+   } );
+
+   size_t total( 0UL ), maximum( 0UL );
+   for( size_t t=0UL; t<threads; ++t ) {
+      total  += counts[t];
+      maximum = max( maximum, counts[t] );
+   }
+
+   // Keeping the row split in case no thread processes more than 125% of the average workload
+   if( 4UL*maximum <= 5UL*( total / threads + 1UL ) )
+      return false;
+
+   offsets.resize( M+1UL, false );
+   offsets[0UL] = 0UL;
+
+   size_t base( 0UL );
+   for( size_t t=0UL; t<threads; ++t ) {
+      const size_t count( counts[t] );
+      counts[t] = base;
+      base += count;
+   }
+
+   smpFor( threads, [&]( size_t t )
+   {
+      const size_t begin( min( t*rowsPerThread, M ) );
+      const size_t end  ( min( begin+rowsPerThread, M ) );
+
+      size_t offset( counts[t] );
+      for( size_t i=begin; i<end; ++i ) {
+         offset += A.nonZeros( i );
+         offsets[i+1UL] = offset;
+      }
+   } );
+
+   BLAZE_INTERNAL_ASSERT( offsets[M] == total, "Invalid row offsets detected" );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Search of the merge-path coordinate of the given diagonal.
+// \ingroup sparse_matrix
+//
+// \param diagonal The diagonal of the merge path \f$ [0..rows+nonzeros] \f$.
+// \param offsets The row offsets of the sparse matrix (see computeMergePathOffsets()).
+// \param rows The number of rows of the sparse matrix.
+// \param nonzeros The total number of non-zero elements of the sparse matrix.
+// \return The number of rows completed on the merge path up to the given diagonal.
+//
+// The merge path merges the sorted sequence of row end offsets with the sequence of the indices
+// of all non-zero elements. Splitting the path at equidistant diagonals distributes both the rows
+// and the non-zero elements evenly among the threads, irrespective of the distribution of the
+// non-zero elements among the rows. This function performs a binary search along the given
+// diagonal and returns the number of rows \a i that have been completed up to this diagonal.
+// The according number of consumed non-zero elements is \a diagonal - \a i.
+*/
+template< typename OT >  // Type of the offset vector
+size_t mergePathSearch( size_t diagonal, const OT& offsets, size_t rows, size_t nonzeros )
+{
+   BLAZE_INTERNAL_ASSERT( diagonal <= rows + nonzeros, "Invalid merge-path diagonal" );
+
+   size_t low ( ( diagonal > nonzeros )?( diagonal - nonzeros ):( 0UL ) );
+   size_t high( min( diagonal, rows ) );
+
+   while( low < high )
+   {
+      const size_t pivot( low + ( high - low ) / 2UL );
+
+      if( offsets[pivot+1UL] <= diagonal - pivot - 1UL )
+         low = pivot + 1UL;
+      else
+         high = pivot;
+   }
+
+   return low;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
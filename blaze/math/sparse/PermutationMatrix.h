@@ -0,0 +1,1992 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/PermutationMatrix.h
+//  \brief Implementation of a permutation matrix
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_PERMUTATIONMATRIX_H_
+#define _BLAZE_MATH_SPARSE_PERMUTATIONMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/SameTag.h>
+#include <blaze/math/constraints/Scalar.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Expression.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup permutation_matrix PermutationMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of an \f$ N \times N \f$ permutation matrix.
+// \ingroup permutation_matrix
+//
+// The PermutationMatrix class template is the representation of an immutable, arbitrary sized
+// permutation matrix with \f$ N \cdot N \f$ elements of arbitrary type. Instead of the elements
+// the matrix only stores the \f$ N \f$ column indices \f$ p \f$ of its non-zero elements, i.e.
+// row \a i of the matrix contains a single 1 in column \f$ p_i \f$. The type of the elements and
+// the group tag of the matrix can be specified via the two template parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, typename Tag >
+   class PermutationMatrix;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. PermutationMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer scalar element type.
+//  - Tag : optional type parameter to tag the matrix. The default type is \a blaze::Group0.
+//          See \ref grouping_tagging for details.
+//
+// It is not possible to insert, erase or modify the elements of a permutation matrix. A
+// PermutationMatrix is always a row-major sparse matrix and can be used as operand in all
+// arithmetic operations and converted into any dense or sparse matrix. However, the following
+// operations are evaluated directly on the index vector in \f$ O(N) \f$ (vectors) or
+// \f$ O(N \cdot K) \f$ (matrices) time instead of by means of a general matrix product:
+
+   \code
+   using blaze::PermutationMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   PermutationMatrix<double> P{ 2, 0, 1 };  // P(0,2) = P(1,0) = P(2,1) = 1
+   PermutationMatrix<double> Q( 3 );        // 3x3 identity permutation
+
+   DynamicVector<double> x{ 1.0, 2.0, 3.0 }, y;
+   DynamicMatrix<double> A( 3UL, 4UL ), B( 4UL, 3UL ), C;
+
+   y = P * x;                     // Gathering: y[i] = x[p[i]], i.e. y = ( 3 1 2 )
+   y = trans( P ) * x;            // Scattering: y[p[i]] = x[i], i.e. y = ( 2 3 1 )
+   C = P * A;                     // Row permutation of A
+   C = B * P;                     // Column permutation of B
+   PermutationMatrix<double> R( P * Q );        // Composition of two permutations
+   PermutationMatrix<double> S( trans( P ) );   // Inverse permutation
+   \endcode
+
+// All products with dense vectors and matrices are executed in parallel in case SMP
+// parallelization is enabled and the operands are sufficiently large. Additionally, the
+// PermutationMatrix can be used as output argument of the lu() decomposition.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+class PermutationMatrix
+   : public Expression< SparseMatrix< PermutationMatrix<Type,Tag>, false > >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This     = PermutationMatrix<Type,Tag>;             //!< Type of this PermutationMatrix.
+   using BaseType = Expression< SparseMatrix<This,false> >;  //!< Base type of this instance.
+
+   //! Result type for expression template evaluations.
+   using ResultType = CompressedMatrix<Type,false,Tag>;
+
+   //! Result type with opposite storage order for expression template evaluations.
+   using OppositeType = CompressedMatrix<Type,true,Tag>;
+
+   //! Transpose type for expression template evaluations.
+   using TransposeType = CompressedMatrix<Type,true,Tag>;
+
+   using ElementType    = Type;         //!< Type of the permutation matrix elements.
+   using TagType        = Tag;          //!< Tag type of this PermutationMatrix instance.
+   using ReturnType     = const Type;   //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;  //!< Data type for composite expression templates.
+   using Reference      = const Type;   //!< Reference to a permutation matrix element.
+   using ConstReference = const Type;   //!< Reference to a constant permutation matrix element.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a PermutationMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = PermutationMatrix<NewType,Tag>;  //!< The type of the other PermutationMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a PermutationMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = PermutationMatrix<Type,Tag>;  //!< The type of the other PermutationMatrix.
+   };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of the permutation matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the permutation matrix.
+      using Element = ValueIndexPair<Type>;
+
+      using IteratorCategory = std::forward_iterator_tag;  //!< The iterator category.
+      using ValueType        = Element;                    //!< Type of the underlying pointers.
+      using PointerType      = ValueType*;                 //!< Pointer return type.
+      using ReferenceType    = ValueType&;                 //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                  //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying pointers.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      constexpr ConstIterator() noexcept
+         : pos_( nullptr )  // Pointer to the column index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param pos Pointer to the column index of the initial matrix element.
+      */
+      constexpr ConstIterator( const size_t* pos ) noexcept
+         : pos_( pos )  // Pointer to the column index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      constexpr ConstIterator& operator++() noexcept {
+         ++pos_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      constexpr ConstIterator operator++( int ) noexcept {
+         ConstIterator tmp( *this );
+         ++pos_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The current value of the sparse element.
+      */
+      constexpr const Element operator*() const noexcept {
+         return Element( Type(1), *pos_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      constexpr const ConstIterator* operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      constexpr Type value() const noexcept {
+         return Type(1);
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      constexpr size_t index() const noexcept {
+         return *pos_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      constexpr bool operator==( const ConstIterator& rhs ) const noexcept {
+         return pos_ == rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      constexpr bool operator!=( const ConstIterator& rhs ) const noexcept {
+         return pos_ != rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return The number of elements between the two ConstIterator objects.
+      */
+      constexpr DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return pos_ - rhs.pos_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const size_t* pos_;  //!< Pointer to the column index of the current element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Iterator = ConstIterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since the products with a permutation matrix are parallelized separately,
+       the \a smpAssignable compilation flag is set to \a false. */
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+            inline PermutationMatrix() noexcept;
+   explicit inline PermutationMatrix( size_t n );
+   explicit inline PermutationMatrix( std::vector<size_t> indices );
+            inline PermutationMatrix( std::initializer_list<size_t> indices );
+
+   template< typename MT, bool SO >
+   explicit inline PermutationMatrix( const Matrix<MT,SO>& m );
+
+   PermutationMatrix( const PermutationMatrix& ) = default;
+   PermutationMatrix( PermutationMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~PermutationMatrix() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+
+   inline const std::vector<size_t>& permutation() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   PermutationMatrix& operator=( const PermutationMatrix& ) & = default;
+   PermutationMatrix& operator=( PermutationMatrix&& ) & = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   clear() noexcept;
+   inline void   resize( size_t n, bool preserve=true );
+   inline void   swap( PermutationMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline PermutationMatrix& transpose();
+   inline PermutationMatrix& ctranspose();
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<size_t> perm_;  //!< The column indices of the non-zero elements of all rows.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_SCALAR_TYPE       ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PermutationMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline PermutationMatrix<Type,Tag>::PermutationMatrix() noexcept
+   : perm_()  // The column indices of the non-zero elements of all rows
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an identity permutation of size \f$ N \times N \f$.
+//
+// \param n The number of rows and columns of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline PermutationMatrix<Type,Tag>::PermutationMatrix( size_t n )
+   : perm_( n )  // The column indices of the non-zero elements of all rows
+{
+   for( size_t i=0UL; i<n; ++i ) {
+      perm_[i] = i;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a permutation matrix from the given index vector.
+//
+// \param indices The column indices of the non-zero elements of all rows.
+// \exception std::invalid_argument Invalid permutation indices.
+//
+// This constructor creates a \f$ N \times N \f$ permutation matrix, whose row \a i contains a
+// single 1 in column \a indices[i]. In case the given indices are not a permutation of the
+// indices \f$ [0..N-1] \f$, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline PermutationMatrix<Type,Tag>::PermutationMatrix( std::vector<size_t> indices )
+   : perm_( std::move( indices ) )  // The column indices of the non-zero elements of all rows
+{
+   if( !isIntact( *this ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation indices" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of the column indices of a permutation matrix.
+//
+// \param indices The column indices of the non-zero elements of all rows.
+// \exception std::invalid_argument Invalid permutation indices.
+
+   \code
+   blaze::PermutationMatrix<double> P{ 2, 0, 1 };
+   \endcode
+
+// This constructor creates a \f$ N \times N \f$ permutation matrix, whose row \a i contains a
+// single 1 in the column specified by the \a i-th element of the given initializer list. In
+// case the given indices are not a permutation of the indices \f$ [0..N-1] \f$, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline PermutationMatrix<Type,Tag>::PermutationMatrix( std::initializer_list<size_t> indices )
+   : perm_( indices )  // The column indices of the non-zero elements of all rows
+{
+   if( !isIntact( *this ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation indices" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a general matrix.
+//
+// \param m The permutation matrix to be converted.
+// \exception std::invalid_argument Invalid setup of permutation matrix.
+//
+// This constructor converts the given dense or sparse matrix into a permutation matrix. In case
+// the given matrix is not a square matrix with exactly one element equal to 1 in every row and
+// every column and 0 elsewhere, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the foreign matrix
+        , bool SO >       // Storage order of the foreign matrix
+inline PermutationMatrix<Type,Tag>::PermutationMatrix( const Matrix<MT,SO>& m )
+   : perm_( (*m).rows() )  // The column indices of the non-zero elements of all rows
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*m).rows() != (*m).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of permutation matrix" );
+   }
+
+   const CompressedMatrix<ElementType_t<MT>,rowMajor> tmp( *m );
+
+   for( size_t i=0UL; i<tmp.rows(); ++i )
+   {
+      if( tmp.nonZeros( i ) != 1UL || !isOne( tmp.begin(i)->value() ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of permutation matrix" );
+      }
+
+      perm_[i] = tmp.begin(i)->index();
+   }
+
+   if( !isIntact( *this ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of permutation matrix" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the permutation matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The resulting value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename PermutationMatrix<Type,Tag>::ConstReference
+   PermutationMatrix<Type,Tag>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid permutation matrix row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid permutation matrix column access index" );
+
+   if( perm_[i] == j )
+      return Type( 1 );
+   else
+      return Type( 0 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the permutation matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The resulting value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename PermutationMatrix<Type,Tag>::ConstReference
+   PermutationMatrix<Type,Tag>::at( size_t i, size_t j ) const
+{
+   if( i >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename PermutationMatrix<Type,Tag>::ConstIterator
+   PermutationMatrix<Type,Tag>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid permutation matrix row access index" );
+   return ConstIterator( perm_.data() + i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename PermutationMatrix<Type,Tag>::ConstIterator
+   PermutationMatrix<Type,Tag>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid permutation matrix row access index" );
+   return ConstIterator( perm_.data() + i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename PermutationMatrix<Type,Tag>::ConstIterator
+   PermutationMatrix<Type,Tag>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid permutation matrix row access index" );
+   return ConstIterator( perm_.data() + i + 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename PermutationMatrix<Type,Tag>::ConstIterator
+   PermutationMatrix<Type,Tag>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid permutation matrix row access index" );
+   return ConstIterator( perm_.data() + i + 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the column indices of the non-zero elements of all rows.
+//
+// \return The index vector of the permutation.
+//
+// The \a i-th element of the returned vector is the column index of the single 1 in row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline const std::vector<size_t>& PermutationMatrix<Type,Tag>::permutation() const noexcept
+{
+   return perm_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the permutation matrix.
+//
+// \return The number of rows of the permutation matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t PermutationMatrix<Type,Tag>::rows() const noexcept
+{
+   return perm_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the permutation matrix.
+//
+// \return The number of columns of the permutation matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t PermutationMatrix<Type,Tag>::columns() const noexcept
+{
+   return perm_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the permutation matrix.
+//
+// \return The capacity of the permutation matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t PermutationMatrix<Type,Tag>::capacity() const noexcept
+{
+   return perm_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t PermutationMatrix<Type,Tag>::capacity( size_t i ) const noexcept
+{
+   MAYBE_UNUSED( i );
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid permutation matrix row access index" );
+
+   return 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the permutation matrix.
+//
+// \return The number of non-zero elements in the permutation matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t PermutationMatrix<Type,Tag>::nonZeros() const noexcept
+{
+   return perm_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t PermutationMatrix<Type,Tag>::nonZeros( size_t i ) const noexcept
+{
+   MAYBE_UNUSED( i );
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid permutation matrix row access index" );
+
+   return 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the permutation matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the permutation matrix is 0.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void PermutationMatrix<Type,Tag>::clear() noexcept
+{
+   perm_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the permutation matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ n \times n \f$. In case the
+// matrix is enlarged and \a preserve is \a true, the existing permutation is preserved and
+// extended by the identity permutation of the new rows and columns. Otherwise the matrix is
+// reset to the identity permutation.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void PermutationMatrix<Type,Tag>::resize( size_t n, bool preserve )
+{
+   const size_t first( ( preserve && n >= perm_.size() ) ? perm_.size() : 0UL );
+
+   perm_.resize( n );
+
+   for( size_t i=first; i<n; ++i ) {
+      perm_[i] = i;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two permutation matrices.
+//
+// \param m The permutation matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void PermutationMatrix<Type,Tag>::swap( PermutationMatrix& m ) noexcept
+{
+   perm_.swap( m.perm_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename PermutationMatrix<Type,Tag>::ConstIterator
+   PermutationMatrix<Type,Tag>::find( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid permutation matrix row access index" );
+
+   if( perm_[i] == j )
+      return begin( i );
+   else
+      return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename PermutationMatrix<Type,Tag>::ConstIterator
+   PermutationMatrix<Type,Tag>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid permutation matrix row access index" );
+
+   if( j <= perm_[i] )
+      return begin( i );
+   else
+      return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename PermutationMatrix<Type,Tag>::ConstIterator
+   PermutationMatrix<Type,Tag>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid permutation matrix row access index" );
+
+   if( j < perm_[i] )
+      return begin( i );
+   else
+      return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+//
+// Since the transpose of a permutation matrix is its inverse, this function replaces the stored
+// permutation by the inverse permutation in \f$ O(N) \f$ time.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline PermutationMatrix<Type,Tag>& PermutationMatrix<Type,Tag>::transpose()
+{
+   std::vector<size_t> tmp( perm_.size() );
+
+   for( size_t i=0UL; i<perm_.size(); ++i ) {
+      tmp[perm_[i]] = i;
+   }
+
+   perm_.swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline PermutationMatrix<Type,Tag>& PermutationMatrix<Type,Tag>::ctranspose()
+{
+   return transpose();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the foreign expression
+inline bool PermutationMatrix<Type,Tag>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the foreign expression
+inline bool PermutationMatrix<Type,Tag>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline bool PermutationMatrix<Type,Tag>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PERMUTATIONMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PermutationMatrix operators */
+//@{
+template< RelaxationFlag RF, typename Type, typename Tag >
+bool isDefault( const PermutationMatrix<Type,Tag>& m ) noexcept;
+
+template< typename Type, typename Tag >
+bool isIntact( const PermutationMatrix<Type,Tag>& m ) noexcept;
+
+template< typename Type, typename Tag >
+void clear( PermutationMatrix<Type,Tag>& m ) noexcept;
+
+template< typename Type, typename Tag >
+void swap( PermutationMatrix<Type,Tag>& a, PermutationMatrix<Type,Tag>& b ) noexcept;
+
+template< typename Type, typename Tag >
+PermutationMatrix<Type,Tag> trans( const PermutationMatrix<Type,Tag>& m );
+
+template< typename Type, typename Tag >
+PermutationMatrix<Type,Tag> ctrans( const PermutationMatrix<Type,Tag>& m );
+
+template< typename Type, typename Tag >
+PermutationMatrix<Type,Tag> inv( const PermutationMatrix<Type,Tag>& m );
+
+template< typename Type, typename Tag >
+void invert( PermutationMatrix<Type,Tag>& m );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given permutation matrix is in default state.
+// \ingroup permutation_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix is in default state, \a false otherwise.
+//
+// This function checks whether the permutation matrix is in default (constructed) state, i.e.
+// if its size is 0.
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename Type      // Data type of the matrix
+        , typename Tag >     // Type tag
+inline bool isDefault( const PermutationMatrix<Type,Tag>& m ) noexcept
+{
+   return ( m.rows() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given permutation matrix are intact.
+// \ingroup permutation_matrix
+//
+// \param m The permutation matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the permutation matrix are intact, i.e. if the
+// stored column indices are a permutation of the indices \f$ [0..N-1] \f$. In case the
+// invariants are intact, the function returns \a true, else it will return \a false.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline bool isIntact( const PermutationMatrix<Type,Tag>& m ) noexcept
+{
+   const std::vector<size_t>& perm( m.permutation() );
+   const size_t n( perm.size() );
+
+   std::vector<bool> used( n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( perm[i] >= n || used[perm[i]] ) {
+         return false;
+      }
+      used[perm[i]] = true;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given permutation matrix.
+// \ingroup permutation_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void clear( PermutationMatrix<Type,Tag>& m ) noexcept
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two permutation matrices.
+// \ingroup permutation_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void swap( PermutationMatrix<Type,Tag>& a, PermutationMatrix<Type,Tag>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the transpose of the given permutation matrix.
+// \ingroup permutation_matrix
+//
+// \param m The permutation matrix to be transposed.
+// \return The transpose of the matrix.
+//
+// This function returns the transpose of the given permutation matrix, i.e. the permutation
+// matrix of the inverse permutation. The transpose is computed in \f$ O(N) \f$ time.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline PermutationMatrix<Type,Tag> trans( const PermutationMatrix<Type,Tag>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   PermutationMatrix<Type,Tag> tmp( m );
+   tmp.transpose();
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the conjugate transpose of the given permutation matrix.
+// \ingroup permutation_matrix
+//
+// \param m The permutation matrix to be transposed.
+// \return The conjugate transpose of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline PermutationMatrix<Type,Tag> ctrans( const PermutationMatrix<Type,Tag>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return trans( m );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the inverse of the given permutation matrix.
+// \ingroup permutation_matrix
+//
+// \param m The permutation matrix to be inverted.
+// \return The inverse of the matrix.
+//
+// This function returns the inverse of the given permutation matrix, which is identical to its
+// transpose. The inverse is computed in \f$ O(N) \f$ time.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline PermutationMatrix<Type,Tag> inv( const PermutationMatrix<Type,Tag>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return trans( m );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of the given permutation matrix.
+// \ingroup permutation_matrix
+//
+// \param m The permutation matrix to be inverted.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void invert( PermutationMatrix<Type,Tag>& m )
+{
+   m.transpose();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the composition of two permutation matrices
+//        (\f$ R=P*Q \f$).
+// \ingroup permutation_matrix
+//
+// \param P The left-hand side permutation matrix.
+// \param Q The right-hand side permutation matrix.
+// \return The permutation matrix of the composed permutation.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The product of two permutation matrices is again a permutation matrix with the column indices
+// \f$ r_i = q_{p_i} \f$. It is computed in \f$ O(N) \f$ time.
+*/
+template< typename T1     // Data type of the left-hand side permutation matrix
+        , typename T2     // Data type of the right-hand side permutation matrix
+        , typename Tag >  // Type tag
+inline PermutationMatrix< MultTrait_t<T1,T2>, Tag >
+   operator*( const PermutationMatrix<T1,Tag>& P, const PermutationMatrix<T2,Tag>& Q )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( P.columns() != Q.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const std::vector<size_t>& p( P.permutation() );
+   const std::vector<size_t>& q( Q.permutation() );
+
+   std::vector<size_t> r( p.size() );
+
+   for( size_t i=0UL; i<p.size(); ++i ) {
+      r[i] = q[p[i]];
+   }
+
+   return PermutationMatrix< MultTrait_t<T1,T2>, Tag >( std::move( r ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GATHER AND SCATTER KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given operation to a partition of the index range \f$ [0..N-1] \f$.
+// \ingroup permutation_matrix
+//
+// \param n The size of the index range.
+// \param parallel \a true in case the operation is large enough for an SMP parallel execution.
+// \param op The operation to be applied to each partition.
+// \return void
+//
+// This function calls \a op for contiguous partitions \f$ [begin..end) \f$ of the index range.
+// In case SMP parallelization is enabled, \a parallel is \a true and no serial or parallel
+// section is active, the range is split into several partitions per thread, which are processed
+// in parallel. Otherwise \a op is called once for the complete range.
+*/
+template< typename OP >  // Type of the partition operation
+void permutationFor( size_t n, bool parallel, OP op )
+{
+   const size_t threads( getNumThreads() );
+
+   if( !parallel || threads < 2UL || n < 2UL ||
+       isSerialSectionActive() || isParallelSectionActive() ) {
+      op( 0UL, n );
+      return;
+   }
+
+   const size_t tasks( min( 4UL*threads, n ) );
+   const size_t chunk( ( n + tasks - 1UL ) / tasks );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*chunk );
+         const size_t end  ( min( begin+chunk, n ) );
+         if( begin < end ) {
+            op( begin, end );
+         }
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the inverse of the given permutation.
+// \ingroup permutation_matrix
+//
+// \param perm The permutation to be inverted.
+// \return The inverse permutation.
+*/
+inline std::vector<size_t> inversePermutation( const std::vector<size_t>& perm )
+{
+   std::vector<size_t> inverse( perm.size() );
+
+   for( size_t i=0UL; i<perm.size(); ++i ) {
+      inverse[perm[i]] = i;
+   }
+
+   return inverse;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a permutation matrix and a dense vector (\f$ \vec{y}=P*\vec{x} \f$
+//        or \f$ \vec{y}^T=\vec{x}^T*P \f$).
+// \ingroup permutation_matrix
+//
+// \param P The permutation matrix.
+// \param x The dense vector operand.
+// \param y The resulting dense vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// In case of column vectors, this function computes \f$ \vec{y}=P*\vec{x} \f$ by means of a
+// gather operation (\f$ y_i = x_{p_i} \f$). In case of row vectors, the function computes
+// \f$ \vec{y}^T=\vec{x}^T*P \f$ by means of a scatter operation (\f$ y_{p_i} = x_i \f$). In
+// case SMP parallelization is enabled and the vectors are sufficiently large, the operation is
+// executed in parallel. The resulting vector \a y is resized accordingly. In case \a x and \a y
+// are aliased, \a x is copied before the operation.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename VT1    // Type of the dense vector operand
+        , typename VT2    // Type of the target dense vector
+        , bool TF >       // Transpose flag of the vectors
+void multiply( const PermutationMatrix<Type,Tag>& P,
+               const DenseVector<VT1,TF>& x, DenseVector<VT2,TF>& y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*x).size() != P.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   if( (*x).isAliased( &(*y) ) ) {
+      const ResultType_t<VT1> tmp( *x );
+      multiply( P, tmp, y );
+      return;
+   }
+
+   const size_t n( P.rows() );
+   const size_t* const p( P.permutation().data() );
+
+   CompositeType_t<VT1> x2( *x );
+
+   resize( *y, n, false );
+
+   permutationFor( n, n >= SMP_DVECASSIGN_THRESHOLD, [p,&x2,&y]( size_t begin, size_t end ) {
+      for( size_t i=begin; i<end; ++i ) {
+         if( TF ) (*y)[p[i]] = x2[i];
+         else     (*y)[i]    = x2[p[i]];
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a permutation matrix and a dense matrix (\f$ Y=P*X \f$).
+// \ingroup permutation_matrix
+//
+// \param P The permutation matrix.
+// \param X The dense matrix operand.
+// \param Y The resulting dense matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function permutes the rows of the given dense matrix (\f$ Y_{i,*} = X_{p_i,*} \f$). In
+// case \a Y is a row-major matrix, complete rows are copied by means of the vectorized dense
+// kernels. In case \a Y is a column-major matrix, the rows are gathered in blocks such that the
+// according part of the permutation remains in cache for all columns. In case SMP
+// parallelization is enabled and the matrices are sufficiently large, the rows are distributed
+// among the threads. The resulting matrix \a Y is resized accordingly. In case \a X and \a Y
+// are aliased, \a X is copied before the operation.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT1    // Type of the dense matrix operand
+        , bool SO1        // Storage order of the dense matrix operand
+        , typename MT2    // Type of the target dense matrix
+        , bool SO2 >      // Storage order of the target dense matrix
+void multiply( const PermutationMatrix<Type,Tag>& P,
+               const DenseMatrix<MT1,SO1>& X, DenseMatrix<MT2,SO2>& Y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*X).rows() != P.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (*X).isAliased( &(*Y) ) ) {
+      const ResultType_t<MT1> tmp( *X );
+      multiply( P, tmp, Y );
+      return;
+   }
+
+   constexpr size_t block( 256UL );
+
+   const size_t m( P.rows() );
+   const size_t n( (*X).columns() );
+   const size_t* const p( P.permutation().data() );
+
+   CompositeType_t<MT1> X2( *X );
+
+   resize( *Y, m, n, false );
+
+   permutationFor( m, m*n >= SMP_DMATASSIGN_THRESHOLD, [=,&X2,&Y]( size_t begin, size_t end )
+   {
+      if( SO2 == rowMajor ) {
+         for( size_t i=begin; i<end; ++i ) {
+            row( *Y, i, unchecked ) = serial( row( X2, p[i], unchecked ) );
+         }
+      }
+      else {
+         for( size_t ii=begin; ii<end; ii+=block ) {
+            const size_t iend( min( ii+block, end ) );
+            for( size_t j=0UL; j<n; ++j ) {
+               for( size_t i=ii; i<iend; ++i ) {
+                  (*Y)(i,j) = X2(p[i],j);
+               }
+            }
+         }
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a dense matrix and a permutation matrix (\f$ Y=X*P \f$).
+// \ingroup permutation_matrix
+//
+// \param X The dense matrix operand.
+// \param P The permutation matrix.
+// \param Y The resulting dense matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function permutes the columns of the given dense matrix (\f$ Y_{*,p_j} = X_{*,j} \f$).
+// In case \a Y is a column-major matrix, complete columns are copied by means of the vectorized
+// dense kernels. In case \a Y is a row-major matrix, the elements of each row are scattered. In
+// case SMP parallelization is enabled and the matrices are sufficiently large, the columns
+// (column-major) or rows (row-major) are distributed among the threads. The resulting matrix
+// \a Y is resized accordingly. In case \a X and \a Y are aliased, \a X is copied before the
+// operation.
+*/
+template< typename MT1    // Type of the dense matrix operand
+        , bool SO1        // Storage order of the dense matrix operand
+        , typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT2    // Type of the target dense matrix
+        , bool SO2 >      // Storage order of the target dense matrix
+void multiply( const DenseMatrix<MT1,SO1>& X,
+               const PermutationMatrix<Type,Tag>& P, DenseMatrix<MT2,SO2>& Y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*X).columns() != P.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (*X).isAliased( &(*Y) ) ) {
+      const ResultType_t<MT1> tmp( *X );
+      multiply( tmp, P, Y );
+      return;
+   }
+
+   const size_t m( (*X).rows() );
+   const size_t n( P.columns() );
+   const size_t* const p( P.permutation().data() );
+
+   CompositeType_t<MT1> X2( *X );
+
+   resize( *Y, m, n, false );
+
+   const bool parallel( m*n >= SMP_DMATASSIGN_THRESHOLD );
+
+   if( SO2 == columnMajor ) {
+      permutationFor( n, parallel, [p,&X2,&Y]( size_t begin, size_t end ) {
+         for( size_t j=begin; j<end; ++j ) {
+            column( *Y, p[j], unchecked ) = serial( column( X2, j, unchecked ) );
+         }
+      } );
+   }
+   else {
+      permutationFor( m, parallel, [p,n,&X2,&Y]( size_t begin, size_t end ) {
+         for( size_t i=begin; i<end; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               (*Y)(i,p[j]) = X2(i,j);
+            }
+         }
+      } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a permutation matrix and a dense
+//        column vector (\f$ \vec{y}=P*\vec{x} \f$).
+// \ingroup permutation_matrix
+//
+// \param P The permutation matrix.
+// \param x The dense column vector.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator immediately evaluates the product by means of a gather operation.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename VT >   // Type of the dense vector operand
+inline DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector >
+   operator*( const PermutationMatrix<Type,Tag>& P, const DenseVector<VT,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector > y;
+   multiply( P, *x, y );
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a dense row vector and a permutation
+//        matrix (\f$ \vec{y}^T=\vec{x}^T*P \f$).
+// \ingroup permutation_matrix
+//
+// \param x The dense row vector.
+// \param P The permutation matrix.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator immediately evaluates the product by means of a scatter operation.
+*/
+template< typename VT     // Type of the dense vector operand
+        , typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline DynamicVector< MultTrait_t< ElementType_t<VT>, Type >, rowVector >
+   operator*( const DenseVector<VT,rowVector>& x, const PermutationMatrix<Type,Tag>& P )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicVector< MultTrait_t< ElementType_t<VT>, Type >, rowVector > y;
+   multiply( P, *x, y );
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a permutation matrix and a dense
+//        matrix (\f$ Y=P*X \f$).
+// \ingroup permutation_matrix
+//
+// \param P The permutation matrix.
+// \param X The dense matrix.
+// \return The resulting dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator immediately evaluates the row permutation of \a X.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT     // Type of the dense matrix operand
+        , bool SO >       // Storage order of the dense matrix operand
+inline DynamicMatrix< MultTrait_t< Type, ElementType_t<MT> >, SO >
+   operator*( const PermutationMatrix<Type,Tag>& P, const DenseMatrix<MT,SO>& X )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicMatrix< MultTrait_t< Type, ElementType_t<MT> >, SO > Y;
+   multiply( P, *X, Y );
+   return Y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a dense matrix and a permutation
+//        matrix (\f$ Y=X*P \f$).
+// \ingroup permutation_matrix
+//
+// \param X The dense matrix.
+// \param P The permutation matrix.
+// \return The resulting dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator immediately evaluates the column permutation of \a X.
+*/
+template< typename MT     // Type of the dense matrix operand
+        , bool SO         // Storage order of the dense matrix operand
+        , typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline DynamicMatrix< MultTrait_t< ElementType_t<MT>, Type >, SO >
+   operator*( const DenseMatrix<MT,SO>& X, const PermutationMatrix<Type,Tag>& P )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicMatrix< MultTrait_t< ElementType_t<MT>, Type >, SO > Y;
+   multiply( *X, P, Y );
+   return Y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a permutation matrix and a sparse
+//        column vector (\f$ \vec{y}=P*\vec{x} \f$).
+// \ingroup permutation_matrix
+//
+// \param P The permutation matrix.
+// \param x The sparse column vector.
+// \return The resulting sparse vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator moves every non-zero element \f$ x_j \f$ to the position \f$ i \f$ with
+// \f$ p_i = j \f$. The product is computed in \f$ O(N + K \log K) \f$ time, where \a K is the
+// number of non-zero elements of \a x.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename VT >   // Type of the sparse vector operand
+CompressedVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector >
+   operator*( const PermutationMatrix<Type,Tag>& P, const SparseVector<VT,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = MultTrait_t< Type, ElementType_t<VT> >;
+
+   if( (*x).size() != P.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   const std::vector<size_t> inverse( inversePermutation( P.permutation() ) );
+
+   CompositeType_t<VT> x2( *x );
+
+   std::vector< std::pair<size_t,ET> > elements;
+   elements.reserve( x2.nonZeros() );
+
+   for( auto element=x2.begin(); element!=x2.end(); ++element ) {
+      elements.emplace_back( inverse[element->index()], element->value() );
+   }
+
+   std::sort( elements.begin(), elements.end(),
+              []( const auto& a, const auto& b ) { return a.first < b.first; } );
+
+   CompressedVector<ET,columnVector> y( P.rows(), elements.size() );
+
+   for( const auto& element : elements ) {
+      y.append( element.first, element.second );
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a sparse row vector and a
+//        permutation matrix (\f$ \vec{y}^T=\vec{x}^T*P \f$).
+// \ingroup permutation_matrix
+//
+// \param x The sparse row vector.
+// \param P The permutation matrix.
+// \return The resulting sparse vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator moves every non-zero element \f$ x_i \f$ to the position \f$ p_i \f$. The
+// product is computed in \f$ O(K \log K) \f$ time, where \a K is the number of non-zero
+// elements of \a x.
+*/
+template< typename VT     // Type of the sparse vector operand
+        , typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+CompressedVector< MultTrait_t< ElementType_t<VT>, Type >, rowVector >
+   operator*( const SparseVector<VT,rowVector>& x, const PermutationMatrix<Type,Tag>& P )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = MultTrait_t< ElementType_t<VT>, Type >;
+
+   if( (*x).size() != P.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   const std::vector<size_t>& p( P.permutation() );
+
+   CompositeType_t<VT> x2( *x );
+
+   std::vector< std::pair<size_t,ET> > elements;
+   elements.reserve( x2.nonZeros() );
+
+   for( auto element=x2.begin(); element!=x2.end(); ++element ) {
+      elements.emplace_back( p[element->index()], element->value() );
+   }
+
+   std::sort( elements.begin(), elements.end(),
+              []( const auto& a, const auto& b ) { return a.first < b.first; } );
+
+   CompressedVector<ET,rowVector> y( P.columns(), elements.size() );
+
+   for( const auto& element : elements ) {
+      y.append( element.first, element.second );
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a permutation matrix and a sparse
+//        matrix (\f$ Y=P*X \f$).
+// \ingroup permutation_matrix
+//
+// \param P The permutation matrix.
+// \param X The sparse matrix.
+// \return The resulting sparse matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator permutes the rows of the given sparse matrix. In case of a row-major matrix,
+// the rows are copied in the permuted order. In case of a column-major matrix, the row indices
+// of every column are permuted and sorted.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag    // Type tag
+        , typename MT     // Type of the sparse matrix operand
+        , bool SO >       // Storage order of the sparse matrix operand
+CompressedMatrix< MultTrait_t< Type, ElementType_t<MT> >, SO >
+   operator*( const PermutationMatrix<Type,Tag>& P, const SparseMatrix<MT,SO>& X )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = MultTrait_t< Type, ElementType_t<MT> >;
+
+   if( (*X).rows() != P.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const std::vector<size_t>& p( P.permutation() );
+
+   CompositeType_t<MT> X2( *X );
+
+   CompressedMatrix<ET,SO> Y( X2.rows(), X2.columns(), X2.nonZeros() );
+
+   if( SO == rowMajor )
+   {
+      for( size_t i=0UL; i<Y.rows(); ++i ) {
+         for( auto element=X2.begin(p[i]); element!=X2.end(p[i]); ++element ) {
+            Y.append( i, element->index(), element->value() );
+         }
+         Y.finalize( i );
+      }
+   }
+   else
+   {
+      const std::vector<size_t> inverse( inversePermutation( p ) );
+      std::vector< std::pair<size_t,ET> > elements;
+
+      for( size_t j=0UL; j<Y.columns(); ++j )
+      {
+         elements.clear();
+
+         for( auto element=X2.begin(j); element!=X2.end(j); ++element ) {
+            elements.emplace_back( inverse[element->index()], element->value() );
+         }
+
+         std::sort( elements.begin(), elements.end(),
+                    []( const auto& a, const auto& b ) { return a.first < b.first; } );
+
+         for( const auto& element : elements ) {
+            Y.append( element.first, j, element.second );
+         }
+         Y.finalize( j );
+      }
+   }
+
+   return Y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a sparse matrix and a permutation
+//        matrix (\f$ Y=X*P \f$).
+// \ingroup permutation_matrix
+//
+// \param X The sparse matrix.
+// \param P The permutation matrix.
+// \return The resulting sparse matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator permutes the columns of the given sparse matrix. In case of a column-major
+// matrix, the columns are copied in the permuted order. In case of a row-major matrix, the
+// column indices of every row are permuted and sorted.
+*/
+template< typename MT     // Type of the sparse matrix operand
+        , bool SO         // Storage order of the sparse matrix operand
+        , typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+CompressedMatrix< MultTrait_t< ElementType_t<MT>, Type >, SO >
+   operator*( const SparseMatrix<MT,SO>& X, const PermutationMatrix<Type,Tag>& P )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = MultTrait_t< ElementType_t<MT>, Type >;
+
+   if( (*X).columns() != P.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const std::vector<size_t>& p( P.permutation() );
+
+   CompositeType_t<MT> X2( *X );
+
+   CompressedMatrix<ET,SO> Y( X2.rows(), X2.columns(), X2.nonZeros() );
+
+   if( SO == columnMajor )
+   {
+      const std::vector<size_t> inverse( inversePermutation( p ) );
+
+      for( size_t j=0UL; j<Y.columns(); ++j ) {
+         for( auto element=X2.begin(inverse[j]); element!=X2.end(inverse[j]); ++element ) {
+            Y.append( element->index(), j, element->value() );
+         }
+         Y.finalize( j );
+      }
+   }
+   else
+   {
+      std::vector< std::pair<size_t,ET> > elements;
+
+      for( size_t i=0UL; i<Y.rows(); ++i )
+      {
+         elements.clear();
+
+         for( auto element=X2.begin(i); element!=X2.end(i); ++element ) {
+            elements.emplace_back( p[element->index()], element->value() );
+         }
+
+         std::sort( elements.begin(), elements.end(),
+                    []( const auto& a, const auto& b ) { return a.first < b.first; } );
+
+         for( const auto& element : elements ) {
+            Y.append( i, element.first, element.second );
+         }
+         Y.finalize( i );
+      }
+   }
+
+   return Y;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSQUARE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type, typename Tag >
+struct IsSquare< PermutationMatrix<Type,Tag> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Type, typename Tag >
+struct IsResizable< PermutationMatrix<Type,Tag> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
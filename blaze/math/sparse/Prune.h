@@ -0,0 +1,663 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Prune.h
+//  \brief Header file for the pruning of sparse matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_PRUNE_H_
+#define _BLAZE_MATH_SPARSE_PRUNE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/SmallArray.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PRUNING FILTERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pruning filter for the removal of all elements below an absolute drop tolerance.
+// \ingroup sparse_matrix
+//
+// This filter keeps all elements whose absolute value is larger than the given tolerance.
+*/
+template< typename ST >  // Type of the drop tolerance
+class PruneTolerance
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor of the PruneTolerance filter.
+   //
+   // \param tol The absolute drop tolerance.
+   */
+   explicit inline PruneTolerance( ST tol )
+      : tol_( tol )  // The absolute drop tolerance
+   {}
+   //**********************************************************************************************
+
+   //**Select function*****************************************************************************
+   /*!\brief Preparation of the filter for the given row/column.
+   //
+   // \param first Iterator to the first element of the row/column.
+   // \param last Iterator one past the last element of the row/column.
+   // \return void
+   */
+   template< typename IteratorType >  // Type of the sparse matrix iterator
+   inline void select( IteratorType first, IteratorType last ) noexcept
+   {
+      MAYBE_UNUSED( first, last );
+   }
+   //**********************************************************************************************
+
+   //**Keep function*******************************************************************************
+   /*!\brief Returns whether the given element is kept.
+   //
+   // \param value The value of the element.
+   // \return \a true in case the element is kept, \a false if it is removed.
+   */
+   template< typename T >  // Type of the element
+   inline bool keep( const T& value ) const
+   {
+      return abs( value ) > tol_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   ST tol_;  //!< The absolute drop tolerance.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pruning filter for the removal of all elements matching a unary predicate.
+// \ingroup sparse_matrix
+//
+// This filter keeps all elements for which the given unary predicate returns \a false.
+*/
+template< typename Pred >  // Type of the unary predicate
+class PrunePredicate
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor of the PrunePredicate filter.
+   //
+   // \param pred The unary predicate selecting the elements to be removed.
+   */
+   explicit inline PrunePredicate( Pred pred )
+      : pred_( std::move( pred ) )  // The unary predicate
+   {}
+   //**********************************************************************************************
+
+   //**Select function*****************************************************************************
+   /*!\brief Preparation of the filter for the given row/column.
+   //
+   // \param first Iterator to the first element of the row/column.
+   // \param last Iterator one past the last element of the row/column.
+   // \return void
+   */
+   template< typename IteratorType >  // Type of the sparse matrix iterator
+   inline void select( IteratorType first, IteratorType last ) noexcept
+   {
+      MAYBE_UNUSED( first, last );
+   }
+   //**********************************************************************************************
+
+   //**Keep function*******************************************************************************
+   /*!\brief Returns whether the given element is kept.
+   //
+   // \param value The value of the element.
+   // \return \a true in case the element is kept, \a false if it is removed.
+   */
+   template< typename T >  // Type of the element
+   inline bool keep( const T& value ) const
+   {
+      return !pred_( value );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Pred pred_;  //!< The unary predicate selecting the elements to be removed.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pruning filter for the removal of all elements below a row/column relative tolerance.
+// \ingroup sparse_matrix
+//
+// This filter keeps all elements whose absolute value is larger than the given tolerance times
+// the Euclidean norm of the according row/column.
+*/
+template< typename ST    // Type of the relative drop tolerance
+        , typename RT >  // Type of the absolute values of the elements
+class PruneRelative
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of the Euclidean norm of a row/column.
+   using NormType = decltype( sqrt( std::declval<RT>() ) );
+
+   //! Type of the absolute drop tolerance.
+   using BoundType = decltype( std::declval<ST>() * std::declval<NormType>() );
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor of the PruneRelative filter.
+   //
+   // \param tol The relative drop tolerance.
+   */
+   explicit inline PruneRelative( ST tol )
+      : tol_  ( tol )  // The relative drop tolerance
+      , bound_()       // The absolute drop tolerance of the current row/column
+   {}
+   //**********************************************************************************************
+
+   //**Select function*****************************************************************************
+   /*!\brief Preparation of the filter for the given row/column.
+   //
+   // \param first Iterator to the first element of the row/column.
+   // \param last Iterator one past the last element of the row/column.
+   // \return void
+   //
+   // This function computes the absolute drop tolerance of the given row/column.
+   */
+   template< typename IteratorType >  // Type of the sparse matrix iterator
+   inline void select( IteratorType first, IteratorType last )
+   {
+      RT sum{};
+
+      for( ; first!=last; ++first ) {
+         const RT tmp( abs( first->value() ) );
+         sum += tmp * tmp;
+      }
+
+      bound_ = tol_ * sqrt( sum );
+   }
+   //**********************************************************************************************
+
+   //**Keep function*******************************************************************************
+   /*!\brief Returns whether the given element is kept.
+   //
+   // \param value The value of the element.
+   // \return \a true in case the element is kept, \a false if it is removed.
+   */
+   template< typename T >  // Type of the element
+   inline bool keep( const T& value ) const
+   {
+      return abs( value ) > bound_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   ST tol_;           //!< The relative drop tolerance.
+   BoundType bound_;  //!< The absolute drop tolerance of the current row/column.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pruning filter keeping the \a k largest elements of each row/column.
+// \ingroup sparse_matrix
+//
+// This filter keeps the \a k elements of largest absolute value of each row/column. In case of
+// ties the elements with the smallest indices are kept. Since the filter uses a scratch buffer,
+// every thread has to operate on its own copy.
+*/
+template< typename RT >  // Type of the absolute values of the elements
+class PruneTopK
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor of the PruneTopK filter.
+   //
+   // \param k The number of elements to be kept per row/column.
+   */
+   explicit inline PruneTopK( size_t k )
+      : k_     ( k )      // The number of elements to be kept per row/column
+      , all_   ( true )   // Flag for keeping all elements of the current row/column
+      , bound_ ()         // The smallest absolute value to be kept
+      , ties_  ( 0UL )    // The remaining number of elements equal to the bound to be kept
+      , buffer_()         // Scratch buffer for the absolute values
+   {}
+   //**********************************************************************************************
+
+   //**Select function*****************************************************************************
+   /*!\brief Preparation of the filter for the given row/column.
+   //
+   // \param first Iterator to the first element of the row/column.
+   // \param last Iterator one past the last element of the row/column.
+   // \return void
+   //
+   // This function determines the \a k-th largest absolute value within the given row/column
+   // and the number of elements equal to this value that can be kept.
+   */
+   template< typename IteratorType >  // Type of the sparse matrix iterator
+   void select( IteratorType first, IteratorType last )
+   {
+      buffer_.clear();
+
+      for( ; first!=last; ++first ) {
+         buffer_.push_back( abs( first->value() ) );
+      }
+
+      const size_t n( buffer_.size() );
+
+      all_ = ( n <= k_ );
+
+      if( all_ || k_ == 0UL ) {
+         ties_ = 0UL;
+         return;
+      }
+
+      const auto kth( buffer_.begin() + ( n - k_ ) );
+      std::nth_element( buffer_.begin(), kth, buffer_.end() );
+      bound_ = *kth;
+
+      size_t greater( 0UL );
+      for( auto element=kth+1; element!=buffer_.end(); ++element ) {
+         greater += ( *element > bound_ ) ? 1UL : 0UL;
+      }
+
+      ties_ = k_ - greater;
+   }
+   //**********************************************************************************************
+
+   //**Keep function*******************************************************************************
+   /*!\brief Returns whether the given element is kept.
+   //
+   // \param value The value of the element.
+   // \return \a true in case the element is kept, \a false if it is removed.
+   //
+   // This function must be called for the elements of the row/column in ascending order of
+   // their indices.
+   */
+   template< typename T >  // Type of the element
+   inline bool keep( const T& value )
+   {
+      if( all_ )
+         return true;
+
+      if( k_ == 0UL )
+         return false;
+
+      const RT tmp( abs( value ) );
+
+      if( tmp > bound_ )
+         return true;
+
+      if( tmp == bound_ && ties_ > 0UL ) {
+         --ties_;
+         return true;
+      }
+
+      return false;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   size_t k_;                //!< The number of elements to be kept per row/column.
+   bool all_;                //!< Flag for keeping all elements of the current row/column.
+   RT bound_;                //!< The smallest absolute value to be kept.
+   size_t ties_;             //!< The remaining number of elements equal to the bound to be kept.
+   std::vector<RT> buffer_;  //!< Scratch buffer for the absolute values.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PRUNING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Pruning functions */
+//@{
+template< typename MT, bool SO, typename ST >
+auto prune( SparseMatrix<MT,SO>& sm, ST tol ) -> EnableIf_t< IsNumeric_v<ST> >;
+
+template< typename MT, bool SO, typename Pred >
+auto prune( SparseMatrix<MT,SO>& sm, Pred pred ) -> EnableIf_t< !IsNumeric_v<Pred> >;
+
+template< typename MT, bool SO, typename ST >
+void pruneRelative( SparseMatrix<MT,SO>& sm, ST tol );
+
+template< typename MT, bool SO >
+void pruneTopK( SparseMatrix<MT,SO>& sm, size_t k );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the pruning of a sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The sparse matrix to be pruned.
+// \param filter The filter selecting the elements to be kept.
+// \return void
+//
+// This function removes all elements from the given sparse matrix that are not selected by the
+// given filter. The pruning is performed in two passes: The first pass counts the number of
+// elements to be kept in every row/column, the second pass copies the selected elements into a
+// tight CompressedMatrix, which is allocated in a single allocation and finally moved/assigned
+// to the given sparse matrix. In case SMP parallelization is enabled, both passes are executed
+// in parallel. For that purpose the rows/columns are distributed among the threads such that
+// all threads process approximately the same number of non-zero elements.
+*/
+template< typename MT        // Type of the sparse matrix
+        , bool SO            // Storage order
+        , typename Filter >  // Type of the pruning filter
+void prune_backend( SparseMatrix<MT,SO>& sm, const Filter& filter )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ResultType = CompressedMatrix< ElementType_t<MT>, SO, TagType_t<MT> >;
+
+   const MT& A( *sm );
+   const size_t N( SO ? A.columns() : A.rows() );
+
+   std::vector<size_t> nonzeros( N );
+
+   const auto count = [&]( size_t kbegin, size_t kend )
+   {
+      Filter local( filter );
+
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         local.select( A.begin(k), A.end(k) );
+
+         size_t n( 0UL );
+         for( auto element=A.begin(k); element!=A.end(k); ++element ) {
+            n += local.keep( element->value() ) ? 1UL : 0UL;
+         }
+         nonzeros[k] = n;
+      }
+   };
+
+   ResultType tmp;
+
+   const auto copy = [&]( size_t kbegin, size_t kend )
+   {
+      Filter local( filter );
+
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         local.select( A.begin(k), A.end(k) );
+
+         for( auto element=A.begin(k); element!=A.end(k); ++element ) {
+            if( local.keep( element->value() ) ) {
+               tmp.append( ( SO ? element->index() : k ), ( SO ? k : element->index() ), element->value() );
+            }
+         }
+      }
+   };
+
+   const size_t threads( min( getNumThreads(), max( N, 1UL ) ) );
+
+   if( threads == 1UL || isSerialSectionActive() || isParallelSectionActive() ) {
+      count( 0UL, N );
+      tmp = ResultType( A.rows(), A.columns(), nonzeros );
+      copy( 0UL, N );
+   }
+   else BLAZE_PARALLEL_SECTION
+   {
+      // Distributing the rows/columns such that all threads process the same number of elements
+      SmallArray<size_t,64UL> bounds( threads+1UL, N );
+      bounds[0UL] = 0UL;
+
+      size_t total( 0UL );
+      for( size_t k=0UL; k<N; ++k ) {
+         nonzeros[k] = A.nonZeros( k );
+         total += nonzeros[k];
+      }
+
+      const size_t share( total / threads + 1UL );
+      size_t k( 0UL ), processed( 0UL );
+
+      for( size_t t=1UL; t<threads; ++t ) {
+         while( k < N && processed < t*share ) {
+            processed += nonzeros[k];
+            ++k;
+         }
+         bounds[t] = k;
+      }
+
+      smpFor( threads, [&]( size_t t )
+      {
+         count( bounds[t], bounds[t+1UL] );
+      } );
+
+      tmp = ResultType( A.rows(), A.columns(), nonzeros );
+
+      smpFor( threads, [&]( size_t t )
+      {
+         copy( bounds[t], bounds[t+1UL] );
+      } );
+   }
+
+   *sm = std::move( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all elements below the given absolute drop tolerance from the sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The sparse matrix to be pruned.
+// \param tol The absolute drop tolerance.
+// \return void
+// \exception std::invalid_argument Invalid assignment to restricted matrix.
+//
+// This function removes all elements from the given sparse matrix whose absolute value is
+// smaller than or equal to the given drop tolerance \a tol. In contrast to the \c erase()
+// member functions, the pruned matrix is tightly packed, i.e. it does not contain any free
+// capacity between the rows/columns. Note that a tolerance of 0 removes all explicitly stored
+// zero elements:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL );
+   // ... Initialization
+
+   prune( A, 1E-8 );  // Removes all elements with an absolute value <= 1E-8
+   prune( A, 0.0  );  // Removes all explicitly stored zero elements
+   \endcode
+
+// In case SMP parallelization is enabled, the pruning is performed in parallel. Note that the
+// function requires a temporary copy of all elements to be kept.
+*/
+template< typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order
+        , typename ST >  // Type of the drop tolerance
+inline auto prune( SparseMatrix<MT,SO>& sm, ST tol )
+   -> EnableIf_t< IsNumeric_v<ST> >
+{
+   prune_backend( sm, PruneTolerance<ST>( tol ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all elements matching the given unary predicate from the sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The sparse matrix to be pruned.
+// \param pred The unary predicate selecting the elements to be removed.
+// \return void
+// \exception std::invalid_argument Invalid assignment to restricted matrix.
+//
+// This function removes all elements from the given sparse matrix for which the given unary
+// predicate returns \a true. In contrast to the \c erase() member functions, the pruned matrix
+// is tightly packed, i.e. it does not contain any free capacity between the rows/columns:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL );
+   // ... Initialization
+
+   prune( A, []( double value ){ return value < 0.0; } );  // Removes all negative elements
+   \endcode
+
+// In case SMP parallelization is enabled, the pruning is performed in parallel. Therefore the
+// predicate must be safe to be called concurrently. Note that the function requires a temporary
+// copy of all elements to be kept.
+*/
+template< typename MT      // Type of the sparse matrix
+        , bool SO          // Storage order
+        , typename Pred >  // Type of the unary predicate
+inline auto prune( SparseMatrix<MT,SO>& sm, Pred pred )
+   -> EnableIf_t< !IsNumeric_v<Pred> >
+{
+   prune_backend( sm, PrunePredicate<Pred>( std::move( pred ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all elements below a drop tolerance relative to the norm of their row/column.
+// \ingroup sparse_matrix
+//
+// \param sm The sparse matrix to be pruned.
+// \param tol The relative drop tolerance.
+// \return void
+// \exception std::invalid_argument Invalid assignment to restricted matrix.
+//
+// This function removes all elements from the given sparse matrix whose absolute value is
+// smaller than or equal to \a tol times the Euclidean norm of the according row (in case of a
+// row-major matrix) or column (in case of a column-major matrix). This is the drop rule of the
+// threshold based incomplete factorizations:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL );
+   // ... Initialization
+
+   pruneRelative( A, 1E-4 );  // Removes all elements with |a_ij| <= 1E-4 * ||a_i||_2
+   \endcode
+
+// In case SMP parallelization is enabled, the pruning is performed in parallel. Note that the
+// function requires a temporary copy of all elements to be kept.
+*/
+template< typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order
+        , typename ST >  // Type of the relative drop tolerance
+inline void pruneRelative( SparseMatrix<MT,SO>& sm, ST tol )
+{
+   using RT = decltype( abs( std::declval< ElementType_t<MT> >() ) );
+
+   prune_backend( sm, PruneRelative<ST,RT>( tol ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Keeps only the \a k largest elements of each row/column of the sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The sparse matrix to be pruned.
+// \param k The number of elements to be kept per row/column.
+// \return void
+// \exception std::invalid_argument Invalid assignment to restricted matrix.
+//
+// This function removes all but the \a k elements of largest absolute value from every row (in
+// case of a row-major matrix) or column (in case of a column-major matrix) of the given sparse
+// matrix. In case of ties the elements with the smallest indices are kept:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL );
+   // ... Initialization
+
+   pruneTopK( A, 10UL );  // Keeps the 10 largest elements of every row
+   \endcode
+
+// In case SMP parallelization is enabled, the pruning is performed in parallel. Note that the
+// function requires a temporary copy of all elements to be kept. Also note that in case the
+// pruning of a restricted matrix (as for instance a symmetric matrix) violates the invariants
+// of the matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline void pruneTopK( SparseMatrix<MT,SO>& sm, size_t k )
+{
+   using RT = decltype( abs( std::declval< ElementType_t<MT> >() ) );
+
+   prune_backend( sm, PruneTopK<RT>( k ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
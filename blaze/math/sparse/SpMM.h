@@ -0,0 +1,238 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SpMM.h
+//  \brief Header file for the parallel sparse matrix/dense matrix multiplication kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPMM_H_
+#define _BLAZE_MATH_SPARSE_SPMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/RowMajorMatrix.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/sparse/MergePath.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/SmallArray.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MERGE-PATH SPARSE MATRIX/DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel kernel for the product of a row-major sparse matrix and a dense matrix.
+// \ingroup sparse_matrix
+//
+// \param C The target left-hand side row-major dense matrix.
+// \param A The row-major sparse matrix operand.
+// \param B The dense matrix operand.
+// \param op The (compound) assignment operation.
+// \return void
+//
+// This function implements the parallel (compound) assignment of the product of the row-major
+// sparse matrix \a A and the dense matrix \a B to the row-major dense matrix \a C (\f$ C=A*B
+// \f$). In case the non-zero elements of \a A are distributed evenly among the rows, every thread
+// computes an equally sized block of rows of \a C. Otherwise (as for instance for matrices with a
+// power-law distribution of the non-zero elements) the work is distributed by means of the merge
+// path (see the mergePathSearch() function), i.e. every thread processes approximately the same
+// number of rows plus non-zero elements. The complete rows of every thread are computed by the
+// serial multiplication kernels, rows that are split among several threads are accumulated in
+// private row buffers and assigned in a short serial fix-up step.
+//
+// Both \a A and \a B must be non-computation types, the element type of \a C must not be
+// resizable. Note that the function must be called outside of any parallel section.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , typename MT2   // Type of the sparse matrix operand
+        , typename MT3   // Type of the dense matrix operand
+        , typename OP >  // Type of the assignment operation
+void smpMergePathMultAssign( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE ( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE ( MT3 );
+
+   using ET = ElementType_t<MT1>;
+   using BufferType = CustomVector<ET,unaligned,unpadded,rowVector>;
+
+   const size_t M( (*C).rows() );
+   const size_t N( (*C).columns() );
+   const size_t K( A.columns() );
+
+   BLAZE_INTERNAL_ASSERT( M == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( K == B.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( N == B.columns(), "Invalid number of columns" );
+
+   // Skipping products without columns, which have no row buffers to accumulate split rows in
+   if( N == 0UL )
+      return;
+
+   const size_t threads( min( getNumThreads(), max( M, 1UL ) ) );
+
+   const size_t addon        ( ( ( M % threads ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerThread( M / threads + addon );
+
+   DynamicVector<size_t,false> offsets;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( threads == 1UL || !computeMergePathOffsets( A, threads, rowsPerThread, offsets ) )
+      {
+         smpFor( threads, [&]( size_t t )
+         {
+            const size_t row( t*rowsPerThread );
+
+            if( row >= M )
+               return;
+
+            const size_t m( min( rowsPerThread, M - row ) );
+
+            auto target( submatrix( *C, row, 0UL, m, N, unchecked ) );
+            op( target, submatrix( A, row, 0UL, m, K, unchecked ) * B );
+         } );
+      }
+      else
+      {
+         const size_t nonzeros( offsets[M] );
+         const size_t items( M + nonzeros );
+         const size_t itemsPerThread( ( items - 1UL ) / threads + 1UL );
+
+         // Rows, whose computation is started by one thread and completed by another
+         SmallArray<size_t,64UL> heads  ( threads, M );
+         SmallArray<size_t,64UL> carries( threads, M );
+         DynamicMatrix<ET,rowMajor> headRows ( threads, N );
+         DynamicMatrix<ET,rowMajor> carryRows( threads, N );
+
+         smpFor( threads, [&]( size_t t )
+         {
+            const size_t first( min( t*itemsPerThread, items ) );
+            const size_t last ( min( first+itemsPerThread, items ) );
+
+            const size_t ibegin( mergePathSearch( first, offsets, M, nonzeros ) );
+            const size_t iend  ( mergePathSearch( last , offsets, M, nonzeros ) );
+            const size_t kend  ( last - iend );
+
+            size_t k( first - ibegin );
+            size_t index( ibegin );
+
+            const auto partial = [&]( BufferType& buffer, size_t i, size_t kfirst, size_t klast )
+            {
+               reset( buffer );
+
+               auto element( A.begin(i) );
+               std::advance( element, kfirst - offsets[i] );
+
+               for( ; kfirst<klast; ++kfirst, ++element ) {
+                  addAssign( buffer, element->value() * row( B, element->index(), unchecked ) );
+               }
+            };
+
+            if( ibegin < iend && k > offsets[ibegin] ) {
+               BufferType buffer( headRows.data(t), N );
+               partial( buffer, ibegin, k, offsets[ibegin+1UL] );
+               heads[t] = ibegin;
+               k = offsets[ibegin+1UL];
+               ++index;
+            }
+
+            if( index < iend ) {
+               auto target( submatrix( *C, index, 0UL, iend-index, N, unchecked ) );
+               op( target, submatrix( A, index, 0UL, iend-index, K, unchecked ) * B );
+               k = offsets[iend];
+            }
+
+            if( iend < M && k < kend ) {
+               BufferType buffer( carryRows.data(t), N );
+               partial( buffer, iend, k, kend );
+               carries[t] = iend;
+            }
+         } );
+
+         for( size_t t=0UL; t<threads; ++t )
+         {
+            if( heads[t] == M )
+               continue;
+
+            BufferType buffer( headRows.data(t), N );
+
+            for( size_t s=0UL; s<t; ++s ) {
+               if( carries[s] == heads[t] )
+                  addAssign( buffer, BufferType( carryRows.data(s), N ) );
+            }
+
+            auto target( row( *C, heads[t], unchecked ) );
+            op( target, buffer );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
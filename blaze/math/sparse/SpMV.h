@@ -0,0 +1,440 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SpMV.h
+//  \brief Header file for the parallel sparse matrix/dense vector multiplication kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPMV_H_
+#define _BLAZE_MATH_SPARSE_SPMV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <iterator>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/RowMajorMatrix.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/sparse/MergePath.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/SmallArray.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SCATTER-BASED SPARSE MATRIX/DENSE VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cost-based selection between the scatter and the row split parallelization strategy.
+// \ingroup sparse_matrix
+//
+// \param A The sparse matrix operand.
+// \param size The size of the target vector.
+// \return \a true in case the scatter strategy is preferable, \a false if not.
+//
+// This function estimates the per-thread overhead of the two parallelization strategies for a
+// scatter product (see the smpScatterMultAssign() function). The row split requires every thread
+// to search the index range of its target section in every non-zero list of \a A, whereas the
+// scatter strategy requires every thread to initialize a private accumulator of size \a size and
+// to take part in the final reduction of all accumulators.
+*/
+template< typename MT >  // Type of the sparse matrix operand
+bool preferScatter( const MT& A, size_t size )
+{
+   constexpr bool SO( IsColumnMajorMatrix_v<MT> );
+
+   const size_t lists( SO ? A.columns() : A.rows() );
+
+   if( lists == 0UL )
+      return false;
+
+   const double average( static_cast<double>( A.nonZeros() ) / lists );
+   const double searchCost( lists * std::log2( average + 2.0 ) );
+
+   return 2.0*size < searchCost;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel kernel for the scatter product of a sparse matrix and a dense vector.
+// \ingroup sparse_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The sparse matrix operand.
+// \param x The dense vector operand.
+// \param op The (compound) assignment operation.
+// \return void
+//
+// This function implements the parallel (compound) assignment of the scatter product of the
+// sparse matrix \a A and the dense vector \a x to the dense vector \a y, i.e. the product of a
+// column-major sparse matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$) or the product of
+// a transpose dense vector and a row-major sparse matrix (\f$ \vec{y}^T=\vec{x}^T*A \f$). In
+// both cases every non-zero list of \a A is scattered into the target vector.
+//
+// Depending on the estimated overhead (see the preferScatter() function), the function selects
+// one of two parallelization strategies:
+//
+//  - Scatter: The non-zero lists of \a A are distributed among the threads such that every
+//    thread processes approximately the same number of non-zero elements. Every thread scatters
+//    its lists into a private accumulator. Afterwards all accumulators are reduced in parallel
+//    by means of SIMD-vectorized additions and assigned to the target vector.
+//  - Row split: The target vector is split into equally sized sections and every thread computes
+//    one section by searching the according index range in every non-zero list of \a A.
+//
+// Both \a A and \a x must be non-computation types, the element type of \a y must not be
+// resizable. Note that the function must be called outside of any parallel section.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , bool TF        // Transpose flag of the left-hand side target vector
+        , typename MT    // Type of the sparse matrix operand
+        , typename VT2   // Type of the dense vector operand
+        , typename OP >  // Type of the assignment operation
+void smpScatterMultAssign( DenseVector<VT1,TF>& y, const MT& A, const VT2& x, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE  ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+
+   using ET = ElementType_t<VT1>;
+   using BufferType = CustomVector<ET,unaligned,unpadded,TF>;
+
+   constexpr bool SO( IsColumnMajorMatrix_v<MT> );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t M( (*y).size() );
+   const size_t N( SO ? A.columns() : A.rows() );
+
+   BLAZE_INTERNAL_ASSERT( M == ( SO ? A.rows() : A.columns() ), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( N == x.size(), "Invalid vector size" );
+
+   const size_t threads( min( getNumThreads(), max( M, 1UL ) ) );
+
+   const size_t addon        ( ( ( M % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( M / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( threads > 1UL && preferScatter( A, M ) )
+      {
+         // Distributing the non-zero lists evenly among the threads
+         SmallArray<size_t,64UL> bounds( threads+1UL, N );
+         bounds[0UL] = 0UL;
+
+         const size_t share( A.nonZeros() / threads + 1UL );
+         size_t list( 0UL ), count( 0UL );
+
+         for( size_t t=1UL; t<threads; ++t ) {
+            while( list < N && count < t*share ) {
+               count += A.nonZeros( list );
+               ++list;
+            }
+            bounds[t] = list;
+         }
+
+         DynamicMatrix<ET,rowMajor> buffers( threads, M );
+
+         smpFor( threads, [&]( size_t t )
+         {
+            BufferType buffer( buffers.data(t), M );
+            reset( buffer );
+
+            for( size_t j=bounds[t]; j<bounds[t+1UL]; ++j )
+            {
+               const auto xj( x[j] );
+               const auto end( A.end(j) );
+
+               for( auto element=A.begin(j); element!=end; ++element ) {
+                  if( SO ) buffer[element->index()] += element->value() * xj;
+                  else     buffer[element->index()] += xj * element->value();
+               }
+            }
+         } );
+
+         smpFor( threads, [&]( size_t t )
+         {
+            const size_t index( t*sizePerThread );
+
+            if( index >= M )
+               return;
+
+            const size_t size( min( sizePerThread, M - index ) );
+
+            BufferType buffer( buffers.data(0UL), M );
+            auto sum( subvector( buffer, index, size, unchecked ) );
+
+            for( size_t k=1UL; k<threads; ++k ) {
+               const BufferType partial( buffers.data(k), M );
+               addAssign( sum, subvector( partial, index, size, unchecked ) );
+            }
+
+            auto target( subvector( *y, index, size, unchecked ) );
+            op( target, sum );
+         } );
+      }
+      else
+      {
+         DynamicVector<ET,TF> tmp( M );
+
+         smpFor( threads, [&]( size_t t )
+         {
+            const size_t index( t*sizePerThread );
+
+            if( index >= M )
+               return;
+
+            const size_t size( min( sizePerThread, M - index ) );
+            const size_t last( index + size );
+
+            auto section( subvector( tmp, index, size, unchecked ) );
+            reset( section );
+
+            for( size_t j=0UL; j<N; ++j )
+            {
+               const auto xj( x[j] );
+               const auto end( SO ? A.lowerBound( last, j ) : A.lowerBound( j, last ) );
+
+               for( auto element=( SO ? A.lowerBound( index, j ) : A.lowerBound( j, index ) );
+                    element!=end; ++element ) {
+                  if( SO ) tmp[element->index()] += element->value() * xj;
+                  else     tmp[element->index()] += xj * element->value();
+               }
+            }
+
+            auto target( subvector( *y, index, size, unchecked ) );
+            op( target, section );
+         } );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//=================================================================================================
+//
+//  MERGE-PATH SPARSE MATRIX/DENSE VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel kernel for the product of a row-major sparse matrix and a dense vector.
+// \ingroup sparse_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The row-major sparse matrix operand.
+// \param x The dense vector operand.
+// \param op The (compound) assignment operation.
+// \return void
+//
+// This function implements the parallel (compound) assignment of the product of the row-major
+// sparse matrix \a A and the dense vector \a x to the dense vector \a y (\f$ \vec{y}=A*\vec{x}
+// \f$). In case the non-zero elements of \a A are distributed evenly among the rows, the target
+// vector is split into equally sized sections and every thread computes one section. Otherwise
+// (as for instance for matrices with a power-law distribution of the non-zero elements) the work
+// is distributed by means of the merge path (see the mergePathSearch() function), i.e. every
+// thread processes approximately the same number of rows plus non-zero elements. Rows that are
+// split among several threads are accumulated in a short serial fix-up step.
+//
+// Both \a A and \a x must be non-computation types, the element type of \a y must not be
+// resizable. Note that the function must be called outside of any parallel section.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename MT    // Type of the sparse matrix operand
+        , typename VT2   // Type of the dense vector operand
+        , typename OP >  // Type of the assignment operation
+void smpMergePathMultAssign( DenseVector<VT1,false>& y, const MT& A, const VT2& x, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE   ( MT );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE ( MT );
+
+   using ET = ElementType_t<VT1>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t M( (*y).size() );
+   const size_t N( A.columns() );
+
+   BLAZE_INTERNAL_ASSERT( M == A.rows(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( N == x.size(), "Invalid vector size" );
+
+   const size_t threads( min( getNumThreads(), max( M, 1UL ) ) );
+
+   const size_t addon        ( ( ( M % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( M / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+   DynamicVector<size_t,false> offsets;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( threads == 1UL || !computeMergePathOffsets( A, threads, sizePerThread, offsets ) )
+      {
+         smpFor( threads, [&]( size_t t )
+         {
+            const size_t index( t*sizePerThread );
+
+            if( index >= M )
+               return;
+
+            const size_t size( min( sizePerThread, M - index ) );
+
+            auto target( subvector( *y, index, size, unchecked ) );
+            op( target, submatrix( A, index, 0UL, size, N, unchecked ) * x );
+         } );
+      }
+      else
+      {
+         const size_t nonzeros( offsets[M] );
+         const size_t items( M + nonzeros );
+         const size_t itemsPerThread( ( items - 1UL ) / threads + 1UL );
+
+         // Rows, whose computation is started by one thread and completed by another
+         SmallArray<size_t,64UL> heads  ( threads, M );
+         SmallArray<size_t,64UL> carries( threads, M );
+         SmallArray<ET,64UL> headValues ( threads );
+         SmallArray<ET,64UL> carryValues( threads );
+
+         smpFor( threads, [&]( size_t t )
+         {
+            const size_t first( min( t*itemsPerThread, items ) );
+            const size_t last ( min( first+itemsPerThread, items ) );
+
+            const size_t ibegin( mergePathSearch( first, offsets, M, nonzeros ) );
+            const size_t iend  ( mergePathSearch( last , offsets, M, nonzeros ) );
+            const size_t kend  ( last - iend );
+
+            size_t k( first - ibegin );
+            size_t index( ibegin );
+
+            const auto dot = [&]( size_t i, size_t kfirst, size_t klast )
+            {
+               ET sum{};
+
+               auto element( A.begin(i) );
+               std::advance( element, kfirst - offsets[i] );
+
+               for( ; kfirst<klast; ++kfirst, ++element ) {
+                  sum += element->value() * x[element->index()];
+               }
+
+               return sum;
+            };
+
+            if( ibegin < iend )
+            {
+               if( k > offsets[ibegin] ) {
+                  heads[t] = ibegin;
+                  headValues[t] = dot( ibegin, k, offsets[ibegin+1UL] );
+                  ++index;
+               }
+
+               k = offsets[iend];
+            }
+
+            if( iend < M && k < kend ) {
+               carries[t] = iend;
+               carryValues[t] = dot( iend, k, kend );
+            }
+
+            if( index < iend ) {
+               auto target( subvector( *y, index, iend-index, unchecked ) );
+               op( target, submatrix( A, index, 0UL, iend-index, N, unchecked ) * x );
+            }
+         } );
+
+         for( size_t t=0UL; t<threads; ++t )
+         {
+            if( heads[t] == M )
+               continue;
+
+            for( size_t c=0UL; c<t; ++c ) {
+               if( carries[c] == heads[t] )
+                  headValues[t] += carryValues[c];
+            }
+
+            auto target( subvector( *y, heads[t], 1UL, unchecked ) );
+            op( target, CustomVector<ET,unaligned,unpadded>( &headValues[t], 1UL ) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1410 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SymmetricCompressedMatrix.h
+//  \brief Implementation of a symmetric sparse matrix storing a single triangle
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SYMMETRICCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SYMMETRICCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/adaptors/SymmetricMatrix.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/SameTag.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SMatDeclSymExpr.h>
+#include <blaze/math/expressions/SMatTransExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/SparseMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/SmallArray.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup symmetric_compressed_matrix SymmetricCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Half-storage implementation of a symmetric \f$ N \times N \f$ sparse matrix.
+// \ingroup symmetric_compressed_matrix
+//
+// The SymmetricCompressedMatrix class template represents a symmetric sparse matrix, of which
+// only the lower triangle (including the diagonal) is stored. The type of the elements, the
+// storage order, and the group tag of the matrix can be specified via the three template
+// parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, bool SO, typename Tag >
+   class SymmetricCompressedMatrix;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SymmetricCompressedMatrix can be used
+//          with any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::defaultStorageOrder.
+//  - Tag : optional type parameter to tag the matrix. The default type is \a blaze::Group0.
+//          See \ref grouping_tagging for details.
+//
+// In contrast to the SymmetricMatrix adaptor, which keeps both triangles of the adapted
+// CompressedMatrix in sync, SymmetricCompressedMatrix stores every off-diagonal element only
+// once. The element \f$ a_{ij} \f$ is stored at position \f$ (\max(i,j),\min(i,j)) \f$ of a
+// lower triangular CompressedMatrix, i.e. in case of a row-major matrix row \a i contains
+// the elements \f$ a_{ij} \f$ with \f$ j \le i \f$, in case of a column-major matrix column
+// \a j contains the elements \f$ a_{ij} \f$ with \f$ i \ge j \f$. This halves the memory
+// footprint and, since sparse matrix/vector products are memory bound, also roughly halves
+// the memory traffic of a matrix/vector multiplication:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::SymmetricCompressedMatrix<double,rowMajor> A( 10000UL );
+
+   A.set( 2, 5, 1.0 );       // Sets both a(2,5) and a(5,2); stored at position (5,2)
+   A.insert( 3, 3, 2.0 );    // Inserting a diagonal element
+   A(5,2) == A(2,5);         // Read access to any element of the full matrix
+
+   blaze::DynamicVector<double> x( 10000UL ), y;
+   // ... Initialization
+
+   y = A * x;                // Symmetric matrix/vector multiplication
+   multiply( A, x, y );      // In-place symmetric matrix/vector multiplication
+   \endcode
+
+// The iteration via begin() and end() only traverses the stored elements of a row/column.
+// Since the expression template machinery of \b Blaze relies on iterators over the complete
+// rows/columns of a sparse matrix, SymmetricCompressedMatrix is not a sparse matrix in the
+// sense of the SparseMatrix base class and cannot be used in arbitrary expressions. Instead
+// it provides a specialized symmetric matrix/vector multiplication, which uses every stored
+// element twice (for the contribution to its row and to its column). For all other operations
+// the matrix() function returns the full representation as SymmetricMatrix adaptor:
+
+   \code
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<double,rowMajor> > B( A.matrix() );
+   \endcode
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+class SymmetricCompressedMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = SymmetricCompressedMatrix<Type,SO,Tag>;  //!< Type of this instance.
+   using StorageType    = CompressedMatrix<Type,SO,Tag>;           //!< Type of the triangular storage.
+   using ResultType     = SymmetricMatrix<StorageType>;            //!< Type of the full representation.
+   using ElementType    = Type;                                    //!< Type of the matrix elements.
+   using TagType        = Tag;                                     //!< Tag type of this instance.
+   using ConstReference = ConstReference_t<StorageType>;           //!< Reference to a constant matrix value.
+   using Iterator       = Iterator_t<StorageType>;                 //!< Iterator over non-constant stored elements.
+   using ConstIterator  = ConstIterator_t<StorageType>;            //!< Iterator over constant stored elements.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SymmetricCompressedMatrix();
+   explicit inline SymmetricCompressedMatrix( size_t n );
+   inline SymmetricCompressedMatrix( size_t n, size_t nonzeros );
+
+   template< typename MT, bool SO2 >
+   explicit inline SymmetricCompressedMatrix( const Matrix<MT,SO2>& m );
+
+   SymmetricCompressedMatrix( const SymmetricCompressedMatrix& ) = default;
+   SymmetricCompressedMatrix( SymmetricCompressedMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~SymmetricCompressedMatrix() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   SymmetricCompressedMatrix& operator=( const SymmetricCompressedMatrix& ) & = default;
+   SymmetricCompressedMatrix& operator=( SymmetricCompressedMatrix&& ) & = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   reset();
+   inline void   clear();
+   inline void   resize ( size_t n, bool preserve=true );
+   inline void   reserve( size_t nonzeros );
+   inline void   reserve( size_t i, size_t nonzeros );
+   inline void   trim   ();
+   inline void   swap( SymmetricCompressedMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline Iterator set     ( size_t i, size_t j, const Type& value );
+   inline Iterator insert  ( size_t i, size_t j, const Type& value );
+   inline void     append  ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void     finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Erase and lookup functions******************************************************************
+   /*!\name Erase and lookup functions */
+   //@{
+   inline void          erase( size_t i, size_t j );
+   inline Iterator      find ( size_t i, size_t j );
+   inline ConstIterator find ( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   template< typename Other > inline SymmetricCompressedMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion functions************************************************************************
+   /*!\name Conversion functions */
+   //@{
+   inline const StorageType& storage() const noexcept;
+   inline ResultType         matrix() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   StorageType storage_;  //!< The lower triangle of the symmetric matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SymmetricCompressedMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline SymmetricCompressedMatrix<Type,SO,Tag>::SymmetricCompressedMatrix()
+   : storage_()  // The lower triangle of the symmetric matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a symmetric matrix of size \f$ n \times n \f$.
+//
+// \param n The number of rows and columns of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline SymmetricCompressedMatrix<Type,SO,Tag>::SymmetricCompressedMatrix( size_t n )
+   : storage_( n, n )  // The lower triangle of the symmetric matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a symmetric matrix of size \f$ n \times n \f$.
+//
+// \param n The number of rows and columns of the matrix.
+// \param nonzeros The number of expected stored elements.
+//
+// The \a nonzeros parameter refers to the number of elements in the lower triangle, i.e. every
+// off-diagonal element of the full matrix is counted once.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline SymmetricCompressedMatrix<Type,SO,Tag>::SymmetricCompressedMatrix( size_t n, size_t nonzeros )
+   : storage_( n, n, nonzeros )  // The lower triangle of the symmetric matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a symmetric dense or sparse matrix.
+//
+// \param m Symmetric matrix to be copied.
+// \exception std::invalid_argument Invalid setup of symmetric matrix.
+//
+// This constructor initializes the matrix from the lower triangle of the given matrix. In case
+// the given matrix is not square or not symmetric, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the foreign matrix
+        , bool SO2 >      // Storage order of the foreign matrix
+inline SymmetricCompressedMatrix<Type,SO,Tag>::SymmetricCompressedMatrix( const Matrix<MT,SO2>& m )
+   : storage_()  // The lower triangle of the symmetric matrix
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( !isSquare( *m ) || ( !IsSymmetric_v<MT> && !isSymmetric( *m ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of symmetric matrix" );
+   }
+
+   // Due to the symmetry, the k-th row and the k-th column of the matrix are identical and
+   // the lower triangle can be extracted independent of the storage order of the matrix
+   const CompressedMatrix<Type,SO2,Tag> tmp( *m );
+   const size_t n( tmp.rows() );
+
+   const auto isStored = [&]( size_t index, size_t k ) {
+      return ( SO ? index >= k : index <= k );
+   };
+
+   size_t nonzeros( 0UL );
+   for( size_t k=0UL; k<n; ++k ) {
+      for( auto element=tmp.begin(k); element!=tmp.end(k); ++element ) {
+         if( isStored( element->index(), k ) ) ++nonzeros;
+      }
+   }
+
+   StorageType storage( n, n, nonzeros );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      for( auto element=tmp.begin(k); element!=tmp.end(k); ++element ) {
+         const size_t index( element->index() );
+         if( isStored( index, k ) ) {
+            storage.append( ( SO ? index : k ), ( SO ? k : index ), element->value() );
+         }
+      }
+      storage.finalize( k );
+   }
+
+   storage_.swap( storage );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the symmetric matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename SymmetricCompressedMatrix<Type,SO,Tag>::ConstReference
+   SymmetricCompressedMatrix<Type,SO,Tag>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return storage_( max( i, j ), min( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the symmetric matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename SymmetricCompressedMatrix<Type,SO,Tag>::ConstReference
+   SymmetricCompressedMatrix<Type,SO,Tag>::at( size_t i, size_t j ) const
+{
+   if( i >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first stored element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first stored element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// stored element of row \a i (i.e. the elements \f$ a_{ij} \f$ with \f$ j \le i \f$), in case
+// the storage flag is set to \a columnMajor the function returns an iterator to the first stored
+// element of column \a i (i.e. the elements \f$ a_{ji} \f$ with \f$ j \ge i \f$).
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename SymmetricCompressedMatrix<Type,SO,Tag>::Iterator
+   SymmetricCompressedMatrix<Type,SO,Tag>::begin( size_t i ) noexcept
+{
+   return storage_.begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first stored element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first stored element of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename SymmetricCompressedMatrix<Type,SO,Tag>::ConstIterator
+   SymmetricCompressedMatrix<Type,SO,Tag>::begin( size_t i ) const noexcept
+{
+   return storage_.begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first stored element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first stored element of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename SymmetricCompressedMatrix<Type,SO,Tag>::ConstIterator
+   SymmetricCompressedMatrix<Type,SO,Tag>::cbegin( size_t i ) const noexcept
+{
+   return storage_.cbegin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last stored element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last stored element of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename SymmetricCompressedMatrix<Type,SO,Tag>::Iterator
+   SymmetricCompressedMatrix<Type,SO,Tag>::end( size_t i ) noexcept
+{
+   return storage_.end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last stored element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last stored element of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename SymmetricCompressedMatrix<Type,SO,Tag>::ConstIterator
+   SymmetricCompressedMatrix<Type,SO,Tag>::end( size_t i ) const noexcept
+{
+   return storage_.end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last stored element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last stored element of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename SymmetricCompressedMatrix<Type,SO,Tag>::ConstIterator
+   SymmetricCompressedMatrix<Type,SO,Tag>::cend( size_t i ) const noexcept
+{
+   return storage_.cend( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the symmetric matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t SymmetricCompressedMatrix<Type,SO,Tag>::rows() const noexcept
+{
+   return storage_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the symmetric matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t SymmetricCompressedMatrix<Type,SO,Tag>::columns() const noexcept
+{
+   return storage_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the symmetric matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t SymmetricCompressedMatrix<Type,SO,Tag>::capacity() const noexcept
+{
+   return storage_.capacity();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements in the symmetric matrix.
+//
+// \return The number of stored elements in the lower triangle of the matrix.
+//
+// Note that every off-diagonal non-zero element of the lower triangle represents two non-zero
+// elements of the full matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t SymmetricCompressedMatrix<Type,SO,Tag>::nonZeros() const
+{
+   return storage_.nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of stored elements of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t SymmetricCompressedMatrix<Type,SO,Tag>::nonZeros( size_t i ) const
+{
+   return storage_.nonZeros( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void SymmetricCompressedMatrix<Type,SO,Tag>::reset()
+{
+   storage_.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the symmetric matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the symmetric matrix is 0.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void SymmetricCompressedMatrix<Type,SO,Tag>::clear()
+{
+   storage_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the symmetric matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ n \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void SymmetricCompressedMatrix<Type,SO,Tag>::resize( size_t n, bool preserve )
+{
+   storage_.resize( n, n, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the symmetric matrix.
+//
+// \param nonzeros The new minimum capacity of the symmetric matrix.
+// \return void
+//
+// This function increases the capacity of the symmetric matrix to at least \a nonzeros
+// stored elements. The current values of the matrix elements and the individual capacities
+// of the matrix rows/columns are preserved.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void SymmetricCompressedMatrix<Type,SO,Tag>::reserve( size_t nonzeros )
+{
+   storage_.reserve( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the symmetric matrix.
+//
+// \param i The row/column index \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+//
+// This function increases the capacity of row/column \a i of the symmetric matrix to at least
+// \a nonzeros stored elements. The current values of the matrix and all other individual
+// capacities of the matrix rows/columns are preserved.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void SymmetricCompressedMatrix<Type,SO,Tag>::reserve( size_t i, size_t nonzeros )
+{
+   storage_.reserve( i, nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void SymmetricCompressedMatrix<Type,SO,Tag>::trim()
+{
+   storage_.trim();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two symmetric matrices.
+//
+// \param sm The matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void SymmetricCompressedMatrix<Type,SO,Tag>::swap( SymmetricCompressedMatrix& sm ) noexcept
+{
+   storage_.swap( sm.storage_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting elements of the symmetric matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of the elements \f$ a_{ij} \f$ and \f$ a_{ji} \f$. In case the
+// element is not yet stored, it is inserted into the lower triangle. The returned iterator
+// refers to the stored element at position \f$ (\max(i,j),\min(i,j)) \f$.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename SymmetricCompressedMatrix<Type,SO,Tag>::Iterator
+   SymmetricCompressedMatrix<Type,SO,Tag>::set( size_t i, size_t j, const Type& value )
+{
+   return storage_.set( max( i, j ), min( i, j ), value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting elements into the symmetric matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid sparse matrix access index.
+//
+// This function inserts the elements \f$ a_{ij} \f$ and \f$ a_{ji} \f$ by storing a single
+// element at position \f$ (\max(i,j),\min(i,j)) \f$. Duplicate elements are not allowed. In
+// case the element is already stored, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename SymmetricCompressedMatrix<Type,SO,Tag>::Iterator
+   SymmetricCompressedMatrix<Type,SO,Tag>::insert( size_t i, size_t j, const Type& value )
+{
+   return storage_.insert( max( i, j ), min( i, j ), value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appending elements to the specified row/column of the symmetric matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill the lower triangle of a symmetric matrix
+// with elements. It appends a new element to the end of the specified row/column and works
+// exactly like the append() function of CompressedMatrix, i.e. it requires sufficient capacity
+// and a call to finalize() after every completed row/column. Additionally, all elements have
+// to be part of the lower triangle, i.e. \a j must not be larger than \a i:
+
+   \code
+   // Setup of the symmetric matrix
+   //
+   //       ( 0 1 3 )
+   //   A = ( 1 2 0 )
+   //       ( 3 0 0 )
+   //
+   blaze::SymmetricCompressedMatrix<int,rowMajor> A( 3, 4 );
+
+   A.finalize( 0 );      // Finalizing the empty first row
+   A.append( 1, 0, 1 );  // Appending the element 1 at position (1,0)
+   A.append( 1, 1, 2 );  // Appending the element 2 at position (1,1)
+   A.finalize( 1 );      // Finalizing the second row
+   A.append( 2, 0, 3 );  // Appending the element 3 at position (2,0)
+   A.finalize( 2 );      // Finalizing the third row
+   \endcode
+
+// \note Although append() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void SymmetricCompressedMatrix<Type,SO,Tag>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( j <= i, "Invalid element outside of the lower triangle" );
+
+   storage_.append( i, j, value, check );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row/column.
+//
+// \param i The index of the row/column to be finalized \f$[0..N-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill the lower triangle of
+// a symmetric matrix with elements. After completion of row/column \a i via the append()
+// function, this function can be called to finalize row/column \a i and prepare the next
+// row/column for insertion process via append().
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void SymmetricCompressedMatrix<Type,SO,Tag>::finalize( size_t i )
+{
+   storage_.finalize( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERASE AND LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the symmetric matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function erases both the elements \f$ a_{ij} \f$ and \f$ a_{ji} \f$ from the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void SymmetricCompressedMatrix<Type,SO,Tag>::erase( size_t i, size_t j )
+{
+   storage_.erase( max( i, j ), min( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function searches the stored element representing \f$ a_{ij} \f$ and \f$ a_{ji} \f$.
+// In case the element is found, the function returns an iterator to the element at position
+// \f$ (\max(i,j),\min(i,j)) \f$. Otherwise an iterator just past the last stored element of
+// the according row/column of the lower triangle is returned, i.e. end(max(i,j)) in case of
+// a row-major matrix and end(min(i,j)) in case of a column-major matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename SymmetricCompressedMatrix<Type,SO,Tag>::Iterator
+   SymmetricCompressedMatrix<Type,SO,Tag>::find( size_t i, size_t j )
+{
+   return storage_.find( max( i, j ), min( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function searches the stored element representing \f$ a_{ij} \f$ and \f$ a_{ji} \f$.
+// In case the element is found, the function returns an iterator to the element at position
+// \f$ (\max(i,j),\min(i,j)) \f$. Otherwise an iterator just past the last stored element of
+// the according row/column of the lower triangle is returned, i.e. end(max(i,j)) in case of
+// a row-major matrix and end(min(i,j)) in case of a column-major matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename SymmetricCompressedMatrix<Type,SO,Tag>::ConstIterator
+   SymmetricCompressedMatrix<Type,SO,Tag>::find( size_t i, size_t j ) const
+{
+   return storage_.find( max( i, j ), min( i, j ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scaling of the symmetric matrix by the scalar value \a scalar (\f$ A=A*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the symmetric matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the scalar value
+inline SymmetricCompressedMatrix<Type,SO,Tag>&
+   SymmetricCompressedMatrix<Type,SO,Tag>::scale( const Other& scalar )
+{
+   storage_.scale( scalar );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the lower triangle of the symmetric matrix.
+//
+// \return Reference to the lower triangular storage of the matrix.
+//
+// This function provides access to the stored lower triangle, which can for instance be used
+// as operand of all sparse matrix operations that only require a single triangle.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline const typename SymmetricCompressedMatrix<Type,SO,Tag>::StorageType&
+   SymmetricCompressedMatrix<Type,SO,Tag>::storage() const noexcept
+{
+   return storage_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the full representation of the symmetric matrix.
+//
+// \return The full symmetric matrix.
+//
+// This function expands the symmetric matrix into a SymmetricMatrix adaptor, which stores both
+// triangles and can be used in all expressions. The expansion requires \f$ O(nnz) \f$ operations.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline typename SymmetricCompressedMatrix<Type,SO,Tag>::ResultType
+   SymmetricCompressedMatrix<Type,SO,Tag>::matrix() const
+{
+   const size_t n( rows() );
+   const StorageType upper( trans( storage_ ) );
+
+   StorageType full( n, n, 2UL*storage_.nonZeros() );
+
+   // In case of a row-major matrix the k-th row consists of the k-th row of the lower triangle
+   // followed by the strictly upper part of the k-th row of the transpose, in case of a column-
+   // major matrix the strictly upper part of the k-th column of the transpose comes first
+   for( size_t k=0UL; k<n; ++k )
+   {
+      if( SO ) {
+         for( auto element=upper.begin(k); element!=upper.end(k); ++element ) {
+            if( element->index() < k )
+               full.append( element->index(), k, element->value() );
+         }
+      }
+
+      for( auto element=storage_.begin(k); element!=storage_.end(k); ++element ) {
+         full.append( ( SO ? element->index() : k ), ( SO ? k : element->index() ), element->value() );
+      }
+
+      if( !SO ) {
+         for( auto element=upper.begin(k); element!=upper.end(k); ++element ) {
+            if( element->index() > k )
+               full.append( k, element->index(), element->value() );
+         }
+      }
+
+      full.finalize( k );
+   }
+
+   return ResultType( declsym( full ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYMMETRIC SPARSE MATRIX/DENSE VECTOR MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial kernel for the multiplication of a half-storage symmetric matrix and a dense vector.
+// \ingroup symmetric_compressed_matrix
+//
+// \param A The symmetric matrix operand.
+// \param x The dense vector operand.
+// \param y The target dense vector.
+// \param kbegin The index of the first row/column of the lower triangle to be processed.
+// \param kend The index one past the last row/column of the lower triangle to be processed.
+// \return void
+//
+// This function adds the contribution of the stored rows/columns \f$ [kbegin..kend) \f$ to
+// the target vector \a y. Every stored element is used twice, once for its own row and once
+// for its mirrored position in the upper triangle.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename VT1    // Type of the dense vector operand
+        , typename VT2 >  // Type of the target dense vector
+void symmetricMultiply( const SymmetricCompressedMatrix<Type,SO,Tag>& A, const VT1& x, VT2& y,
+                        size_t kbegin, size_t kend )
+{
+   using ET = ElementType_t<VT2>;
+
+   for( size_t k=kbegin; k<kend; ++k )
+   {
+      const auto xk( x[k] );
+      ET sum{};
+
+      const auto end( A.end(k) );
+      for( auto element=A.begin(k); element!=end; ++element )
+      {
+         const size_t index( element->index() );
+         sum += element->value() * x[index];
+         if( index != k )
+            y[index] += element->value() * xk;
+      }
+
+      y[k] += sum;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a half-storage symmetric matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup symmetric_compressed_matrix
+//
+// \param A The symmetric matrix operand.
+// \param x The dense vector operand.
+// \param y The target dense vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes the product of the symmetric matrix \a A and the dense vector \a x and
+// assigns it to the dense vector \a y, which is resized if necessary. Every stored element of the
+// lower triangle contributes both to its row and to its mirrored column. Due to the symmetry of
+// \a A the function can also be used to compute the product of a transpose dense vector and the
+// matrix (\f$ \vec{y}^T=\vec{x}^T*A \f$):
+
+   \code
+   blaze::SymmetricCompressedMatrix<double> A( 1000UL );
+   blaze::DynamicVector<double,blaze::columnVector> x( 1000UL ), y;
+   blaze::DynamicVector<double,blaze::rowVector> u( 1000UL ), v;
+   // ... Initialization
+
+   multiply( A, x, y );  // Computes y = A * x
+   multiply( A, u, v );  // Computes v = u * A
+   \endcode
+
+// In case SMP parallelization is enabled and the matrix is sufficiently large, the stored
+// rows/columns are distributed among the threads such that all threads process approximately
+// the same number of stored elements. Since the mirrored contributions of different threads
+// may target the same elements of \a y, every thread scatters its contribution into a private
+// buffer, which only covers the range of \a y that can be reached from its rows/columns (i.e.
+// \f$ [0..kend) \f$ for a row-major and \f$ [kbegin..N) \f$ for a column-major matrix).
+// Afterwards the buffers are reduced in parallel by means of SIMD-vectorized additions.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename VT1    // Type of the dense vector operand
+        , typename VT2    // Type of the target dense vector
+        , bool TF >       // Transpose flag of the vectors
+void multiply( const SymmetricCompressedMatrix<Type,SO,Tag>& A,
+               const DenseVector<VT1,TF>& x, DenseVector<VT2,TF>& y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<VT2>;
+   using BufferType = CustomVector<ET,unaligned,unpadded,TF>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   if( (*x).size() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   if( (*x).isAliased( &(*y) ) ) {
+      const ResultType_t<VT1> tmp( *x );
+      multiply( A, tmp, y );
+      return;
+   }
+
+   const size_t N( A.rows() );
+
+   resize( *y, N, false );
+   reset( *y );
+
+   CompositeType_t<VT1> x2( *x );
+
+   const size_t threads( min( getNumThreads(), max( N, 1UL ) ) );
+
+   if( threads == 1UL || N < SMP_SMATDVECMULT_THRESHOLD ||
+       isSerialSectionActive() || isParallelSectionActive() ) {
+      symmetricMultiply( A, x2, *y, 0UL, N );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      // Distributing the rows/columns such that all threads process the same number of elements
+      SmallArray<size_t,64UL> bounds( threads+1UL, N );
+      bounds[0UL] = 0UL;
+
+      const size_t share( A.nonZeros() / threads + 1UL );
+      size_t k( 0UL ), processed( 0UL );
+
+      for( size_t t=1UL; t<threads; ++t ) {
+         while( k < N && processed < t*share ) {
+            processed += A.nonZeros( k );
+            ++k;
+         }
+         bounds[t] = k;
+      }
+
+      // The range of the target vector that can be reached by the given thread
+      const auto first = [&]( size_t t ) { return ( SO ? bounds[t] : 0UL ); };
+      const auto last  = [&]( size_t t ) { return ( SO ? N : bounds[t+1UL] ); };
+
+      DynamicMatrix<ET,rowMajor> buffers( threads, N );
+
+      smpFor( threads, [&]( size_t t )
+      {
+         BufferType buffer( buffers.data(t), N );
+         auto range( subvector( buffer, first(t), last(t)-first(t), unchecked ) );
+         reset( range );
+
+         symmetricMultiply( A, x2, buffer, bounds[t], bounds[t+1UL] );
+      } );
+
+      const size_t addon        ( ( ( N % threads ) != 0UL )? 1UL : 0UL );
+      const size_t equalShare   ( N / threads + addon );
+      const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+      const size_t sizePerThread( ( rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+      smpFor( threads, [&]( size_t t )
+      {
+         const size_t index( t*sizePerThread );
+
+         if( index >= N )
+            return;
+
+         const size_t end( min( index+sizePerThread, N ) );
+
+         for( size_t s=0UL; s<threads; ++s )
+         {
+            const size_t ibegin( max( index, first(s) ) );
+            const size_t iend  ( min( end, last(s) ) );
+
+            if( ibegin >= iend )
+               continue;
+
+            const BufferType partial( buffers.data(s), N );
+            auto target( subvector( *y, ibegin, iend-ibegin, unchecked ) );
+            addAssign( target, subvector( partial, ibegin, iend-ibegin, unchecked ) );
+         }
+      } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a half-storage symmetric matrix and
+//        a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup symmetric_compressed_matrix
+//
+// \param A The symmetric matrix operand.
+// \param x The dense vector operand.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator immediately evaluates the product of the symmetric matrix and the dense vector
+// by means of the multiply() function.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename VT >   // Type of the dense vector operand
+inline DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector >
+   operator*( const SymmetricCompressedMatrix<Type,SO,Tag>& A, const DenseVector<VT,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicVector< MultTrait_t< Type, ElementType_t<VT> >, columnVector > y;
+   multiply( A, x, y );
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a transpose dense vector and a
+//        half-storage symmetric matrix (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+// \ingroup symmetric_compressed_matrix
+//
+// \param x The transpose dense vector operand.
+// \param A The symmetric matrix operand.
+// \return The resulting transpose dense vector.
+// \exception std::invalid_argument Vector and matrix sizes do not match.
+//
+// This operator immediately evaluates the product of the dense vector and the symmetric matrix
+// by means of the multiply() function.
+*/
+template< typename VT     // Type of the dense vector operand
+        , typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DynamicVector< MultTrait_t< ElementType_t<VT>, Type >, rowVector >
+   operator*( const DenseVector<VT,rowVector>& x, const SymmetricCompressedMatrix<Type,SO,Tag>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicVector< MultTrait_t< ElementType_t<VT>, Type >, rowVector > y;
+   multiply( A, x, y );
+   return y;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYMMETRICCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SymmetricCompressedMatrix operators */
+//@{
+template< typename Type, bool SO, typename Tag >
+void reset( SymmetricCompressedMatrix<Type,SO,Tag>& m );
+
+template< typename Type, bool SO, typename Tag >
+void clear( SymmetricCompressedMatrix<Type,SO,Tag>& m );
+
+template< typename Type, bool SO, typename Tag >
+void swap( SymmetricCompressedMatrix<Type,SO,Tag>& a, SymmetricCompressedMatrix<Type,SO,Tag>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given symmetric matrix.
+// \ingroup symmetric_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void reset( SymmetricCompressedMatrix<Type,SO,Tag>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given symmetric matrix.
+// \ingroup symmetric_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void clear( SymmetricCompressedMatrix<Type,SO,Tag>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two symmetric matrices.
+// \ingroup symmetric_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void swap( SymmetricCompressedMatrix<Type,SO,Tag>& a,
+                  SymmetricCompressedMatrix<Type,SO,Tag>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -56,6 +56,7 @@ namespace blaze {
 constexpr bool usePadding               = BLAZE_USE_PADDING;
 constexpr bool useStreaming             = BLAZE_USE_STREAMING;
 constexpr bool useOptimizedKernels      = BLAZE_USE_OPTIMIZED_KERNELS;
+constexpr bool useFixedSizeKernels      = BLAZE_USE_FIXED_SIZE_KERNELS;
 constexpr bool useDefaultInitialization = BLAZE_USE_DEFAULT_INITIALIZATION;
 /*! \endcond */
 //*************************************************************************************************
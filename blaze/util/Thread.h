@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <blaze/util/Assert.h>
@@ -306,12 +307,12 @@ class Thread
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   volatile bool   terminated_;  //!< Thread termination flag.
-                                 /*!< This flag value is used by the managing thread
-                                      pool to learn whether the thread has terminated
-                                      its execution. */
-   ThreadPoolType* pool_;        //!< Handle to the managing thread pool.
-   ThreadHandle    thread_;      //!< Handle to the thread of execution.
+   std::atomic<bool> terminated_;  //!< Thread termination flag.
+                                   /*!< This flag value is used by the managing thread
+                                        pool to learn whether the thread has terminated
+                                        its execution. */
+   ThreadPoolType*   pool_;        //!< Handle to the managing thread pool.
+   ThreadHandle      thread_;      //!< Handle to the thread of execution.
    //@}
    //**********************************************************************************************
 
@@ -40,11 +40,14 @@
 // Includes
 //*************************************************************************************************
 
+#include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <memory>
 #include <vector>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Exception.h>
+#include <blaze/util/MaybeUnused.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Thread.h>
@@ -193,6 +196,31 @@ namespace blaze {
 // for the given functions/functors.
 //
 //
+// \section threadpool_idle_timeout Idle timeout
+//
+// By default, all threads of a thread pool are kept alive until the pool is resized or
+// destroyed. Via the setIdleTimeout() function it is possible to specify a duration after
+// which idle threads terminate. This does not change the size of the thread pool: terminated
+// threads are restarted on demand as soon as new tasks are scheduled, or explicitly by means
+// of the warmup() function:
+
+   \code
+   StdThreadPool threadpool( 8 );
+
+   // Terminating all threads that have been idle for at least five seconds
+   threadpool.setIdleTimeout( std::chrono::seconds( 5 ) );
+
+   // ... Using the thread pool
+
+   // Restarting all terminated threads in advance of a latency critical section
+   threadpool.warmup();
+   \endcode
+
+// Note that the idle timeout requires a condition variable that accepts \c std::chrono
+// durations (as for instance \c std::condition_variable). For any other condition variable
+// type, idle threads are kept alive.
+//
+//
 // \section threadpool_exception Throwing exceptions in a thread parallel environment
 //
 // It can happen that during the execution of a given task a thread encounters an erroneous
@@ -330,6 +358,7 @@ class ThreadPool
    /*!\name Constructor */
    //@{
    explicit ThreadPool( size_t n );
+   ThreadPool( size_t n, std::chrono::milliseconds timeout );
    //@}
    //**********************************************************************************************
 
@@ -347,6 +376,7 @@ class ThreadPool
    inline size_t size()    const;
    inline size_t active()  const;
    inline size_t ready()   const;
+   inline size_t running() const;
    //@}
    //**********************************************************************************************
 
@@ -361,9 +391,11 @@ class ThreadPool
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   void resize( size_t n, bool block=false );
-   void wait();
-   void clear();
+   void resize        ( size_t n, bool block=false );
+   void wait          ();
+   void clear         ();
+   void warmup        ();
+   void setIdleTimeout( std::chrono::milliseconds timeout );
    //@}
    //**********************************************************************************************
 
@@ -372,23 +404,36 @@ class ThreadPool
    /*!\name Thread functions */
    //@{
    void createThread();
+   void joinThreads();
+   bool waitForTask( Lock& lock );
    bool executeTask();
+
+   template< typename C, typename L >
+   static auto waitFor( C& cond, L& lock, std::chrono::milliseconds timeout, int )
+      -> decltype( cond.wait_for( lock, timeout ) == std::cv_status::no_timeout );
+
+   template< typename C, typename L >
+   static bool waitFor( C& cond, L& lock, std::chrono::milliseconds timeout, long );
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   volatile size_t total_;     //!< Total number of threads in the thread pool.
-   volatile size_t expected_;  //!< Expected number of threads in the thread pool.
-                               /*!< This number may differ from the total number of threads
-                                    during a resize of the thread pool. */
-   volatile size_t active_;    //!< Number of currently active/busy threads.
-   Threads threads_;           //!< The threads contained in the thread pool.
-   TaskQueue taskqueue_;       //!< Task queue for the scheduled tasks.
-   mutable Mutex mutex_;       //!< Synchronization mutex.
-   Condition waitForTask_;     //!< Wait condition for idle threads.
-   Condition waitForThread_;   //!< Wait condition for the thread management.
+   volatile size_t total_;              //!< Total number of threads in the thread pool.
+   volatile size_t expected_;           //!< Expected number of threads in the thread pool.
+                                        /*!< This number may differ from the total number of
+                                             threads during a resize of the thread pool or in
+                                             case idle threads have been terminated. */
+   volatile size_t active_;             //!< Number of currently active/busy threads.
+   Threads threads_;                    //!< The threads contained in the thread pool.
+   TaskQueue taskqueue_;                //!< Task queue for the scheduled tasks.
+   mutable Mutex mutex_;                //!< Synchronization mutex.
+   Condition waitForTask_;              //!< Wait condition for idle threads.
+   Condition waitForThread_;            //!< Wait condition for the thread management.
+   std::chrono::milliseconds timeout_;  //!< Idle timeout of the threads.
+                                        /*!< In case of a zero timeout idle threads are kept
+                                             alive. */
    //@}
    //**********************************************************************************************
 
@@ -422,14 +467,31 @@ template< typename TT    // Type of the encapsulated thread
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
 ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
-   : total_   ( 0UL )  // Total number of threads in the thread pool
-   , expected_( 0UL )  // Expected number of threads in the thread pool
-   , active_  ( 0UL )  // Number of currently active/busy threads
-   , threads_      ()  // The threads contained in the thread pool
-   , taskqueue_    ()  // Task queue for the scheduled tasks
-   , mutex_        ()  // Synchronization mutex
-   , waitForTask_  ()  // Wait condition for idle threads
-   , waitForThread_()  // Wait condition for the thread management
+   : ThreadPool( n, std::chrono::milliseconds::zero() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadPool class.
+//
+// \param n Initial number of threads \f$[1..\infty)\f$.
+// \param timeout The idle timeout of the threads (see setIdleTimeout()).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n, std::chrono::milliseconds timeout )
+   : total_   ( 0UL )      // Total number of threads in the thread pool
+   , expected_( 0UL )      // Expected number of threads in the thread pool
+   , active_  ( 0UL )      // Number of currently active/busy threads
+   , threads_      ()      // The threads contained in the thread pool
+   , taskqueue_    ()      // Task queue for the scheduled tasks
+   , mutex_        ()      // Synchronization mutex
+   , waitForTask_  ()      // Wait condition for idle threads
+   , waitForThread_()      // Wait condition for the thread management
+   , timeout_( timeout )  // Idle timeout of the threads
 {
    resize( n );
 }
@@ -559,6 +621,27 @@ inline size_t ThreadPool<TT,MT,LT,CT>::ready() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the number of currently running threads.
+//
+// \return The number of running threads.
+//
+// This function returns the number of threads of the pool that are currently running. In case
+// idle threads have been terminated due to the idle timeout (see setIdleTimeout()), this number
+// is smaller than the size of the thread pool.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadPool<TT,MT,LT,CT>::running() const
+{
+   Lock lock( mutex_ );
+   return total_;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -576,7 +659,8 @@ inline size_t ThreadPool<TT,MT,LT,CT>::ready() const
 //
 // This function schedules the given function/functor for execution. The given function/functor
 // must be copyable, must be callable with the given type and number of arguments and must return
-// \c void.
+// \c void. In case there are less idle threads than scheduled tasks and some threads of the pool
+// have been terminated due to the idle timeout, a new thread is started.
 */
 template< typename TT         // Type of the encapsulated thread
         , typename MT         // Type of the synchronization mutex
@@ -588,6 +672,12 @@ void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
 {
    Lock lock( mutex_ );
    taskqueue_.push( std::bind<void>( func, std::forward<Args>( args )... ) );
+
+   if( total_ < expected_ && taskqueue_.size() > total_ - active_ ) {
+      joinThreads();
+      createThread();
+   }
+
    waitForTask_.notify_one();
 }
 //*************************************************************************************************
@@ -662,6 +752,7 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
       if( n > expected_ ) {
          for( size_t i=expected_; i<n; ++i )
             createThread();
+         expected_ = n;
       }
 
       // Removing threads from the pool
@@ -669,19 +760,13 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
          expected_ = n;
          waitForTask_.notify_all();
 
-         while( block && total_ != expected_ ) {
+         while( block && total_ > expected_ ) {
             waitForThread_.wait( lock );
          }
       }
 
       // Joining and destroying any terminated thread
-      for( typename Threads::iterator thread=threads_.begin(); thread!=threads_.end(); ) {
-         if( (*thread)->hasTerminated() ) {
-            (*thread)->join();
-            thread = threads_.erase( thread );
-         }
-         else ++thread;
-      }
+      joinThreads();
    }
 }
 //*************************************************************************************************
@@ -729,6 +814,58 @@ void ThreadPool<TT,MT,LT,CT>::clear()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Restarting all threads that have been terminated due to the idle timeout.
+//
+// \return void
+//
+// This function restarts all threads of the pool that have been terminated due to the idle
+// timeout (see setIdleTimeout()), such that all threads are available for the next scheduled
+// tasks. It can for instance be used in advance of a latency critical section.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::warmup()
+{
+   Lock lock( mutex_ );
+
+   joinThreads();
+
+   while( total_ < expected_ ) {
+      createThread();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the idle timeout of the threads.
+//
+// \param timeout The new idle timeout, zero to keep idle threads alive.
+// \return void
+//
+// This function sets the duration after which idle threads terminate. The size of the thread
+// pool is not affected: terminated threads are restarted on demand as soon as new tasks are
+// scheduled (see schedule()) or explicitly via the warmup() function. In case of a zero
+// timeout (the default), idle threads are kept alive until the pool is resized or destroyed.
+// Note that the idle timeout has no effect in case the condition variable of the thread pool
+// does not accept \c std::chrono durations.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::setIdleTimeout( std::chrono::milliseconds timeout )
+{
+   Lock lock( mutex_ );
+   timeout_ = timeout;
+   waitForTask_.notify_all();
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -738,9 +875,12 @@ void ThreadPool<TT,MT,LT,CT>::clear()
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Adding a new thread to the thread pool.
+/*!\brief Starting a new thread of the thread pool.
 //
 // \return void
+//
+// This function starts a new thread of the thread pool. Note that it does not change the
+// expected number of threads.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -750,12 +890,106 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
 {
    threads_.push_back( std::unique_ptr<ManagedThread>( new ManagedThread( this ) ) );
    ++total_;
-   ++expected_;
    ++active_;
 }
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Joining and destroying all terminated threads.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::joinThreads()
+{
+   for( typename Threads::iterator thread=threads_.begin(); thread!=threads_.end(); ) {
+      if( (*thread)->hasTerminated() ) {
+         (*thread)->join();
+         thread = threads_.erase( thread );
+      }
+      else ++thread;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for a new task to be scheduled.
+//
+// \param lock The lock of the synchronization mutex.
+// \return \a false in case the idle timeout has expired, \a true if not.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+bool ThreadPool<TT,MT,LT,CT>::waitForTask( Lock& lock )
+{
+   if( timeout_ == std::chrono::milliseconds::zero() ) {
+      waitForTask_.wait( lock );
+      return true;
+   }
+
+   return waitFor( waitForTask_, lock, timeout_, 0 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting on the given condition variable for the given duration.
+//
+// \param cond The condition variable to wait on.
+// \param lock The lock of the synchronization mutex.
+// \param timeout The maximum waiting duration.
+// \return \a false in case the timeout has expired, \a true if not.
+//
+// This overload is selected for all condition variables accepting \c std::chrono durations.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+template< typename C     // Type of the condition variable
+        , typename L >   // Type of the mutex lock
+auto ThreadPool<TT,MT,LT,CT>::waitFor( C& cond, L& lock, std::chrono::milliseconds timeout, int )
+   -> decltype( cond.wait_for( lock, timeout ) == std::cv_status::no_timeout )
+{
+   return cond.wait_for( lock, timeout ) == std::cv_status::no_timeout;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting on the given condition variable without timeout.
+//
+// \param cond The condition variable to wait on.
+// \param lock The lock of the synchronization mutex.
+// \param timeout The maximum waiting duration (ignored).
+// \return \a true.
+//
+// This overload is selected for all condition variables that do not accept \c std::chrono
+// durations. In this case the idle timeout has no effect.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+template< typename C     // Type of the condition variable
+        , typename L >   // Type of the mutex lock
+bool ThreadPool<TT,MT,LT,CT>::waitFor( C& cond, L& lock, std::chrono::milliseconds timeout, long )
+{
+   MAYBE_UNUSED( timeout );
+
+   cond.wait( lock );
+   return true;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Executing a scheduled task.
 //
@@ -763,7 +997,8 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
 //
 // This function is repeatedly called by every thread to execute one of the scheduled tasks.
 // In case there is no task available, the thread blocks and waits for a new task to be
-// scheduled.
+// scheduled. In case no task is scheduled within the idle timeout (see setIdleTimeout()),
+// the function returns \a false and the thread terminates.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -787,7 +1022,12 @@ bool ThreadPool<TT,MT,LT,CT>::executeTask()
             return false;
          }
 
-         waitForTask_.wait( lock );
+         if( !waitForTask( lock ) && taskqueue_.isEmpty() ) {
+            --total_;
+            waitForThread_.notify_all();
+            return false;
+         }
+
          ++active_;
       }
 
@@ -96,6 +96,36 @@ const MatrixStructure structure( random );
 
 
 
+//=================================================================================================
+//
+//  BASELINE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Significance level for the comparison of the Blaze kernels with a baseline.
+//
+// This value specifies the significance level of the Mann-Whitney U test that is used to decide
+// whether the timings of a Blaze kernel differ from the timings stored in a baseline file (see
+// the \a -compare-baseline command line argument). The default setting is 0.05.
+*/
+const double significance( 0.05 );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Tolerated slowdown of the Blaze kernels compared to a baseline [%].
+//
+// This value specifies by how many percent a Blaze kernel may be slower than the baseline before
+// a statistically significant slowdown is reported as regression. The default setting is 2.0.
+*/
+const double tolerance( 2.0 );
+//*************************************************************************************************
+
+
+
+
+
 //=================================================================================================
 //
 //  RANDOM NUMBER CONFIGURATION
@@ -0,0 +1,528 @@
+//=================================================================================================
+/*!
+//  \file blazemark/util/Baseline.h
+//  \brief Header file for the storage and comparison of benchmark baselines
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZEMARK_UTIL_BASELINE_H_
+#define _BLAZEMARK_UTIL_BASELINE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+#include <blazemark/util/Benchmarks.h>
+#include <blazemark/util/Timer.h>
+
+
+namespace blazemark {
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Timing samples of a single benchmark run (in seconds per step).
+*/
+using Samples = std::vector<double>;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Timing samples of a single benchmark run of a specific benchmark.
+//
+// A baseline file contains one entry per line, which consists of the name of the benchmark,
+// the parameters of the benchmark run (e.g. "1000" for a vector size of 1000 or "1000:10" for
+// a sparse matrix with 1000 rows and 10 non-zero elements per row), the number of samples and
+// the samples in seconds per step:
+
+   \code
+   dvecdvecadd 1000 3 1.1702e-07 1.1695e-07 1.1711e-07
+   \endcode
+*/
+struct BaselineEntry
+{
+   std::string benchmark;  //!< The name of the benchmark.
+   std::string run;        //!< The parameters of the benchmark run.
+   Samples samples;        //!< The timing samples of the benchmark run.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STATISTICS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the median of the given samples.
+//
+// \param samples The timing samples.
+// \return The median of the samples.
+*/
+inline double median( Samples samples )
+{
+   if( samples.empty() )
+      return 0.0;
+
+   const size_t n( samples.size() );
+   std::sort( samples.begin(), samples.end() );
+
+   return ( n % 2UL )?( samples[n/2UL] ):( 0.5 * ( samples[n/2UL-1UL] + samples[n/2UL] ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Two-sided Mann-Whitney U test for two sets of samples.
+//
+// \param a The first set of samples.
+// \param b The second set of samples.
+// \return The p-value of the hypothesis that both sets stem from the same distribution.
+//
+// This function uses the normal approximation of the U statistic including the correction for
+// ties and the continuity correction. The approximation requires about 8 or more samples per
+// set; for fewer samples the returned p-value is conservative.
+*/
+inline double mannWhitney( const Samples& a, const Samples& b )
+{
+   const size_t n1( a.size() );
+   const size_t n2( b.size() );
+   const size_t n ( n1 + n2 );
+
+   if( n1 == 0UL || n2 == 0UL )
+      return 1.0;
+
+   std::vector< std::pair<double,size_t> > values;
+   values.reserve( n );
+   for( double value : a ) values.emplace_back( value, 0UL );
+   for( double value : b ) values.emplace_back( value, 1UL );
+   std::sort( values.begin(), values.end() );
+
+   // Computing the rank sum of the first set (with average ranks for ties)
+   double rankSum( 0.0 ), ties( 0.0 );
+
+   for( size_t i=0UL; i<n; )
+   {
+      size_t j( i+1UL );
+      while( j < n && values[j].first == values[i].first ) ++j;
+
+      const double rank( 0.5 * ( i + j + 1UL ) );
+      const double t( j - i );
+      ties += t*t*t - t;
+
+      for( size_t k=i; k<j; ++k ) {
+         if( values[k].second == 0UL ) rankSum += rank;
+      }
+
+      i = j;
+   }
+
+   const double u    ( rankSum - 0.5 * n1 * ( n1 + 1UL ) );
+   const double mu   ( 0.5 * n1 * n2 );
+   const double sigma( std::sqrt( n1 * n2 / 12.0 * ( ( n + 1.0 ) - ties / ( n * ( n - 1.0 ) ) ) ) );
+
+   if( sigma == 0.0 )
+      return 1.0;
+
+   const double z( std::max( std::abs( u - mu ) - 0.5, 0.0 ) / sigma );
+
+   return std::erfc( z / std::sqrt( 2.0 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bootstrap confidence interval for the speedup between two sets of samples.
+//
+// \param baseline The timing samples of the baseline.
+// \param current The current timing samples.
+// \return The lower and upper bound of the 95% confidence interval.
+//
+// This function estimates the 95% confidence interval of the ratio of the medians of the two
+// sets of samples by means of 2000 bootstrap resamples (percentile method). The resampling is
+// deterministic due to the use of the configured seed.
+*/
+inline std::pair<double,double> bootstrapSpeedup( const Samples& baseline, const Samples& current )
+{
+   const size_t resamples( 2000UL );
+
+   std::mt19937 rng( static_cast<std::mt19937::result_type>( seed ) );
+   std::uniform_int_distribution<size_t> pickBaseline( 0UL, baseline.size()-1UL );
+   std::uniform_int_distribution<size_t> pickCurrent ( 0UL, current.size()-1UL );
+
+   Samples b( baseline.size() ), c( current.size() ), speedups( resamples );
+
+   for( size_t r=0UL; r<resamples; ++r ) {
+      for( double& value : b ) value = baseline[pickBaseline( rng )];
+      for( double& value : c ) value = current[pickCurrent( rng )];
+      speedups[r] = median( b ) / median( c );
+   }
+
+   std::sort( speedups.begin(), speedups.end() );
+
+   return std::make_pair( speedups[( resamples * 25UL ) / 1000UL],
+                          speedups[( resamples * 975UL ) / 1000UL - 1UL] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BASELINE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the timing samples of all benchmark runs of the current benchmark.
+//
+// \return Reference to the list of recorded samples.
+*/
+inline std::vector< std::pair<std::string,Samples> >& recordedSamples()
+{
+   static std::vector< std::pair<std::string,Samples> > samples;
+   return samples;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the recordSamples() function for the last run parameter.
+//
+// \param os The output stream for the parameters of the benchmark run.
+// \return void
+*/
+inline void printRunParameters( std::ostream& /*os*/ )
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the recordSamples() function for the run parameters.
+//
+// \param os The output stream for the parameters of the benchmark run.
+// \param param The next parameter of the benchmark run.
+// \param params The remaining parameters of the benchmark run.
+// \return void
+*/
+template< typename T        // Type of the next run parameter
+        , typename... Ts >  // Types of the remaining run parameters
+inline void printRunParameters( std::ostream& os, const T& param, const Ts&... params )
+{
+   os << ':' << param;
+   printRunParameters( os, params... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the timing samples of the last Blaze kernel.
+//
+// \param steps The number of steps per time measurement.
+// \param param The first parameter of the benchmark run (e.g. the size of the vectors).
+// \param params The remaining parameters of the benchmark run (e.g. the number of non-zeros).
+// \return void
+//
+// This function moves all time measurements recorded by the blazemark::Timer of the last Blaze
+// kernel to the samples of the current benchmark run. The samples are normalized by the given
+// number of steps, such that they are independent of the estimated number of steps of a run.
+*/
+template< typename T        // Type of the first run parameter
+        , typename... Ts >  // Types of the remaining run parameters
+void recordSamples( size_t steps, const T& param, const Ts&... params )
+{
+   std::ostringstream run;
+   run << param;
+   printRunParameters( run, params... );
+
+   Samples samples;
+   samples.swap( Timer::samples() );
+
+   for( double& sample : samples ) {
+      sample /= steps;
+   }
+
+   recordedSamples().emplace_back( run.str(), std::move( samples ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading the given baseline file.
+//
+// \param file The name of the baseline file.
+// \param required \a true in case the baseline file must exist, \a false if not.
+// \return The entries of the baseline file.
+// \exception std::runtime_error Invalid baseline file.
+//
+// In case the file cannot be opened and \a required is \a false (as for instance when a new
+// baseline file is created), an empty list of entries is returned. In case \a required is
+// \a true, a \a std::runtime_error exception is thrown instead.
+*/
+inline std::vector<BaselineEntry> readBaseline( const std::string& file, bool required = false )
+{
+   std::vector<BaselineEntry> entries;
+   std::ifstream in( file.c_str() );
+   std::string line;
+
+   if( !in && required ) {
+      throw std::runtime_error( "Unable to read baseline file '" + file + "'" );
+   }
+
+   while( std::getline( in, line ) )
+   {
+      if( line.empty() || line[0] == '#' )
+         continue;
+
+      std::istringstream iss( line );
+      BaselineEntry entry;
+      size_t n( 0UL );
+
+      if( !( iss >> entry.benchmark >> entry.run >> n ) ) {
+         throw std::runtime_error( "Invalid baseline entry '" + line + "' in '" + file + "'" );
+      }
+
+      entry.samples.resize( n );
+      for( double& sample : entry.samples ) {
+         if( !( iss >> sample ) ) {
+            throw std::runtime_error( "Invalid baseline entry '" + line + "' in '" + file + "'" );
+         }
+      }
+
+      entries.push_back( std::move( entry ) );
+   }
+
+   return entries;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Storing the recorded samples of the given benchmark in a baseline file.
+//
+// \param benchmark The name of the benchmark.
+// \param file The name of the baseline file.
+// \return void
+// \exception std::runtime_error Invalid baseline file.
+//
+// This function replaces all entries of the given benchmark in the given baseline file by the
+// recorded samples. The entries of all other benchmarks are preserved, i.e. the same baseline
+// file can be used for all benchmarks.
+*/
+inline void saveBaseline( const std::string& benchmark, const std::string& file )
+{
+   std::vector<BaselineEntry> entries( readBaseline( file ) );
+
+   entries.erase( std::remove_if( entries.begin(), entries.end(),
+                                  [&]( const BaselineEntry& entry ) {
+                                     return entry.benchmark == benchmark;
+                                  } ),
+                  entries.end() );
+
+   for( const auto& samples : recordedSamples() ) {
+      entries.push_back( BaselineEntry{ benchmark, samples.first, samples.second } );
+   }
+
+   std::ofstream out( file.c_str() );
+   out << "# Blazemark baseline: <benchmark> <run> <number of samples> <seconds per step>...\n"
+       << std::setprecision( 10 );
+
+   for( const BaselineEntry& entry : entries ) {
+      out << entry.benchmark << ' ' << entry.run << ' ' << entry.samples.size();
+      for( double sample : entry.samples ) {
+         out << ' ' << sample;
+      }
+      out << '\n';
+   }
+
+   if( !out ) {
+      throw std::runtime_error( "Unable to write baseline file '" + file + "'" );
+   }
+
+   std::cout << "   Stored " << recordedSamples().size() << " Blaze runs in '" << file << "'\n";
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparing the recorded samples of the given benchmark to a baseline file.
+//
+// \param benchmark The name of the benchmark.
+// \param file The name of the baseline file.
+// \return \a true in case no regression was detected, \a false if not.
+// \exception std::runtime_error Invalid baseline file.
+//
+// This function compares the recorded samples of all runs of the given benchmark to the samples
+// stored in the given baseline file and prints the speedup (i.e. the ratio of the median time
+// of the baseline and the current median time), the 95% bootstrap confidence interval of the
+// speedup, and the p-value of the two-sided Mann-Whitney U test. A run is reported as regression
+// in case the difference is significant (see blazemark::significance), the confidence interval
+// lies entirely below 1, and the speedup is below 1 minus the tolerated slowdown (see
+// blazemark::tolerance). Runs without baseline samples are reported as missing and fail the
+// comparison as well. In case the baseline file cannot be read or does not contain any entry of
+// the given benchmark, a \a std::runtime_error exception is thrown.
+*/
+inline bool compareBaseline( const std::string& benchmark, const std::string& file )
+{
+   const std::vector<BaselineEntry> entries( readBaseline( file, true ) );
+
+   const auto isBenchmark = [&]( const BaselineEntry& entry ) {
+      return entry.benchmark == benchmark;
+   };
+
+   if( std::none_of( entries.begin(), entries.end(), isBenchmark ) ) {
+      throw std::runtime_error( "No baseline of '" + benchmark + "' in '" + file + "'" );
+   }
+
+   size_t regressions( 0UL ), missing( 0UL );
+
+   std::cout << "   Blaze baseline comparison [speedup (95% CI), p-value]:\n" << std::fixed;
+
+   for( const auto& samples : recordedSamples() )
+   {
+      std::cout << "     " << std::setw(12) << samples.first << "  ";
+
+      const auto entry( std::find_if( entries.begin(), entries.end(),
+                                      [&]( const BaselineEntry& e ) {
+                                         return e.benchmark == benchmark && e.run == samples.first;
+                                      } ) );
+
+      if( entry == entries.end() || entry->samples.empty() || samples.second.empty() ) {
+         std::cout << "no baseline  MISSING\n";
+         ++missing;
+         continue;
+      }
+
+      const double speedup( median( entry->samples ) / median( samples.second ) );
+      const std::pair<double,double> ci( bootstrapSpeedup( entry->samples, samples.second ) );
+      const double p( mannWhitney( entry->samples, samples.second ) );
+
+      std::cout << std::setprecision(3) << speedup
+                << " (" << ci.first << "-" << ci.second << ")  "
+                << "p=" << std::setprecision(4) << p;
+
+      if( p < significance && ci.second < 1.0 && speedup < 1.0 - tolerance*0.01 ) {
+         std::cout << "  REGRESSION";
+         ++regressions;
+      }
+      else if( p < significance && ci.first > 1.0 && speedup > 1.0 + tolerance*0.01 ) {
+         std::cout << "  improvement";
+      }
+
+      std::cout << "\n";
+   }
+
+   std::cout.unsetf( std::ios_base::floatfield );
+   std::cout << std::setprecision(6);
+
+   if( regressions > 0UL ) {
+      std::cerr << "   " << regressions << " Blaze regression(s) detected compared to '"
+                << file << "'\n";
+   }
+
+   if( missing > 0UL ) {
+      std::cerr << "   " << missing << " Blaze run(s) without baseline in '" << file << "'\n";
+   }
+
+   return regressions == 0UL && missing == 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Storing and comparing the recorded samples of the given benchmark.
+//
+// \param benchmark The name of the benchmark.
+// \param benchmarks The benchmark configuration.
+// \return \a true in case of success, \a false in case of a regression or an error.
+//
+// This function compares the recorded timing samples of the Blaze kernels with the baseline
+// file given via the \a -compare-baseline command line argument and afterwards stores them in
+// the baseline file given via the \a -save-baseline command line argument. The result should
+// be used as exit code of the benchmark, which allows to gate library upgrades and changes of
+// the compiler flags by the measured performance:
+
+   \code
+   ./dvecdvecadd -only-blaze -reps 10 -save-baseline base.txt      // Old configuration
+   ./dvecdvecadd -only-blaze -reps 10 -compare-baseline base.txt   // New configuration
+   \endcode
+*/
+inline bool processBaseline( const std::string& benchmark, const Benchmarks& benchmarks )
+{
+   bool success( true );
+
+   try {
+      if( !benchmarks.compareBaseline.empty() ) {
+         success = compareBaseline( benchmark, benchmarks.compareBaseline );
+      }
+      if( !benchmarks.saveBaseline.empty() ) {
+         saveBaseline( benchmark, benchmarks.saveBaseline );
+      }
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during baseline processing: " << ex.what() << "\n";
+      return false;
+   }
+
+   return success;
+}
+//*************************************************************************************************
+
+} // namespace blazemark
+
+#endif
@@ -43,7 +43,9 @@
 #include <cstring>
 #include <sstream>
 #include <stdexcept>
+#include <string>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -137,6 +139,14 @@ struct Benchmarks
                             is available for a particular benchmark, the kernel is included in the
                             benchmark tests. In case the runEigen flag is set to \a false, the
                             Eigen kernel will be skipped.*/
+   std::string saveBaseline;     //!< File for the storage of the Blaze timing samples.
+                                 /*!< In case the file name is not empty, the timing samples of
+                                      the Blaze kernels are stored as baseline in the given file
+                                      (see blazemark/util/Baseline.h). */
+   std::string compareBaseline;  //!< File for the comparison of the Blaze timing samples.
+                                 /*!< In case the file name is not empty, the timing samples of
+                                      the Blaze kernels are compared to the baseline stored in
+                                      the given file (see blazemark/util/Baseline.h). */
    //@}
    //**********************************************************************************************
 };
@@ -166,6 +176,8 @@ inline Benchmarks::Benchmarks()
    , runFLENS    ( blazemark::runFLENS     )  // Flag value for the FLENS benchmark kernels
    , runMTL      ( blazemark::runMTL       )  // Flag value for the MTL benchmark kernels
    , runEigen    ( blazemark::runEigen     )  // Flag value for the Eigen benchmark kernels
+   , saveBaseline   ()                          // File for the storage of the timing samples
+   , compareBaseline()                          // File for the comparison of the timing samples
 {}
 //*************************************************************************************************
 
@@ -223,9 +235,14 @@ inline Benchmarks::Benchmarks()
 //   - \a -eigen: Activates the Eigen kernels.
 //   - \a -no-eigen: Deactivates the Eigen kernels.
 //   - \a -only-eigen: Activates the Eigen kernels and deactivates all other.
+//   - \a -reps \a <n>: Sets the number of repetitions of the Blaze kernels (i.e. the number
+//     of timing samples per benchmark run) to \a n.
+//   - \a -save-baseline \a <file>: Stores the timing samples of the Blaze kernels in \a file.
+//   - \a -compare-baseline \a <file>: Compares the timing samples of the Blaze kernels to the
+//     baseline stored in \a file.
 //
-// In case an unknown command line option is encountered, a \a std::invalid_argument exception
-// is thrown.
+// In case an unknown command line option or an invalid value is encountered, a
+// \a std::invalid_argument exception is thrown.
 */
 inline void parseCommandLineArguments( int argc, char** argv, Benchmarks& benchmarks )
 {
@@ -440,6 +457,22 @@ inline void parseCommandLineArguments( int argc, char** argv, Benchmarks& benchm
          benchmarks.runMTL       = false;
          benchmarks.runEigen     = true;
       }
+      else if( std::strcmp( argv[i], "-reps" ) == 0 && i+1 < argc ) {
+         std::istringstream iss( argv[++i] );
+         size_t repetitions( 0UL );
+         if( !( iss >> repetitions ) || repetitions == 0UL ) {
+            std::ostringstream oss;
+            oss << " Invalid number of repetitions: '" << argv[i] << "'";
+            throw std::invalid_argument( oss.str() );
+         }
+         Timer::setRepetitions( repetitions );
+      }
+      else if( std::strcmp( argv[i], "-save-baseline" ) == 0 && i+1 < argc ) {
+         benchmarks.saveBaseline = argv[++i];
+      }
+      else if( std::strcmp( argv[i], "-compare-baseline" ) == 0 && i+1 < argc ) {
+         benchmarks.compareBaseline = argv[++i];
+      }
       else {
          std::ostringstream oss;
          oss << " Unknown command line argument: '" << argv[i] << "'";
@@ -0,0 +1,184 @@
+//=================================================================================================
+/*!
+//  \file blazemark/util/Timer.h
+//  \brief Header file for the recording wall clock timer of the Blaze kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZEMARK_UTIL_TIMER_H_
+#define _BLAZEMARK_UTIL_TIMER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/util/Timing.h>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+
+
+namespace blazemark {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Wall clock timer recording all time measurements of a benchmark kernel.
+//
+// The Timer class extends the wall clock timer of the Blaze library by two features required
+// for the storage and comparison of baselines (see blazemark/util/Baseline.h):
+//
+//  - every measured time is appended to the list of samples, which is cleared as soon as the
+//    samples are stored for the according benchmark run;
+//  - the number of repetitions of a kernel defaults to the configured number of repetitions
+//    (see blazemark/config/Config.h), but can be increased via the \a -reps command line
+//    argument in order to collect sufficiently many samples for a statistical comparison.
+*/
+class Timer : public ::blaze::timing::WcTimer
+{
+ public:
+   //**Timing functions****************************************************************************
+   /*!\name Timing functions */
+   //@{
+   inline void end();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t               repetitions();
+   static inline void                 setRepetitions( size_t repetitions );
+   static inline std::vector<double>& samples();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   static inline size_t& repetitionsRef();
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TIMING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Ending of a time measurement.
+//
+// \return void
+//
+// This function ends the currently running time measurement and appends the measured time to
+// the list of samples.
+*/
+inline void Timer::end()
+{
+   ::blaze::timing::WcTimer::end();
+   samples().push_back( last() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of repetitions of a benchmark kernel.
+//
+// \return The number of repetitions.
+*/
+inline size_t Timer::repetitions()
+{
+   return repetitionsRef();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the number of repetitions of a benchmark kernel.
+//
+// \param repetitions The new number of repetitions.
+// \return void
+*/
+inline void Timer::setRepetitions( size_t repetitions )
+{
+   repetitionsRef() = repetitions;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the list of all recorded time measurements.
+//
+// \return Reference to the list of samples.
+*/
+inline std::vector<double>& Timer::samples()
+{
+   static std::vector<double> samples;
+   return samples;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a reference to the number of repetitions of a benchmark kernel.
+//
+// \return Reference to the number of repetitions.
+*/
+inline size_t& Timer::repetitionsRef()
+{
+   static size_t repetitions( reps );
+   return repetitions;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blazemark
+
+#endif
@@ -41,10 +41,10 @@
 #include <vector>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/CG.h>
 #include <blazemark/blaze/init/DynamicVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 namespace blazemark {
 
@@ -88,7 +88,7 @@ double cg( size_t N, size_t steps, size_t iterations )
    ::blaze::CompressedMatrix<element_t,rowMajor> A( NN, NN, nnz );
    ::blaze::DynamicVector<element_t,columnVector> x( NN ), b( NN ), r( NN ), d( NN ), h( NN ), start( NN );
    element_t alpha, beta, delta;
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       for( size_t j=0UL; j<N; ++j ) {
@@ -103,7 +103,7 @@ double cg( size_t N, size_t steps, size_t iterations )
    reset( b );
    init( start );
 
-   for( size_t rep=0UL; rep<reps; ++rep )
+   for( size_t rep=0UL; rep<timer.repetitions(); ++rep )
    {
       timer.start();
       for( size_t step=0UL; step<steps; ++step )
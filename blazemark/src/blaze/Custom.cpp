@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <blaze/Math.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/Custom.h>
 #include <blazemark/blaze/Init.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -76,7 +76,7 @@ double custom( size_t /*N*/, size_t /*F*/, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    //** INITIALIZATIONS **
 
@@ -84,7 +84,7 @@ double custom( size_t /*N*/, size_t /*F*/, size_t steps )
    //** INITIAL KERNEL CALL **
 
 
-   for( size_t rep=0UL; rep<reps; ++rep )
+   for( size_t rep=0UL; rep<timer.repetitions(); ++rep )
    {
       timer.start();
       for( size_t step=0UL; step<steps; ++step ) {
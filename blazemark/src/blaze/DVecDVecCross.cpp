@@ -41,10 +41,10 @@
 #include <vector>
 #include <blaze/math/StaticVector.h>
 #include <blaze/util/AlignedAllocator.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/DVecDVecCross.h>
 #include <blazemark/blaze/init/StaticVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -78,7 +78,7 @@ double dvecdveccross( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::std::vector< VectorType, AllocatorType > a( N ), b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       init( a[i] );
@@ -89,7 +89,7 @@ double dvecdveccross( size_t N, size_t steps )
       c[i] = noalias( a[i] % b[i] );
    }
 
-   for( size_t rep=0UL; rep<reps; ++rep )
+   for( size_t rep=0UL; rep<timer.repetitions(); ++rep )
    {
       timer.start();
       for( size_t step=0UL, i=0UL; step<steps; ++step, ++i ) {
@@ -41,10 +41,10 @@
 #include <vector>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/util/AlignedAllocator.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/StaticMatrix.h>
 #include <blazemark/blaze/Mat3TMat3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -82,7 +82,7 @@ double mat3tmat3mult( size_t N, size_t steps )
 
    ::std::vector< RowMajorMatrixType, RowMajorAllocatorType > A( N ), C( N );
    ::std::vector< ColumnMajorMatrixType, ColumnMajorAllocatorType > B( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       init( A[i] );
@@ -93,7 +93,7 @@ double mat3tmat3mult( size_t N, size_t steps )
       C[i] = noalias( A[i] * B[i] );
    }
 
-   for( size_t rep=0UL; rep<reps; ++rep )
+   for( size_t rep=0UL; rep<timer.repetitions(); ++rep )
    {
       timer.start();
       for( size_t step=0UL, i=0UL; step<steps; ++step, ++i ) {
@@ -42,11 +42,11 @@
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/util/AlignedAllocator.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/SVecDVecCross.h>
 #include <blazemark/blaze/init/CompressedVector.h>
 #include <blazemark/blaze/init/StaticVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -82,7 +82,7 @@ double svecdveccross( size_t N, size_t F, size_t steps )
 
    ::std::vector< ::blaze::CompressedVector<element_t,columnVector> > a( N );
    ::std::vector< VectorType, AllocatorType > b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       a[i].resize( 3UL );
@@ -94,7 +94,7 @@ double svecdveccross( size_t N, size_t F, size_t steps )
       c[i] = noalias( a[i] % b[i] );
    }
 
-   for( size_t rep=0UL; rep<reps; ++rep )
+   for( size_t rep=0UL; rep<timer.repetitions(); ++rep )
    {
       timer.start();
       for( size_t step=0UL, i=0UL; step<steps; ++step, ++i ) {
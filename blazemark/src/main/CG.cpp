@@ -59,6 +59,7 @@
 #include <blazemark/system/GMM.h>
 #include <blazemark/system/MTL.h>
 #include <blazemark/system/Types.h>
+#include <blazemark/util/Baseline.h>
 #include <blazemark/util/Benchmarks.h>
 #include <blazemark/util/Parser.h>
 #include <blazemark/util/SolverRun.h>
@@ -231,6 +232,7 @@ void cg( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t steps     ( run->getSteps() );
          const size_t iterations( run->getIterations() );
          run->setBlazeResult( blazemark::blaze::cg( N, steps, iterations ) );
+         blazemark::recordSamples( steps, N, iterations );
          const double mflops( ( ( 13UL*N*N - 8UL*N - 1UL ) * steps +
                                 ( 19UL*N*N - 8UL*N ) * steps * iterations ) / run->getBlazeResult() / 1E6 );
          std::cout << "     " << std::setw(12) << N << mflops << std::endl;
@@ -354,6 +356,9 @@ int main( int argc, char** argv )
       return EXIT_FAILURE;
    }
 
+   if( !blazemark::processBaseline( "cg", benchmarks ) )
+      return EXIT_FAILURE;
+
    return EXIT_SUCCESS;
 }
 //*************************************************************************************************
@@ -69,6 +69,7 @@
 #include <blazemark/system/GMM.h>
 #include <blazemark/system/MTL.h>
 #include <blazemark/system/Types.h>
+#include <blazemark/util/Baseline.h>
 #include <blazemark/util/Benchmarks.h>
 #include <blazemark/util/DynamicDenseRun.h>
 #include <blazemark/util/Parser.h>
@@ -234,6 +235,7 @@ void complex3( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setBlazeResult( blazemark::blaze::complex3( N, steps ) );
+         blazemark::recordSamples( steps, N );
          const double mflops( run->getFlops() * steps / run->getBlazeResult() / 1E6 );
          std::cout << "     " << std::setw(12) << N << mflops << std::endl;
       }
@@ -388,6 +390,9 @@ int main( int argc, char** argv )
       return EXIT_FAILURE;
    }
 
+   if( !blazemark::processBaseline( "complex3", benchmarks ) )
+      return EXIT_FAILURE;
+
    return EXIT_SUCCESS;
 }
 //*************************************************************************************************
@@ -62,6 +62,7 @@
 #include <blazemark/system/GMM.h>
 #include <blazemark/system/MTL.h>
 #include <blazemark/system/Types.h>
+#include <blazemark/util/Baseline.h>
 #include <blazemark/util/Benchmarks.h>
 #include <blazemark/util/DynamicSparseRun.h>
 #include <blazemark/util/Parser.h>
@@ -179,6 +180,7 @@ void custom( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t F    ( run->getNonZeros() );
          const size_t steps( run->getSteps()    );
          run->setBlazeResult( blazemark::blaze::custom( N, F, steps ) );
+         blazemark::recordSamples( steps, N, F );
          std::cout << "     " << std::setw(12) << run->getSize() << run->getBlazeResult() << std::endl;
       }
    }
@@ -318,6 +320,9 @@ int main( int argc, char** argv )
       return EXIT_FAILURE;
    }
 
+   if( !blazemark::processBaseline( "custom", benchmarks ) )
+      return EXIT_FAILURE;
+
    return EXIT_SUCCESS;
 }
 //*************************************************************************************************
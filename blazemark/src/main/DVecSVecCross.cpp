@@ -55,6 +55,7 @@
 #include <blazemark/blaze/init/StaticVector.h>
 #include <blazemark/system/Config.h>
 #include <blazemark/system/Types.h>
+#include <blazemark/util/Baseline.h>
 #include <blazemark/util/Benchmarks.h>
 #include <blazemark/util/Parser.h>
 #include <blazemark/util/StaticSparseRun.h>
@@ -218,6 +219,7 @@ void dvecsveccross( std::vector<Run>& runs, Benchmarks benchmarks )
             const size_t F     ( run->getNonZeros() );
             const size_t steps ( run->getSteps()    );
             run->setBlazeResult( blazemark::blaze::dvecsveccross( N, F, steps ) );
+            blazemark::recordSamples( steps, N, F );
             const double mflops( run->getFlops() * steps / run->getBlazeResult() / 1E6 );
             std::cout << "     " << std::setw(12) << N << mflops << std::endl;
          }
@@ -281,6 +283,9 @@ int main( int argc, char** argv )
       return EXIT_FAILURE;
    }
 
+   if( !blazemark::processBaseline( "dvecsveccross", benchmarks ) )
+      return EXIT_FAILURE;
+
    return EXIT_SUCCESS;
 }
 //*************************************************************************************************
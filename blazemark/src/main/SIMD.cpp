@@ -0,0 +1,1272 @@
+//=================================================================================================
+/*!
+//  \file src/main/SIMD.cpp
+//  \brief Source file for the Blaze SIMD primitive microbenchmark
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDDiv.h>
+#include <blaze/math/typetraits/HasSIMDExp.h>
+#include <blaze/math/typetraits/HasSIMDMax.h>
+#include <blaze/math/typetraits/HasSIMDMin.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSqrt.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Timing.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+
+
+//=================================================================================================
+//
+//  CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Minimum wall clock time of a single timing sample (in seconds).
+*/
+constexpr double minTime = 0.01;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of timing samples per measurement (the fastest sample is reported).
+*/
+constexpr size_t samples = 5UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of dependent operations per call of a latency kernel.
+*/
+constexpr size_t chainLength = 1024UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Padding of all buffers (in elements).
+//
+// The padding accommodates the unaligned loads and stores, which are shifted by one element,
+// and the operand packs of the latency kernels. It is a multiple of the largest SIMD width
+// (64 8-bit integers in case of AVX-512).
+*/
+constexpr size_t padding = 512UL;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compiler barrier for the scalar reference loops.
+//
+// \return void
+//
+// The barrier forces the compiler to assume that all memory may have changed. Placed inside a
+// scalar loop it prevents the auto-vectorization of the loop, such that the scalar reference
+// really measures scalar code, and between two repetitions of a kernel it prevents that the
+// repetitions are merged or removed. Local variables that are kept in registers (for instance
+// the value of a dependency chain) are not affected.
+*/
+BLAZE_ALWAYS_INLINE void barrier() noexcept
+{
+#if defined(__GNUC__)
+   asm volatile( "" ::: "memory" );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the given element type.
+//
+// \return The name of the element type.
+*/
+template< typename T > const char* typeName();
+template<> const char* typeName<float>               () { return "float";           }
+template<> const char* typeName<double>              () { return "double";          }
+template<> const char* typeName<std::complex<float>> () { return "complex<float>";  }
+template<> const char* typeName<std::complex<double>>() { return "complex<double>"; }
+template<> const char* typeName<int8_t>              () { return "int8_t";          }
+template<> const char* typeName<int16_t>             () { return "int16_t";         }
+template<> const char* typeName<int32_t>             () { return "int32_t";         }
+template<> const char* typeName<int64_t>             () { return "int64_t";         }
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the instruction set the benchmark has been compiled for.
+//
+// \return The name of the compiled instruction set.
+*/
+std::string isaName()
+{
+   std::string isa;
+
+#if BLAZE_AVX512F_MODE
+   isa = "AVX-512F";
+#  if BLAZE_AVX512BW_MODE
+   isa += "/BW";
+#  endif
+#  if BLAZE_AVX512DQ_MODE
+   isa += "/DQ";
+#  endif
+#elif BLAZE_MIC_MODE
+   isa = "MIC";
+#elif BLAZE_AVX2_MODE
+   isa = "AVX2";
+#elif BLAZE_AVX_MODE
+   isa = "AVX";
+#elif BLAZE_SSE4_MODE
+   isa = "SSE4";
+#elif BLAZE_SSSE3_MODE
+   isa = "SSSE3";
+#elif BLAZE_SSE3_MODE
+   isa = "SSE3";
+#elif BLAZE_SSE2_MODE
+   isa = "SSE2";
+#elif BLAZE_SSE_MODE
+   isa = "SSE";
+#else
+   isa = "none (scalar)";
+#endif
+
+#if BLAZE_FMA_MODE
+   isa += " + FMA";
+#endif
+#if BLAZE_SVML_MODE
+   isa += " + SVML";
+#endif
+#if BLAZE_SLEEF_MODE
+   isa += " + Sleef";
+#endif
+#if BLAZE_XSIMD_MODE
+   isa += " + XSIMD";
+#endif
+
+   return isa;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the executing CPU supports the compiled instruction set.
+//
+// \return The name of the first missing CPU feature, \a nullptr if all features are available.
+//
+// The check is only performed for GCC compatible compilers on x86 platforms. On all other
+// platforms it is assumed that the CPU supports the compiled instruction set.
+*/
+const char* missingFeature()
+{
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+   __builtin_cpu_init();
+#  if BLAZE_AVX512BW_MODE
+   if( !__builtin_cpu_supports( "avx512bw" ) ) return "avx512bw";
+#  endif
+#  if BLAZE_AVX512DQ_MODE
+   if( !__builtin_cpu_supports( "avx512dq" ) ) return "avx512dq";
+#  endif
+#  if BLAZE_AVX512F_MODE
+   if( !__builtin_cpu_supports( "avx512f" ) ) return "avx512f";
+#  endif
+#  if BLAZE_FMA_MODE
+   if( !__builtin_cpu_supports( "fma" ) ) return "fma";
+#  endif
+#  if BLAZE_AVX2_MODE
+   if( !__builtin_cpu_supports( "avx2" ) ) return "avx2";
+#  endif
+#  if BLAZE_AVX_MODE
+   if( !__builtin_cpu_supports( "avx" ) ) return "avx";
+#  endif
+#  if BLAZE_SSE4_MODE
+   if( !__builtin_cpu_supports( "sse4.1" ) ) return "sse4.1";
+#  endif
+#  if BLAZE_SSSE3_MODE
+   if( !__builtin_cpu_supports( "ssse3" ) ) return "ssse3";
+#  endif
+#  if BLAZE_SSE3_MODE
+   if( !__builtin_cpu_supports( "sse3" ) ) return "sse3";
+#  endif
+#endif
+   return nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the runtime of the given kernel.
+//
+// \param kernel The kernel to be measured.
+// \param work The number of operations performed by a single call of the kernel.
+// \return The runtime per operation (in nanoseconds).
+//
+// The number of repetitions is doubled until a single sample takes at least \a minTime seconds.
+// Afterwards \a samples samples are taken and the fastest one is reported.
+*/
+template< typename Kernel >
+double measure( Kernel kernel, size_t work )
+{
+   blaze::timing::WcTimer timer;
+   size_t reps( 1UL );
+
+   while( true ) {
+      timer.start();
+      for( size_t rep=0UL; rep<reps; ++rep ) {
+         kernel();
+         barrier();
+      }
+      timer.end();
+      if( timer.last() >= minTime ) break;
+      reps *= 2UL;
+   }
+
+   double best( std::numeric_limits<double>::max() );
+
+   for( size_t sample=0UL; sample<samples; ++sample ) {
+      timer.start();
+      for( size_t rep=0UL; rep<reps; ++rep ) {
+         kernel();
+         barrier();
+      }
+      timer.end();
+      best = std::min( best, timer.last() );
+   }
+
+   return best * 1E9 / ( reps * work );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BUFFERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The aligned, L1-resident operand buffers of the microbenchmark.
+//
+// The input buffers \a a, \a b, and \a c are initialized with small positive values, which keep
+// all operations free of overflow, denormals, and division by zero. The \a ops and \a zeros
+// buffers provide the operands of the latency kernels.
+*/
+template< typename T >
+struct Buffers
+{
+   explicit Buffers( size_t size )
+      : n    ( size )
+      , a    ( blaze::allocate<T>( size + padding ) )
+      , b    ( blaze::allocate<T>( size + padding ) )
+      , c    ( blaze::allocate<T>( size + padding ) )
+      , d    ( blaze::allocate<T>( size + padding ) )
+      , ops  ( blaze::allocate<T>( padding ) )
+      , zeros( blaze::allocate<T>( padding ) )
+   {
+      for( size_t i=0UL; i<size+padding; ++i ) {
+         a[i] = T( 1 + i%7UL );
+         b[i] = T( 1 + i%5UL );
+         c[i] = T( 1 + i%3UL );
+         d[i] = T( 0 );
+      }
+      std::fill( zeros, zeros+padding, T( 0 ) );
+   }
+
+   ~Buffers()
+   {
+      blaze::deallocate( a );
+      blaze::deallocate( b );
+      blaze::deallocate( c );
+      blaze::deallocate( d );
+      blaze::deallocate( ops );
+      blaze::deallocate( zeros );
+   }
+
+   Buffers( const Buffers& ) = delete;
+   Buffers& operator=( const Buffers& ) = delete;
+
+   size_t n;  //!< The number of elements per buffer.
+   T* a;      //!< The first input buffer.
+   T* b;      //!< The second input buffer.
+   T* c;      //!< The third input buffer.
+   T* d;      //!< The output buffer.
+   T* ops;    //!< The operands of the latency kernels.
+   T* zeros;  //!< Zero operands for the latency kernel of the fused multiply-add.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default properties of a SIMD primitive.
+//
+// Every primitive provides the following interface:
+//  - \a name(): the name of the primitive in the result table
+//  - \a Applicable<T>: whether the primitive is defined for the element type \a T
+//  - \a Vectorized<T>: whether Blaze provides a SIMD implementation for the element type \a T
+//  - \a emulation<T>(): a short description in case the SIMD implementation is emulated by
+//    means of other instructions, \a nullptr otherwise
+//  - \a neutral<T>(): the operand of the latency kernel
+//  - \a simd() and \a scalar(): the throughput kernels
+//  - \a Chained: whether the primitive provides the latency kernels \a simdChain() and
+//    \a scalarChain()
+*/
+struct Primitive
+{
+   template< typename T >
+   using Applicable = blaze::TrueType;
+
+   template< typename T >
+   using Vectorized = blaze::BoolConstant< blaze::IsVectorizable_v<T> >;
+
+   template< typename T >
+   static const char* emulation() { return nullptr; }
+
+   template< typename T >
+   static T neutral() { return T( 0 ); }
+
+   using Chained = blaze::FalseType;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Throughput kernel of the aligned and unaligned SIMD loads.
+//
+// The loaded values are accumulated into four independent accumulators, which keeps the kernel
+// bound by the loads instead of the latency of the additions.
+*/
+template< bool Aligned >
+struct LoadKernel : public Primitive
+{
+   static const char* name() { return Aligned ? "loada" : "loadu"; }
+
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE blaze::SIMDTrait_t<T> load( const T* address ) noexcept
+   {
+      return Aligned ? blaze::loada( address ) : blaze::loadu( address+1UL );
+   }
+
+   template< typename T >
+   static void simd( Buffers<T>& buf )
+   {
+      constexpr size_t SIMDSIZE( blaze::SIMDTrait<T>::size );
+
+      const T* a( buf.a );
+      blaze::SIMDTrait_t<T> x1( load( a ) ), x2( load( a+SIMDSIZE ) ),
+                            x3( load( a+SIMDSIZE*2UL ) ), x4( load( a+SIMDSIZE*3UL ) );
+
+      for( size_t i=SIMDSIZE*4UL; i<buf.n; i+=SIMDSIZE*4UL ) {
+         x1 = x1 + load( a+i             );
+         x2 = x2 + load( a+i+SIMDSIZE    );
+         x3 = x3 + load( a+i+SIMDSIZE*2UL );
+         x4 = x4 + load( a+i+SIMDSIZE*3UL );
+      }
+
+      blaze::storea( buf.d, ( x1 + x2 ) + ( x3 + x4 ) );
+   }
+
+   template< typename T >
+   static void scalar( Buffers<T>& buf )
+   {
+      const T* a( buf.a + ( Aligned ? 0UL : 1UL ) );
+      T x1( a[0UL] ), x2( a[1UL] ), x3( a[2UL] ), x4( a[3UL] );
+
+      for( size_t i=4UL; i<buf.n; i+=4UL ) {
+         x1 += a[i    ];
+         x2 += a[i+1UL];
+         x3 += a[i+2UL];
+         x4 += a[i+3UL];
+         barrier();
+      }
+
+      buf.d[0UL] = ( x1 + x2 ) + ( x3 + x4 );
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Throughput kernel of the aligned, unaligned, and streaming SIMD stores.
+*/
+template< size_t Mode >  // 0: storea, 1: storeu, 2: stream
+struct StoreKernel : public Primitive
+{
+   static const char* name() { return Mode == 0UL ? "storea" : Mode == 1UL ? "storeu" : "stream"; }
+
+   template< typename T >
+   static void simd( Buffers<T>& buf )
+   {
+      constexpr size_t SIMDSIZE( blaze::SIMDTrait<T>::size );
+
+      const blaze::SIMDTrait_t<T> x( blaze::loada( buf.c ) );
+
+      for( size_t i=0UL; i<buf.n; i+=SIMDSIZE ) {
+         if( Mode == 0UL )      blaze::storea( buf.d+i, x );
+         else if( Mode == 1UL ) blaze::storeu( buf.d+i+1UL, x );
+         else                   blaze::stream( buf.d+i, x );
+      }
+   }
+
+   template< typename T >
+   static void scalar( Buffers<T>& buf )
+   {
+      const T x( buf.c[0UL] );
+      T* d( buf.d + ( Mode == 1UL ? 1UL : 0UL ) );
+
+      for( size_t i=0UL; i<buf.n; ++i ) {
+         d[i] = x;
+         barrier();
+      }
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Throughput kernel of the SIMD broadcast (set).
+*/
+struct SetKernel : public Primitive
+{
+   static const char* name() { return "set"; }
+
+   template< typename T >
+   static void simd( Buffers<T>& buf )
+   {
+      constexpr size_t SIMDSIZE( blaze::SIMDTrait<T>::size );
+
+      for( size_t i=0UL; i<buf.n; i+=SIMDSIZE ) {
+         blaze::storea( buf.d+i, blaze::set( buf.a[i] ) );
+      }
+   }
+
+   template< typename T >
+   static void scalar( Buffers<T>& buf )
+   {
+      for( size_t i=0UL; i<buf.n; ++i ) {
+         buf.d[i] = buf.a[i];
+         barrier();
+      }
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Throughput and latency kernels of the binary elementwise SIMD operations.
+//
+// The latency kernel repeatedly combines the result of the previous operation with the neutral
+// operand of the operation, which keeps the values of the dependency chain constant.
+*/
+template< typename OP >
+struct BinaryKernel : public Primitive
+{
+   using Chained = blaze::TrueType;
+
+   template< typename T >
+   static void simd( Buffers<T>& buf )
+   {
+      constexpr size_t SIMDSIZE( blaze::SIMDTrait<T>::size );
+
+      for( size_t i=0UL; i<buf.n; i+=SIMDSIZE ) {
+         blaze::storea( buf.d+i, OP::apply( blaze::loada( buf.a+i ), blaze::loada( buf.b+i ) ) );
+      }
+   }
+
+   template< typename T >
+   static void scalar( Buffers<T>& buf )
+   {
+      for( size_t i=0UL; i<buf.n; ++i ) {
+         buf.d[i] = OP::apply( buf.a[i], buf.b[i] );
+         barrier();
+      }
+   }
+
+   template< typename T >
+   static void simdChain( Buffers<T>& buf )
+   {
+      constexpr size_t SIMDSIZE( blaze::SIMDTrait<T>::size );
+
+      blaze::SIMDTrait_t<T> x( blaze::loada( buf.c ) );
+
+      for( size_t k=0UL; k<chainLength; ++k ) {
+         x = OP::apply( x, blaze::loada( buf.ops + ( k & 7UL )*SIMDSIZE ) );
+      }
+
+      blaze::storea( buf.d, x );
+   }
+
+   template< typename T >
+   static void scalarChain( Buffers<T>& buf )
+   {
+      T x( buf.c[0UL] );
+
+      for( size_t k=0UL; k<chainLength; ++k ) {
+         x = OP::apply( x, buf.ops[k & 7UL] );
+         barrier();
+      }
+
+      buf.d[0UL] = x;
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The SIMD addition.
+*/
+struct Addition : public BinaryKernel<Addition>
+{
+   static const char* name() { return "add"; }
+
+   template< typename T >
+   using Vectorized = blaze::BoolConstant< blaze::IsVectorizable_v<T> &&
+                                           blaze::HasSIMDAdd_v<T,T> >;
+
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE decltype(auto) apply( const T1& a, const T2& b ) { return a + b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The SIMD subtraction.
+*/
+struct Subtraction : public BinaryKernel<Subtraction>
+{
+   static const char* name() { return "sub"; }
+
+   template< typename T >
+   using Vectorized = blaze::BoolConstant< blaze::IsVectorizable_v<T> &&
+                                           blaze::HasSIMDSub_v<T,T> >;
+
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE decltype(auto) apply( const T1& a, const T2& b ) { return a - b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The SIMD multiplication.
+*/
+struct Multiplication : public BinaryKernel<Multiplication>
+{
+   static const char* name() { return "mult"; }
+
+   template< typename T >
+   using Vectorized = blaze::BoolConstant< blaze::IsVectorizable_v<T> &&
+                                           blaze::HasSIMDMult_v<T,T> >;
+
+   template< typename T >
+   static T neutral() { return T( 1 ); }
+
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE decltype(auto) apply( const T1& a, const T2& b ) { return a * b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The SIMD division.
+*/
+struct Division : public BinaryKernel<Division>
+{
+   static const char* name() { return "div"; }
+
+   template< typename T >
+   using Vectorized = blaze::BoolConstant< blaze::IsVectorizable_v<T> &&
+                                           blaze::HasSIMDDiv_v<T,T> >;
+
+   template< typename T >
+   static T neutral() { return T( 1 ); }
+
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE decltype(auto) apply( const T1& a, const T2& b ) { return a / b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The SIMD minimum.
+*/
+struct Minimum : public BinaryKernel<Minimum>
+{
+   static const char* name() { return "min"; }
+
+   template< typename T >
+   using Applicable = blaze::BoolConstant< !blaze::IsComplex_v<T> >;
+
+   template< typename T >
+   using Vectorized = blaze::BoolConstant< blaze::IsVectorizable_v<T> &&
+                                           blaze::HasSIMDMin_v<T,T> >;
+
+   template< typename T >
+   static T neutral() { return std::numeric_limits<T>::max(); }
+
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE decltype(auto) apply( const T1& a, const T2& b )
+   {
+      return blaze::min( a, b );
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The SIMD maximum.
+*/
+struct Maximum : public BinaryKernel<Maximum>
+{
+   static const char* name() { return "max"; }
+
+   template< typename T >
+   using Applicable = blaze::BoolConstant< !blaze::IsComplex_v<T> >;
+
+   template< typename T >
+   using Vectorized = blaze::BoolConstant< blaze::IsVectorizable_v<T> &&
+                                           blaze::HasSIMDMax_v<T,T> >;
+
+   template< typename T >
+   static T neutral() { return std::numeric_limits<T>::lowest(); }
+
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE decltype(auto) apply( const T1& a, const T2& b )
+   {
+      return blaze::max( a, b );
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The SIMD (fused) multiply-add.
+//
+// In case FMA instructions are available, Blaze evaluates the expression \f$ a*b+c \f$ of two
+// floating point SIMD packs by a single fused multiply-add, otherwise by a multiplication and
+// an addition. The latency kernel computes \f$ x = x*1+0 \f$.
+*/
+struct FusedMultiplyAdd : public Primitive
+{
+   static const char* name() { return "fmadd"; }
+
+   using Chained = blaze::TrueType;
+
+   template< typename T >
+   using Vectorized = blaze::BoolConstant< blaze::IsVectorizable_v<T> &&
+                                           blaze::HasSIMDMult_v<T,T> && blaze::HasSIMDAdd_v<T,T> >;
+
+   template< typename T >
+   static const char* emulation()
+   {
+      return ( blaze::IsFloatingPoint_v<T> && BLAZE_FMA_MODE ) ? nullptr : "unfused mult+add";
+   }
+
+   template< typename T >
+   static T neutral() { return T( 1 ); }
+
+   template< typename T >
+   static void simd( Buffers<T>& buf )
+   {
+      constexpr size_t SIMDSIZE( blaze::SIMDTrait<T>::size );
+
+      for( size_t i=0UL; i<buf.n; i+=SIMDSIZE ) {
+         blaze::storea( buf.d+i, blaze::loada( buf.a+i ) * blaze::loada( buf.b+i ) +
+                                 blaze::loada( buf.c+i ) );
+      }
+   }
+
+   template< typename T >
+   static void scalar( Buffers<T>& buf )
+   {
+      for( size_t i=0UL; i<buf.n; ++i ) {
+         buf.d[i] = buf.a[i] * buf.b[i] + buf.c[i];
+         barrier();
+      }
+   }
+
+   template< typename T >
+   static void simdChain( Buffers<T>& buf )
+   {
+      constexpr size_t SIMDSIZE( blaze::SIMDTrait<T>::size );
+
+      blaze::SIMDTrait_t<T> x( blaze::loada( buf.c ) );
+
+      for( size_t k=0UL; k<chainLength; ++k ) {
+         const size_t offset( ( k & 7UL )*SIMDSIZE );
+         x = x * blaze::loada( buf.ops+offset ) + blaze::loada( buf.zeros+offset );
+      }
+
+      blaze::storea( buf.d, x );
+   }
+
+   template< typename T >
+   static void scalarChain( Buffers<T>& buf )
+   {
+      T x( buf.c[0UL] );
+
+      for( size_t k=0UL; k<chainLength; ++k ) {
+         x = x * buf.ops[k & 7UL] + buf.zeros[k & 7UL];
+         barrier();
+      }
+
+      buf.d[0UL] = x;
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Throughput and latency kernels of the unary elementwise SIMD operations.
+//
+// The latency kernel repeatedly applies the \a step() function of the operation to the result
+// of the previous step.
+*/
+template< typename OP >
+struct UnaryKernel : public Primitive
+{
+   using Chained = blaze::TrueType;
+
+   template< typename T >
+   using Applicable = blaze::BoolConstant< blaze::IsFloatingPoint_v<T> >;
+
+   template< typename T >
+   static void simd( Buffers<T>& buf )
+   {
+      constexpr size_t SIMDSIZE( blaze::SIMDTrait<T>::size );
+
+      for( size_t i=0UL; i<buf.n; i+=SIMDSIZE ) {
+         blaze::storea( buf.d+i, OP::apply( blaze::loada( buf.a+i ) ) );
+      }
+   }
+
+   template< typename T >
+   static void scalar( Buffers<T>& buf )
+   {
+      for( size_t i=0UL; i<buf.n; ++i ) {
+         buf.d[i] = OP::apply( buf.a[i] );
+         barrier();
+      }
+   }
+
+   template< typename T >
+   static void simdChain( Buffers<T>& buf )
+   {
+      constexpr size_t SIMDSIZE( blaze::SIMDTrait<T>::size );
+
+      blaze::SIMDTrait_t<T> x( blaze::loada( buf.c ) );
+
+      for( size_t k=0UL; k<chainLength; ++k ) {
+         x = OP::step( x, blaze::loada( buf.ops + ( k & 7UL )*SIMDSIZE ) );
+      }
+
+      blaze::storea( buf.d, x );
+   }
+
+   template< typename T >
+   static void scalarChain( Buffers<T>& buf )
+   {
+      T x( buf.c[0UL] );
+
+      for( size_t k=0UL; k<chainLength; ++k ) {
+         x = OP::step( x, buf.ops[k & 7UL] );
+         barrier();
+      }
+
+      buf.d[0UL] = x;
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The SIMD square root.
+//
+// The latency kernel computes \f$ x = \sqrt{x} \f$, which converges towards 1.
+*/
+struct SquareRoot : public UnaryKernel<SquareRoot>
+{
+   static const char* name() { return "sqrt"; }
+
+   template< typename T >
+   using Vectorized = blaze::BoolConstant< blaze::IsVectorizable_v<T> && blaze::HasSIMDSqrt_v<T> >;
+
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE decltype(auto) apply( const T& a )
+   {
+      using std::sqrt;
+      using blaze::sqrt;
+      return sqrt( a );
+   }
+
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE decltype(auto) step( const T1& x, const T2& /*op*/ )
+   {
+      return apply( x );
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The SIMD exponential function.
+//
+// The latency kernel computes \f$ x = e^{0-x} \f$, which converges towards 0.567. Therefore the
+// reported latency includes one dependent subtraction.
+*/
+struct Exponential : public UnaryKernel<Exponential>
+{
+   static const char* name() { return "exp"; }
+
+   template< typename T >
+   using Vectorized = blaze::BoolConstant< blaze::IsVectorizable_v<T> && blaze::HasSIMDExp_v<T> >;
+
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE decltype(auto) apply( const T& a )
+   {
+      using std::exp;
+      using blaze::exp;
+      return exp( a );
+   }
+
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE decltype(auto) step( const T1& x, const T2& op )
+   {
+      return apply( op - x );
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Throughput kernel of the horizontal SIMD reductions.
+//
+// Every SIMD pack is reduced independently and the result is stored, which measures the
+// throughput instead of the latency of the reduction. The scalar reference reduces the same
+// groups of elements one element at a time.
+*/
+template< typename OP >
+struct ReductionKernel : public Primitive
+{
+   template< typename T >
+   static void simd( Buffers<T>& buf )
+   {
+      constexpr size_t SIMDSIZE( blaze::SIMDTrait<T>::size );
+
+      for( size_t i=0UL; i<buf.n; i+=SIMDSIZE ) {
+         buf.d[i/SIMDSIZE] = OP::reduce( blaze::loada( buf.a+i ) );
+      }
+   }
+
+   template< typename T >
+   static void scalar( Buffers<T>& buf )
+   {
+      constexpr size_t SIMDSIZE( blaze::SIMDTrait<T>::size );
+
+      for( size_t i=0UL; i<buf.n; i+=SIMDSIZE ) {
+         T redux( buf.a[i] );
+         for( size_t j=1UL; j<SIMDSIZE; ++j ) {
+            redux = OP::combine( redux, buf.a[i+j] );
+            barrier();
+         }
+         buf.d[i/SIMDSIZE] = redux;
+      }
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The horizontal SIMD sum.
+*/
+struct Summation : public ReductionKernel<Summation>
+{
+   static const char* name() { return "sum"; }
+
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE decltype(auto) reduce( const T& a ) { return blaze::sum( a ); }
+
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE T combine( const T& a, const T& b ) { return a + b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The horizontal SIMD product.
+*/
+struct Product : public ReductionKernel<Product>
+{
+   static const char* name() { return "prod"; }
+
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE decltype(auto) reduce( const T& a ) { return blaze::prod( a ); }
+
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE T combine( const T& a, const T& b ) { return a * b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The generic horizontal SIMD reduction (by means of the maximum).
+//
+// Since Blaze only provides dedicated horizontal reductions for addition and multiplication,
+// all other reductions store the SIMD pack and reduce the elements one by one.
+*/
+struct Reduction : public ReductionKernel<Reduction>
+{
+   static const char* name() { return "reduce"; }
+
+   template< typename T >
+   using Applicable = blaze::BoolConstant< !blaze::IsComplex_v<T> >;
+
+   template< typename T >
+   static const char* emulation() { return "store + scalar loop"; }
+
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE decltype(auto) reduce( const T& a )
+   {
+      return blaze::reduce( a, blaze::Max() );
+   }
+
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE T combine( const T& a, const T& b ) { return blaze::max( a, b ); }
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BENCHMARK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Measurement of the SIMD throughput of a vectorized primitive.
+//
+// \param buf The operand buffers.
+// \return The runtime per element (in nanoseconds).
+*/
+template< typename OP, typename T >
+double simdThroughput( Buffers<T>& buf, blaze::TrueType )
+{
+   return measure( [&buf]() { OP::simd( buf ); }, buf.n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measurement of the SIMD throughput of a primitive without SIMD implementation.
+//
+// \return NaN.
+*/
+template< typename OP, typename T >
+double simdThroughput( Buffers<T>& /*buf*/, blaze::FalseType )
+{
+   return std::numeric_limits<double>::quiet_NaN();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measurement of the SIMD latency of a vectorized primitive.
+//
+// \param buf The operand buffers.
+// \return The latency of a single SIMD operation (in nanoseconds).
+*/
+template< typename OP, typename T >
+double simdLatency( Buffers<T>& buf, blaze::TrueType, blaze::TrueType )
+{
+   return measure( [&buf]() { OP::simdChain( buf ); }, chainLength );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measurement of the SIMD latency of a primitive without SIMD implementation or without
+//        latency kernel.
+//
+// \return NaN.
+*/
+template< typename OP, typename T, typename Vectorized, typename Chained >
+double simdLatency( Buffers<T>& /*buf*/, Vectorized, Chained )
+{
+   return std::numeric_limits<double>::quiet_NaN();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measurement of the scalar latency of a primitive with latency kernel.
+//
+// \param buf The operand buffers.
+// \return The latency of a single scalar operation (in nanoseconds).
+*/
+template< typename OP, typename T >
+double scalarLatency( Buffers<T>& buf, blaze::TrueType )
+{
+   return measure( [&buf]() { OP::scalarChain( buf ); }, chainLength );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measurement of the scalar latency of a primitive without latency kernel.
+//
+// \return NaN.
+*/
+template< typename OP, typename T >
+double scalarLatency( Buffers<T>& /*buf*/, blaze::FalseType )
+{
+   return std::numeric_limits<double>::quiet_NaN();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prints a single value of the result table.
+//
+// \param value The value to be printed (NaN is printed as '-').
+// \return void
+*/
+void printValue( double value )
+{
+   if( std::isnan( value ) )
+      std::cout << std::setw(10) << "-";
+   else
+      std::cout << std::setw(10) << std::fixed << std::setprecision(3) << value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmark of a single primitive for the element type \a T.
+//
+// \param buf The operand buffers.
+// \return void
+//
+// The function prints one row of the result table: the SIMD and scalar throughput (in elements
+// per nanosecond), the speedup of the SIMD implementation, the latency of a single SIMD and a
+// single scalar operation (in nanoseconds), and the status of the SIMD implementation.
+*/
+template< typename OP, typename T >
+void benchmark( Buffers<T>& buf, blaze::TrueType /*applicable*/ )
+{
+   using Vectorized = typename OP::template Vectorized<T>;
+   using Chained    = typename OP::Chained;
+
+   std::fill( buf.ops, buf.ops+padding, OP::template neutral<T>() );
+
+   const double simdTime  ( simdThroughput<OP>( buf, Vectorized() ) );
+   const double scalarTime( measure( [&buf]() { OP::scalar( buf ); }, buf.n ) );
+   const double simdLat   ( simdLatency<OP>( buf, Vectorized(), Chained() ) );
+   const double scalarLat ( scalarLatency<OP>( buf, Chained() ) );
+   const double speedup   ( scalarTime / simdTime );
+
+   std::cout << "   " << std::left << std::setw(8) << OP::name() << std::right;
+   printValue( 1.0 / simdTime );
+   printValue( 1.0 / scalarTime );
+   printValue( speedup );
+   printValue( simdLat );
+   printValue( scalarLat );
+
+   const char* emulation( OP::template emulation<T>() );
+
+   std::cout << "   ";
+   if( !Vectorized::value )
+      std::cout << "FALLBACK: scalar only";
+   else if( emulation != nullptr )
+      std::cout << "emulated: " << emulation;
+   else if( speedup < 1.0 )
+      std::cout << "slower than scalar";
+   else
+      std::cout << "native";
+   std::cout << std::endl;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmark of a primitive that is not defined for the element type \a T.
+//
+// \return void
+*/
+template< typename OP, typename T >
+void benchmark( Buffers<T>& /*buf*/, blaze::FalseType /*applicable*/ )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmark of all SIMD primitives for the element type \a T.
+//
+// \param N The number of elements per buffer.
+// \return void
+*/
+template< typename T >
+void benchmark( size_t N )
+{
+   using blaze::SIMDTrait;
+
+   Buffers<T> buf( N );
+
+   std::cout << "\n " << typeName<T>() << " (" << SIMDTrait<T>::size << " elements per SIMD pack, "
+             << ( blaze::IsVectorizable_v<T> ? "vectorizable" : "not vectorizable" ) << ")\n"
+             << "   Primitive  SIMD[E/ns]  Scal[E/ns]   Speedup  SIMD[ns]  Scal[ns]   Status\n";
+
+   benchmark< LoadKernel<true>    >( buf, typename LoadKernel<true>   ::template Applicable<T>() );
+   benchmark< LoadKernel<false>   >( buf, typename LoadKernel<false>  ::template Applicable<T>() );
+   benchmark< StoreKernel<0UL>    >( buf, typename StoreKernel<0UL>   ::template Applicable<T>() );
+   benchmark< StoreKernel<1UL>    >( buf, typename StoreKernel<1UL>   ::template Applicable<T>() );
+   benchmark< StoreKernel<2UL>    >( buf, typename StoreKernel<2UL>   ::template Applicable<T>() );
+   benchmark< SetKernel           >( buf, typename SetKernel          ::template Applicable<T>() );
+   benchmark< Addition            >( buf, typename Addition           ::template Applicable<T>() );
+   benchmark< Subtraction         >( buf, typename Subtraction        ::template Applicable<T>() );
+   benchmark< Multiplication      >( buf, typename Multiplication     ::template Applicable<T>() );
+   benchmark< Division            >( buf, typename Division           ::template Applicable<T>() );
+   benchmark< FusedMultiplyAdd    >( buf, typename FusedMultiplyAdd   ::template Applicable<T>() );
+   benchmark< Minimum             >( buf, typename Minimum            ::template Applicable<T>() );
+   benchmark< Maximum             >( buf, typename Maximum            ::template Applicable<T>() );
+   benchmark< SquareRoot          >( buf, typename SquareRoot         ::template Applicable<T>() );
+   benchmark< Exponential         >( buf, typename Exponential        ::template Applicable<T>() );
+   benchmark< Summation           >( buf, typename Summation          ::template Applicable<T>() );
+   benchmark< Product             >( buf, typename Product            ::template Applicable<T>() );
+   benchmark< Reduction           >( buf, typename Reduction          ::template Applicable<T>() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze SIMD primitive microbenchmark.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The microbenchmark measures the throughput and the latency of the SIMD primitives of Blaze
+// for all element types and compares them to scalar reference loops. Since the instruction set
+// is selected at compile time, the benchmark has to be compiled once per instruction set (see
+// the 'simd-<isa>' targets of the blazemark Makefile). Primitives without SIMD implementation
+// for the compiled instruction set are marked as FALLBACK, primitives that are emulated by means
+// of other instructions are marked as emulated.
+*/
+int main( int argc, char** argv )
+{
+   size_t N( 512UL );
+
+   if( argc == 3 && std::string( argv[1] ) == "-n" && atoi( argv[2] ) > 0 ) {
+      N = static_cast<size_t>( atoi( argv[2] ) );
+   }
+   else if( argc != 1 ) {
+      std::cerr << " Invalid use of program 'SIMD'!\n"
+                << "   Use: ./simd [-n <number_of_elements>]\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   // All kernels process four SIMD packs of up to 64 elements at once
+   N = ( ( N + 255UL ) / 256UL ) * 256UL;
+
+   if( const char* feature = missingFeature() ) {
+      std::cerr << " The CPU does not support the compiled instruction set (missing '"
+                << feature << "')!\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   std::cout << "\n Blaze SIMD primitive microbenchmark\n"
+             << "   Instruction set: " << isaName() << "\n"
+             << "   Elements per buffer: " << N << "\n"
+             << "   Throughput in elements per nanosecond, latency in nanoseconds per operation\n";
+
+   benchmark<float>( N );
+   benchmark<double>( N );
+   benchmark< std::complex<float> >( N );
+   benchmark< std::complex<double> >( N );
+   benchmark<int8_t>( N );
+   benchmark<int16_t>( N );
+   benchmark<int32_t>( N );
+   benchmark<int64_t>( N );
+
+   std::cout << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
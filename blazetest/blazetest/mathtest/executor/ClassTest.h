@@ -0,0 +1,202 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/executor/ClassTest.h
+//  \brief Header file for the Executor class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_EXECUTOR_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_EXECUTOR_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <blaze/math/smp/threads/Executor.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace executor {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the Executor class.
+//
+// This class represents the collection of tests for the execution of thread parallel operations
+// by means of an executor injected via the setExecutor() function. In case the C++11 or Boost
+// thread-based parallelization is not active, all tests have no effect.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Private class RecordingExecutor*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Executor recording all executed batches of tasks.
+   //
+   // This executor executes every task of a batch on a separate thread and records the number
+   // of executed batches and tasks.
+   */
+   class RecordingExecutor : public blaze::Executor
+   {
+    public:
+      explicit RecordingExecutor( size_t available )
+         : available_( available )  // The number of available threads
+         , batches_  ( 0UL )        // The number of executed batches
+         , tasks_    ( 0UL )        // The number of executed tasks
+      {}
+
+      size_t concurrency() const override { return available_.load(); }
+      size_t available  () const override { return available_.load(); }
+
+      void execute( size_t n, const std::function<void(size_t)>& task ) override {
+         ++batches_;
+         tasks_ += n;
+
+         std::vector<std::thread> threads;
+         for( size_t i=0UL; i<n; ++i ) {
+            threads.emplace_back( task, i );
+         }
+         for( std::thread& thread : threads ) {
+            thread.join();
+         }
+      }
+
+      void   setAvailable( size_t available ) { available_.store( available ); }
+      size_t batches     () const { return batches_.load(); }
+      size_t tasks       () const { return tasks_.load(); }
+
+    private:
+      std::atomic<size_t> available_;  //!< The number of available threads.
+      std::atomic<size_t> batches_;    //!< The number of executed batches.
+      std::atomic<size_t> tasks_;      //!< The number of executed tasks.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testExecution();
+   void testParallelismBudget();
+   void testNestedExecution();
+   //@}
+   //**********************************************************************************************
+
+   //**Test constants******************************************************************************
+   /*!\name Test constants */
+   //@{
+   //! The size of the vectors of the parallel assignments.
+   /*! The size is chosen to exceed the SMP threshold of the dense vector assignment. */
+   static constexpr size_t size = 100000UL;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the Executor class.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the Executor class test.
+*/
+#define RUN_EXECUTOR_CLASS_TEST \
+   blazetest::mathtest::executor::runTest();
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace executor
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -130,6 +130,9 @@ class DecompositionTest
    template< typename Type > void testUngl2();
    template< typename Type > void testOrmlq();
    template< typename Type > void testUnmlq();
+
+   template< typename Type > void testMatsqrt();
+   template< typename Type > void testPolar();
    //@}
    //**********************************************************************************************
 
@@ -3315,6 +3318,197 @@ void DecompositionTest::testUnmlq()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the matrix square root functions (matsqrt() and matinvsqrt()).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the matrix square root and inverse square root functions
+// for various data types. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >
+void DecompositionTest::testMatsqrt()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   {
+      test_ = "Square root of a row-major positive definite matrix";
+
+      blaze::StaticMatrix<Type,5UL,5UL,blaze::rowMajor> B, A, S;
+      randomize( B );
+      A = ctrans( B ) * B;
+      for( size_t i=0UL; i<5UL; ++i ) {
+         A(i,i) += Type( 1 );
+      }
+
+      blaze::matsqrt( A, S );
+
+      if( !isHermitian( S ) || ( S * S ) != A ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Matrix square root failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix (A):\n" << A << "\n"
+             << "   Result (S):\n" << S << "\n"
+             << "   S * S:\n" << ( S * S ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Inverse square root of a column-major positive definite matrix";
+
+      blaze::StaticMatrix<Type,5UL,5UL,blaze::columnMajor> B, A, S, I;
+      randomize( B );
+      A = ctrans( B ) * B;
+      for( size_t i=0UL; i<5UL; ++i ) {
+         A(i,i) += Type( 1 );
+         I(i,i)  = Type( 1 );
+      }
+
+      blaze::matinvsqrt( A, S );
+
+      if( !isHermitian( S ) || ( S * A * S ) != I ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Matrix inverse square root failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix (A):\n" << A << "\n"
+             << "   Result (S):\n" << S << "\n"
+             << "   S * A * S:\n" << ( S * A * S ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Square root of a singular positive semi-definite matrix";
+
+      blaze::StaticMatrix<Type,2UL,2UL,blaze::rowMajor> A{ { Type(1), Type(1) },
+                                                           { Type(1), Type(1) } };
+      blaze::StaticMatrix<Type,2UL,2UL,blaze::rowMajor> S;
+
+      blaze::matsqrt( A, S );
+
+      if( !isHermitian( S ) || ( S * S ) != A ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Matrix square root failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix (A):\n" << A << "\n"
+             << "   Result (S):\n" << S << "\n"
+             << "   S * S:\n" << ( S * S ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Square root of an indefinite matrix";
+
+      blaze::StaticMatrix<Type,2UL,2UL,blaze::rowMajor> A{ { Type(1), Type( 0) },
+                                                           { Type(0), Type(-1) } };
+      blaze::StaticMatrix<Type,2UL,2UL,blaze::rowMajor> S;
+
+      try {
+         blaze::matsqrt( A, S );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Square root of indefinite matrix succeeded\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix (A):\n" << A << "\n"
+             << "   Result (S):\n" << S << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the polar decomposition functions (polar()).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the polar decomposition functions for various data types.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DecompositionTest::testPolar()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   {
+      test_ = "Polar decomposition of a row-major matrix";
+
+      blaze::StaticMatrix<Type,5UL,3UL,blaze::rowMajor> A, U;
+      blaze::StaticMatrix<Type,3UL,3UL,blaze::rowMajor> H, I;
+      randomize( A );
+      for( size_t i=0UL; i<3UL; ++i ) {
+         I(i,i) = Type( 1 );
+      }
+
+      blaze::polar( A, U, H );
+
+      if( ( U * H ) != A || ( ctrans( U ) * U ) != I || !isHermitian( H ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Polar decomposition failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix (A):\n" << A << "\n"
+             << "   Unitary factor (U):\n" << U << "\n"
+             << "   Hermitian factor (H):\n" << H << "\n"
+             << "   U * H:\n" << ( U * H ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Polar decomposition of a rank deficient column-major matrix";
+
+      blaze::StaticMatrix<Type,3UL,2UL,blaze::columnMajor> A{ { Type(1), Type(2) },
+                                                             { Type(2), Type(4) },
+                                                             { Type(3), Type(6) } };
+      blaze::StaticMatrix<Type,3UL,2UL,blaze::columnMajor> U;
+      blaze::StaticMatrix<Type,2UL,2UL,blaze::columnMajor> H;
+
+      blaze::polar( A, U, H );
+
+      if( ( U * H ) != A || !isHermitian( H ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Polar decomposition failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix (A):\n" << A << "\n"
+             << "   Unitary factor (U):\n" << U << "\n"
+             << "   Hermitian factor (H):\n" << H << "\n"
+             << "   U * H:\n" << ( U * H ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -44,6 +44,8 @@
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blaze/math/HermitianMatrix.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
@@ -99,6 +101,7 @@ class SolverTest
    template< typename Type > void testHesv();
    template< typename Type > void testPosv();
    template< typename Type > void testTrsv();
+   template< typename Type > void testRefined();
    //@}
    //**********************************************************************************************
 
@@ -1992,6 +1995,166 @@ void SolverTest::testTrsv()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the mixed-precision iterative refinement functions (solveRefined).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the mixed-precision iterative refinement functions for
+// various data types. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SolverTest::testRefined()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major mixed-precision LSE (classical refinement)";
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> A( 20UL, 20UL );
+      randomize( A );
+      diagonal( A ) += Type( 20 );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( 20UL ), x;
+      randomize( b );
+
+      if( !blaze::solveRefined( A, x, b ) || ( A * x ) != b ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Result (x):\n" << x << "\n"
+             << "   Right-hand side (b):\n" << b << "\n"
+             << "   A * x:\n" << ( A * x ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major mixed-precision LSE (GMRES-based refinement)";
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> A( 20UL, 20UL );
+      randomize( A );
+      diagonal( A ) += Type( 20 );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( 20UL ), x;
+      randomize( b );
+
+      if( !blaze::solveRefined<blaze::byGMRESIR>( A, x, b ) || ( A * x ) != b ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Result (x):\n" << x << "\n"
+             << "   Right-hand side (b):\n" << b << "\n"
+             << "   A * x:\n" << ( A * x ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   {
+      test_ = "Row-major mixed-precision LSE (fallback for single precision overflow)";
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> A( 20UL, 20UL );
+      randomize( A );
+      diagonal( A ) += Type( 20 );
+      A *= Type( 1E39 );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( 20UL ), x, y;
+      randomize( b );
+      b *= Type( 1E39 );
+
+      blaze::solve( A, y, b );
+
+      if( blaze::solveRefined( A, x, b ) || x != y ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Falling back to the double precision solver failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Result (x):\n" << x << "\n"
+             << "   Expected result:\n" << y << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major mixed-precision LSE (classical refinement)";
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> A( 20UL, 20UL );
+      randomize( A );
+      diagonal( A ) += Type( 20 );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( 20UL ), x;
+      randomize( b );
+
+      if( !blaze::solveRefined( A, x, b ) || ( A * x ) != b ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Result (x):\n" << x << "\n"
+             << "   Right-hand side (b):\n" << b << "\n"
+             << "   A * x:\n" << ( A * x ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major mixed-precision LSE (fallback for ill-conditioned matrix)";
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> A( 10UL, 10UL );
+      for( size_t i=0UL; i<10UL; ++i ) {
+         for( size_t j=0UL; j<10UL; ++j ) {
+            A(i,j) = Type( 1 ) / Type( i+j+1UL );
+         }
+      }
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( 10UL, Type( 1 ) ), x, y;
+
+      blaze::solve( A, y, b );
+
+      if( blaze::solveRefined( A, x, b ) || x != y ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Falling back to the double precision solver failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Result (x):\n" << x << "\n"
+             << "   Expected result:\n" << y << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,210 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrices/blockdiagonalmatrix/ClassTest.h
+//  \brief Header file for the BlockDiagonalMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZETEST_MATHTEST_MATRICES_BLOCKDIAGONALMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MATRICES_BLOCKDIAGONALMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/BlockDiagonalMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace blockdiagonalmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the BlockDiagonalMatrix class template.
+//
+// This class represents a test suite for the blaze::BlockDiagonalMatrix class template and the
+// according block-wise multiplications, linear solvers and decompositions. It performs a series
+// of runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors  ();
+   void testElementAccess ();
+   void testMultiplication();
+   void testSolve         ();
+   void testDecompositions();
+
+   template< typename T1, typename T2 >
+   void checkError( const T1& result, const T2& expected, double tolerance ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using MT = blaze::BlockDiagonalMatrix<double>;            //!< Type of the block-diagonal matrix.
+   using DT = blaze::DynamicMatrix<double,blaze::rowMajor>;  //!< Type of the dense matrix.
+   using VT = blaze::DynamicVector<double>;                  //!< Type of the dense vector.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static MT createMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the relative error of the given vector or matrix.
+//
+// \param result The vector or matrix to be checked.
+// \param expected The expected result.
+// \param tolerance The admissible relative error in the Euclidean/Frobenius norm.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given vector or matrix with the expected result. In case the
+// relative error exceeds the given tolerance, a \a std::runtime_error exception is thrown.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void ClassTest::checkError( const T1& result, const T2& expected, double tolerance ) const
+{
+   const double error( std::abs( blaze::norm( result - expected ) ) );
+   const double scale( std::abs( blaze::norm( expected ) ) );
+
+   if( !( error <= tolerance * scale ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid approximation detected\n"
+          << " Details:\n"
+          << "   Relative error: " << ( error / scale ) << "\n"
+          << "   Tolerance: " << tolerance << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the BlockDiagonalMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the BlockDiagonalMatrix class test.
+*/
+#define RUN_BLOCKDIAGONALMATRIX_CLASS_TEST \
+   blazetest::mathtest::matrices::blockdiagonalmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blockdiagonalmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
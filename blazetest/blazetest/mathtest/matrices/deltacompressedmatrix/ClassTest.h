@@ -0,0 +1,236 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrices/deltacompressedmatrix/ClassTest.h
+//  \brief Header file for the DeltaCompressedMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZETEST_MATHTEST_MATRICES_DELTACOMPRESSEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MATRICES_DELTACOMPRESSEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DeltaCompressedMatrix.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace deltacompressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the DeltaCompressedMatrix class template.
+//
+// This class represents a test suite for the blaze::DeltaCompressedMatrix class template
+// and the according matrix/vector and matrix/matrix multiplications. It performs a series of
+// runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors  ();
+   void testDeduplication ();
+   void testMultiplication();
+
+   template< bool SO >
+   void testRandomMultiplication( size_t m, size_t n, size_t nonzeros, bool deduplicate );
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const MT1& result, const MT2& expected ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using MT  = blaze::DeltaCompressedMatrix<double,blaze::rowMajor>;     //!< Row-major type.
+   using OMT = blaze::DeltaCompressedMatrix<double,blaze::columnMajor>;  //!< Column-major type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the values of the given matrix.
+//
+// \param result The matrix to be checked.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares all elements of the given matrix with the expected result.
+// In case any element differs, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the result matrix
+        , typename MT2 >  // Type of the expected matrix
+void ClassTest::checkMatrix( const MT1& result, const MT2& expected ) const
+{
+   bool equal( result.rows() == expected.rows() && result.columns() == expected.columns() );
+
+   for( size_t i=0UL; equal && i<result.rows(); ++i ) {
+      for( size_t j=0UL; equal && j<result.columns(); ++j ) {
+         equal = ( result(i,j) == expected(i,j) );
+      }
+   }
+
+   if( !equal ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix detected\n"
+          << " Details:\n"
+          << "   Result:\n" << result.matrix() << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the values of the given vector.
+//
+// \param result The vector to be checked.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given vector with the expected result. In case any element
+// differs, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected vector
+void ClassTest::checkVector( const VT1& result, const VT2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector detected\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the DeltaCompressedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the DeltaCompressedMatrix class test.
+*/
+#define RUN_DELTACOMPRESSEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::matrices::deltacompressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace deltacompressedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -120,7 +120,12 @@ class GeneralTest
    void testMean();
    void testVar();
    void testStdDev();
+   void testRolling();
    void testSoftmax();
+   void testPairwiseDistances();
+   void testKnn();
+   void testCov();
+   void testCor();
    void testLeftShift();
    void testRightShift();
    void testBitand();
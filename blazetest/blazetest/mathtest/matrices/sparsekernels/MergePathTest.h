@@ -0,0 +1,210 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrices/sparsekernels/MergePathTest.h
+//  \brief Header file for the merge-path test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MATRICES_SPARSEKERNELS_MERGEPATHTEST_H_
+#define _BLAZETEST_MATHTEST_MATRICES_SPARSEKERNELS_MERGEPATHTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/MergePath.h>
+#include <blaze/math/sparse/SpMV.h>
+#include <blaze/math/SMP.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace sparsekernels {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the merge-path load balancing.
+//
+// This class represents a test suite for the merge-path functions (see the
+// computeMergePathOffsets() and mergePathSearch() functions) and for the merge-path kernel of
+// row-major sparse matrix/dense vector multiplications (see the smpMergePathMultAssign()
+// function). All kernel tests are performed with several threads and compare the results with
+// the serial multiplication.
+*/
+class MergePathTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit MergePathTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using MT = blaze::CompressedMatrix<int,blaze::rowMajor>;       //!< Row-major sparse matrix type.
+   using VT = blaze::DynamicVector<int,blaze::columnVector>;      //!< Dense column vector type.
+   using OT = blaze::DynamicVector<size_t,blaze::columnVector>;   //!< Row offset vector type.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testOffsets   ();
+   void testSearch    ();
+   void testSkewedRows();
+   void testEmpty     ();
+   void testFewRows   ();
+
+   void checkKernel( const MT& A );
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& expected, const char* operation ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;     //!< Label of the currently performed test.
+   size_t      threads_;  //!< The number of threads of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the values of the given vector.
+//
+// \param result The vector to be checked.
+// \param expected The expected result.
+// \param operation The performed (compound) assignment.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given vector with the expected result. In case any element
+// differs, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected vector
+void MergePathTest::checkVector( const VT1& result, const VT2& expected,
+                                 const char* operation ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the " << operation << "\n"
+          << " Details:\n"
+          << "   Number of threads: " << threads_ << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the merge-path load balancing.
+//
+// \return void
+*/
+void runTest()
+{
+   MergePathTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the merge-path test.
+*/
+#define RUN_SPARSEKERNELS_MERGEPATH_TEST \
+   blazetest::mathtest::matrices::sparsekernels::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace sparsekernels
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,264 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrices/sparsekernels/ScatterTest.h
+//  \brief Header file for the parallel scatter kernel test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MATRICES_SPARSEKERNELS_SCATTERTEST_H_
+#define _BLAZETEST_MATHTEST_MATRICES_SPARSEKERNELS_SCATTERTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <initializer_list>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/SpMV.h>
+#include <blaze/math/SMP.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace sparsekernels {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the parallel scatter kernels.
+//
+// This class represents a test suite for the parallel scatter kernels of column-major sparse
+// matrix/dense vector multiplications and of transpose dense vector/row-major sparse matrix
+// multiplications (see the smpScatterMultAssign() function). All tests are performed with
+// several threads and compare the results with the serial multiplication.
+*/
+class ScatterTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ScatterTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testScatter       ();
+   void testRowSplit      ();
+   void testEmpty         ();
+   void testSerialFallback();
+
+   template< typename MT1, typename VT1, typename VT2 >
+   void checkKernel( const MT1& A, const VT1& x, const VT2& ref );
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& expected, const char* operation ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using MT  = blaze::CompressedMatrix<int,blaze::rowMajor>;     //!< Row-major sparse matrix.
+   using TMT = blaze::CompressedMatrix<int,blaze::columnMajor>;  //!< Column-major sparse matrix.
+   using VT  = blaze::DynamicVector<int,blaze::columnVector>;    //!< Dense column vector.
+   using TVT = blaze::DynamicVector<int,blaze::rowVector>;       //!< Dense row vector.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;     //!< Label of the currently performed test.
+   size_t      threads_;  //!< The number of threads of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the scatter kernel for the given operands.
+//
+// \param A The sparse matrix operand.
+// \param x The dense vector operand.
+// \param ref The result of the serial multiplication.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function runs the assignment, the addition assignment, and the subtraction assignment
+// of the scatter kernel with 2, 3, 4, and 7 threads and compares the results with the given
+// result of the serial multiplication. In case any result differs, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT1    // Type of the sparse matrix operand
+        , typename VT1    // Type of the dense vector operand
+        , typename VT2 >  // Type of the reference result
+void ScatterTest::checkKernel( const MT1& A, const VT1& x, const VT2& ref )
+{
+   VT2 init( ref.size() );
+   for( size_t i=0UL; i<init.size(); ++i ) {
+      init[i] = static_cast<int>( i % 7UL ) - 3;
+   }
+
+   const auto assignOp = []( auto& a, const auto& b ){ assign( a, b ); };
+   const auto addOp    = []( auto& a, const auto& b ){ addAssign( a, b ); };
+   const auto subOp    = []( auto& a, const auto& b ){ subAssign( a, b ); };
+
+   for( size_t threads : { 2UL, 3UL, 4UL, 7UL } )
+   {
+      threads_ = threads;
+      blaze::setNumThreads( threads );
+
+      {
+         VT2 y( init );
+         blaze::smpScatterMultAssign( y, A, x, assignOp );
+         checkVector( y, ref, "assignment" );
+      }
+
+      {
+         VT2 y( init );
+         blaze::smpScatterMultAssign( y, A, x, addOp );
+         checkVector( y, init + ref, "addition assignment" );
+      }
+
+      {
+         VT2 y( init );
+         blaze::smpScatterMultAssign( y, A, x, subOp );
+         checkVector( y, init - ref, "subtraction assignment" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the values of the given vector.
+//
+// \param result The vector to be checked.
+// \param expected The expected result.
+// \param operation The performed (compound) assignment.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given vector with the expected result. In case any element
+// differs, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected vector
+void ScatterTest::checkVector( const VT1& result, const VT2& expected, const char* operation ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the " << operation << "\n"
+          << " Details:\n"
+          << "   Number of threads: " << threads_ << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parallel scatter kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   ScatterTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the scatter kernel test.
+*/
+#define RUN_SPARSEKERNELS_SCATTER_TEST \
+   blazetest::mathtest::matrices::sparsekernels::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace sparsekernels
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -118,6 +118,8 @@ class GeneralTest
    void testMean();
    void testVar();
    void testStdDev();
+   void testPrune();
+   void testMatrixPowers();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -46,7 +46,9 @@
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/LowerMatrix.h>
 #include <blaze/math/StaticVector.h>
+#include <blaze/math/UpperMatrix.h>
 
 
 namespace blazetest {
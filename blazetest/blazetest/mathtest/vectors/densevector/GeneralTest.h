@@ -105,6 +105,7 @@ class GeneralTest
    void testMean();
    void testVar();
    void testStdDev();
+   void testRolling();
    void testSoftmax();
    void testLeftShift();
    void testRightShift();
@@ -0,0 +1,330 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/executor/ClassTest.cpp
+//  \brief Source file for the Executor class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/system/SMP.h>
+#include <blazetest/mathtest/executor/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace executor {
+
+//=================================================================================================
+//
+//  DEFINITION OF THE TEST CONSTANTS
+//
+//=================================================================================================
+
+constexpr size_t ClassTest::size;
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Executor class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testExecution();
+   testParallelismBudget();
+   testNestedExecution();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the execution of parallel operations by an injected executor.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the number of threads of parallel operations is given by the
+// available() function of an executor injected via setExecutor() and that the tasks of a
+// parallel assignment are executed as a single batch by this executor. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testExecution()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+
+   test_ = "Execution by an injected executor";
+
+   RecordingExecutor executor( 3UL );
+   blaze::setExecutor( executor );
+
+   const size_t threads( blaze::getNumThreads() );
+
+   executor.setAvailable( 2UL );
+
+   const blaze::DynamicVector<int> a( size, 1 ), b( size, 2 );
+   blaze::DynamicVector<int> c( size, 0 );
+
+   c = a + b;
+
+   blaze::resetExecutor();
+
+   if( threads != 3UL || executor.batches() != 1UL || executor.tasks() != 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid execution by the injected executor\n"
+          << " Details:\n"
+          << "   Number of threads : " << threads << " (expected 3)\n"
+          << "   Executed batches  : " << executor.batches() << " (expected 1)\n"
+          << "   Executed tasks    : " << executor.tasks() << " (expected 2)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( c != blaze::DynamicVector<int>( size, 3 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the parallel assignment\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BLAZE_PARALLELISM_BUDGET macro.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the BLAZE_PARALLELISM_BUDGET macro restricts the number of threads
+// of the parallel operations started by the calling thread and that the previous budget is
+// restored at the end of the section. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testParallelismBudget()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+
+   test_ = "Parallelism budget";
+
+   RecordingExecutor executor( 4UL );
+   blaze::setExecutor( executor );
+
+   size_t outer( 0UL ), inner( 0UL ), restored( 0UL ), serial( 0UL );
+
+   const blaze::DynamicVector<int> a( size, 1 ), b( size, 2 );
+   blaze::DynamicVector<int> c( size, 0 );
+
+   BLAZE_PARALLELISM_BUDGET( 2UL )
+   {
+      outer = blaze::getNumThreads();
+
+      BLAZE_PARALLELISM_BUDGET( 3UL ) {
+         inner = blaze::getNumThreads();
+      }
+
+      restored = blaze::getNumThreads();
+
+      BLAZE_PARALLELISM_BUDGET( 1UL ) {
+         serial = blaze::getNumThreads();
+      }
+
+      c = a + b;
+   }
+
+   const size_t threads( blaze::getNumThreads() );
+   const size_t budget ( blaze::getParallelismBudget() );
+
+   blaze::resetExecutor();
+
+   if( outer != 2UL || inner != 2UL || restored != 2UL || serial != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of threads within the budget sections\n"
+          << " Details:\n"
+          << "   Budget 2          : " << outer << " (expected 2)\n"
+          << "   Budget 2 and 3    : " << inner << " (expected 2)\n"
+          << "   Budget 2 restored : " << restored << " (expected 2)\n"
+          << "   Budget 2 and 1    : " << serial << " (expected 1)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( executor.batches() != 1UL || executor.tasks() != 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Budget has not been applied to the parallel assignment\n"
+          << " Details:\n"
+          << "   Executed batches  : " << executor.batches() << " (expected 1)\n"
+          << "   Executed tasks    : " << executor.tasks() << " (expected 2)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( threads != 4UL || budget != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Budget has not been restored at the end of the section\n"
+          << " Details:\n"
+          << "   Number of threads : " << threads << " (expected 4)\n"
+          << "   Active budget     : " << budget << " (expected 0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( c != blaze::DynamicVector<int>( size, 3 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the parallel assignment\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of parallel operations started from within an executed task.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a parallel assignment issued from within a task executed by the
+// executor is executed serially on the executing thread instead of being passed to the executor
+// again. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNestedExecution()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+
+   test_ = "Parallel assignment within an executed task";
+
+   RecordingExecutor executor( 2UL );
+   blaze::setExecutor( executor );
+
+   const blaze::DynamicVector<int> a( size, 1 ), b( size, 2 );
+   blaze::DynamicVector<int> c( size, 0 ), d( size, 0 );
+
+   std::atomic<size_t> threads( 0UL );
+
+   const auto task = [&threads,&a,&b]( blaze::DynamicVector<int>& x )
+   {
+      threads += blaze::getNumThreads();
+      x = a + b;
+   };
+
+   blaze::TheThreadBackend::schedule( [&task,&c]() { task( c ); } );
+   blaze::TheThreadBackend::schedule( [&task,&d]() { task( d ); } );
+   blaze::TheThreadBackend::wait();
+
+   blaze::resetExecutor();
+
+   if( executor.batches() != 1UL || executor.tasks() != 2UL || threads.load() != 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Nested parallel assignment has not been executed serially\n"
+          << " Details:\n"
+          << "   Executed batches  : " << executor.batches() << " (expected 1)\n"
+          << "   Executed tasks    : " << executor.tasks() << " (expected 2)\n"
+          << "   Number of threads : " << threads.load() << " (expected 2 in total)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( c != blaze::DynamicVector<int>( size, 3 ) || d != blaze::DynamicVector<int>( size, 3 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the nested parallel assignments\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+} // namespace executor
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running Executor class test..." << std::endl;
+
+   try
+   {
+      RUN_EXECUTOR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during Executor class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -92,6 +92,8 @@ DecompositionTest::DecompositionTest()
    //testOrglq< float >();
    //testOrgl2< float >();
    //testOrmlq< float >();
+   //testMatsqrt< float >();
+   //testPolar< float >();
 
 
    //=====================================================================================
@@ -117,6 +119,8 @@ DecompositionTest::DecompositionTest()
    testOrglq< double >();
    testOrgl2< double >();
    testOrmlq< double >();
+   testMatsqrt< double >();
+   testPolar< double >();
 
 
    //=====================================================================================
@@ -143,6 +147,8 @@ DecompositionTest::DecompositionTest()
    //testUnglq< complex<float> >();
    //testUngl2< complex<float> >();
    //testUnmlq< complex<float> >();
+   //testMatsqrt< complex<float> >();
+   //testPolar< complex<float> >();
 
 
    //=====================================================================================
@@ -169,6 +175,8 @@ DecompositionTest::DecompositionTest()
    testUnglq< complex<double> >();
    testUngl2< complex<double> >();
    testUnmlq< complex<double> >();
+   testMatsqrt< complex<double> >();
+   testPolar< complex<double> >();
 }
 //*************************************************************************************************
 
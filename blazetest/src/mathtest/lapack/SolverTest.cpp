@@ -87,6 +87,7 @@ SolverTest::SolverTest()
    testSysv< double >();
    testPosv< double >();
    testTrsv< double >();
+   testRefined< double >();
 
 
    //=====================================================================================
@@ -109,6 +110,7 @@ SolverTest::SolverTest()
    testHesv< complex<double> >();
    testPosv< complex<double> >();
    testTrsv< complex<double> >();
+   testRefined< complex<double> >();
 }
 //*************************************************************************************************
 
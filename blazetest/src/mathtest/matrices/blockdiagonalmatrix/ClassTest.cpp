@@ -0,0 +1,483 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/blockdiagonalmatrix/ClassTest.cpp
+//  \brief Source file for the BlockDiagonalMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/BlockDiagonalMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/blockdiagonalmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace blockdiagonalmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BlockDiagonalMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testElementAccess();
+   testMultiplication();
+   testSolve();
+   testDecompositions();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BlockDiagonalMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BlockDiagonalMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   {
+      test_ = "BlockDiagonalMatrix default constructor";
+
+      const MT A;
+
+      if( A.rows() != 0UL || A.columns() != 0UL || A.blocks() != 0UL || !isIntact( A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid matrix size\n"
+             << " Details:\n"
+             << "   Number of rows   : " << A.rows() << "\n"
+             << "   Number of columns: " << A.columns() << "\n"
+             << "   Expected size: 0x0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockDiagonalMatrix block size constructor";
+
+      const MT A( std::vector<size_t>{ 3UL, 1UL, 2UL } );
+
+      if( A.rows() != 6UL || A.columns() != 6UL || A.blocks() != 3UL || !isIntact( A ) ||
+          A.blockSize( 2UL ) != 2UL || A.blockOffset( 2UL ) != 4UL ||
+          A.capacity() != 14UL || A.nonZeros() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Number of rows   : " << A.rows() << "\n"
+             << "   Number of columns: " << A.columns() << "\n"
+             << "   Number of blocks : " << A.blocks() << "\n"
+             << "   Capacity         : " << A.capacity() << "\n"
+             << "   Expected size: 6x6 with 3 blocks and capacity 14\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockDiagonalMatrix initializer list constructor";
+
+      MT A{ 2UL, 1UL };
+      A.block( 0UL ) = { { 1.0, 2.0 }, { 3.0, 4.0 } };
+      A.block( 1UL ) = { { 5.0 } };
+
+      const DT D{ { 1.0, 2.0, 0.0 }, { 3.0, 4.0, 0.0 }, { 0.0, 0.0, 5.0 } };
+
+      if( A.rows() != 3UL || A.columns() != 3UL || !isIntact( A ) || A != D ||
+          A.nonZeros() != 5UL || A.nonZeros( 2UL ) != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Number of non-zeros: " << A.nonZeros() << "\n"
+             << "   Result:\n" << A << "\n"
+             << "   Expected result:\n" << D << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element access of the BlockDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator, the at() function and the
+// transpose operations of the BlockDiagonalMatrix class template. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testElementAccess()
+{
+   {
+      test_ = "BlockDiagonalMatrix::operator() and at()";
+
+      MT A{ 3UL, 1UL, 4UL };
+      DT D( 8UL, 8UL, 0.0 );
+
+      for( size_t k=0UL; k<A.blocks(); ++k ) {
+         auto B( A.block( k ) );
+         blaze::randomize( B );
+         submatrix( D, A.blockOffset( k ), A.blockOffset( k ), B.rows(), B.columns() ) = B;
+      }
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            if( A(i,j) != D(i,j) || A.at(i,j) != D(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Access failed\n"
+                   << " Details:\n"
+                   << "   Element: (" << i << "," << j << ")\n"
+                   << "   Result: " << A(i,j) << "\n"
+                   << "   Expected result: " << D(i,j) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      try {
+         const double value( A.at( 0UL, 8UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound access succeeded\n"
+             << " Details:\n"
+             << "   Result: " << value << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+
+      test_ = "BlockDiagonalMatrix transpose";
+
+      const MT T( trans( A ) );
+
+      if( T != trans( D ) || !isIntact( T ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose failed\n"
+             << " Details:\n"
+             << "   Result:\n" << T << "\n"
+             << "   Expected result:\n" << trans( D ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockDiagonalMatrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the block-wise multiplication of a BlockDiagonalMatrix with
+// dense vectors and dense matrices. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   const MT A( createMatrix() );
+   const DT D( A );
+
+   {
+      test_ = "BlockDiagonalMatrix/dense vector multiplication";
+
+      VT x( A.columns() );
+      blaze::randomize( x );
+
+      const VT y( A * x );
+      checkError( y, VT( D * x ), 1E-12 );
+   }
+
+   {
+      test_ = "BlockDiagonalMatrix/dense matrix multiplication";
+
+      DT X( A.columns(), 5UL );
+      blaze::randomize( X );
+
+      const DT Y( A * X );
+      checkError( Y, DT( D * X ), 1E-12 );
+   }
+
+   {
+      test_ = "BlockDiagonalMatrix/dense vector multiplication with aliasing";
+
+      VT x( A.columns() );
+      blaze::randomize( x );
+
+      const VT y( D * x );
+      multiply( A, x, x );
+      checkError( x, y, 1E-12 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockDiagonalMatrix linear solvers and inversion.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the block-wise solution of linear systems and of the
+// block-wise inversion of a BlockDiagonalMatrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSolve()
+{
+   const MT A( createMatrix() );
+
+   {
+      test_ = "BlockDiagonalMatrix solve with a single right-hand side";
+
+      VT x( A.columns() ), y;
+      blaze::randomize( x );
+
+      solve( A, y, VT( A * x ) );
+      checkError( y, x, 1E-10 );
+   }
+
+   {
+      test_ = "BlockDiagonalMatrix solve with multiple right-hand sides";
+
+      DT X( A.columns(), 4UL ), Y;
+      blaze::randomize( X );
+
+      solve( A, Y, DT( A * X ) );
+      checkError( Y, X, 1E-10 );
+   }
+
+   {
+      test_ = "BlockDiagonalMatrix inversion";
+
+      VT x( A.columns() );
+      blaze::randomize( x );
+
+      const MT B( inv( A ) );
+      checkError( VT( B * VT( A * x ) ), x, 1E-10 );
+   }
+
+   {
+      test_ = "BlockDiagonalMatrix inversion of a singular matrix";
+
+      MT B( A );
+      reset( B.block( 2UL ) );
+
+      bool failed( false );
+
+      try {
+         invert( B );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockDiagonalMatrix decompositions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the block-wise Cholesky decomposition and the block-wise
+// eigenvalue computation of a BlockDiagonalMatrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDecompositions()
+{
+   const MT A( createMatrix() );
+   const DT D( A );
+
+   {
+      test_ = "BlockDiagonalMatrix Cholesky decomposition";
+
+      MT L;
+      llh( A, L );
+
+      const DT LD( L );
+      checkError( DT( LD * trans( LD ) ), D, 1E-12 );
+
+      if( !isLower( LD ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-lower Cholesky factor detected\n"
+             << " Details:\n"
+             << "   Result:\n" << LD << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockDiagonalMatrix eigenvalues";
+
+      VT w;
+      eigen( A, w );
+
+      for( size_t k=0UL; k<A.blocks(); ++k )
+      {
+         const size_t offset( A.blockOffset( k ) );
+         const size_t n( A.blockSize( k ) );
+
+         DT B( A.block( k ) );
+         VT expected( n );
+         blaze::syev( B, expected, 'N', 'L' );
+         checkError( VT( subvector( w, offset, n ) ), expected, 1E-10 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a symmetric positive definite block-diagonal test matrix.
+//
+// \return The block-diagonal test matrix.
+//
+// This function creates a block-diagonal matrix with blocks of varying size, each of which is
+// symmetric and strictly diagonally dominant.
+*/
+ClassTest::MT ClassTest::createMatrix()
+{
+   MT A{ 7UL, 1UL, 40UL, 13UL, 120UL, 2UL, 25UL };
+
+   for( size_t k=0UL; k<A.blocks(); ++k )
+   {
+      auto B( A.block( k ) );
+      const size_t n( B.rows() );
+
+      DT R( n, n );
+      blaze::randomize( R, -1.0, 1.0 );
+
+      B = R + trans( R );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         B(i,i) += 2.0 * n;
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+} // namespace blockdiagonalmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BlockDiagonalMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BLOCKDIAGONALMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BlockDiagonalMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,275 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/circulantmatrix/ClassTest.cpp
+//  \brief Source file for the CirculantMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/CirculantMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/circulantmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace circulantmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CirculantMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testElementAccess();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CirculantMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the CirculantMatrix class template. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   {
+      test_ = "CirculantMatrix default constructor";
+
+      const MT A;
+
+      if( A.rows() != 0UL || A.columns() != 0UL || !isIntact( A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid matrix size\n"
+             << " Details:\n"
+             << "   Number of rows   : " << A.rows() << "\n"
+             << "   Number of columns: " << A.columns() << "\n"
+             << "   Expected size: 0x0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CirculantMatrix column constructor";
+
+      const MT A( VT{ 1.0, 2.0, 0.0 } );
+      const DT D{ { 1.0, 0.0, 2.0 }, { 2.0, 1.0, 0.0 }, { 0.0, 2.0, 1.0 } };
+
+      if( A.rows() != 3UL || A.columns() != 3UL || !isIntact( A ) || A != D ||
+          A.nonZeros() != 6UL || A.nonZeros( 1UL ) != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Number of non-zeros: " << A.nonZeros() << "\n"
+             << "   Result:\n" << A << "\n"
+             << "   Expected result:\n" << D << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element access of the CirculantMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator and the at() function of the
+// CirculantMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testElementAccess()
+{
+   test_ = "CirculantMatrix::operator() and at()";
+
+   VT column( 6UL );
+   blaze::randomize( column );
+
+   const MT A( column );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         const double expected( column[(i+6UL-j)%6UL] );
+         if( A(i,j) != expected || A.at(i,j) != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Access failed\n"
+                << " Details:\n"
+                << "   Element: (" << i << "," << j << ")\n"
+                << "   Result: " << A(i,j) << "\n"
+                << "   Expected result: " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   try {
+      const double value( A.at( 6UL, 0UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound access succeeded\n"
+          << " Details:\n"
+          << "   Result: " << value << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CirculantMatrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the FFT-based multiplication of a CirculantMatrix with dense
+// vectors and dense matrices. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   VT column( 200UL );
+   blaze::randomize( column );
+
+   const MT A( column );
+   const DT D( A );
+
+   {
+      test_ = "CirculantMatrix/dense vector multiplication";
+
+      VT x( 200UL );
+      blaze::randomize( x );
+
+      const VT y( A * x );
+      checkError( y, VT( D * x ), 1E-12 );
+   }
+
+   {
+      test_ = "CirculantMatrix/dense matrix multiplication";
+
+      DT X( 200UL, 5UL );
+      blaze::randomize( X );
+
+      const DT Y( A * X );
+      checkError( Y, DT( D * X ), 1E-12 );
+   }
+
+   {
+      test_ = "CirculantMatrix/dense vector multiplication with aliasing";
+
+      VT x( 200UL );
+      blaze::randomize( x );
+
+      const VT y( D * x );
+      multiply( A, x, x );
+      checkError( x, y, 1E-12 );
+   }
+}
+//*************************************************************************************************
+
+} // namespace circulantmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CirculantMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_CIRCULANTMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CirculantMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,450 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/deltacompressedmatrix/ClassTest.cpp
+//  \brief Source file for the DeltaCompressedMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DeltaCompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/deltacompressedmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace deltacompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DeltaCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testDeduplication();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the DeltaCompressedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the DeltaCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   const blaze::DynamicMatrix<double,blaze::rowMajor> D{ { 1, 0, 3, 0 },
+                                                         { 0, 0, 0, 0 },
+                                                         { 0, 2, 4, 5 } };
+
+   {
+      test_ = "DeltaCompressedMatrix default constructor";
+
+      MT A;
+
+      checkMatrix( A, blaze::DynamicMatrix<double>() );
+
+      if( A.nonZeros() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements\n"
+             << " Details:\n"
+             << "   Number of non-zeros: " << A.nonZeros() << "\n"
+             << "   Expected number of non-zeros: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major DeltaCompressedMatrix conversion constructor (dense)";
+
+      const MT A( D );
+
+      checkMatrix( A, D );
+
+      if( A.nonZeros() != 5UL || A.nonZeros( 0UL ) != 2UL ||
+          A.nonZeros( 1UL ) != 0UL || A.nonZeros( 2UL ) != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements\n"
+             << " Details:\n"
+             << "   Result:\n" << A.matrix() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major DeltaCompressedMatrix conversion constructor (sparse)";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> C( D );
+      const OMT A( C );
+
+      checkMatrix( A, D );
+
+      if( A.nonZeros() != 5UL || A.nonZeros( 0UL ) != 1UL || A.nonZeros( 2UL ) != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements\n"
+             << " Details:\n"
+             << "   Result:\n" << A.matrix() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DeltaCompressedMatrix conversion constructor (large index differences)";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> C( 2UL, 300000UL );
+      C(0,0UL) = 1.0;
+      C(0,200UL) = 2.0;
+      C(0,70000UL) = 3.0;
+      C(1,299999UL) = 4.0;
+      C(1,299998UL) = 5.0;
+
+      const MT A( C );
+
+      if( A.matrix() != C || A(0,70000) != 3.0 || A(1,299998) != 5.0 || A(1,0) != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid decoding of the indices\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DeltaCompressedMatrix::at()";
+
+      const MT A( D );
+
+      try {
+         const double value( A.at( 3UL, 0UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bounds access succeeded\n"
+             << " Details:\n"
+             << "   Result: " << value << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+
+   {
+      test_ = "DeltaCompressedMatrix::forEach()";
+
+      const OMT A( D );
+
+      size_t count( 0UL ), last( 0UL );
+      double sum( 0.0 );
+
+      A.forEach( 2UL, [&]( size_t i, const double& value ) {
+         ++count;
+         last = i;
+         sum += value;
+      } );
+
+      if( count != 2UL || last != 2UL || sum != 7.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid traversal of column 2\n"
+             << " Details:\n"
+             << "   Number of elements: " << count << " (expected 2)\n"
+             << "   Last index: " << last << " (expected 2)\n"
+             << "   Sum: " << sum << " (expected 7)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the value deduplication of DeltaCompressedMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the storage of the values as codes into a table of distinct
+// values. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDeduplication()
+{
+   blaze::CompressedMatrix<double,blaze::rowMajor> C( 100UL, 100UL );
+
+   for( size_t i=0UL; i<C.rows(); ++i ) {
+      for( size_t j=i%3UL; j<C.columns(); j+=3UL ) {
+         C(i,j) = static_cast<double>( ( i + j ) % 7UL ) - 3.0;
+      }
+   }
+
+   {
+      test_ = "DeltaCompressedMatrix deduplication of values";
+
+      const MT A( C );
+      const MT B( C, false );
+
+      checkMatrix( A, C );
+      checkMatrix( B, C );
+
+      if( !A.isDeduplicated() || B.isDeduplicated() || A.bytes() >= B.bytes() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid deduplication\n"
+             << " Details:\n"
+             << "   Deduplicated: " << A.isDeduplicated() << " and " << B.isDeduplicated() << "\n"
+             << "   Bytes: " << A.bytes() << " and " << B.bytes() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DeltaCompressedMatrix deduplication of too many distinct values";
+
+      for( size_t i=0UL; i<C.rows(); ++i ) {
+         C(i,i) = static_cast<double>( i ) + 0.25;
+         C(i,(i+25UL)%C.columns()) = static_cast<double>( i ) + 0.5;
+         C(i,(i+50UL)%C.columns()) = static_cast<double>( i ) + 0.75;
+      }
+
+      const MT A( C );
+
+      checkMatrix( A, C );
+
+      if( A.isDeduplicated() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deduplication of more than 256 distinct values succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the delta-compressed matrix/vector and matrix/matrix multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of a DeltaCompressedMatrix with dense
+// vectors and dense matrices. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   const blaze::DynamicMatrix<double,blaze::rowMajor> D{ { 1, 0, 3 },
+                                                         { 0, 2, 4 } };
+
+   {
+      test_ = "Row-major DeltaCompressedMatrix/dense vector multiplication";
+
+      const MT A( D );
+      const blaze::DynamicVector<double,blaze::columnVector> x{ 1, 2, 3 };
+
+      checkVector( A * x, blaze::DynamicVector<double,blaze::columnVector>{ 10, 16 } );
+   }
+
+   {
+      test_ = "Transpose dense vector/column-major DeltaCompressedMatrix multiplication";
+
+      const OMT A( D );
+      const blaze::DynamicVector<double,blaze::rowVector> x{ 1, 2 };
+
+      checkVector( x * A, blaze::DynamicVector<double,blaze::rowVector>{ 1, 4, 11 } );
+   }
+
+   {
+      test_ = "Aliased DeltaCompressedMatrix/dense vector multiplication";
+
+      const MT A( blaze::DynamicMatrix<double>{ { 1, 0, 3 }, { 0, 2, 4 }, { 3, 4, 0 } } );
+      blaze::DynamicVector<double,blaze::columnVector> x{ 1, 2, 3 };
+
+      multiply( A, x, x );
+
+      checkVector( x, blaze::DynamicVector<double,blaze::columnVector>{ 10, 16, 11 } );
+   }
+
+   {
+      test_ = "DeltaCompressedMatrix/dense vector multiplication (size mismatch)";
+
+      const MT A( D );
+      const blaze::DynamicVector<double,blaze::columnVector> x{ 1, 2 };
+
+      try {
+         const blaze::DynamicVector<double,blaze::columnVector> y( A * x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with invalid vector succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "DeltaCompressedMatrix/dense matrix multiplication";
+
+      const MT A( D );
+      const OMT B( D );
+      const blaze::DynamicMatrix<double,blaze::columnMajor> X{ { 1, 2 }, { 3, 4 }, { 5, 6 } };
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> Y{ { 16, 20 }, { 26, 32 } };
+
+      checkVector( A * X, Y );
+      checkVector( B * X, Y );
+   }
+
+   testRandomMultiplication<blaze::rowMajor>   (  50UL,  70UL,   300UL, true  );
+   testRandomMultiplication<blaze::columnMajor>(  50UL,  70UL,   300UL, false );
+   testRandomMultiplication<blaze::rowMajor>   ( 997UL, 801UL, 20000UL, true  );
+   testRandomMultiplication<blaze::rowMajor>   ( 997UL, 801UL, 20000UL, false );
+   testRandomMultiplication<blaze::columnMajor>( 997UL, 801UL, 20000UL, true  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the delta-compressed matrix multiplications with random matrices.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param nonzeros The number of non-zero elements of the random matrix.
+// \param deduplicate \a true to deduplicate the values of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the multiplications of a random DeltaCompressedMatrix with random
+// dense vectors and matrices with the according multiplications of a CompressedMatrix. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order
+void ClassTest::testRandomMultiplication( size_t m, size_t n, size_t nonzeros, bool deduplicate )
+{
+   test_ = "Random DeltaCompressedMatrix multiplication";
+
+   blaze::CompressedMatrix<int,SO> R( m, n );
+   blaze::randomize( R, nonzeros, -5, 5 );
+
+   const blaze::CompressedMatrix<double,SO> C( R );
+   const blaze::DeltaCompressedMatrix<double,SO> A( C, deduplicate );
+
+   checkMatrix( A, C );
+
+   blaze::DynamicVector<double,blaze::columnVector> x( n );
+   blaze::randomize( x, -5, 5 );
+
+   blaze::DynamicVector<double,blaze::columnVector> y( m );
+   blaze::randomize( y, -5, 5 );
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> X( n, 7UL );
+   blaze::randomize( X, -5, 5 );
+
+   checkVector( A * x, C * x );
+   checkVector( trans( y ) * A, trans( y ) * C );
+   checkVector( A * X, C * X );
+}
+//*************************************************************************************************
+
+} // namespace deltacompressedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running DeltaCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_DELTACOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during DeltaCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
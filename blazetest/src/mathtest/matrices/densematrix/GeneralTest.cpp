@@ -102,7 +102,12 @@ GeneralTest::GeneralTest()
    testMean();
    testVar();
    testStdDev();
+   testRolling();
    testSoftmax();
+   testPairwiseDistances();
+   testKnn();
+   testCov();
+   testCor();
    testLeftShift();
    testRightShift();
    testBitand();
@@ -8035,6 +8040,232 @@ void GeneralTest::testStdDev()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the rolling-window functions for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c rollingSum(), \c rollingMean(), \c rollingMin(),
+// \c rollingMax(), and \c rollingVar() functions for dense matrices. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testRolling()
+{
+   using blaze::rowwise;
+   using blaze::columnwise;
+
+
+   // Comparison of all windows of the given matrix with the directly computed reductions
+   const auto checkWindows = [this]( const auto& mat, size_t w )
+   {
+      using MT = blaze::RemoveCVRef_t<decltype( mat )>;
+      using RT = blaze::DynamicMatrix<double,blaze::StorageOrder_v<MT>>;
+
+      if( w <= mat.columns() )
+      {
+         const RT sum ( blaze::rollingSum <rowwise>( mat, w ) );
+         const RT mean( blaze::rollingMean<rowwise>( mat, w ) );
+         const RT min ( blaze::rollingMin <rowwise>( mat, w ) );
+         const RT max ( blaze::rollingMax <rowwise>( mat, w ) );
+
+         RT var;
+         if( w > 1UL ) var = blaze::rollingVar<rowwise>( mat, w );
+
+         checkRows   ( sum, mat.rows() );
+         checkColumns( sum, mat.columns()-w+1UL );
+
+         for( size_t i=0UL; i<sum.rows(); ++i ) {
+            for( size_t j=0UL; j<sum.columns(); ++j )
+            {
+               const auto window( subvector( row( mat, i ), j, w ) );
+
+               if( std::fabs( sum(i,j)  - blaze::sum ( window ) ) > 1E-10 ||
+                   std::fabs( mean(i,j) - blaze::mean( window ) ) > 1E-10 ||
+                   min(i,j) != blaze::min( window ) || max(i,j) != blaze::max( window ) ||
+                   ( w > 1UL && std::fabs( var(i,j) - blaze::var( window ) ) > 1E-10 ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Row-wise rolling-window computation failed\n"
+                      << " Details:\n"
+                      << "   Size  : " << mat.rows() << "x" << mat.columns() << "\n"
+                      << "   Window: " << w << "\n"
+                      << "   Index : (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      if( w <= mat.rows() )
+      {
+         const RT sum ( blaze::rollingSum <columnwise>( mat, w ) );
+         const RT mean( blaze::rollingMean<columnwise>( mat, w ) );
+         const RT min ( blaze::rollingMin <columnwise>( mat, w ) );
+         const RT max ( blaze::rollingMax <columnwise>( mat, w ) );
+
+         RT var;
+         if( w > 1UL ) var = blaze::rollingVar<columnwise>( mat, w );
+
+         checkRows   ( sum, mat.rows()-w+1UL );
+         checkColumns( sum, mat.columns() );
+
+         for( size_t i=0UL; i<sum.rows(); ++i ) {
+            for( size_t j=0UL; j<sum.columns(); ++j )
+            {
+               const auto window( subvector( column( mat, j ), i, w ) );
+
+               if( std::fabs( sum(i,j)  - blaze::sum ( window ) ) > 1E-10 ||
+                   std::fabs( mean(i,j) - blaze::mean( window ) ) > 1E-10 ||
+                   min(i,j) != blaze::min( window ) || max(i,j) != blaze::max( window ) ||
+                   ( w > 1UL && std::fabs( var(i,j) - blaze::var( window ) ) > 1E-10 ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Column-wise rolling-window computation failed\n"
+                      << " Details:\n"
+                      << "   Size  : " << mat.rows() << "x" << mat.columns() << "\n"
+                      << "   Window: " << w << "\n"
+                      << "   Index : (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   };
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major rolling-window functions";
+
+      {
+         const blaze::DynamicMatrix<int,blaze::rowMajor> mat{ { 1, 2, 3, 4 },
+                                                              { 5, 6, 7, 8 } };
+
+         using RT = blaze::DynamicMatrix<int,blaze::rowMajor>;
+
+         const RT rsum( blaze::rollingSum<rowwise>( mat, 2UL ) );
+         const RT csum( blaze::rollingSum<columnwise>( mat, 2UL ) );
+
+         checkRows   ( rsum, 2UL );
+         checkColumns( rsum, 3UL );
+         checkRows   ( csum, 1UL );
+         checkColumns( csum, 4UL );
+
+         if( rsum(0,0) !=  3 || rsum(0,1) !=  5 || rsum(0,2) !=  7 ||
+             rsum(1,0) != 11 || rsum(1,1) != 13 || rsum(1,2) != 15 ||
+             csum(0,0) !=  6 || csum(0,1) !=  8 || csum(0,2) != 10 || csum(0,3) != 12 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Rolling-window computation failed\n"
+                << " Details:\n"
+                << "   Row-wise result:\n" << rsum << "\n"
+                << "   Expected row-wise result:\n(  3  5  7 )\n( 11 13 15 )\n"
+                << "   Column-wise result:\n" << csum << "\n"
+                << "   Expected column-wise result:\n(  6  8 10 12 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      for( const auto& dims : { std::make_pair( 1UL, 1UL ), std::make_pair( 3UL, 17UL )
+                              , std::make_pair( 17UL, 3UL ), std::make_pair( 2UL, 5000UL )
+                              , std::make_pair( 5000UL, 2UL ), std::make_pair( 120UL, 130UL ) } ) {
+         for( size_t w : { 1UL, 2UL, 5UL, 64UL } )
+         {
+            blaze::DynamicMatrix<double,blaze::rowMajor> mat( dims.first, dims.second );
+            randomize( mat, -1.0, 1.0 );
+
+            checkWindows( mat, w );
+         }
+      }
+
+      try {
+         using RT = blaze::DynamicMatrix<int,blaze::rowMajor>;
+
+         const RT mat( 3UL, 5UL );
+         const RT sum( blaze::rollingSum<columnwise>( mat, 4UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Rolling-window computation with too large window succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << sum << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major rolling-window functions";
+
+      {
+         const blaze::DynamicMatrix<int,blaze::columnMajor> mat{ { 1, 2, 3, 4 },
+                                                                 { 5, 6, 7, 8 } };
+
+         using RT = blaze::DynamicMatrix<double,blaze::columnMajor>;
+
+         const RT rmean( blaze::rollingMean<rowwise>( mat, 2UL ) );
+         const RT cmean( blaze::rollingMean<columnwise>( mat, 2UL ) );
+
+         checkRows   ( rmean, 2UL );
+         checkColumns( rmean, 3UL );
+         checkRows   ( cmean, 1UL );
+         checkColumns( cmean, 4UL );
+
+         if( !isEqual( rmean(0,0), 1.5 ) || !isEqual( rmean(0,2), 3.5 ) ||
+             !isEqual( rmean(1,0), 5.5 ) || !isEqual( rmean(1,2), 7.5 ) ||
+             !isEqual( cmean(0,0), 3.0 ) || !isEqual( cmean(0,3), 6.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Rolling-window computation failed\n"
+                << " Details:\n"
+                << "   Row-wise result:\n" << rmean << "\n"
+                << "   Expected row-wise result:\n( 1.5 2.5 3.5 )\n( 5.5 6.5 7.5 )\n"
+                << "   Column-wise result:\n" << cmean << "\n"
+                << "   Expected column-wise result:\n( 3 4 5 6 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      for( const auto& dims : { std::make_pair( 1UL, 1UL ), std::make_pair( 3UL, 17UL )
+                              , std::make_pair( 17UL, 3UL ), std::make_pair( 2UL, 5000UL )
+                              , std::make_pair( 5000UL, 2UL ), std::make_pair( 120UL, 130UL ) } ) {
+         for( size_t w : { 1UL, 2UL, 5UL, 64UL } )
+         {
+            blaze::DynamicMatrix<double,blaze::columnMajor> mat( dims.first, dims.second );
+            randomize( mat, -1.0, 1.0 );
+
+            checkWindows( mat, w );
+         }
+      }
+
+      try {
+         const blaze::DynamicMatrix<int,blaze::columnMajor> mat( 3UL, 5UL );
+         using RT = blaze::DynamicMatrix<double,blaze::columnMajor>;
+
+         const RT var( blaze::rollingVar<rowwise>( mat, 1UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Rolling-window variance with window size 1 succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << var << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c softmax() function for dense matrices.
 //
@@ -8104,6 +8335,478 @@ void GeneralTest::testSoftmax()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the \c pairwiseDistances() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c pairwiseDistances() function for dense matrices. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testPairwiseDistances()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major pairwiseDistances() (Euclidean distance)";
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> X{ { 0.0, 0.0 }, { 1.0, 1.0 } };
+      const blaze::DynamicMatrix<double,blaze::rowMajor> Y{ { 3.0, 4.0 },
+                                                            { 1.0, 0.0 },
+                                                            { 0.0, 0.0 } };
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> D;
+      pairwiseDistances( X, Y, D );
+
+      const double s2 ( std::sqrt(  2.0 ) );
+      const double s13( std::sqrt( 13.0 ) );
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> R{ { 5.0, 1.0, 0.0 },
+                                                            { s13, 1.0, s2  } };
+
+      if( D != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Distance computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major pairwiseDistances() (squared Euclidean distance)";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> X( 70UL, 5UL ), Y( 300UL, 5UL );
+      randomize( X, -1.0, 1.0 );
+      randomize( Y, -1.0, 1.0 );
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> D(
+         pairwiseDistances( X, Y, blaze::squaredEuclideanDistance ) );
+
+      for( size_t i=0UL; i<X.rows(); ++i ) {
+         for( size_t j=0UL; j<Y.rows(); ++j ) {
+            if( !blaze::equal( D(i,j), sqrNorm( row( X, i ) - row( Y, j ) ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Distance computation failed\n"
+                   << " Details:\n"
+                   << "   Element: (" << i << "," << j << ")\n"
+                   << "   Result: " << D(i,j) << "\n"
+                   << "   Expected result: " << sqrNorm( row( X, i ) - row( Y, j ) ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major pairwiseDistances() (invalid matrix sizes)";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> X( 2UL, 3UL ), Y( 2UL, 4UL ), D;
+
+      try {
+         pairwiseDistances( X, Y, D );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Distance computation with invalid matrix sizes succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major pairwiseDistances() (cosine distance)";
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> X{ { 1.0, 0.0 }, { 0.0, 0.0 } };
+      const blaze::DynamicMatrix<double,blaze::columnMajor> Y{ {  2.0, 0.0 },
+                                                               {  0.0, 3.0 },
+                                                               { -1.0, 0.0 } };
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> D;
+      pairwiseDistances( X, Y, D, blaze::cosineDistance );
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> R{ { 0.0, 1.0, 2.0 },
+                                                               { 1.0, 1.0, 1.0 } };
+
+      if( D != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Distance computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c knn() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c knn() function for dense matrices. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testKnn()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major knn()";
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> X{ { 0.0, 0.0 }, { 5.0, 5.0 } };
+      const blaze::DynamicMatrix<double,blaze::rowMajor> Y{ { 1.0,  0.0 },
+                                                            { 4.0,  4.0 },
+                                                            { 0.0,  2.0 },
+                                                            { 0.0, -1.0 },
+                                                            { 6.0,  6.0 } };
+
+      blaze::DynamicMatrix<size_t,blaze::rowMajor> I;
+      blaze::DynamicMatrix<double,blaze::rowMajor> D;
+      knn( X, Y, 3UL, I, D );
+
+      const blaze::DynamicMatrix<size_t,blaze::rowMajor> RI{ { 0UL, 3UL, 2UL }, { 1UL, 4UL, 2UL } };
+      const double s2 ( std::sqrt(  2.0 ) );
+      const double s34( std::sqrt( 34.0 ) );
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> RD{ { 1.0, 1.0, 2.0 },
+                                                             { s2 , s2 , s34 } };
+
+      if( I != RI || D != RD ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Nearest neighbor computation failed\n"
+             << " Details:\n"
+             << "   Result indices:\n" << I << "\n"
+             << "   Expected indices:\n" << RI << "\n"
+             << "   Result distances:\n" << D << "\n"
+             << "   Expected distances:\n" << RD << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major knn() (invalid number of neighbors)";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> X( 2UL, 3UL ), Y( 4UL, 3UL );
+      blaze::DynamicMatrix<size_t,blaze::rowMajor> I;
+
+      try {
+         knn( X, Y, 5UL, I );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Nearest neighbor computation with invalid number of neighbors succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << I << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major knn()";
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> X( 20UL, 4UL ), Y( 600UL, 4UL );
+      randomize( X );
+      randomize( Y );
+
+      blaze::DynamicMatrix<size_t,blaze::columnMajor> I;
+      blaze::DynamicMatrix<double,blaze::columnMajor> D;
+      knn( X, Y, 7UL, I, D, blaze::cosineDistance );
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> P(
+         pairwiseDistances( X, Y, blaze::cosineDistance ) );
+
+      for( size_t i=0UL; i<X.rows(); ++i )
+      {
+         const double bound( D(i,6UL) );
+         size_t closer( 0UL );
+
+         for( size_t j=0UL; j<Y.rows(); ++j ) {
+            closer += ( P(i,j) < bound ) ? 1UL : 0UL;
+         }
+
+         for( size_t j=0UL; j<7UL; ++j )
+         {
+            if( !blaze::equal( D(i,j), P(i,I(i,j)) ) || ( j > 0UL && D(i,j) < D(i,j-1UL) ) ||
+                closer >= 7UL ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Nearest neighbor computation failed\n"
+                   << " Details:\n"
+                   << "   Query point: " << i << "\n"
+                   << "   Result indices:\n" << row( I, i ) << "\n"
+                   << "   Result distances:\n" << row( D, i ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c cov() functions for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c cov() functions for dense matrices. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testCov()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major cov()";
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> X{ { 1, 2 }, { 2, 4 }, { 3, 7 } };
+
+      const blaze::SymmetricMatrix< blaze::DynamicMatrix<double,blaze::rowMajor> > C( cov( X ) );
+      const blaze::DynamicMatrix<double,blaze::rowMajor> R{ { 1.0, 2.5 }, { 2.5, 19.0/3.0 } };
+
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Covariance computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major cov() (large matrix)";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> X( 1500UL, 40UL );
+      randomize( X );
+      X += 1000.0;
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> Xc(
+         X - blaze::expand( blaze::mean<blaze::columnwise>( X ), X.rows() ) );
+      const blaze::DynamicMatrix<double,blaze::rowMajor> R(
+         trans( Xc ) * Xc / double( X.rows()-1UL ) );
+
+      const blaze::SymmetricMatrix< blaze::DynamicMatrix<double,blaze::rowMajor> > C( cov( X ) );
+
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Covariance computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major cov() (weighted)";
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> X{ { 1.0, 2.0 }
+                                                          , { 2.0, 4.0 }
+                                                          , { 3.0, 7.0 }
+                                                          , { 2.0, 4.0 } };
+      const blaze::DynamicVector<double,blaze::columnVector> w{ 1.0, 1.0, 1.0, 0.0 };
+      const blaze::DynamicVector<double,blaze::columnVector> u{ 1.0, 2.0, 1.0 };
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> C1( cov( X, w ) );
+      const blaze::DynamicMatrix<double,blaze::rowMajor> C2(
+         cov( submatrix( X, 0UL, 0UL, 3UL, 2UL ), u ) );
+      const blaze::DynamicMatrix<double,blaze::rowMajor> R1{ { 1.0, 2.5 }, { 2.5, 19.0/3.0 } };
+      const blaze::DynamicMatrix<double,blaze::rowMajor> R2{ { 0.8, 2.0 }, { 2.0,  5.1     } };
+
+      if( C1 != R1 || C2 != R2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Weighted covariance computation failed\n"
+             << " Details:\n"
+             << "   Result (zero weight):\n" << C1 << "\n"
+             << "   Expected result (zero weight):\n" << R1 << "\n"
+             << "   Result (non-uniform weights):\n" << C2 << "\n"
+             << "   Expected result (non-uniform weights):\n" << R2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major cov() (invalid input)";
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> X( 1UL, 3UL, 1.0 );
+
+      try {
+         const blaze::DynamicMatrix<double,blaze::rowMajor> C( cov( X ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Covariance computation of a single observation succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Row-major cov() (invalid weights)";
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> X( 3UL, 2UL, 1.0 );
+      const blaze::DynamicVector<double,blaze::columnVector> w{ 1.0, -1.0, 1.0 };
+
+      try {
+         const blaze::DynamicMatrix<double,blaze::rowMajor> C( cov( X, w ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Covariance computation with negative weights succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major cov()";
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> X( 700UL, 130UL );
+      blaze::DynamicVector<double,blaze::columnVector> w( 700UL );
+      randomize( X );
+      randomize( w, 0.0, 2.0 );
+
+      const double V1( sum( w ) );
+      const double V2( sum( w * w ) );
+
+      const blaze::DynamicVector<double,blaze::rowVector> mu( trans( w ) * X / V1 );
+      const blaze::DynamicMatrix<double,blaze::columnMajor> Xc( X - expand( mu, X.rows() ) );
+      const blaze::DynamicMatrix<double,blaze::columnMajor> R(
+         trans( Xc ) * ( expand( w, X.columns() ) % Xc ) / ( V1 - V2 / V1 ) );
+
+      const blaze::SymmetricMatrix< blaze::DynamicMatrix<double,blaze::columnMajor> > C(
+         cov( X, w ) );
+
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Weighted covariance computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c cor() functions for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c cor() functions for dense matrices. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testCor()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major cor()";
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> X{ { 1.0, 2.0, 3.0 }
+                                                          , { 2.0, 4.0, 1.0 }
+                                                          , { 3.0, 6.0, 2.0 } };
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> C( cor( X ) );
+      const blaze::DynamicMatrix<double,blaze::rowMajor> R{ {  1.0,  1.0, -0.5 }
+                                                          , {  1.0,  1.0, -0.5 }
+                                                          , { -0.5, -0.5,  1.0 } };
+
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Correlation computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major cor() (weighted)";
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> X( 300UL, 20UL );
+      blaze::DynamicVector<double,blaze::columnVector> w( 300UL );
+      randomize( X );
+      randomize( w, 0.0, 2.0 );
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> C( cov( X, w ) );
+      const blaze::DynamicMatrix<double,blaze::columnMajor> P( cor( X, w ) );
+
+      for( size_t i=0UL; i<X.columns(); ++i ) {
+         for( size_t j=0UL; j<X.columns(); ++j )
+         {
+            if( !blaze::equal( P(i,j), C(i,j) / std::sqrt( C(i,i) * C(j,j) ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Weighted correlation computation failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << P << "\n"
+                   << "   Covariance matrix:\n" << C << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the left-shift operator for dense matrices.
 //
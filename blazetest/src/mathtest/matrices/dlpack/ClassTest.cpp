@@ -0,0 +1,620 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/dlpack/ClassTest.cpp
+//  \brief Source file for the DLPack interoperability test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <blaze/math/DLPack.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/dlpack/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace dlpack {
+
+//=================================================================================================
+//
+//  STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+int ClassTest::deleted_ = 0;
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DLPack interoperability test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testMatrixExport();
+   testVectorExport();
+   testOwnership();
+   testImport();
+   testAlignment();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the export of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the export of dense matrices via the toDLPack() function.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatrixExport()
+{
+   {
+      test_ = "Row-major DynamicMatrix export";
+
+      MT A{ { 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 } };
+
+      DLManagedTensor* managed( blaze::toDLPack( A ) );
+      const DLTensor& tensor( managed->dl_tensor );
+
+      if( tensor.data != A.data() || tensor.ndim != 2 ||
+          tensor.shape[0] != 2 || tensor.shape[1] != 3 ||
+          tensor.strides[0] != static_cast<int64_t>( A.spacing() ) || tensor.strides[1] != 1 ||
+          tensor.dtype.code != kDLFloat || tensor.dtype.bits != 64U || tensor.dtype.lanes != 1U ||
+          tensor.device.device_type != kDLCPU ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid DLPack tensor detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::DLPackTensor handle( blaze::fromDLPack( managed ) );
+      checkMatrix( handle.matrix<double,blaze::rowMajor>(), A );
+
+      auto B( handle.customMatrix<double,blaze::unaligned,blaze::unpadded,blaze::rowMajor>() );
+      B(1,1) = 0.0;
+
+      if( A(1,1) != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Imported matrix does not refer to the exported matrix\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major DynamicMatrix export";
+
+      OMT A( 5UL, 3UL );
+      blaze::randomize( A );
+
+      blaze::DLPackTensor handle( blaze::fromDLPack( blaze::toDLPack( A ) ) );
+
+      if( handle.stride( 0UL ) != 1L || handle.stride( 1UL ) != static_cast<ptrdiff_t>( A.spacing() ) ||
+          handle.isContiguous<blaze::rowMajor>() || !handle.isContiguous<blaze::columnMajor>() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid strides detected\n"
+             << " Details:\n"
+             << "   Strides: " << handle.stride( 0UL ) << ", " << handle.stride( 1UL ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkMatrix( handle.matrix<double,blaze::rowMajor>(), A );
+      checkMatrix( handle.customMatrix<double,blaze::unaligned,blaze::unpadded,blaze::columnMajor>(), A );
+   }
+
+   {
+      test_ = "StridedMatrix export";
+
+      std::vector<double> array( 40UL );
+      std::iota( array.begin(), array.end(), 0.0 );
+
+      blaze::StridedMatrix<double> A( array.data()+39UL, 3UL, 4UL, -10L, -2L );
+
+      blaze::DLPackTensor handle( blaze::fromDLPack( blaze::toDLPack( A ) ) );
+
+      if( handle.stride( 0UL ) != -10L || handle.stride( 1UL ) != -2L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid strides detected\n"
+             << " Details:\n"
+             << "   Strides: " << handle.stride( 0UL ) << ", " << handle.stride( 1UL ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkMatrix( handle.matrix<double>(), A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the export of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the export of dense vectors via the toDLPack() function.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testVectorExport()
+{
+   {
+      test_ = "DynamicVector export";
+
+      VT a{ 1, 2, 3, 4, 5 };
+
+      blaze::DLPackTensor handle( blaze::fromDLPack( blaze::toDLPack( a ) ) );
+
+      if( handle.dimensions() != 1UL || handle.extent( 0UL ) != 5UL || handle.stride( 0UL ) != 1L ||
+          handle.dataType().code != kDLInt || handle.dataType().bits != 8U*sizeof( int ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid DLPack tensor detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkMatrix( handle.vector<int>(), a );
+   }
+
+   {
+      test_ = "StridedVector export";
+
+      std::vector<int> array( 15UL );
+      std::iota( array.begin(), array.end(), 0 );
+
+      blaze::StridedVector<int,blaze::rowVector> a( array.data(), 5UL, 3L );
+
+      blaze::DLPackTensor handle( blaze::fromDLPack( blaze::toDLPack( a ) ) );
+
+      if( handle.stride( 0UL ) != 3L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid stride detected\n"
+             << " Details:\n"
+             << "   Stride: " << handle.stride( 0UL ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkMatrix( handle.vector<int,blaze::rowVector>(), a );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ownership semantics of exported and imported tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the transfer and sharing of ownership between Blaze and
+// DLPack tensors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testOwnership()
+{
+   {
+      test_ = "Export of a temporary DynamicVector";
+
+      VT a{ 1, 2, 3, 4, 5 };
+      const int* ptr( a.data() );
+
+      DLManagedTensor* managed( blaze::toDLPack( std::move( a ) ) );
+
+      if( managed->dl_tensor.data != ptr ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Elements have been copied\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::DLPackTensor handle( blaze::fromDLPack( managed ) );
+      checkMatrix( handle.vector<int>(), VT{ 1, 2, 3, 4, 5 } );
+   }
+
+   {
+      test_ = "Export of a matrix expression";
+
+      const MT A{ { 1.0, 2.0 }, { 3.0, 4.0 }, { 5.0, 6.0 } };
+      const MT ref( A * trans( A ) );
+
+      blaze::DLPackTensor handle( blaze::fromDLPack( blaze::toDLPack( A * trans( A ) ) ) );
+      checkMatrix( handle.matrix<double>(), ref );
+   }
+
+   {
+      test_ = "Export with shared ownership";
+
+      std::shared_ptr<double> memory( new double[12](), std::default_delete<double[]>() );
+      DLManagedTensor* managed( nullptr );
+
+      {
+         blaze::CustomMatrix<double,blaze::unaligned,blaze::unpadded> A( memory.get(), 3UL, 4UL );
+         A = 2.0;
+         managed = blaze::toDLPack( A, memory );
+      }
+
+      const long count( memory.use_count() );
+
+      {
+         blaze::DLPackTensor handle( blaze::fromDLPack( managed ) );
+         checkMatrix( handle.matrix<double>(), MT( 3UL, 4UL, 2.0 ) );
+      }
+
+      if( count != 2L || memory.use_count() != 1L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid ownership detected\n"
+             << " Details:\n"
+             << "   Use count during export: " << count << " (expected 2)\n"
+             << "   Use count after release: " << memory.use_count() << " (expected 1)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Re-export of an imported tensor";
+
+      MT A( 4UL, 3UL );
+      blaze::randomize( A );
+
+      blaze::DLPackTensor handle( blaze::fromDLPack( blaze::toDLPack( A ) ) );
+      DLManagedTensor* managed( blaze::toDLPack( handle ) );
+
+      if( handle.useCount() != 2L || managed->dl_tensor.data != A.data() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid ownership detected\n"
+             << " Details:\n"
+             << "   Use count: " << handle.useCount() << " (expected 2)\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      managed->deleter( managed );
+
+      if( handle.useCount() != 1L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid ownership detected\n"
+             << " Details:\n"
+             << "   Use count: " << handle.useCount() << " (expected 1)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the import of foreign DLPack tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the import of DLPack tensors created by other frameworks.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testImport()
+{
+   double array[8] = { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0 };
+   int64_t shape[2] = { 2, 3 };
+   int64_t strides[2] = { 0, 1 };
+
+   const auto deleter = []( DLManagedTensor* tensor ) { ++deleted_; delete tensor; };
+
+   deleted_ = 0;
+
+   {
+      test_ = "Import of a compact tensor with byte offset";
+
+      DLManagedTensor* managed( new DLManagedTensor() );
+      managed->dl_tensor.data        = array;
+      managed->dl_tensor.device      = DLDevice{ kDLCPU, 0 };
+      managed->dl_tensor.ndim        = 2;
+      managed->dl_tensor.dtype       = DLDataType{ kDLFloat, 64U, 1U };
+      managed->dl_tensor.shape       = shape;
+      managed->dl_tensor.strides     = nullptr;
+      managed->dl_tensor.byte_offset = sizeof( double );
+      managed->deleter               = deleter;
+
+      {
+         blaze::DLPackTensor handle( blaze::fromDLPack( managed ) );
+         blaze::DLPackTensor copy( handle );
+
+         checkMatrix( copy.matrix<double>(), MT{ { 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 } } );
+      }
+
+      if( deleted_ != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deleter has not been called exactly once\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Import of a tensor with zero stride of size-1 dimension";
+
+      shape[0] = 1;
+
+      DLManagedTensor* managed( new DLManagedTensor() );
+      managed->dl_tensor.data    = array;
+      managed->dl_tensor.device  = DLDevice{ kDLCPU, 0 };
+      managed->dl_tensor.ndim    = 2;
+      managed->dl_tensor.dtype   = DLDataType{ kDLFloat, 64U, 1U };
+      managed->dl_tensor.shape   = shape;
+      managed->dl_tensor.strides = strides;
+      managed->deleter           = deleter;
+
+      blaze::DLPackTensor handle( blaze::fromDLPack( managed ) );
+
+      if( handle.stride( 0UL ) != 1L || !handle.isContiguous<blaze::rowMajor>() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid stride normalization\n"
+             << " Details:\n"
+             << "   Strides: " << handle.stride( 0UL ) << ", " << handle.stride( 1UL ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkMatrix( handle.customMatrix<double,blaze::unaligned,blaze::unpadded,blaze::rowMajor>(),
+                   MT{ { 0.0, 1.0, 2.0 } } );
+   }
+
+   {
+      test_ = "Import of an invalid tensor";
+
+      DLManagedTensor* managed( new DLManagedTensor() );
+      managed->dl_tensor.data   = array;
+      managed->dl_tensor.device = DLDevice{ kDLCUDA, 0 };
+      managed->dl_tensor.ndim   = 2;
+      managed->dl_tensor.dtype  = DLDataType{ kDLFloat, 64U, 1U };
+      managed->dl_tensor.shape  = shape;
+      managed->deleter          = deleter;
+
+      const int deleted( deleted_ );
+
+      try {
+         blaze::fromDLPack( managed );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Import of a device tensor succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( deleted_ != deleted ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deleter of rejected tensor has been called\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      delete managed;
+   }
+
+   {
+      test_ = "Import with invalid element type";
+
+      MT A( 2UL, 2UL, 1.0 );
+      blaze::DLPackTensor handle( blaze::fromDLPack( blaze::toDLPack( A ) ) );
+
+      try {
+         handle.matrix<float>();
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: View with invalid element type succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the alignment and padding queries of imported tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the isAligned() and isPadded() member functions of the
+// DLPackTensor class. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAlignment()
+{
+   test_ = "DLPackTensor::isAligned() and DLPackTensor::isPadded()";
+
+   MT A( 5UL, 7UL );
+   blaze::randomize( A );
+
+   {
+      blaze::DLPackTensor handle( blaze::fromDLPack( blaze::toDLPack( A ) ) );
+
+      if( !handle.isAligned<double,blaze::rowMajor>() || !handle.isPadded<double,blaze::rowMajor>() ||
+          handle.isAligned<double,blaze::columnMajor>() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid alignment of padded matrix detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkMatrix( handle.customMatrix<double,blaze::aligned,blaze::padded,blaze::rowMajor>(), A );
+   }
+
+   {
+      auto sm = blaze::submatrix( A, 0UL, 1UL, 5UL, 4UL );
+      blaze::DLPackTensor handle( blaze::fromDLPack( blaze::toDLPack( sm ) ) );
+
+      if( blaze::SIMDTrait<double>::size > 1UL && handle.isAligned<double,blaze::rowMajor>() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid alignment of unaligned submatrix detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkMatrix( handle.customMatrix<double,blaze::unaligned,blaze::unpadded,blaze::rowMajor>(), sm );
+   }
+
+   {
+      test_ = "DLPackTensor::isPadded() of a strided slice";
+
+      alignas( 64 ) double buffer[16];
+      std::fill( buffer, buffer+16, 1.0 );
+
+      int64_t shape  [2] = { 2, 5 };
+      int64_t strides[2] = { 8, 1 };
+
+      DLManagedTensor* managed( new DLManagedTensor() );
+      managed->dl_tensor.data    = buffer;
+      managed->dl_tensor.device  = DLDevice{ kDLCPU, 0 };
+      managed->dl_tensor.ndim    = 2;
+      managed->dl_tensor.dtype   = DLDataType{ kDLFloat, 64U, 1U };
+      managed->dl_tensor.shape   = shape;
+      managed->dl_tensor.strides = strides;
+      managed->deleter           = []( DLManagedTensor* tensor ) { delete tensor; };
+
+      blaze::DLPackTensor handle( blaze::fromDLPack( managed ) );
+
+      if( handle.isPadded<double,blaze::rowMajor>() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Foreign tensor reported as padded\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         handle.customMatrix<double,blaze::aligned,blaze::padded,blaze::rowMajor>();
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Padded matrix on top of a strided slice succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      auto B( handle.customMatrix<double,blaze::unaligned,blaze::unpadded,blaze::rowMajor>() );
+      B = 2.0;
+      B += MT( 2UL, 5UL, 1.0 );
+
+      for( size_t i=0UL; i<2UL; ++i ) {
+         for( size_t j=0UL; j<8UL; ++j ) {
+            if( buffer[i*8UL+j] != ( j < 5UL ? 3.0 : 1.0 ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Assignment modified the parent array outside of the slice\n"
+                   << " Details:\n"
+                   << "   Element (" << i << "," << j << "): " << buffer[i*8UL+j] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace dlpack
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running DLPack interoperability test..." << std::endl;
+
+   try
+   {
+      RUN_DLPACK_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during DLPack interoperability test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,978 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/dynamicsparsematrix/ClassTest.cpp
+//  \brief Source file for the DynamicSparseMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/dynamicsparsematrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace dynamicsparsematrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DynamicSparseMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testInsert();
+   testAppend();
+   testErase();
+   testResize();
+   testReserve();
+   testCompact();
+   testExpressions();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the DynamicSparseMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the DynamicSparseMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicSparseMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major size constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicSparseMatrix size constructor (3x4)";
+
+      MT mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+   }
+
+   {
+      test_ = "Row-major DynamicSparseMatrix size constructor (3x4, per-row capacities)";
+
+      MT mat( 3UL, 4UL, std::vector<size_t>{ 2UL, 0UL, 4UL } );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 0UL, 2UL );
+      checkCapacity( mat, 2UL, 4UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major list initialization
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicSparseMatrix initializer list constructor";
+
+      MT mat{ { 1, 0, 2 }, { 0, 0, 0 }, { 0, 3 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 1UL );
+      checkMatrix  ( mat, CMT{ { 1, 0, 2 }, { 0, 0, 0 }, { 0, 3, 0 } } );
+   }
+
+
+   //=====================================================================================
+   // Row-major copy and move constructors
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicSparseMatrix copy constructor";
+
+      MT mat1{ { 1, 0, 2 }, { 0, 4, 0 } };
+      MT mat2( mat1 );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkMatrix  ( mat2, mat1 );
+   }
+
+   {
+      test_ = "Row-major DynamicSparseMatrix move constructor";
+
+      MT mat1{ { 1, 0, 2 }, { 0, 4, 0 } };
+      MT mat2( std::move( mat1 ) );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkMatrix  ( mat2, CMT{ { 1, 0, 2 }, { 0, 4, 0 } } );
+   }
+
+
+   //=====================================================================================
+   // Row-major conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicSparseMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> dense{ { 0, 5, 0 }, { 6, 0, 7 } };
+      MT mat( dense );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkMatrix  ( mat, dense );
+   }
+
+   {
+      test_ = "Row-major DynamicSparseMatrix sparse matrix constructor";
+
+      OCMT sparse{ { 0, 5, 0 }, { 6, 0, 7 } };
+      MT mat( sparse );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkMatrix  ( mat, sparse );
+   }
+
+
+   //=====================================================================================
+   // Column-major constructors
+   //=====================================================================================
+
+   {
+      test_ = "Column-major DynamicSparseMatrix size constructor (3x4)";
+
+      OMT mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 3UL, 0UL );
+   }
+
+   {
+      test_ = "Column-major DynamicSparseMatrix initializer list constructor";
+
+      OMT mat{ { 1, 0, 2 }, { 0, 0, 0 }, { 0, 3 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+      checkMatrix  ( mat, CMT{ { 1, 0, 2 }, { 0, 0, 0 }, { 0, 3, 0 } } );
+   }
+
+   {
+      test_ = "Column-major DynamicSparseMatrix sparse matrix constructor";
+
+      CMT sparse{ { 0, 5, 0 }, { 6, 0, 7 } };
+      OMT mat( sparse );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+      checkMatrix  ( mat, sparse );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DynamicSparseMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the DynamicSparseMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "Row-major DynamicSparseMatrix copy assignment";
+
+      MT mat1{ { 1, 0, 2 }, { 0, 4, 0 } };
+      MT mat2( 5UL, 5UL );
+      mat2(4,4) = 9;
+
+      mat2 = mat1;
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkMatrix  ( mat2, mat1 );
+   }
+
+   {
+      test_ = "Row-major DynamicSparseMatrix move assignment";
+
+      MT mat1{ { 1, 0, 2 }, { 0, 4, 0 } };
+      MT mat2( 5UL, 5UL );
+
+      mat2 = std::move( mat1 );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkMatrix  ( mat2, CMT{ { 1, 0, 2 }, { 0, 4, 0 } } );
+   }
+
+   {
+      test_ = "Row-major DynamicSparseMatrix dense matrix assignment";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> dense{ { 0, 5, 0 }, { 6, 0, 7 } };
+      MT mat( 1UL, 1UL );
+
+      mat = dense;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkMatrix  ( mat, dense );
+   }
+
+   {
+      test_ = "Row-major DynamicSparseMatrix sparse matrix assignment (opposite storage order)";
+
+      OMT sparse{ { 0, 5, 0 }, { 6, 0, 7 } };
+      MT mat{ { 1, 1 } };
+
+      mat = sparse;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkMatrix  ( mat, sparse );
+   }
+
+   {
+      test_ = "Row-major DynamicSparseMatrix self-referencing assignment";
+
+      MT mat{ { 1, 2 }, { 0, 3 } };
+
+      mat = trans( mat );
+
+      checkNonZeros( mat, 3UL );
+      checkMatrix  ( mat, CMT{ { 1, 0 }, { 2, 3 } } );
+   }
+
+   {
+      test_ = "Row-major DynamicSparseMatrix addition assignment";
+
+      MT  mat{ { 1, 0, 2 }, { 0, 4, 0 } };
+      CMT ref( mat );
+
+      mat += CMT{ { 0, 3, -2 }, { 0, 0, 1 } };
+      ref += CMT{ { 0, 3, -2 }, { 0, 0, 1 } };
+
+      checkNonZeros( mat, ref.nonZeros() );
+      checkMatrix  ( mat, CMT{ { 1, 3, 0 }, { 0, 4, 1 } } );
+   }
+
+   {
+      test_ = "Column-major DynamicSparseMatrix subtraction assignment";
+
+      OMT mat{ { 1, 0, 2 }, { 0, 4, 0 } };
+
+      mat -= blaze::DynamicMatrix<int>{ { 1, 0, 0 }, { 0, 0, -1 } };
+
+      checkNonZeros( mat, 3UL );
+      checkMatrix  ( mat, CMT{ { 0, 0, 2 }, { 0, 4, 1 } } );
+   }
+
+   {
+      test_ = "Column-major DynamicSparseMatrix Schur product assignment";
+
+      OMT mat{ { 1, 0, 2 }, { 0, 4, 0 } };
+
+      mat %= CMT{ { 3, 1, 0 }, { 0, 2, 0 } };
+
+      checkNonZeros( mat, 2UL );
+      checkMatrix  ( mat, CMT{ { 3, 0, 0 }, { 0, 8, 0 } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DynamicSparseMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the function call operator
+// of the DynamicSparseMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   {
+      test_ = "Row-major DynamicSparseMatrix::operator()";
+
+      MT mat( 3UL, 5UL );
+
+      mat(2,2) = 1;
+      mat(2,4) = 2;
+      mat(2,0) = 3;
+      mat(0,3) = 4;
+      mat(2,2) += 5;
+
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 3UL );
+      checkMatrix  ( mat, CMT{ { 0, 0, 0, 4, 0 }, { 0, 0, 0, 0, 0 }, { 3, 0, 6, 0, 2 } } );
+
+      mat(2,4) = 0;
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      const MT& cmat( mat );
+      if( cmat(2,0) != 3 || cmat(2,2) != 6 || cmat(1,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Const access failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major DynamicSparseMatrix::operator()";
+
+      OMT mat( 3UL, 5UL );
+
+      mat(2,2) = 1;
+      mat(1,2) = 2;
+      mat(0,2) = 3;
+      mat(0,4) = 4;
+
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 2UL, 3UL );
+      checkNonZeros( mat, 4UL, 1UL );
+      checkMatrix  ( mat, CMT{ { 0, 0, 3, 0, 4 }, { 0, 0, 2, 0, 0 }, { 0, 0, 1, 0, 0 } } );
+   }
+
+   {
+      test_ = "Row-major DynamicSparseMatrix::at()";
+
+      MT mat( 2UL, 2UL );
+
+      try {
+         mat.at( 2UL, 0UL ) = 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bounds access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c insert() and \c set() member functions of the DynamicSparseMatrix class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c insert() and \c set() member functions of the
+// DynamicSparseMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testInsert()
+{
+   {
+      test_ = "Row-major DynamicSparseMatrix::insert()";
+
+      MT mat( 2UL, 20UL );
+
+      // Inserting in reverse order forces an element shift and regular reallocations
+      for( size_t j=20UL; j-- > 0UL; ) {
+         mat.insert( 1UL, j, int( j+1UL ) );
+      }
+
+      checkNonZeros( mat, 20UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 20UL );
+
+      size_t j( 0UL );
+      for( MT::ConstIterator it=mat.begin(1UL); it!=mat.end(1UL); ++it, ++j ) {
+         if( it->index() != j || it->value() != int( j+1UL ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element order detected\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      try {
+         mat.insert( 1UL, 5UL, 1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting a duplicate element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Column-major DynamicSparseMatrix::set()";
+
+      OMT mat( 4UL, 2UL );
+
+      mat.set( 3UL, 0UL, 1 );
+      mat.set( 0UL, 0UL, 2 );
+      mat.set( 3UL, 0UL, 3 );
+      mat.set( 1UL, 1UL, 4 );
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkMatrix  ( mat, CMT{ { 2, 0 }, { 0, 4 }, { 0, 0 }, { 3, 0 } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c append() member function of the DynamicSparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c append() member function of the DynamicSparseMatrix
+// class template. In contrast to the CompressedMatrix, appending to any row/column is possible
+// at any time and without a prior reservation. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAppend()
+{
+   {
+      test_ = "Row-major DynamicSparseMatrix::append()";
+
+      MT mat( 3UL, 4UL );
+
+      // Appending to the rows in arbitrary order and without reservation
+      mat.append( 2UL, 1UL, 1 );
+      mat.append( 0UL, 0UL, 2 );
+      mat.append( 2UL, 3UL, 3 );
+      mat.append( 0UL, 2UL, 0, true );
+      mat.append( 1UL, 0UL, 4 );
+      mat.append( 0UL, 3UL, 5 );
+
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         mat.finalize( i );
+      }
+
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+      checkMatrix  ( mat, CMT{ { 2, 0, 0, 5 }, { 4, 0, 0, 0 }, { 0, 1, 0, 3 } } );
+   }
+
+   {
+      test_ = "Column-major DynamicSparseMatrix::append()";
+
+      OMT mat( 3UL, 2UL );
+
+      mat.append( 0UL, 1UL, 1 );
+      mat.append( 1UL, 0UL, 2 );
+      mat.append( 2UL, 1UL, 3 );
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkMatrix  ( mat, CMT{ { 0, 1 }, { 2, 0 }, { 0, 3 } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c erase() member functions of the DynamicSparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c erase() member functions of the DynamicSparseMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testErase()
+{
+   {
+      test_ = "Row-major DynamicSparseMatrix::erase( size_t, size_t )";
+
+      MT mat{ { 1, 2, 0, 3 }, { 0, 4, 5, 0 } };
+
+      mat.erase( 0UL, 1UL );
+      mat.erase( 1UL, 0UL );
+
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkMatrix  ( mat, CMT{ { 1, 0, 0, 3 }, { 0, 4, 5, 0 } } );
+   }
+
+   {
+      test_ = "Row-major DynamicSparseMatrix::erase( size_t, Iterator, Iterator )";
+
+      MT mat{ { 1, 2, 0, 3 }, { 0, 4, 5, 0 } };
+
+      MT::Iterator pos = mat.erase( 0UL, mat.find( 0UL, 1UL ), mat.end( 0UL ) );
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkMatrix  ( mat, CMT{ { 1, 0, 0, 0 }, { 0, 4, 5, 0 } } );
+
+      if( pos != mat.end( 0UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid iterator returned\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major DynamicSparseMatrix::erase( Pred )";
+
+      OMT mat{ { 1, 2, 0, 3 }, { 0, 4, 5, 0 } };
+
+      mat.erase( []( int value ){ return value % 2 == 1; } );
+
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkMatrix  ( mat, CMT{ { 0, 2, 0, 0 }, { 0, 4, 0, 0 } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the DynamicSparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the DynamicSparseMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "Row-major DynamicSparseMatrix::resize()";
+
+      MT mat{ { 1, 0, 2 }, { 0, 3, 0 }, { 4, 0, 5 } };
+
+      mat.resize( 2UL, 2UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 2UL );
+      checkNonZeros( mat, 2UL );
+      checkMatrix  ( mat, CMT{ { 1, 0 }, { 0, 3 } } );
+
+      mat.resize( 4UL, 3UL );
+      mat(3,2) = 6;
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkMatrix  ( mat, CMT{ { 1, 0, 0 }, { 0, 3, 0 }, { 0, 0, 0 }, { 0, 0, 6 } } );
+
+      mat.resize( 5UL, 5UL, false );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 0UL );
+
+      mat.clear();
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major DynamicSparseMatrix::resize()";
+
+      OMT mat{ { 1, 0, 2 }, { 0, 3, 0 }, { 4, 0, 5 } };
+
+      mat.resize( 2UL, 3UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkMatrix  ( mat, CMT{ { 1, 0, 2 }, { 0, 3, 0 } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reserve() and \c trim() member functions of the DynamicSparseMatrix class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reserve() and \c trim() member functions of the
+// DynamicSparseMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testReserve()
+{
+   {
+      test_ = "Row-major DynamicSparseMatrix::reserve()";
+
+      MT mat( 4UL, 10UL );
+
+      mat.reserve( 2UL, 7UL );
+      checkCapacity( mat, 2UL, 7UL );
+
+      mat.reserve( 20UL );
+      checkCapacity( mat, 0UL, 5UL );
+      checkCapacity( mat, 2UL, 7UL );
+
+      if( mat.capacity() < 20UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid total capacity detected\n"
+             << " Details:\n"
+             << "   Capacity                 : " << mat.capacity() << "\n"
+             << "   Expected minimum capacity: 20\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major DynamicSparseMatrix::trim()";
+
+      MT mat( 3UL, 10UL );
+      mat.reserve( 30UL );
+      mat(0,1) = 1;
+      mat(0,5) = 2;
+      mat(2,9) = 3;
+
+      mat.trim( 0UL );
+
+      if( mat.capacity( 0UL ) != 2UL || mat.capacity( 2UL ) < 10UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Trimming a single row failed\n"
+             << " Details:\n"
+             << "   Capacity of row 0: " << mat.capacity( 0UL ) << " (expected 2)\n"
+             << "   Capacity of row 2: " << mat.capacity( 2UL ) << " (expected >= 10)\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat.trim();
+
+      if( mat.capacity() != 3UL || mat.capacity( 1UL ) != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Trimming the matrix failed\n"
+             << " Details:\n"
+             << "   Capacity: " << mat.capacity() << " (expected 3)\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkMatrix( mat, CMT{ { 0, 1, 0, 0, 0, 2, 0, 0, 0, 0 }
+                           , { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+                           , { 0, 0, 0, 0, 0, 0, 0, 0, 0, 3 } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c compact() member function of the DynamicSparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c compact() member function of the DynamicSparseMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCompact()
+{
+   {
+      test_ = "Row-major DynamicSparseMatrix::compact()";
+
+      MT mat( 200UL, 150UL );
+
+      for( size_t n=0UL; n<2000UL; ++n ) {
+         mat( blaze::rand<size_t>( 0UL, 199UL ), blaze::rand<size_t>( 0UL, 149UL ) ) =
+            blaze::rand<int>( 1, 10 );
+      }
+      for( size_t j=0UL; j<mat.columns(); ++j ) {
+         mat(17,j) = 1;
+      }
+
+      const MT::CompactType cmp( mat.compact() );
+
+      checkRows    ( cmp, 200UL );
+      checkColumns ( cmp, 150UL );
+      checkNonZeros( cmp, mat.nonZeros() );
+      checkMatrix  ( cmp, mat );
+
+      if( cmp.capacity() != cmp.nonZeros() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Compacted matrix is not tight\n"
+             << " Details:\n"
+             << "   Number of non-zeros: " << cmp.nonZeros() << "\n"
+             << "   Capacity           : " << cmp.capacity() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major DynamicSparseMatrix::compact()";
+
+      OMT mat( 150UL, 200UL );
+
+      for( size_t n=0UL; n<2000UL; ++n ) {
+         mat( blaze::rand<size_t>( 0UL, 149UL ), blaze::rand<size_t>( 0UL, 199UL ) ) =
+            blaze::rand<int>( 1, 10 );
+      }
+
+      const OMT::CompactType cmp( mat.compact() );
+
+      checkRows    ( cmp, 150UL );
+      checkColumns ( cmp, 200UL );
+      checkNonZeros( cmp, mat.nonZeros() );
+      checkMatrix  ( cmp, mat );
+   }
+
+   {
+      test_ = "Row-major DynamicSparseMatrix::compact() (empty matrix)";
+
+      MT mat( 0UL, 3UL );
+      const MT::CompactType cmp( mat.compact() );
+
+      checkRows    ( cmp, 0UL );
+      checkColumns ( cmp, 3UL );
+      checkNonZeros( cmp, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DynamicSparseMatrix class template within expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the DynamicSparseMatrix class template as operand and target of sparse
+// matrix expressions and views. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testExpressions()
+{
+   {
+      test_ = "Row-major DynamicSparseMatrix/dense vector multiplication";
+
+      MT  mat{ { 1, 0, 2 }, { 0, 3, 0 } };
+      CMT ref( mat );
+      const blaze::DynamicVector<int> x{ 1, 2, 3 };
+
+      const blaze::DynamicVector<int> y1( mat * x );
+      const blaze::DynamicVector<int> y2( ref * x );
+
+      if( y1 != y2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid multiplication result\n"
+             << " Details:\n"
+             << "   Result:\n" << y1 << "\n"
+             << "   Expected result:\n" << y2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicSparseMatrix/DynamicSparseMatrix multiplication";
+
+      MT  A{ { 1, 0, 2 }, { 0, 3, 0 } };
+      OMT B{ { 1, 0 }, { 0, 4 }, { 5, 0 } };
+
+      const MT C( A * B );
+
+      checkMatrix( C, CMT( CMT( A ) * OCMT( B ) ) );
+   }
+
+   {
+      test_ = "DynamicSparseMatrix addition and transpose";
+
+      MT  A{ { 1, 0, 2 }, { 0, 3, 0 } };
+      OMT B{ { 0, 1 }, { 2, 0 }, { 0, 3 } };
+
+      MT C( A + trans( B ) );
+
+      checkMatrix( C, CMT{ { 1, 2, 2 }, { 1, 3, 3 } } );
+
+      C.transpose();
+
+      checkRows   ( C, 3UL );
+      checkColumns( C, 2UL );
+      checkMatrix ( C, CMT{ { 1, 1 }, { 2, 3 }, { 2, 3 } } );
+   }
+
+   {
+      test_ = "DynamicSparseMatrix views";
+
+      MT A{ { 1, 0, 2 }, { 0, 3, 0 }, { 4, 0, 5 } };
+
+      row( A, 1UL ) = blaze::CompressedVector<int,blaze::rowVector>{ 6, 0, 7 };
+      column( A, 0UL ) *= 2;
+      submatrix( A, 1UL, 1UL, 2UL, 2UL ) = blaze::DynamicMatrix<int>{ { 8, 0 }, { 0, 9 } };
+
+      checkMatrix( A, CMT{ { 2, 0, 2 }, { 12, 8, 0 }, { 8, 0, 9 } } );
+   }
+}
+//*************************************************************************************************
+
+} // namespace dynamicsparsematrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running DynamicSparseMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_DYNAMICSPARSEMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during DynamicSparseMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
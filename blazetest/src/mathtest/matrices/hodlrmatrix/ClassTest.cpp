@@ -0,0 +1,532 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/hodlrmatrix/ClassTest.cpp
+//  \brief Source file for the HODLRMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/HODLRMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/hodlrmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace hodlrmatrix {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the element \f$ (i,j) \f$ of a diagonally dominant kernel matrix.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The element \f$ 1/(1+|i-j|/8) + 2\delta_{ij} \f$.
+*/
+inline double kernel( size_t i, size_t j )
+{
+   const double distance( i < j ? double( j-i ) : double( i-j ) );
+   return 1.0 / ( 1.0 + distance / 8.0 ) + ( i == j ? 2.0 : 0.0 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the given kernel matrix as dense matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The dense kernel matrix.
+*/
+inline blaze::DynamicMatrix<double,blaze::columnMajor> kernelMatrix( size_t n )
+{
+   blaze::DynamicMatrix<double,blaze::columnMajor> K( n, n );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      for( size_t i=0UL; i<n; ++i ) {
+         K(i,j) = kernel( i, j );
+      }
+   }
+
+   return K;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the HODLRMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testElementAccess();
+   testMultiplication();
+   testSolve();
+   testComplex();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the HODLRMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the HODLRMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   {
+      test_ = "HODLRMatrix default constructor";
+
+      MT A;
+
+      if( A.rows() != 0UL || A.columns() != 0UL || A.levels() != 0UL || A.rank() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid matrix size\n"
+             << " Details:\n"
+             << "   Number of rows   : " << A.rows() << "\n"
+             << "   Number of columns: " << A.columns() << "\n"
+             << "   Expected size: 0x0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "HODLRMatrix single leaf constructor";
+
+      const DT K( kernelMatrix( 20UL ) );
+      const MT A( 20UL, kernel, 1E-8, 32UL );
+
+      if( A.levels() != 0UL || A.matrix() != K ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid matrix detected\n"
+             << " Details:\n"
+             << "   Number of levels: " << A.levels() << "\n"
+             << "   Result:\n" << A.matrix() << "\n"
+             << "   Expected result:\n" << K << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "HODLRMatrix generator constructor";
+
+      const DT K( kernelMatrix( 333UL ) );
+      const MT A( 333UL, kernel, 1E-8, 16UL );
+
+      if( A.rows() != 333UL || A.columns() != 333UL || A.levels() != 5UL || A.leafSize() != 16UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid matrix setup\n"
+             << " Details:\n"
+             << "   Number of rows   : " << A.rows() << "\n"
+             << "   Number of columns: " << A.columns() << "\n"
+             << "   Number of levels : " << A.levels() << "\n"
+             << "   Expected size: 333x333 (5 levels)\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkError( A.matrix(), K, 1E-7 );
+
+      if( A.rank() == 0UL || A.rank() > 32UL || A.bytes() >= 333UL*333UL*sizeof(double) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid compression detected\n"
+             << " Details:\n"
+             << "   Rank: " << A.rank() << "\n"
+             << "   Bytes: " << A.bytes() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "HODLRMatrix dense matrix constructor";
+
+      const DT K( kernelMatrix( 333UL ) );
+      const MT A( K, 1E-8, 16UL );
+
+      checkError( A.matrix(), K, 1E-7 );
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> R( K );
+      const MT B( R, 1E-4, 16UL );
+
+      checkError( B.matrix(), K, 1E-3 );
+
+      if( B.rank() > A.rank() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid rank detected\n"
+             << " Details:\n"
+             << "   Rank (tolerance 1E-4): " << B.rank() << "\n"
+             << "   Rank (tolerance 1E-8): " << A.rank() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "HODLRMatrix constructor with invalid arguments";
+
+      const auto expectThrow = [this]( auto&& construct, const char* label )
+      {
+         try {
+            construct();
+         }
+         catch( std::invalid_argument& ) {
+            return;
+         }
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << label << " was accepted\n";
+         throw std::runtime_error( oss.str() );
+      };
+
+      expectThrow( []{ MT( 10UL, kernel, 1E-8, 0UL ); }, "Leaf size 0" );
+      expectThrow( []{ MT( 10UL, kernel, -1.0 ); }, "Negative tolerance" );
+      expectThrow( []{ MT( DT( 10UL, 11UL, 0.0 ) ); }, "Non-square matrix" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the HODLRMatrix element access functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator and the at() function of the
+// HODLRMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testElementAccess()
+{
+   test_ = "HODLRMatrix element access";
+
+   const MT A( 100UL, kernel, 1E-10, 8UL );
+   const DT M( A.matrix() );
+
+   for( size_t i=0UL; i<100UL; i+=7UL ) {
+      for( size_t j=0UL; j<100UL; j+=3UL )
+      {
+         if( std::abs( A(i,j) - M(i,j) ) > 1E-12 || std::abs( A.at(i,j) - kernel(i,j) ) > 1E-8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element detected\n"
+                << " Details:\n"
+                << "   Index: (" << i << "," << j << ")\n"
+                << "   Result: " << A(i,j) << "\n"
+                << "   Expected result: " << kernel(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   try {
+      A.at( 100UL, 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bounds access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the HODLRMatrix/dense vector and HODLRMatrix/dense matrix multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the products of a HODLR matrix with the products of the dense matrix.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   const size_t n( 1000UL );
+
+   const DT K( kernelMatrix( n ) );
+   const MT A( n, kernel, 1E-10, 32UL );
+
+   {
+      test_ = "HODLRMatrix/dense vector multiplication";
+
+      blaze::DynamicVector<double> x( n );
+      blaze::randomize( x, -1.0, 1.0 );
+
+      checkError( A * x, K * x, 1E-8 );
+
+      blaze::DynamicVector<double> y( x );
+      multiply( A, y, y );
+      checkError( y, K * x, 1E-8 );
+   }
+
+   {
+      test_ = "HODLRMatrix/dense matrix multiplication";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> X( n, 5UL );
+      blaze::randomize( X, -1.0, 1.0 );
+
+      checkError( A * X, K * X, 1E-8 );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> Y;
+      multiply( A, X, Y );
+      checkError( Y, K * X, 1E-8 );
+   }
+
+   {
+      test_ = "HODLRMatrix multiplication with invalid sizes";
+
+      try {
+         const blaze::DynamicVector<double> y( A * blaze::DynamicVector<double>( n-1UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with invalid vector succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the HODLRMatrix factorization and linear solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves linear systems with a factorized HODLR matrix and checks the errors of
+// the solutions. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSolve()
+{
+   const size_t n( 1000UL );
+
+   const DT K( kernelMatrix( n ) );
+   MT A( n, kernel, 1E-10, 32UL );
+
+   {
+      test_ = "HODLRMatrix solve with unfactorized matrix";
+
+      try {
+         blaze::DynamicVector<double> x;
+         solve( A, x, blaze::DynamicVector<double>( n, 1.0 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solve with unfactorized matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   A.factorize();
+
+   {
+      test_ = "HODLRMatrix solve with single right-hand side";
+
+      blaze::DynamicVector<double> x( n ), y;
+      blaze::randomize( x, -1.0, 1.0 );
+
+      solve( A, y, K * x );
+      checkError( y, x, 1E-7 );
+   }
+
+   {
+      test_ = "HODLRMatrix solve with multiple right-hand sides";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> X( n, 5UL ), Y;
+      blaze::randomize( X, -1.0, 1.0 );
+
+      solve( A, Y, K * X );
+      checkError( Y, X, 1E-7 );
+   }
+
+   {
+      test_ = "HODLRMatrix factorization of a singular matrix";
+
+      MT B( 100UL, []( size_t i, size_t j ) { return ( i == j && i != 42UL ) ? 1.0 : 0.0; },
+            1E-8, 8UL );
+
+      try {
+         B.factorize();
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Factorization of singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( B.isFactorized() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Singular matrix marked as factorized\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the HODLRMatrix with complex elements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs the compression, the multiplication and the solution of a linear
+// system with a complex HODLR matrix. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testComplex()
+{
+   test_ = "HODLRMatrix with complex elements";
+
+   using cplx = std::complex<double>;
+
+   const size_t n( 300UL );
+
+   const auto entry = []( size_t i, size_t j ) {
+      return kernel( i, j ) * cplx( 1.0, i < j ? 0.5 : -0.5 );
+   };
+
+   blaze::DynamicMatrix<cplx,blaze::columnMajor> K( n, n );
+   for( size_t j=0UL; j<n; ++j ) {
+      for( size_t i=0UL; i<n; ++i ) {
+         K(i,j) = entry( i, j );
+      }
+   }
+
+   blaze::HODLRMatrix<cplx> A( n, entry, 1E-10, 16UL );
+   const blaze::HODLRMatrix<cplx> B( K, 1E-10, 16UL );
+
+   checkError( A.matrix(), K, 1E-8 );
+   checkError( B.matrix(), K, 1E-8 );
+
+   blaze::DynamicVector<cplx> x( n ), y;
+   blaze::randomize( x );
+
+   checkError( A * x, K * x, 1E-8 );
+
+   A.factorize();
+   solve( A, y, K * x );
+   checkError( y, x, 1E-7 );
+}
+//*************************************************************************************************
+
+} // namespace hodlrmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running HODLRMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_HODLRMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during HODLRMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
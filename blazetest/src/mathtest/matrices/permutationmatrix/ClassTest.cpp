@@ -0,0 +1,516 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/permutationmatrix/ClassTest.cpp
+//  \brief Source file for the PermutationMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/IdentityMatrix.h>
+#include <blaze/math/PermutationMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/permutationmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace permutationmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PermutationMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testElementAccess();
+   testMultiplication();
+   testComposition();
+   testLU();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the PermutationMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the PermutationMatrix class template. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   {
+      test_ = "PermutationMatrix default constructor";
+
+      const MT P;
+
+      if( P.rows() != 0UL || P.columns() != 0UL || !isIntact( P ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid matrix size\n"
+             << " Details:\n"
+             << "   Number of rows   : " << P.rows() << "\n"
+             << "   Number of columns: " << P.columns() << "\n"
+             << "   Expected size: 0x0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "PermutationMatrix identity constructor";
+
+      const MT P( 4UL );
+
+      if( P.rows() != 4UL || P.columns() != 4UL || !isIntact( P ) || P.nonZeros() != 4UL ||
+          P != blaze::IdentityMatrix<double>( 4UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << P << "\n"
+             << "   Expected result: 4x4 identity matrix\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "PermutationMatrix index vector constructor";
+
+      const MT P( std::vector<size_t>{ 2UL, 0UL, 1UL } );
+      const DT D{ { 0.0, 0.0, 1.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } };
+
+      if( P.rows() != 3UL || P.columns() != 3UL || !isIntact( P ) || P != D ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << P << "\n"
+             << "   Expected result:\n" << D << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "PermutationMatrix dense matrix constructor";
+
+      const DT D{ { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 }, { 1.0, 0.0, 0.0 } };
+      const MT P( D );
+
+      if( P.rows() != 3UL || P.columns() != 3UL || !isIntact( P ) || P != D ||
+          P.permutation() != std::vector<size_t>{ 1UL, 2UL, 0UL } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << P << "\n"
+             << "   Expected result:\n" << D << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "PermutationMatrix constructor with invalid indices";
+
+      try {
+         const MT P{ 0UL, 2UL, 0UL };
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with invalid indices succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << P << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "PermutationMatrix constructor with invalid dense matrix";
+
+      try {
+         const MT P( DT{ { 0.0, 2.0 }, { 1.0, 0.0 } } );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with invalid dense matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << P << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element access of the PermutationMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator, the at() function and the
+// iterators of the PermutationMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testElementAccess()
+{
+   test_ = "PermutationMatrix::operator(), at() and begin()";
+
+   const MT P( blaze::rand<MT>( 9UL ) );
+   const std::vector<size_t>& p( P.permutation() );
+
+   for( size_t i=0UL; i<P.rows(); ++i )
+   {
+      if( P.begin(i)->index() != p[i] || P.begin(i)->value() != 1.0 ||
+          P.end(i) - P.begin(i) != 1L || P.find( i, p[i] ) != P.begin(i) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator access failed\n"
+             << " Details:\n"
+             << "   Row: " << i << "\n"
+             << "   Result: " << P.begin(i)->index() << "\n"
+             << "   Expected result: " << p[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t j=0UL; j<P.columns(); ++j ) {
+         const double expected( j == p[i] ? 1.0 : 0.0 );
+         if( P(i,j) != expected || P.at(i,j) != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Access failed\n"
+                << " Details:\n"
+                << "   Element: (" << i << "," << j << ")\n"
+                << "   Result: " << P(i,j) << "\n"
+                << "   Expected result: " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   try {
+      const double value( P.at( 9UL, 0UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound access succeeded\n"
+          << " Details:\n"
+          << "   Result: " << value << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PermutationMatrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the gather and scatter based multiplication of a
+// PermutationMatrix with dense and sparse vectors and matrices. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   using ODT = blaze::DynamicMatrix<double,blaze::columnMajor>;
+   using SVT = blaze::CompressedVector<double>;
+   using SMT = blaze::CompressedMatrix<double,blaze::rowMajor>;
+   using OSMT = blaze::CompressedMatrix<double,blaze::columnMajor>;
+
+   const MT P( blaze::rand<MT>( 150UL ) );
+   const DT D( P );
+
+   {
+      test_ = "PermutationMatrix/dense vector multiplication";
+
+      VT x( 150UL );
+      blaze::randomize( x );
+
+      const VT y( P * x );
+      checkError( y, VT( D * x ), 1E-14 );
+
+      const blaze::DynamicVector<double,blaze::rowVector> z( trans( x ) * P );
+      checkError( z, blaze::DynamicVector<double,blaze::rowVector>( trans( x ) * D ), 1E-14 );
+   }
+
+   {
+      test_ = "PermutationMatrix/dense matrix multiplication";
+
+      DT X( 150UL, 37UL );
+      blaze::randomize( X );
+      const ODT OX( X );
+
+      checkError( DT( P * X ), DT( D * X ), 1E-14 );
+      checkError( ODT( P * OX ), DT( D * X ), 1E-14 );
+      checkError( DT( trans( X ) * P ), DT( trans( X ) * D ), 1E-14 );
+      checkError( ODT( trans( OX ) * P ), DT( trans( X ) * D ), 1E-14 );
+
+      ODT Y;
+      multiply( P, X, Y );
+      checkError( Y, DT( D * X ), 1E-14 );
+   }
+
+   {
+      test_ = "PermutationMatrix/sparse vector multiplication";
+
+      SVT x( 150UL );
+      blaze::randomize( x, 20UL );
+
+      const SVT y( P * x );
+      checkError( y, VT( D * x ), 1E-14 );
+
+      const blaze::CompressedVector<double,blaze::rowVector> z( trans( x ) * P );
+      checkError( z, blaze::DynamicVector<double,blaze::rowVector>( trans( x ) * D ), 1E-14 );
+   }
+
+   {
+      test_ = "PermutationMatrix/sparse matrix multiplication";
+
+      SMT X( 150UL, 150UL );
+      blaze::randomize( X, 600UL );
+      const OSMT OX( X );
+
+      checkError( SMT( P * X ), DT( D * X ), 1E-14 );
+      checkError( OSMT( P * OX ), DT( D * X ), 1E-14 );
+      checkError( SMT( X * P ), DT( X * D ), 1E-14 );
+      checkError( OSMT( OX * P ), DT( X * D ), 1E-14 );
+   }
+
+   {
+      test_ = "PermutationMatrix/dense vector multiplication with aliasing";
+
+      VT x( 150UL );
+      blaze::randomize( x );
+
+      const VT y( D * x );
+      multiply( P, x, x );
+      checkError( x, y, 1E-14 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the composition and inversion of PermutationMatrix instances.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the product of two permutation matrices and of the transpose
+// and inverse of a permutation matrix. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testComposition()
+{
+   const MT P( blaze::rand<MT>( 40UL ) );
+   const MT Q( blaze::rand<MT>( 40UL ) );
+
+   {
+      test_ = "PermutationMatrix/PermutationMatrix multiplication";
+
+      const MT R( P * Q );
+      const DT D( DT( P ) * DT( Q ) );
+
+      if( !isIntact( R ) || R != D ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Composition failed\n"
+             << " Details:\n"
+             << "   Result:\n" << R << "\n"
+             << "   Expected result:\n" << D << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "PermutationMatrix transpose and inverse";
+
+      const MT T( trans( P ) );
+      MT I( P );
+      invert( I );
+
+      if( !isIntact( T ) || T != trans( DT( P ) ) || I != T ||
+          P * T != blaze::IdentityMatrix<double>( 40UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose failed\n"
+             << " Details:\n"
+             << "   Result:\n" << T << "\n"
+             << "   Expected result:\n" << trans( DT( P ) ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the LU decomposition with a PermutationMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the lu() function with a PermutationMatrix as resulting
+// permutation matrix for both row-major and column-major matrices. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLU()
+{
+   using ODT = blaze::DynamicMatrix<double,blaze::columnMajor>;
+
+   {
+      test_ = "Row-major LU decomposition with PermutationMatrix";
+
+      DT A( 30UL, 45UL );
+      blaze::randomize( A );
+
+      DT L, U, D;
+      MT P;
+
+      lu( A, L, U, P );
+      checkError( DT( L * U ) * P, A, 1E-12 );
+
+      lu( A, L, U, D );
+
+      if( !isIntact( P ) || P != D ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid permutation matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << P << "\n"
+             << "   Expected result:\n" << D << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major LU decomposition with PermutationMatrix";
+
+      ODT A( 45UL, 30UL );
+      blaze::randomize( A );
+
+      ODT L, U, D;
+      MT P;
+
+      lu( A, L, U, P );
+      checkError( P * ODT( L * U ), A, 1E-12 );
+
+      lu( A, L, U, D );
+
+      if( !isIntact( P ) || P != D ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid permutation matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << P << "\n"
+             << "   Expected result:\n" << D << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace permutationmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PermutationMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_PERMUTATIONMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PermutationMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
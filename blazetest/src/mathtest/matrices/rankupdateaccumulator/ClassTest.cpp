@@ -0,0 +1,545 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/rankupdateaccumulator/ClassTest.cpp
+//  \brief Source file for the RankUpdateAccumulator class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/rankupdateaccumulator/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace rankupdateaccumulator {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the RankUpdateAccumulator class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructor();
+   testRank1Update();
+   testRankUpdate();
+   testAddAssign();
+   testSubAssign();
+   testFunctionCall();
+   testFlush();
+   testFailedFlush();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the RankUpdateAccumulator constructor.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the constructor of the RankUpdateAccumulator class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructor()
+{
+   test_ = "RankUpdateAccumulator constructor";
+
+   {
+      MT A( 5UL, 3UL, 0.0 );
+      blaze::RankUpdateAccumulator<MT> acc( A, 4UL );
+
+      if( acc.rows() != 5UL || acc.columns() != 3UL ||
+          acc.pending() != 0UL || acc.capacity() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid accumulator state detected\n"
+             << " Details:\n"
+             << "   Rows     : " << acc.rows() << " (expected 5)\n"
+             << "   Columns  : " << acc.columns() << " (expected 3)\n"
+             << "   Pending  : " << acc.pending() << " (expected 0)\n"
+             << "   Capacity : " << acc.capacity() << " (expected 4)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   try {
+      MT A( 5UL, 3UL, 0.0 );
+      blaze::RankUpdateAccumulator<MT> acc( A, 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction with zero capacity succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the buffered rank-1 updates.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the rank-1 update() functions of the RankUpdateAccumulator
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRank1Update()
+{
+   test_ = "RankUpdateAccumulator::update( x, y )";
+
+   {
+      MT A( 7UL, 5UL ), ref;
+      blaze::randomize( A );
+      ref = A;
+
+      {
+         blaze::RankUpdateAccumulator<MT> acc( A, 3UL );
+
+         for( size_t k=0UL; k<8UL; ++k )
+         {
+            VT x( 7UL ), y( 5UL );
+            blaze::randomize( x );
+            blaze::randomize( y );
+
+            if( k % 2UL ) {
+               acc.update( x, y );
+               ref += x * trans( y );
+            }
+            else {
+               acc.update( 0.5*k, x, y );
+               ref += 0.5*k * x * trans( y );
+            }
+         }
+
+         if( acc.pending() != 2UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of pending updates\n"
+                << " Details:\n"
+                << "   Result  : " << acc.pending() << "\n"
+                << "   Expected: 2\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      checkMatrix( A, ref );
+   }
+
+   {
+      OMT A( 4UL, 6UL, 1.0 ), ref( 4UL, 6UL, 1.0 );
+
+      {
+         blaze::RankUpdateAccumulator<OMT> acc( A );
+
+         VT x( 4UL, 2.0 ), y( 6UL, 3.0 );
+         acc.update( x, y );
+         ref += x * trans( y );
+      }
+
+      checkMatrix( A, ref );
+   }
+
+   try {
+      MT A( 7UL, 5UL, 0.0 );
+      blaze::RankUpdateAccumulator<MT> acc( A );
+      acc.update( VT( 5UL ), VT( 5UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Update with invalid vector size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the buffered rank-r updates.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the rank-r update() function of the RankUpdateAccumulator
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRankUpdate()
+{
+   test_ = "RankUpdateAccumulator::update( X, Y )";
+
+   {
+      MT A( 9UL, 6UL ), ref;
+      blaze::randomize( A );
+      ref = A;
+
+      {
+         blaze::RankUpdateAccumulator<MT> acc( A, 4UL );
+
+         for( size_t r=1UL; r<7UL; ++r )
+         {
+            OMT X( 9UL, r );
+            MT  Y( 6UL, r );
+            blaze::randomize( X );
+            blaze::randomize( Y );
+
+            acc.update( X, Y );
+            ref += X * trans( Y );
+         }
+      }
+
+      checkMatrix( A, ref );
+   }
+
+   try {
+      MT A( 7UL, 5UL, 0.0 );
+      blaze::RankUpdateAccumulator<MT> acc( A );
+      acc.update( MT( 7UL, 2UL ), MT( 5UL, 3UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Update with invalid matrix sizes succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the RankUpdateAccumulator addition assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operators of the RankUpdateAccumulator
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   test_ = "RankUpdateAccumulator::operator+=()";
+
+   {
+      MT A( 6UL, 8UL ), ref;
+      blaze::randomize( A );
+      ref = A;
+
+      {
+         blaze::RankUpdateAccumulator<MT> acc( A, 2UL );
+
+         for( size_t k=0UL; k<5UL; ++k )
+         {
+            VT x( 6UL ), y( 8UL );
+            blaze::randomize( x );
+            blaze::randomize( y );
+
+            acc += x * trans( y );
+            acc += 2.0 * x * trans( y );
+            acc += ( x * trans( y ) ) * 3.0;
+            ref += 6.0 * x * trans( y );
+         }
+
+         MT B( 6UL, 8UL );
+         blaze::randomize( B );
+
+         acc += B;
+         ref += B;
+
+         if( acc.pending() != 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Pending updates after general addition detected\n"
+                << " Details:\n"
+                << "   Pending: " << acc.pending() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      checkMatrix( A, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the RankUpdateAccumulator subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operators of the
+// RankUpdateAccumulator class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   test_ = "RankUpdateAccumulator::operator-=()";
+
+   {
+      MT A( 6UL, 8UL ), ref;
+      blaze::randomize( A );
+      ref = A;
+
+      {
+         blaze::RankUpdateAccumulator<MT> acc( A, 3UL );
+
+         for( size_t k=0UL; k<5UL; ++k )
+         {
+            VT x( 6UL ), y( 8UL );
+            blaze::randomize( x );
+            blaze::randomize( y );
+
+            acc -= x * trans( y );
+            acc -= ( x * trans( y ) ) * 2.0;
+            ref -= 3.0 * x * trans( y );
+         }
+
+         MT B( 6UL, 8UL );
+         blaze::randomize( B );
+
+         acc -= B;
+         ref -= B;
+      }
+
+      checkMatrix( A, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the RankUpdateAccumulator function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator of the RankUpdateAccumulator
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "RankUpdateAccumulator::operator()";
+
+   {
+      MT A( 3UL, 3UL, 1.0 );
+      blaze::RankUpdateAccumulator<MT> acc( A, 8UL );
+
+      acc += VT( 3UL, 2.0 ) * trans( VT( 3UL, 3.0 ) );
+      acc += VT( 3UL, 1.0 ) * trans( VT( 3UL, 4.0 ) );
+
+      if( acc(1,2) != 11.0 || A(1,2) != 1.0 || acc.pending() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid element access\n"
+             << " Details:\n"
+             << "   Result  : " << acc(1,2) << "\n"
+             << "   Expected: 11\n"
+             << "   Pending : " << acc.pending() << " (expected 2)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the flush of pending updates.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the flush() and matrix() functions of the
+// RankUpdateAccumulator class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFlush()
+{
+   test_ = "RankUpdateAccumulator::flush()";
+
+   {
+      MT A( 3UL, 3UL, 0.0 );
+      const MT ref( 3UL, 3UL, 6.0 );
+
+      blaze::RankUpdateAccumulator<MT> acc( A, 8UL );
+      acc += VT( 3UL, 2.0 ) * trans( VT( 3UL, 3.0 ) );
+
+      checkMatrix( A, MT( 3UL, 3UL, 0.0 ) );
+      checkMatrix( acc.matrix(), ref );
+
+      acc += VT( 3UL, 1.0 ) * trans( VT( 3UL, 1.0 ) );
+      acc.flush();
+
+      checkMatrix( A, ref + 1.0 );
+
+      if( acc.pending() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Pending updates after flush detected\n"
+             << " Details:\n"
+             << "   Pending: " << acc.pending() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a failing flush of pending updates.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the flush of pending updates that violate the invariants of
+// a symmetric target matrix. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testFailedFlush()
+{
+   test_ = "RankUpdateAccumulator::flush() (failing update)";
+
+   const VT x{ 1.0, 2.0, 3.0 };
+   const VT y{ 2.0, 0.0, 1.0 };
+
+   {
+      SMT S( 3UL );
+      blaze::RankUpdateAccumulator<SMT> acc( S, 4UL );
+
+      acc += x * trans( y );
+
+      try {
+         acc.flush();
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-symmetric update of a symmetric matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( acc.pending() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Pending updates lost after failed flush\n"
+             << " Details:\n"
+             << "   Pending: " << acc.pending() << " (expected 1)\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkMatrix( S, MT( 3UL, 3UL, 0.0 ) );
+
+      acc += y * trans( x );
+      acc.flush();
+
+      checkMatrix( S, x * trans( y ) + y * trans( x ) );
+   }
+
+   {
+      SMT S( 3UL );
+
+      {
+         blaze::RankUpdateAccumulator<SMT> acc( S, 4UL );
+         acc += x * trans( y );
+      }
+
+      checkMatrix( S, MT( 3UL, 3UL, 0.0 ) );
+   }
+}
+//*************************************************************************************************
+
+} // namespace rankupdateaccumulator
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running RankUpdateAccumulator class test..." << std::endl;
+
+   try
+   {
+      RUN_RANKUPDATEACCUMULATOR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during RankUpdateAccumulator class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
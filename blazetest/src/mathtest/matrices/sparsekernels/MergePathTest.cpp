@@ -0,0 +1,485 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/sparsekernels/MergePathTest.cpp
+//  \brief Source file for the merge-path test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <initializer_list>
+#include <iostream>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/sparsekernels/MergePathTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace sparsekernels {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the merge-path test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+MergePathTest::MergePathTest()
+   : test_   ()       // Label of the currently performed test
+   , threads_( 1UL )  // The number of threads of the currently performed test
+{
+   testOffsets();
+   testSearch();
+   testSkewedRows();
+   testEmpty();
+   testFewRows();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the computeMergePathOffsets() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the computation of the row offsets for balanced, skewed, and
+// empty sparse matrices. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void MergePathTest::testOffsets()
+{
+   {
+      test_ = "computeMergePathOffsets() with evenly distributed non-zero elements";
+
+      MT A( 8UL, 100UL );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=i; j<A.columns(); j+=10UL ) {
+            A(i,j) = 1;
+         }
+      }
+
+      OT offsets;
+      bool computed( true );
+
+      BLAZE_PARALLEL_SECTION
+      {
+         computed = blaze::computeMergePathOffsets( A, 4UL, 2UL, offsets );
+      }
+
+      if( computed || offsets.size() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Row offsets computed for a balanced matrix\n"
+             << " Details:\n"
+             << "   Offsets:\n" << offsets << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   for( size_t threads : { 2UL, 4UL, 7UL } )
+   {
+      test_ = "computeMergePathOffsets() with a single dominant row";
+
+      MT A( 9UL, 100UL );
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A(4,j) = 1;
+      }
+      A(0,3) = 1;
+      A(7,5) = 1;
+      A(7,9) = 1;
+
+      const size_t rowsPerThread( ( A.rows() - 1UL ) / threads + 1UL );
+
+      const OT expected{ 0UL, 1UL, 1UL, 1UL, 1UL, 101UL, 101UL, 101UL, 103UL, 103UL };
+
+      OT offsets;
+      bool computed( false );
+
+      BLAZE_PARALLEL_SECTION
+      {
+         computed = blaze::computeMergePathOffsets( A, threads, rowsPerThread, offsets );
+      }
+
+      if( !computed || offsets != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid row offsets\n"
+             << " Details:\n"
+             << "   Number of threads: " << threads << "\n"
+             << "   Result:\n" << offsets << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "computeMergePathOffsets() with an empty matrix";
+
+      MT A( 8UL, 100UL );
+
+      OT offsets;
+      bool computed( true );
+
+      BLAZE_PARALLEL_SECTION
+      {
+         computed = blaze::computeMergePathOffsets( A, 4UL, 2UL, offsets );
+      }
+
+      if( computed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Row offsets computed for an empty matrix\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mergePathSearch() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of the mergePathSearch() function for all diagonals of
+// several merge paths with an explicit walk along the merge path. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void MergePathTest::testSearch()
+{
+   test_ = "mergePathSearch()";
+
+   const std::initializer_list<OT> paths = {
+      OT{ 0UL },                                   // No rows
+      OT{ 0UL, 0UL, 0UL, 0UL },                    // Empty rows only
+      OT{ 0UL, 12UL },                             // Single row
+      OT{ 0UL, 0UL, 9UL, 9UL, 9UL },               // Single non-empty row
+      OT{ 0UL, 1UL, 1UL, 30UL, 31UL, 31UL, 33UL }  // Skewed rows with empty rows
+   };
+
+   for( const OT& offsets : paths )
+   {
+      const size_t rows( offsets.size() - 1UL );
+      const size_t nonzeros( offsets[rows] );
+
+      size_t i( 0UL ), k( 0UL );
+
+      for( size_t diagonal=0UL; diagonal<=rows+nonzeros; ++diagonal )
+      {
+         const size_t result( blaze::mergePathSearch( diagonal, offsets, rows, nonzeros ) );
+
+         if( result != i ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid merge-path coordinate\n"
+                << " Details:\n"
+                << "   Row offsets:\n" << offsets << "\n"
+                << "   Diagonal: " << diagonal << "\n"
+                << "   Result: " << result << "\n"
+                << "   Expected result: " << i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         // Walking one step along the merge path, preferring the completion of rows
+         if( i < rows && offsets[i+1UL] <= k )
+            ++i;
+         else
+            ++k;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the merge-path kernel with heavily skewed rows.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the merge-path kernel with sparse matrices, in which a single
+// row or a few rows contain most of the non-zero elements. These rows are split among several
+// threads. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void MergePathTest::testSkewedRows()
+{
+   for( size_t row : { 0UL, 7UL, 39UL } )
+   {
+      test_ = "Single dominant row";
+
+      MT A( 40UL, 2000UL );
+      blaze::randomize( A, 60UL, -9, 9 );
+      for( size_t j=0UL; j<1500UL; ++j ) {
+         A(row,j) = static_cast<int>( j % 17UL ) - 8;
+      }
+
+      OT offsets;
+      bool computed( false );
+
+      BLAZE_PARALLEL_SECTION
+      {
+         computed = blaze::computeMergePathOffsets( A, 2UL, 20UL, offsets );
+      }
+
+      if( !computed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Merge path not selected\n"
+             << " Details:\n"
+             << "   Dominant row: " << row << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkKernel( A );
+   }
+
+   {
+      test_ = "Power-law distribution of the non-zero elements";
+
+      MT A( 60UL, 3000UL );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); j+=i*i+1UL ) {
+            A(i,j) = static_cast<int>( ( i + j ) % 11UL ) - 5;
+         }
+      }
+
+      checkKernel( A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the merge-path kernel with empty rows.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the merge-path kernel with an empty sparse matrix, with a
+// sparse matrix without rows, and with a skewed sparse matrix, whose remaining rows are empty.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void MergePathTest::testEmpty()
+{
+   {
+      test_ = "Empty sparse matrix";
+
+      MT A( 50UL, 100UL );
+
+      checkKernel( A );
+   }
+
+   {
+      test_ = "Sparse matrix without rows";
+
+      MT A( 0UL, 100UL );
+
+      checkKernel( A );
+   }
+
+   {
+      test_ = "Single dominant row and empty rows";
+
+      MT A( 30UL, 1000UL );
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A(10,j) = static_cast<int>( j % 9UL ) - 4;
+      }
+      A(11,0) = 2;
+      A(25,999) = -3;
+
+      checkKernel( A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the merge-path kernel with more threads than rows.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the merge-path kernel with sparse matrices with fewer rows
+// than threads. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void MergePathTest::testFewRows()
+{
+   {
+      test_ = "Three rows with a single dominant row";
+
+      MT A( 3UL, 3000UL );
+      for( size_t j=0UL; j<2500UL; ++j ) {
+         A(1,j) = static_cast<int>( j % 13UL ) - 6;
+      }
+      A(0,17) = 5;
+      A(2,2999) = -7;
+
+      checkKernel( A );
+   }
+
+   {
+      test_ = "Two rows with an empty row";
+
+      MT A( 2UL, 3000UL );
+      blaze::randomize( A, 2000UL, -9, 9 );
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A.erase( 0UL, j );
+      }
+
+      checkKernel( A );
+   }
+
+   {
+      test_ = "Single row";
+
+      MT A( 1UL, 3000UL );
+      blaze::randomize( A, 1000UL, -9, 9 );
+
+      checkKernel( A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the merge-path kernel for the given sparse matrix.
+//
+// \param A The row-major sparse matrix operand.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function runs the assignment, the addition assignment, and the subtraction assignment
+// of the merge-path kernel with 2, 3, 4, and 7 threads and compares the results with the result
+// of the serial multiplication. In case any result differs, a \a std::runtime_error exception
+// is thrown.
+*/
+void MergePathTest::checkKernel( const MT& A )
+{
+   VT x( A.columns() );
+   blaze::randomize( x, -9, 9 );
+
+   const VT ref( blaze::serial( A * x ) );
+
+   VT init( A.rows() );
+   for( size_t i=0UL; i<init.size(); ++i ) {
+      init[i] = static_cast<int>( i % 7UL ) - 3;
+   }
+
+   const auto assignOp = []( auto& a, const auto& b ){ assign( a, b ); };
+   const auto addOp    = []( auto& a, const auto& b ){ addAssign( a, b ); };
+   const auto subOp    = []( auto& a, const auto& b ){ subAssign( a, b ); };
+
+   for( size_t threads : { 2UL, 3UL, 4UL, 7UL } )
+   {
+      threads_ = threads;
+      blaze::setNumThreads( threads );
+
+      {
+         VT y( init );
+         blaze::smpMergePathMultAssign( y, A, x, assignOp );
+         checkVector( y, ref, "assignment" );
+      }
+
+      {
+         VT y( init );
+         blaze::smpMergePathMultAssign( y, A, x, addOp );
+         checkVector( y, init + ref, "addition assignment" );
+      }
+
+      {
+         VT y( init );
+         blaze::smpMergePathMultAssign( y, A, x, subOp );
+         checkVector( y, init - ref, "subtraction assignment" );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace sparsekernels
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running merge-path test..." << std::endl;
+
+   try
+   {
+      RUN_SPARSEKERNELS_MERGEPATH_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during merge-path test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,370 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/sparsekernels/ScatterTest.cpp
+//  \brief Source file for the parallel scatter kernel test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/sparsekernels/ScatterTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace sparsekernels {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the scatter kernel test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ScatterTest::ScatterTest()
+   : test_   ()       // Label of the currently performed test
+   , threads_( 1UL )  // The number of threads of the currently performed test
+{
+   testScatter();
+   testRowSplit();
+   testEmpty();
+   testSerialFallback();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the scatter strategy of the parallel scatter kernel.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the scatter strategy, which is selected for operands with
+// many short non-zero lists. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ScatterTest::testScatter()
+{
+   {
+      test_ = "Scatter strategy (column-major sparse matrix/dense vector multiplication)";
+
+      TMT A( 24UL, 3000UL );
+      blaze::randomize( A, 6000UL, -9, 9 );
+
+      VT x( 3000UL );
+      blaze::randomize( x, -9, 9 );
+
+      if( !blaze::preferScatter( A, A.rows() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Scatter strategy not selected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkKernel( A, x, VT( blaze::serial( A * x ) ) );
+   }
+
+   {
+      test_ = "Scatter strategy (transpose dense vector/row-major sparse matrix multiplication)";
+
+      MT A( 3000UL, 24UL );
+      blaze::randomize( A, 6000UL, -9, 9 );
+
+      TVT x( 3000UL );
+      blaze::randomize( x, -9, 9 );
+
+      if( !blaze::preferScatter( A, A.columns() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Scatter strategy not selected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkKernel( A, x, TVT( blaze::serial( x * A ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the row split strategy of the parallel scatter kernel.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the row split strategy, which is selected for operands with
+// few long non-zero lists. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ScatterTest::testRowSplit()
+{
+   {
+      test_ = "Row split strategy (column-major sparse matrix/dense vector multiplication)";
+
+      TMT A( 3000UL, 8UL );
+      blaze::randomize( A, 6000UL, -9, 9 );
+
+      VT x( 8UL );
+      blaze::randomize( x, -9, 9 );
+
+      if( blaze::preferScatter( A, A.rows() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Row split strategy not selected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkKernel( A, x, VT( blaze::serial( A * x ) ) );
+   }
+
+   {
+      test_ = "Row split strategy (transpose dense vector/row-major sparse matrix multiplication)";
+
+      MT A( 8UL, 3000UL );
+      blaze::randomize( A, 6000UL, -9, 9 );
+
+      TVT x( 8UL );
+      blaze::randomize( x, -9, 9 );
+
+      if( blaze::preferScatter( A, A.columns() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Row split strategy not selected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkKernel( A, x, TVT( blaze::serial( x * A ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel scatter kernel with empty rows and columns.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the parallel scatter kernel with operands containing empty
+// rows and columns, with an empty operand, and with operands of size 0. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ScatterTest::testEmpty()
+{
+   const auto fill = []( auto& A )
+   {
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            if( i % 5UL != 0UL && j % 2UL == 0UL && ( i + j ) % 3UL == 0UL )
+               A(i,j) = static_cast<int>( ( i + j ) % 5UL ) + 1;
+         }
+      }
+   };
+
+   {
+      test_ = "Empty rows and columns (scatter strategy)";
+
+      TMT A( 40UL, 2000UL );
+      fill( A );
+
+      VT x( 2000UL );
+      blaze::randomize( x, -9, 9 );
+
+      checkKernel( A, x, VT( blaze::serial( A * x ) ) );
+   }
+
+   {
+      test_ = "Empty rows and columns (row split strategy)";
+
+      MT A( 6UL, 2000UL );
+      fill( A );
+
+      TVT x( 6UL );
+      blaze::randomize( x, -9, 9 );
+
+      checkKernel( A, x, TVT( blaze::serial( x * A ) ) );
+   }
+
+   {
+      test_ = "Empty sparse matrix";
+
+      TMT A( 30UL, 1000UL );
+      VT x( 1000UL, 1 );
+
+      checkKernel( A, x, VT( 30UL, 0 ) );
+   }
+
+   {
+      test_ = "Sparse matrix without rows";
+
+      TMT A( 0UL, 100UL );
+      VT x( 100UL, 1 );
+
+      checkKernel( A, x, VT() );
+   }
+
+   {
+      test_ = "Sparse matrix without columns";
+
+      TMT A( 50UL, 0UL );
+      VT x;
+
+      checkKernel( A, x, VT( 50UL, 0 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel assignment of scatter products via the expression templates.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment of scatter products with several threads.
+// Small products are evaluated by the serial fallback, large products by the parallel scatter
+// kernel. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ScatterTest::testSerialFallback()
+{
+   blaze::setNumThreads( 4UL );
+   threads_ = 4UL;
+
+   for( size_t m : { 7UL, 1500UL } )
+   {
+      test_ = "Column-major sparse matrix/dense vector multiplication";
+
+      TMT A( m, 40UL );
+      blaze::randomize( A, 4UL*m, -9, 9 );
+
+      VT x( 40UL );
+      blaze::randomize( x, -9, 9 );
+
+      const VT ref( blaze::serial( A * x ) );
+
+      VT y( m, 2 );
+
+      y = A * x;
+      checkVector( y, ref, "assignment" );
+
+      y += A * x;
+      checkVector( y, 2*ref, "addition assignment" );
+
+      y -= A * x;
+      checkVector( y, ref, "subtraction assignment" );
+   }
+
+   for( size_t n : { 7UL, 1500UL } )
+   {
+      test_ = "Transpose dense vector/row-major sparse matrix multiplication";
+
+      MT A( 40UL, n );
+      blaze::randomize( A, 4UL*n, -9, 9 );
+
+      TVT x( 40UL );
+      blaze::randomize( x, -9, 9 );
+
+      const TVT ref( blaze::serial( x * A ) );
+
+      TVT y( n, 2 );
+
+      y = x * A;
+      checkVector( y, ref, "assignment" );
+
+      y += x * A;
+      checkVector( y, 2*ref, "addition assignment" );
+
+      y -= x * A;
+      checkVector( y, ref, "subtraction assignment" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace sparsekernels
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running scatter kernel test..." << std::endl;
+
+   try
+   {
+      RUN_SPARSEKERNELS_SCATTER_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during scatter kernel test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,373 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/sparsekernels/SpMMTest.cpp
+//  \brief Source file for the parallel sparse matrix/dense matrix multiplication kernel test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <initializer_list>
+#include <iostream>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/sparsekernels/SpMMTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace sparsekernels {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the sparse matrix/dense matrix multiplication kernel test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SpMMTest::SpMMTest()
+   : test_   ()       // Label of the currently performed test
+   , threads_( 1UL )  // The number of threads of the currently performed test
+{
+   testRowSplit();
+   testMergePath();
+   testEmpty();
+   testSerialFallback();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the row split of the parallel sparse matrix/dense matrix kernel.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the parallel kernel for sparse matrices with an even
+// distribution of the non-zero elements among the rows. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SpMMTest::testRowSplit()
+{
+   test_ = "Row split (evenly distributed non-zero elements)";
+
+   SMT A( 60UL, 50UL );
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t k=0UL; k<4UL; ++k ) {
+         A( i, ( i*7UL + k*11UL ) % A.columns() ) = blaze::rand<int>( 1, 9 );
+      }
+   }
+
+   DMT B( 50UL, 9UL );
+   blaze::randomize( B, -9, 9 );
+
+   checkKernel( A, B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the merge-path distribution of the parallel sparse matrix/dense matrix kernel.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the parallel kernel for sparse matrices with an uneven
+// distribution of the non-zero elements among the rows, including rows that are split among
+// several threads. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SpMMTest::testMergePath()
+{
+   {
+      test_ = "Merge path (single dense row)";
+
+      SMT A( 40UL, 300UL );
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A(3,j) = blaze::rand<int>( 1, 9 );
+      }
+      A(0,5) = 2;
+      A(39,7) = -3;
+
+      DMT B( 300UL, 5UL );
+      blaze::randomize( B, -9, 9 );
+
+      checkKernel( A, B );
+   }
+
+   {
+      test_ = "Merge path (power-law distribution)";
+
+      SMT A( 100UL, 200UL );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         const size_t nonzeros( 200UL / ( i + 1UL ) );
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            A( i, ( i + k*3UL ) % A.columns() ) = blaze::rand<int>( -9, 9 );
+         }
+      }
+
+      DMT B( 200UL, 7UL );
+      blaze::randomize( B, -9, 9 );
+
+      checkKernel( A, B );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel sparse matrix/dense matrix kernel with empty rows and columns.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the parallel kernel with operands containing empty rows
+// and columns, with an empty operand, and with operands of size 0. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void SpMMTest::testEmpty()
+{
+   {
+      test_ = "Empty rows and columns";
+
+      SMT A( 50UL, 40UL );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            if( i % 5UL != 0UL && j % 2UL == 0UL && ( i + j ) % 3UL == 0UL )
+               A(i,j) = static_cast<int>( ( i + j ) % 5UL ) + 1;
+         }
+      }
+
+      DMT B( 40UL, 6UL );
+      blaze::randomize( B, -9, 9 );
+
+      checkKernel( A, B );
+   }
+
+   {
+      test_ = "Empty rows and columns (merge path)";
+
+      SMT A( 50UL, 40UL );
+      for( size_t j=0UL; j<A.columns(); j+=2UL ) {
+         A(17,j) = static_cast<int>( j % 5UL ) + 1;
+      }
+
+      DMT B( 40UL, 6UL );
+      blaze::randomize( B, -9, 9 );
+
+      checkKernel( A, B );
+   }
+
+   {
+      test_ = "Empty sparse matrix";
+
+      checkKernel( SMT( 30UL, 20UL ), DMT( 20UL, 4UL, 1 ) );
+   }
+
+   {
+      test_ = "Sparse matrix without rows";
+
+      checkKernel( SMT( 0UL, 20UL ), DMT( 20UL, 4UL, 1 ) );
+   }
+
+   {
+      test_ = "Sparse matrix without columns";
+
+      checkKernel( SMT( 30UL, 0UL ), DMT( 0UL, 4UL ) );
+   }
+
+   {
+      test_ = "Dense matrix without columns";
+
+      SMT A( 30UL, 20UL );
+      blaze::randomize( A, 60UL, -9, 9 );
+
+      checkKernel( A, DMT( 20UL, 0UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel assignment of sparse matrix/dense matrix products via the
+//        expression templates.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment of sparse matrix/dense matrix products with
+// several threads. Small products are evaluated by the serial fallback, large products by the
+// parallel kernel. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SpMMTest::testSerialFallback()
+{
+   blaze::setNumThreads( 4UL );
+   threads_ = 4UL;
+
+   for( size_t m : { 7UL, 200UL } )
+   {
+      test_ = "Sparse matrix/dense matrix multiplication";
+
+      SMT A( m, 60UL );
+      blaze::randomize( A, 3UL*m, -9, 9 );
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A(m/2UL,j) = 1;
+      }
+
+      DMT B( 60UL, 50UL );
+      blaze::randomize( B, -9, 9 );
+
+      const DMT ref( blaze::serial( A * B ) );
+
+      DMT C( m, 50UL, 2 );
+
+      C = A * B;
+      checkMatrix( C, ref, "assignment" );
+
+      C += A * B;
+      checkMatrix( C, 2*ref, "addition assignment" );
+
+      C -= A * B;
+      checkMatrix( C, ref, "subtraction assignment" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the parallel kernel for the given operands.
+//
+// \param A The sparse matrix operand.
+// \param B The dense matrix operand.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function runs the assignment, the addition assignment, and the subtraction assignment
+// of the parallel kernel with 2, 3, 4, and 7 threads and compares the results with the serial
+// multiplication. In case any result differs, a \a std::runtime_error exception is thrown.
+*/
+void SpMMTest::checkKernel( const SMT& A, const DMT& B )
+{
+   const DMT ref( blaze::serial( A * B ) );
+
+   DMT init( A.rows(), B.columns() );
+   for( size_t i=0UL; i<init.rows(); ++i ) {
+      for( size_t j=0UL; j<init.columns(); ++j ) {
+         init(i,j) = static_cast<int>( ( i + 2UL*j ) % 7UL ) - 3;
+      }
+   }
+
+   const auto assignOp = []( auto& a, const auto& b ){ assign( a, b ); };
+   const auto addOp    = []( auto& a, const auto& b ){ addAssign( a, b ); };
+   const auto subOp    = []( auto& a, const auto& b ){ subAssign( a, b ); };
+
+   for( size_t threads : { 2UL, 3UL, 4UL, 7UL } )
+   {
+      threads_ = threads;
+      blaze::setNumThreads( threads );
+
+      {
+         DMT C( init );
+         blaze::smpMergePathMultAssign( C, A, B, assignOp );
+         checkMatrix( C, ref, "assignment" );
+      }
+
+      {
+         DMT C( init );
+         blaze::smpMergePathMultAssign( C, A, B, addOp );
+         checkMatrix( C, init + ref, "addition assignment" );
+      }
+
+      {
+         DMT C( init );
+         blaze::smpMergePathMultAssign( C, A, B, subOp );
+         checkMatrix( C, init - ref, "subtraction assignment" );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace sparsekernels
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SpMM kernel test..." << std::endl;
+
+   try
+   {
+      RUN_SPARSEKERNELS_SPMM_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SpMM kernel test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -39,8 +39,10 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 #include <blaze/math/sparse/SparseMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blazetest/mathtest/IsEqual.h>
 #include <blazetest/mathtest/matrices/sparsematrix/GeneralTest.h>
@@ -99,6 +101,8 @@ GeneralTest::GeneralTest()
    testMean();
    testVar();
    testStdDev();
+   testPrune();
+   testMatrixPowers();
 }
 //*************************************************************************************************
 
@@ -7925,6 +7929,335 @@ void GeneralTest::testStdDev()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the \c prune() functions for sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c prune(), \c pruneRelative(), and \c pruneTopK()
+// functions for sparse matrices. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void GeneralTest::testPrune()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major prune() (drop tolerance)";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> mat{ { 1.0, 0.1, 0.0 },
+                                                           { 0.0, 0.0, 0.0 },
+                                                           { -0.2, 3.0, 0.5 } };
+      mat.reserve( 1UL, 5UL );
+      mat(1,1) = 0.0;
+
+      blaze::prune( mat, 0.2 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat.capacity() != 3UL ||
+          mat(0,0) != 1.0 || mat(2,1) != 3.0 || mat(2,2) != 0.5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Pruning operation failed\n"
+             << " Details:\n"
+             << "   Capacity: " << mat.capacity() << " (expected 3)\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 0 0 )\n( 0 3 0.5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major prune() (predicate)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat{ { 1, -2, 0, 4 },
+                                                        { -1, 0, 3, 0 } };
+
+      blaze::prune( mat, []( int value ){ return value < 0; } );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+
+      if( mat(0,0) != 1 || mat(0,3) != 4 || mat(1,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Pruning operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 4 )\n( 0 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major pruneRelative()";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> mat{ { 3.0, 0.0, 4.0, 0.5 },
+                                                           { 0.0, 0.1, 0.0, 0.0 } };
+
+      blaze::pruneRelative( mat, 0.2 );
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+
+      if( mat(0,0) != 3.0 || mat(0,2) != 4.0 || mat(1,1) != 0.1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Pruning operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 3 0 4 0 )\n( 0 0.1 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major pruneTopK()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat{ { 1, -5, 2, 5, 3 },
+                                                        { 0, 0, 0, 0, 7 },
+                                                        { 2, 2, 2, 0, 0 } };
+
+      blaze::pruneTopK( mat, 2UL );
+
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,1) != -5 || mat(0,3) != 5 || mat(1,4) != 7 || mat(2,0) != 2 || mat(2,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Pruning operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 -5 0 5 0 )\n( 0 0 0 0 7 )\n( 2 2 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::pruneTopK( mat, 0UL );
+
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major prune() (drop tolerance)";
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> mat{ { 1.0, 0.0, -0.2 },
+                                                              { 0.1, 0.0, 3.0 },
+                                                              { 0.0, 0.0, 0.5 } };
+
+      blaze::prune( mat, 0.2 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 1.0 || mat(1,2) != 3.0 || mat(2,2) != 0.5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Pruning operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 0 3 )\n( 0 0 0.5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major pruneTopK()";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat{ { 1, 0 },
+                                                           { -4, 2 },
+                                                           { 3, 0 } };
+
+      blaze::pruneTopK( mat, 1UL );
+
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+
+      if( mat(1,0) != -4 || mat(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Pruning operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 )\n( -4 2 )\n( 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c matrixPowers() function for sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the communication-avoiding \c matrixPowers() function for
+// sparse matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testMatrixPowers()
+{
+   using VT = blaze::DynamicVector<double,blaze::columnVector>;
+   using DT = blaze::DynamicMatrix<double,blaze::columnMajor>;
+
+   // Creating a tridiagonal matrix that is large enough to be split into several row blocks
+   const size_t N( 40000UL );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( N, N, 3UL*N );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      if( i > 0UL ) A.append( i, i-1UL, -1.0 );
+      A.append( i, i, 2.5 );
+      if( i+1UL < N ) A.append( i, i+1UL, -1.0 );
+      A.finalize( i );
+   }
+
+   VT x( N );
+   blaze::randomize( x );
+
+   const auto check = [this]( const DT& result, const DT& expected )
+   {
+      const double error( blaze::max( blaze::abs( result - expected ) ) );
+
+      if( result.rows() != expected.rows() || result.columns() != expected.columns() ||
+          !( error <= 1E-10 * blaze::max( blaze::abs( expected ) ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Matrix powers computation failed\n"
+             << " Details:\n"
+             << "   Size: " << result.rows() << "x" << result.columns() << "\n"
+             << "   Expected size: " << expected.rows() << "x" << expected.columns() << "\n"
+             << "   Maximum error: " << error << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   };
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major matrixPowers() (monomial basis)";
+
+      DT expected( N, 6UL );
+      column( expected, 0UL ) = x;
+      for( size_t k=1UL; k<6UL; ++k ) {
+         column( expected, k ) = A * column( expected, k-1UL );
+      }
+
+      DT V;
+      blaze::matrixPowers( A, x, V, 5UL );
+
+      check( V, expected );
+   }
+
+   {
+      test_ = "Row-major matrixPowers() (Chebyshev basis)";
+
+      const blaze::KrylovBasis<double> basis( blaze::chebyshevBasis( 0.5, 4.5, 6UL ) );
+
+      DT expected( N, 7UL );
+      column( expected, 0UL ) = x;
+      column( expected, 1UL ) = ( A * x - 2.5 * x ) / 2.0;
+      for( size_t k=2UL; k<7UL; ++k ) {
+         column( expected, k ) = A * column( expected, k-1UL ) - 2.5 * column( expected, k-1UL )
+                               - column( expected, k-2UL );
+      }
+
+      DT V;
+      blaze::matrixPowers( A, x, V, basis );
+
+      check( V, expected );
+   }
+
+   {
+      test_ = "Row-major matrixPowers() (Newton basis)";
+
+      const std::vector<double> shifts{ 1.0, 3.0, 4.0 };
+      const blaze::KrylovBasis<double> basis( blaze::newtonBasis( shifts ) );
+
+      DT expected( N, 4UL );
+      column( expected, 0UL ) = x;
+      for( size_t k=1UL; k<4UL; ++k ) {
+         column( expected, k ) = A * column( expected, k-1UL )
+                               - shifts[k-1UL] * column( expected, k-1UL );
+      }
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> V;
+      blaze::matrixPowers( A, x, V, basis );
+
+      check( DT( V ), expected );
+   }
+
+   {
+      test_ = "Row-major matrixPowers() (non-square matrix)";
+
+      try {
+         DT V;
+         blaze::matrixPowers( blaze::CompressedMatrix<double>( 4UL, 3UL ), VT( 3UL ), V, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Matrix powers computation of non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << V << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major matrixPowers() (monomial basis)";
+
+      const blaze::CompressedMatrix<double,blaze::columnMajor> B( A );
+
+      DT expected( N, 5UL );
+      column( expected, 0UL ) = x;
+      for( size_t k=1UL; k<5UL; ++k ) {
+         column( expected, k ) = B * column( expected, k-1UL );
+      }
+
+      DT V;
+      blaze::matrixPowers( B, x, V, 4UL );
+
+      check( V, expected );
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace sparsematrix
 
 } // namespace matrices
@@ -0,0 +1,756 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/stridedmatrix/ClassTest.cpp
+//  \brief Source file for the StridedMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Submatrix.h>
+#include <blazetest/mathtest/matrices/stridedmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace stridedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the StridedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testIterator();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testSchurAssign();
+   testMultiplication();
+   testTranspose();
+   testSubmatrix();
+   testAliasing();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the StridedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the StridedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   std::vector<int> array( 24UL );
+   std::iota( array.begin(), array.end(), 0 );
+
+
+   //=====================================================================================
+   // Contiguous constructors
+   //=====================================================================================
+
+   {
+      test_ = "StridedMatrix constructor ( Type*, size_t, size_t )";
+
+      MT  A( array.data(), 4UL, 6UL );
+      OMT B( array.data(), 4UL, 6UL );
+
+      if( A.rowStride() != 6L || A.columnStride() != 1L ||
+          B.rowStride() != 1L || B.columnStride() != 4L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid strides detected\n"
+             << " Details:\n"
+             << "   Row-major strides   : " << A.rowStride() << ", " << A.columnStride() << " (expected 6, 1)\n"
+             << "   Column-major strides: " << B.rowStride() << ", " << B.columnStride() << " (expected 1, 4)\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkMatrix( A, RMT{ {  0,  1,  2,  3,  4,  5 },
+                           {  6,  7,  8,  9, 10, 11 },
+                           { 12, 13, 14, 15, 16, 17 },
+                           { 18, 19, 20, 21, 22, 23 } } );
+      checkMatrix( B, RMT{ { 0, 4,  8, 12, 16, 20 },
+                           { 1, 5,  9, 13, 17, 21 },
+                           { 2, 6, 10, 14, 18, 22 },
+                           { 3, 7, 11, 15, 19, 23 } } );
+   }
+
+
+   //=====================================================================================
+   // Strided constructors
+   //=====================================================================================
+
+   {
+      test_ = "StridedMatrix constructor ( Type*, size_t, size_t, ptrdiff_t, ptrdiff_t )";
+
+      MT A( array.data(), 2UL, 3UL, 12L, 2L );
+
+      checkMatrix( A, RMT{ {  0,  2,  4 },
+                           { 12, 14, 16 } } );
+   }
+
+   {
+      test_ = "StridedMatrix constructor ( Type*, size_t, size_t, ptrdiff_t, ptrdiff_t ) (transposed)";
+
+      OMT A( array.data(), 3UL, 2UL, 1L, 6L );
+
+      checkMatrix( A, RMT{ { 0, 6 },
+                           { 1, 7 },
+                           { 2, 8 } } );
+   }
+
+   {
+      test_ = "StridedMatrix constructor ( Type*, size_t, size_t, ptrdiff_t, ptrdiff_t ) (negative stride)";
+
+      MT A( array.data()+23UL, 2UL, 3UL, -6L, -1L );
+
+      checkMatrix( A, RMT{ { 23, 22, 21 },
+                           { 17, 16, 15 } } );
+   }
+
+   {
+      test_ = "StridedMatrix constructor ( nullptr, size_t, size_t )";
+
+      try {
+         MT A( nullptr, 2UL, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with nullptr succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "StridedMatrix constructor ( Type*, size_t, size_t, 0, ptrdiff_t )";
+
+      try {
+         MT A( array.data(), 2UL, 3UL, 0L, 1L );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with zero stride succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StridedMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the StridedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   std::vector<int> array( 24UL );
+   std::iota( array.begin(), array.end(), 0 );
+
+   {
+      test_ = "Row-major StridedMatrix iterator";
+
+      MT A( array.data(), 2UL, 3UL, 12L, 2L );
+
+      const ptrdiff_t number( A.end( 1UL ) - A.begin( 1UL ) );
+      int sum( 0 );
+      for( auto it=A.cbegin( 1UL ); it!=A.cend( 1UL ); ++it )
+         sum += *it;
+
+      if( number != 3L || sum != 42 || A.begin( 1UL )[2] != 16 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid iteration detected\n"
+             << " Details:\n"
+             << "   Number of elements: " << number << " (expected 3)\n"
+             << "   Sum of elements   : " << sum << " (expected 42)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major StridedMatrix iterator";
+
+      OMT A( array.data()+23UL, 2UL, 3UL, -6L, -1L );
+
+      const ptrdiff_t number( A.end( 2UL ) - A.begin( 2UL ) );
+      int sum( 0 );
+      for( auto it=A.begin( 2UL ); it!=A.end( 2UL ); ++it )
+         sum += *it;
+
+      if( number != 2L || sum != 36 || *( A.end( 2UL ) - 1L ) != 15 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid iteration detected\n"
+             << " Details:\n"
+             << "   Number of elements: " << number << " (expected 2)\n"
+             << "   Sum of elements   : " << sum << " (expected 36)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StridedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the StridedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   const RMT ref{ { 1, 2, 3 }, { 4, 5, 6 } };
+
+   {
+      test_ = "StridedMatrix homogeneous assignment";
+
+      std::vector<int> array( 12UL, 0 );
+      MT A( array.data(), 2UL, 3UL, 6L, 2L );
+      A = 7;
+
+      checkMatrix( A, RMT( 2UL, 3UL, 7 ) );
+
+      if( array[1] != 0 || array[2] != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid assignment to unreferenced elements\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "StridedMatrix dense matrix assignment (non-unit strides)";
+
+      std::vector<int> array( 12UL, 0 );
+      MT A( array.data(), 2UL, 3UL, 6L, 2L );
+      A = ref;
+
+      checkMatrix( A, ref );
+
+      if( array[0] != 1 || array[2] != 2 || array[6] != 4 || array[1] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid array layout detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "StridedMatrix dense matrix assignment (contiguous rows)";
+
+      std::vector<int> array( 10UL, 0 );
+      OMT A( array.data(), 2UL, 3UL, 5L, 1L );
+      A = ref;
+
+      checkMatrix( A, ref );
+
+      if( array[3] != 0 || array[5] != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid array layout detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "StridedMatrix dense matrix assignment (size mismatch)";
+
+      std::vector<int> array( 12UL, 0 );
+      MT A( array.data(), 3UL, 2UL, 4L, 1L );
+
+      try {
+         A = ref;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a matrix with different size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "StridedMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<int> S( 2UL, 3UL );
+      S(0,1) = 2;
+      S(1,2) = 6;
+
+      std::vector<int> array( 12UL, 1 );
+      MT A( array.data(), 2UL, 3UL, 6L, 2L );
+      A = S;
+
+      checkMatrix( A, S );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StridedMatrix addition assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operators of the StridedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   const RMT ref{ { 1, 2, 3 }, { 4, 5, 6 } };
+
+   {
+      test_ = "StridedMatrix dense matrix addition assignment";
+
+      std::vector<int> array( 12UL, 1 );
+      OMT A( array.data(), 2UL, 3UL, 6L, 2L );
+      A += ref;
+
+      checkMatrix( A, ref + 1 );
+   }
+
+   {
+      test_ = "StridedMatrix sparse matrix addition assignment";
+
+      blaze::CompressedMatrix<int> S( 2UL, 3UL );
+      S(1,1) = 3;
+
+      std::vector<int> array( 12UL, 1 );
+      MT A( array.data(), 2UL, 3UL, 6L, 2L );
+      A += S;
+
+      checkMatrix( A, RMT{ { 1, 1, 1 }, { 1, 4, 1 } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StridedMatrix subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operators of the StridedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   const RMT ref{ { 1, 2, 3 }, { 4, 5, 6 } };
+
+   {
+      test_ = "StridedMatrix dense matrix subtraction assignment";
+
+      std::vector<int> array( 12UL, 1 );
+      MT A( array.data()+11UL, 2UL, 3UL, -6L, -2L );
+      A -= ref;
+
+      checkMatrix( A, 1 - ref );
+   }
+
+   {
+      test_ = "StridedMatrix sparse matrix subtraction assignment";
+
+      blaze::CompressedMatrix<int> S( 2UL, 3UL );
+      S(0,2) = 3;
+
+      std::vector<int> array( 12UL, 1 );
+      OMT A( array.data(), 2UL, 3UL, 1L, 4L );
+      A -= S;
+
+      checkMatrix( A, RMT{ { 1, 1, -2 }, { 1, 1, 1 } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StridedMatrix Schur product assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the Schur product assignment operators of the StridedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSchurAssign()
+{
+   const RMT ref{ { 1, 2, 3 }, { 4, 5, 6 } };
+
+   {
+      test_ = "StridedMatrix dense matrix Schur product assignment";
+
+      std::vector<int> array( 12UL, 2 );
+      MT A( array.data(), 2UL, 3UL, 6L, 2L );
+      A %= ref;
+
+      checkMatrix( A, 2 * ref );
+   }
+
+   {
+      test_ = "StridedMatrix sparse matrix Schur product assignment";
+
+      blaze::CompressedMatrix<int> S( 2UL, 3UL );
+      S(1,0) = 3;
+
+      std::vector<int> array( 12UL, 2 );
+      MT A( array.data(), 2UL, 3UL, 6L, 2L );
+      A %= S;
+
+      checkMatrix( A, RMT{ { 0, 0, 0 }, { 6, 0, 0 } } );
+
+      if( array[1] != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid assignment to unreferenced elements\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of strided matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of dense matrix multiplications involving strided operands
+// and strided targets. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   std::vector<int> array( 120UL );
+   std::iota( array.begin(), array.end(), -60 );
+
+   const MT  A( array.data(), 5UL, 7UL, 21L, 3L );
+   const OMT B( array.data()+1UL, 7UL, 4UL, 2L, 30L );
+   const RMT RA( A ), RB( B );
+   const RMT ref( RA * RB );
+
+   {
+      test_ = "StridedMatrix multiplication (strided operands)";
+
+      const RMT C( A * B );
+      checkMatrix( C, ref );
+
+      const RMT D( trans( B ) * trans( A ) );
+      checkMatrix( D, trans( ref ) );
+   }
+
+   {
+      test_ = "StridedMatrix multiplication (strided target)";
+
+      std::vector<int> target( 80UL, 0 );
+      MT C( target.data(), 5UL, 4UL, 16L, 2L );
+
+      C = A * B;
+      checkMatrix( C, ref );
+
+      C += RA * RB;
+      checkMatrix( C, 2 * ref );
+
+      C -= A * RB;
+      checkMatrix( C, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the transpose() member function of the StridedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the transpose() member function of the StridedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTranspose()
+{
+   test_ = "StridedMatrix::transpose()";
+
+   std::vector<int> array( 16UL );
+   std::iota( array.begin(), array.end(), 0 );
+
+   MT A( array.data(), 3UL, 3UL, 5L, 2L );
+   const RMT ref( trans( RMT( A ) ) );
+
+   A.transpose();
+   checkMatrix( A, ref );
+
+   A = trans( A );
+   checkMatrix( A, trans( ref ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of submatrices on strided matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of submatrices on top of strided matrices. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubmatrix()
+{
+   test_ = "Submatrix on StridedMatrix";
+
+   std::vector<int> array( 48UL );
+   std::iota( array.begin(), array.end(), 0 );
+
+   MT A( array.data(), 4UL, 4UL, 12L, 3L );
+   RMT ref( A );
+
+   auto sm = blaze::submatrix( A, 1UL, 1UL, 2UL, 3UL );
+   checkMatrix( sm, blaze::submatrix( ref, 1UL, 1UL, 2UL, 3UL ) );
+
+   sm = 0;
+   blaze::submatrix( ref, 1UL, 1UL, 2UL, 3UL ) = 0;
+   checkMatrix( A, ref );
+}
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*!\brief Test of the aliasing detection of strided matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of assignments between strided matrices referring to
+// overlapping memory. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAliasing()
+{
+   {
+      test_ = "StridedMatrix assignment of a transposed view (contiguous rows)";
+
+      std::vector<int> array( 9UL );
+      std::iota( array.begin(), array.end(), 1 );
+
+      MT A( array.data(), 3UL, 3UL, 3L, 1L );
+      MT B( array.data(), 3UL, 3UL, 1L, 3L );
+      const RMT ref( trans( RMT( A ) ) );
+
+      if( !A.isAliased( &B ) || !B.canAlias( &A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliasing of a transposed view not detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      A = B;
+      checkMatrix( A, ref );
+   }
+
+   {
+      test_ = "StridedMatrix assignment of a transposed view (non-unit strides)";
+
+      std::vector<int> array( 32UL );
+      std::iota( array.begin(), array.end(), 1 );
+
+      MT  A( array.data(), 4UL, 4UL, 8L, 2L );
+      OMT B( array.data(), 4UL, 4UL, 2L, 8L );
+      const RMT ref( trans( RMT( A ) ) );
+
+      A = B;
+      checkMatrix( A, ref );
+   }
+
+   {
+      test_ = "StridedMatrix assignment of a reversed view";
+
+      std::vector<int> array( 12UL );
+      std::iota( array.begin(), array.end(), 1 );
+
+      MT A( array.data()   , 3UL, 4UL,  4L,  1L );
+      MT R( array.data()+11UL, 3UL, 4UL, -4L, -1L );
+      const RMT ref( R );
+
+      A = R;
+      checkMatrix( A, ref );
+   }
+
+   {
+      test_ = "StridedMatrix addition/subtraction assignment of a reversed view";
+
+      std::vector<int> array( 12UL );
+      std::iota( array.begin(), array.end(), 1 );
+
+      MT A( array.data()  , 3UL, 4UL,  4L, 1L );
+      MT R( array.data()+8UL, 3UL, 4UL, -4L, 1L );
+      RMT ref( A );
+
+      ref += RMT( R );
+      A += R;
+      checkMatrix( A, ref );
+
+      ref -= RMT( R );
+      A -= R;
+      checkMatrix( A, ref );
+   }
+
+   {
+      test_ = "CustomMatrix assignment of a transposed strided view";
+
+      std::vector<int> array( 9UL );
+      std::iota( array.begin(), array.end(), 1 );
+
+      blaze::CustomMatrix<int,blaze::unaligned,blaze::unpadded> C( array.data(), 3UL, 3UL );
+      MT B( array.data(), 3UL, 3UL, 1L, 3L );
+      const RMT ref( trans( RMT( C ) ) );
+
+      C = B;
+      checkMatrix( C, ref );
+   }
+
+   {
+      test_ = "StridedMatrix assignment of a shifted CustomMatrix";
+
+      std::vector<int> array( 12UL );
+      std::iota( array.begin(), array.end(), 1 );
+
+      MT A( array.data()+1UL, 3UL, 3UL, 3L, 1L );
+      blaze::CustomMatrix<int,blaze::unaligned,blaze::unpadded> C( array.data(), 3UL, 3UL );
+      const RMT ref( C );
+
+      A = C;
+      checkMatrix( A, ref );
+   }
+
+   {
+      test_ = "StridedMatrix aliasing of disjoint views";
+
+      std::vector<int> array( 12UL, 0 );
+
+      MT A( array.data()   , 2UL, 3UL, 3L, 1L );
+      MT B( array.data()+6UL, 2UL, 3UL, 3L, 1L );
+
+      if( A.isAliased( &B ) || B.isAliased( &A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliasing of disjoint views detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace stridedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running StridedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_STRIDEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during StridedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
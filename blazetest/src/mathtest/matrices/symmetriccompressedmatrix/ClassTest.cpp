@@ -0,0 +1,503 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/symmetriccompressedmatrix/ClassTest.cpp
+//  \brief Source file for the SymmetricCompressedMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SymmetricCompressedMatrix.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/symmetriccompressedmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace symmetriccompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SymmetricCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testInsertion();
+   testResize();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SymmetricCompressedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SymmetricCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   const blaze::DynamicMatrix<int,blaze::rowMajor> S{ { 1, 0, 3 },
+                                                      { 0, 2, 4 },
+                                                      { 3, 4, 0 } };
+
+   {
+      test_ = "Row-major SymmetricCompressedMatrix size constructor";
+
+      MT A( 3UL );
+
+      checkMatrix( A, blaze::DynamicMatrix<int>( 3UL, 3UL, 0 ) );
+
+      if( A.nonZeros() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements\n"
+             << " Details:\n"
+             << "   Number of non-zeros: " << A.nonZeros() << "\n"
+             << "   Expected number of non-zeros: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major SymmetricCompressedMatrix conversion constructor (dense)";
+
+      MT A( S );
+
+      checkMatrix( A, S );
+
+      if( A.nonZeros() != 4UL || A.nonZeros( 2UL ) != 2UL ||
+          A.begin( 2UL )->index() != 0UL || A.begin( 2UL )->value() != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid lower triangular storage\n"
+             << " Details:\n"
+             << "   Result:\n" << A.storage() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major SymmetricCompressedMatrix conversion constructor (sparse)";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> C( S );
+      OMT A( C );
+
+      checkMatrix( A, S );
+
+      if( A.nonZeros() != 4UL || A.nonZeros( 0UL ) != 2UL ||
+          A.begin( 0UL )->index() != 0UL || ( A.end( 0UL ) - 1 )->index() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid lower triangular storage\n"
+             << " Details:\n"
+             << "   Result:\n" << A.storage() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricCompressedMatrix conversion constructor (non-symmetric)";
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> N{ { 1, 2 }, { 3, 4 } };
+
+      try {
+         MT A( N );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-symmetric SymmetricCompressedMatrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A.matrix() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "SymmetricCompressedMatrix conversion to SymmetricMatrix";
+
+      const MT A( S );
+      const OMT B( S );
+
+      const blaze::SymmetricMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > C( A.matrix() );
+      const blaze::SymmetricMatrix< blaze::CompressedMatrix<int,blaze::columnMajor> > D( B.matrix() );
+
+      checkMatrix( A, C );
+      checkMatrix( B, D );
+
+      if( C.nonZeros() != 6UL || D.nonZeros() != 6UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements\n"
+             << " Details:\n"
+             << "   Number of non-zeros: " << C.nonZeros() << " and " << D.nonZeros() << "\n"
+             << "   Expected number of non-zeros: 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the insertion and erase functions of SymmetricCompressedMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the set(), insert(), append(), erase() and find() functions
+// of the SymmetricCompressedMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInsertion()
+{
+   {
+      test_ = "Row-major SymmetricCompressedMatrix::append()";
+
+      MT A( 3UL, 3UL );
+      A.finalize( 0UL );
+      A.append( 1UL, 0UL, 1 );
+      A.append( 1UL, 1UL, 2 );
+      A.finalize( 1UL );
+      A.append( 2UL, 0UL, 3 );
+      A.finalize( 2UL );
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> S{ { 0, 1, 3 },
+                                                         { 1, 2, 0 },
+                                                         { 3, 0, 0 } };
+
+      checkMatrix( A, S );
+   }
+
+   {
+      test_ = "Column-major SymmetricCompressedMatrix::append()";
+
+      OMT A( 3UL, 3UL );
+      A.append( 1UL, 0UL, 1 );
+      A.append( 2UL, 0UL, 3 );
+      A.finalize( 0UL );
+      A.append( 1UL, 1UL, 2 );
+      A.finalize( 1UL );
+      A.finalize( 2UL );
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> S{ { 0, 1, 3 },
+                                                         { 1, 2, 0 },
+                                                         { 3, 0, 0 } };
+
+      checkMatrix( A, S );
+   }
+
+   {
+      test_ = "Row-major SymmetricCompressedMatrix::set(), insert() and erase()";
+
+      MT A( 3UL );
+      A.set( 0UL, 2UL, 5 );
+      A.insert( 1UL, 1UL, 7 );
+      A.set( 2UL, 0UL, 6 );
+      A.insert( 1UL, 2UL, -1 );
+      A.erase( 2UL, 1UL );
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> S{ { 0, 0, 6 },
+                                                         { 0, 7, 0 },
+                                                         { 6, 0, 0 } };
+
+      checkMatrix( A, S );
+
+      if( A.nonZeros() != 2UL || A.find( 0UL, 2UL ) == A.end( 2UL ) ||
+          A.find( 0UL, 2UL )->value() != 6 || A.find( 1UL, 2UL ) != A.end( 2UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid lower triangular storage\n"
+             << " Details:\n"
+             << "   Result:\n" << A.storage() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         A.insert( 2UL, 0UL, 1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting an existing element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A.matrix() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Column-major SymmetricCompressedMatrix::set(), insert() and erase()";
+
+      OMT A( 3UL );
+      A.set( 0UL, 2UL, 5 );
+      A.insert( 1UL, 1UL, 7 );
+      A.set( 2UL, 0UL, 6 );
+      A.insert( 1UL, 2UL, -1 );
+      A.erase( 2UL, 1UL );
+      A.scale( 2 );
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> S{ {  0,  0, 12 },
+                                                         {  0, 14,  0 },
+                                                         { 12,  0,  0 } };
+
+      checkMatrix( A, S );
+
+      if( A.nonZeros() != 2UL || A.find( 0UL, 2UL ) == A.end( 0UL ) ||
+          A.find( 0UL, 2UL )->value() != 12 || A.find( 1UL, 2UL ) != A.end( 1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid lower triangular storage\n"
+             << " Details:\n"
+             << "   Result:\n" << A.storage() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() member function of SymmetricCompressedMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() member function of the SymmetricCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "SymmetricCompressedMatrix::resize()";
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> S{ { 1, 0, 3 },
+                                                      { 0, 2, 4 },
+                                                      { 3, 4, 0 } };
+
+   MT A( S );
+   OMT B( S );
+
+   A.resize( 2UL );
+   B.resize( 4UL );
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> S2{ { 1, 0 },
+                                                       { 0, 2 } };
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> S4{ { 1, 0, 3, 0 },
+                                                       { 0, 2, 4, 0 },
+                                                       { 3, 4, 0, 0 },
+                                                       { 0, 0, 0, 0 } };
+
+   checkMatrix( A, S2 );
+   checkMatrix( B, S4 );
+
+   A.clear();
+   B.reset();
+
+   checkMatrix( A, blaze::DynamicMatrix<int>() );
+   checkMatrix( B, blaze::DynamicMatrix<int>( 4UL, 4UL, 0 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the symmetric matrix/vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of a SymmetricCompressedMatrix with dense
+// vectors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   const blaze::DynamicMatrix<int,blaze::rowMajor> S{ { 1, 0, 3 },
+                                                      { 0, 2, 4 },
+                                                      { 3, 4, 0 } };
+
+   {
+      test_ = "Row-major SymmetricCompressedMatrix/dense vector multiplication";
+
+      const MT A( S );
+      const blaze::DynamicVector<int,blaze::columnVector> x{ 1, 2, 3 };
+
+      checkVector( A * x, blaze::DynamicVector<int,blaze::columnVector>{ 10, 16, 11 } );
+   }
+
+   {
+      test_ = "Transpose dense vector/column-major SymmetricCompressedMatrix multiplication";
+
+      const OMT A( S );
+      const blaze::DynamicVector<int,blaze::rowVector> x{ 1, 2, 3 };
+
+      checkVector( x * A, blaze::DynamicVector<int,blaze::rowVector>{ 10, 16, 11 } );
+   }
+
+   {
+      test_ = "Aliased SymmetricCompressedMatrix/dense vector multiplication";
+
+      const MT A( S );
+      blaze::DynamicVector<int,blaze::columnVector> x{ 1, 2, 3 };
+
+      multiply( A, x, x );
+
+      checkVector( x, blaze::DynamicVector<int,blaze::columnVector>{ 10, 16, 11 } );
+   }
+
+   {
+      test_ = "SymmetricCompressedMatrix/dense vector multiplication (size mismatch)";
+
+      const MT A( S );
+      const blaze::DynamicVector<int,blaze::columnVector> x{ 1, 2 };
+
+      try {
+         const blaze::DynamicVector<int,blaze::columnVector> y( A * x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with invalid vector succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   testRandomMultiplication<blaze::rowMajor>   (  50UL,   200UL );
+   testRandomMultiplication<blaze::columnMajor>(  50UL,   200UL );
+   testRandomMultiplication<blaze::rowMajor>   ( 997UL, 20000UL );
+   testRandomMultiplication<blaze::columnMajor>( 997UL, 20000UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the symmetric matrix/vector multiplication with random matrices.
+//
+// \param n The number of rows and columns of the random matrix.
+// \param nonzeros The number of non-zero elements of the random matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the multiplication of a random SymmetricCompressedMatrix and a random
+// dense vector with the according multiplication of a SymmetricMatrix adaptor. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order
+void ClassTest::testRandomMultiplication( size_t n, size_t nonzeros )
+{
+   test_ = "Random SymmetricCompressedMatrix/dense vector multiplication";
+
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<int,SO> > R( n );
+   blaze::randomize( R, nonzeros, -5, 5 );
+
+   const blaze::SymmetricCompressedMatrix<int,SO> A( R );
+
+   blaze::DynamicVector<int,blaze::columnVector> x( n );
+   blaze::randomize( x, -5, 5 );
+
+   checkVector( A * x, R * x );
+   checkVector( trans( x ) * A, trans( x ) * R );
+}
+//*************************************************************************************************
+
+} // namespace symmetriccompressedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SymmetricCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SYMMETRICCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SymmetricCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,513 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/toeplitzmatrix/ClassTest.cpp
+//  \brief Source file for the ToeplitzMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/ToeplitzMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/toeplitzmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace toeplitzmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ToeplitzMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testElementAccess();
+   testIterator();
+   testNonZeros();
+   testMultiplication();
+   testSolve();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the ToeplitzMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the ToeplitzMatrix class template. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   {
+      test_ = "ToeplitzMatrix default constructor";
+
+      const MT A;
+
+      if( A.rows() != 0UL || A.columns() != 0UL || !isIntact( A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid matrix size\n"
+             << " Details:\n"
+             << "   Number of rows   : " << A.rows() << "\n"
+             << "   Number of columns: " << A.columns() << "\n"
+             << "   Expected size: 0x0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "ToeplitzMatrix column/row constructor";
+
+      const MT A( VT{ 1.0, 2.0, 3.0 }, VT{ 1.0, -1.0 } );
+      const DT D{ { 1.0, -1.0 }, { 2.0, 1.0 }, { 3.0, 2.0 } };
+
+      if( A.rows() != 3UL || A.columns() != 2UL || !isIntact( A ) || A != D ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n"
+             << "   Expected result:\n" << D << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "ToeplitzMatrix symmetric constructor";
+
+      const MT A( VT{ 4.0, 2.0, 1.0 } );
+      const DT D{ { 4.0, 2.0, 1.0 }, { 2.0, 4.0, 2.0 }, { 1.0, 2.0, 4.0 } };
+
+      if( A.rows() != 3UL || A.columns() != 3UL || !A.isSymmetric() || A != D ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n"
+             << "   Expected result:\n" << D << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "ToeplitzMatrix constructor with inconsistent first elements";
+
+      try {
+         const MT A( VT{ 1.0, 2.0 }, VT{ 2.0, 1.0 } );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with inconsistent first elements succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "ToeplitzMatrix constructor with empty first row";
+
+      try {
+         const MT A( VT{ 1.0, 2.0 }, VT() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with empty first row succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element access of the ToeplitzMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator and the at() function of the
+// ToeplitzMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testElementAccess()
+{
+   test_ = "ToeplitzMatrix::operator() and at()";
+
+   VT column( 7UL ), row( 5UL );
+   blaze::randomize( column );
+   blaze::randomize( row );
+   row[0UL] = column[0UL];
+
+   const MT A( column, row );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         const double expected( i >= j ? column[i-j] : row[j-i] );
+         if( A(i,j) != expected || A.at(i,j) != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Access failed\n"
+                << " Details:\n"
+                << "   Element: (" << i << "," << j << ")\n"
+                << "   Result: " << A(i,j) << "\n"
+                << "   Expected result: " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   try {
+      const double value( A.at( 7UL, 0UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound access succeeded\n"
+          << " Details:\n"
+          << "   Result: " << value << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ToeplitzMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the ToeplitzMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   test_ = "ToeplitzMatrix iterator";
+
+   const MT A( VT{ 1.0, 2.0, 3.0 }, VT{ 1.0, 4.0, 5.0, 6.0 } );
+
+   for( size_t i=0UL; i<A.rows(); ++i )
+   {
+      if( A.end(i) - A.begin(i) != 4L || A.cend(i) - A.cbegin(i) != 4L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Row: " << i << "\n"
+             << "   Number of elements: " << ( A.end(i) - A.begin(i) ) << "\n"
+             << "   Expected number of elements: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      size_t j( 0UL );
+      for( auto it=A.cbegin(i); it!=A.cend(i); ++it, ++j ) {
+         if( *it != A(i,j) || it[0] != A(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid iterator value detected\n"
+                << " Details:\n"
+                << "   Element: (" << i << "," << j << ")\n"
+                << "   Result: " << *it << "\n"
+                << "   Expected result: " << A(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the nonZeros() member functions of the ToeplitzMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the nonZeros() member functions of the ToeplitzMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "ToeplitzMatrix::nonZeros()";
+
+   const MT A( VT{ 1.0, 0.0, 3.0, 0.0 }, VT{ 1.0, 2.0, 0.0, 0.0, 5.0, 0.0 } );
+   const DT D( A );
+
+   if( A.nonZeros() != nonZeros( D ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << A.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << nonZeros( D ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      if( A.nonZeros(i) != nonZeros( D, i ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements in row " << i << "\n"
+             << " Details:\n"
+             << "   Number of non-zeros         : " << A.nonZeros(i) << "\n"
+             << "   Expected number of non-zeros: " << nonZeros( D, i ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ToeplitzMatrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the FFT-based multiplication of a ToeplitzMatrix with dense
+// vectors and dense matrices. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   VT column( 300UL ), row( 257UL );
+   blaze::randomize( column );
+   blaze::randomize( row );
+   row[0UL] = column[0UL];
+
+   const MT A( column, row );
+   const DT D( A );
+
+   {
+      test_ = "ToeplitzMatrix/dense vector multiplication";
+
+      VT x( 257UL );
+      blaze::randomize( x );
+
+      const VT y( A * x );
+      checkError( y, VT( D * x ), 1E-12 );
+   }
+
+   {
+      test_ = "ToeplitzMatrix/dense matrix multiplication";
+
+      DT X( 257UL, 7UL );
+      blaze::randomize( X );
+
+      const DT Y( A * X );
+      checkError( Y, DT( D * X ), 1E-12 );
+   }
+
+   {
+      test_ = "ToeplitzMatrix/dense vector multiplication (small)";
+
+      const MT B( VT{ 1.0, 2.0, 3.0 }, VT{ 1.0, -1.0 } );
+      const VT y( B * VT{ 1.0, 2.0 } );
+
+      if( y != VT{ -1.0, 4.0, 7.0 } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( -1 4 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "ToeplitzMatrix/dense vector multiplication with invalid vector size";
+
+      try {
+         const VT y( A * VT( 300UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with invalid vector size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ToeplitzMatrix linear solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the solution of linear systems with symmetric (Levinson-
+// Durbin recursion) and non-symmetric ToeplitzMatrix instances. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSolve()
+{
+   VT column( 200UL );
+   for( size_t k=0UL; k<column.size(); ++k ) {
+      column[k] = std::pow( 0.6, double( k ) );
+   }
+   column[0UL] = 2.0;
+
+   const MT A( column );
+
+   {
+      test_ = "ToeplitzMatrix solve (vector)";
+
+      VT b( 200UL ), x;
+      blaze::randomize( b );
+
+      solve( A, x, b );
+      checkError( VT( A * x ), b, 1E-12 );
+   }
+
+   {
+      test_ = "ToeplitzMatrix solve (matrix)";
+
+      DT B( 200UL, 5UL ), X;
+      blaze::randomize( B );
+
+      solve( A, X, B );
+      checkError( DT( A * X ), B, 1E-12 );
+   }
+
+   {
+      test_ = "ToeplitzMatrix solve (non-symmetric)";
+
+      const MT B( VT{ 4.0, 1.0, 0.5 }, VT{ 4.0, 2.0, 0.3 } );
+      const VT b{ 1.0, 2.0, 3.0 };
+      VT x;
+
+      solve( B, x, b );
+      checkError( VT( B * x ), b, 1E-12 );
+   }
+
+   {
+      test_ = "ToeplitzMatrix solve (singular leading submatrix)";
+
+      const MT B( VT{ 0.0, 1.0 } );
+      const VT b{ 1.0, 1.0 };
+      VT x;
+
+      try {
+         solve( B, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with singular leading submatrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace toeplitzmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ToeplitzMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_TOEPLITZMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ToeplitzMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -156,6 +156,30 @@ void AliasingTest::testDMatDMatMult()
       checkResult( dB4x3_, result_ );
    }
 
+   // In-place assignment to left-hand side operand
+   {
+      test_ = "DMatDMatMult - In-place assignment to left-hand side operand";
+
+      initialize();
+
+      result_ = dC3x3_ * dD3x3_;
+      dC3x3_  = dC3x3_ * dD3x3_;
+
+      checkResult( dC3x3_, result_ );
+   }
+
+   // In-place assignment to right-hand side operand
+   {
+      test_ = "DMatDMatMult - In-place assignment to right-hand side operand";
+
+      initialize();
+
+      result_ = dC3x3_ * dD3x3_;
+      dD3x3_  = dC3x3_ * dD3x3_;
+
+      checkResult( dD3x3_, result_ );
+   }
+
    // Assignment to first operand of right-hand side compound
    {
       test_ = "DMatDMatMult - Assignment to first operand of right-hand side compound";
@@ -579,6 +603,30 @@ void AliasingTest::testDMatTDMatMult()
       checkResult( tdB4x3_, result_ );
    }
 
+   // In-place assignment to left-hand side operand
+   {
+      test_ = "DMatTDMatMult - In-place assignment to left-hand side operand";
+
+      initialize();
+
+      result_ = dC3x3_ * tdD3x3_;
+      dC3x3_  = dC3x3_ * tdD3x3_;
+
+      checkResult( dC3x3_, result_ );
+   }
+
+   // In-place assignment to right-hand side operand
+   {
+      test_ = "DMatTDMatMult - In-place assignment to right-hand side operand";
+
+      initialize();
+
+      result_ = dC3x3_ * tdD3x3_;
+      tdD3x3_ = dC3x3_ * tdD3x3_;
+
+      checkResult( tdD3x3_, result_ );
+   }
+
    // Assignment to first operand of right-hand side compound
    {
       test_ = "DMatTDMatMult - Assignment to first operand of right-hand side compound";
@@ -1002,6 +1050,30 @@ void AliasingTest::testTDMatDMatMult()
       checkResult( dB4x3_, result_ );
    }
 
+   // In-place assignment to left-hand side operand
+   {
+      test_ = "TDMatDMatMult - In-place assignment to left-hand side operand";
+
+      initialize();
+
+      result_ = tdC3x3_ * dD3x3_;
+      tdC3x3_ = tdC3x3_ * dD3x3_;
+
+      checkResult( tdC3x3_, result_ );
+   }
+
+   // In-place assignment to right-hand side operand
+   {
+      test_ = "TDMatDMatMult - In-place assignment to right-hand side operand";
+
+      initialize();
+
+      result_ = tdC3x3_ * dD3x3_;
+      dD3x3_  = tdC3x3_ * dD3x3_;
+
+      checkResult( dD3x3_, result_ );
+   }
+
    // Assignment to first operand of right-hand side compound
    {
       test_ = "TDMatDMatMult - Assignment to first operand of right-hand side compound";
@@ -1425,6 +1497,30 @@ void AliasingTest::testTDMatTDMatMult()
       checkResult( tdB4x3_, result_ );
    }
 
+   // In-place assignment to left-hand side operand
+   {
+      test_ = "TDMatTDMatMult - In-place assignment to left-hand side operand";
+
+      initialize();
+
+      result_ = tdC3x3_ * tdD3x3_;
+      tdC3x3_ = tdC3x3_ * tdD3x3_;
+
+      checkResult( tdC3x3_, result_ );
+   }
+
+   // In-place assignment to right-hand side operand
+   {
+      test_ = "TDMatTDMatMult - In-place assignment to right-hand side operand";
+
+      initialize();
+
+      result_ = tdC3x3_ * tdD3x3_;
+      tdD3x3_ = tdC3x3_ * tdD3x3_;
+
+      checkResult( tdD3x3_, result_ );
+   }
+
    // Assignment to first operand of right-hand side compound
    {
       test_ = "TDMatTDMatMult - Assignment to first operand of right-hand side compound";
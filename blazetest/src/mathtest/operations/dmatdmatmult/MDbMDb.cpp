@@ -71,9 +71,9 @@ int main()
       using CMDb = blazetest::Creator<MDb>;
 
       // Running tests with small matrices
-      for( size_t i=0UL; i<=6UL; ++i ) {
-         for( size_t j=0UL; j<=6UL; ++j ) {
-            for( size_t k=0UL; k<=6UL; ++k ) {
+      for( size_t i=0UL; i<=9UL; ++i ) {
+         for( size_t j=0UL; j<=9UL; ++j ) {
+            for( size_t k=0UL; k<=9UL; ++k ) {
                RUN_DMATDMATMULT_OPERATION_TEST( CMDb( i, j ), CMDb( j, k ) );
             }
          }
@@ -121,6 +121,34 @@ void AliasingTest::testDMatDVecMult()
       checkResult( da4_, result_ );
    }
 
+   // In-place assignment to vector operand of upper triangular product
+   {
+      test_ = "DMatDVecMult - In-place assignment to vector operand of upper triangular product";
+
+      initialize();
+
+      const blaze::UpperMatrix<DMat> U{ { 1, 2, -1 }, { 0, 3, 2 }, { 0, 0, -2 } };
+
+      result_ = U * dc3_;
+      dc3_    = U * dc3_;
+
+      checkResult( dc3_, result_ );
+   }
+
+   // In-place assignment to vector operand of lower triangular product
+   {
+      test_ = "DMatDVecMult - In-place assignment to vector operand of lower triangular product";
+
+      initialize();
+
+      const blaze::LowerMatrix<DMat> L{ { 1, 0, 0 }, { -2, 3, 0 }, { 1, 4, -2 } };
+
+      result_ = L * dc3_;
+      dc3_    = L * dc3_;
+
+      checkResult( dc3_, result_ );
+   }
+
    // Assignment to first operand of left-hand side compound
    {
       test_ = "DMatDVecMult - Assignment to first operand of left-hand side compound";
@@ -410,6 +438,34 @@ void AliasingTest::testTDMatDVecMult()
       checkResult( da4_, result_ );
    }
 
+   // In-place assignment to vector operand of upper triangular product
+   {
+      test_ = "TDMatDVecMult - In-place assignment to vector operand of upper triangular product";
+
+      initialize();
+
+      const blaze::UpperMatrix<TDMat> U{ { 1, 2, -1 }, { 0, 3, 2 }, { 0, 0, -2 } };
+
+      result_ = U * dc3_;
+      dc3_    = U * dc3_;
+
+      checkResult( dc3_, result_ );
+   }
+
+   // In-place assignment to vector operand of lower triangular product
+   {
+      test_ = "TDMatDVecMult - In-place assignment to vector operand of lower triangular product";
+
+      initialize();
+
+      const blaze::LowerMatrix<TDMat> L{ { 1, 0, 0 }, { -2, 3, 0 }, { 1, 4, -2 } };
+
+      result_ = L * dc3_;
+      dc3_    = L * dc3_;
+
+      checkResult( dc3_, result_ );
+   }
+
    // Assignment to first operand of right-hand side compound
    {
       test_ = "TDMatDVecMult - Assignment to first operand of right-hand side compound";
@@ -121,6 +121,34 @@ void AliasingTest::testTDVecDMatMult()
       checkResult( tda4_, result_ );
    }
 
+   // In-place assignment to vector operand of upper triangular product
+   {
+      test_ = "TDVecDMatMult - In-place assignment to vector operand of upper triangular product";
+
+      initialize();
+
+      const blaze::UpperMatrix<DMat> U{ { 1, 2, -1 }, { 0, 3, 2 }, { 0, 0, -2 } };
+
+      result_ = tdc3_ * U;
+      tdc3_   = tdc3_ * U;
+
+      checkResult( tdc3_, result_ );
+   }
+
+   // In-place assignment to vector operand of lower triangular product
+   {
+      test_ = "TDVecDMatMult - In-place assignment to vector operand of lower triangular product";
+
+      initialize();
+
+      const blaze::LowerMatrix<DMat> L{ { 1, 0, 0 }, { -2, 3, 0 }, { 1, 4, -2 } };
+
+      result_ = tdc3_ * L;
+      tdc3_   = tdc3_ * L;
+
+      checkResult( tdc3_, result_ );
+   }
+
    // Assignment to first operand of left-hand side compound
    {
       test_ = "TDVecDMatMult - Assignment to first operand of left-hand side compound";
@@ -409,6 +437,34 @@ void AliasingTest::testTDVecTDMatMult()
       checkResult( tda4_, result_ );
    }
 
+   // In-place assignment to vector operand of upper triangular product
+   {
+      test_ = "TDVecTDMatMult - In-place assignment to vector operand of upper triangular product";
+
+      initialize();
+
+      const blaze::UpperMatrix<TDMat> U{ { 1, 2, -1 }, { 0, 3, 2 }, { 0, 0, -2 } };
+
+      result_ = tdc3_ * U;
+      tdc3_   = tdc3_ * U;
+
+      checkResult( tdc3_, result_ );
+   }
+
+   // In-place assignment to vector operand of lower triangular product
+   {
+      test_ = "TDVecTDMatMult - In-place assignment to vector operand of lower triangular product";
+
+      initialize();
+
+      const blaze::LowerMatrix<TDMat> L{ { 1, 0, 0 }, { -2, 3, 0 }, { 1, 4, -2 } };
+
+      result_ = tdc3_ * L;
+      tdc3_   = tdc3_ * L;
+
+      checkResult( tdc3_, result_ );
+   }
+
    // Assignment to first operand of right-hand side compound
    {
       test_ = "TDVecTDMatMult - Assignment to first operand of right-hand side compound";
@@ -92,6 +92,7 @@ GeneralTest::GeneralTest()
    testMean();
    testVar();
    testStdDev();
+   testRolling();
    testSoftmax();
    testLeftShift();
    testRightShift();
@@ -1687,6 +1688,149 @@ void GeneralTest::testStdDev()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the rolling-window functions for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c rollingSum(), \c rollingMean(), \c rollingMin(),
+// \c rollingMax(), and \c rollingVar() functions for dense vectors. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testRolling()
+{
+   test_ = "rolling-window functions";
+
+   {
+      const blaze::DynamicVector<int,blaze::rowVector> vec{ 1, 4, 3, 6, 7 };
+
+      const blaze::DynamicVector<int,blaze::rowVector> sum( blaze::rollingSum( vec, 3UL ) );
+      const blaze::DynamicVector<double,blaze::rowVector> mean( blaze::rollingMean( vec, 2UL ) );
+      const blaze::DynamicVector<int,blaze::rowVector> min( blaze::rollingMin( vec, 2UL ) );
+      const blaze::DynamicVector<int,blaze::rowVector> max( blaze::rollingMax( vec, 2UL ) );
+      const blaze::DynamicVector<double,blaze::rowVector> var( blaze::rollingVar( vec, 3UL ) );
+
+      checkSize( sum , 3UL );
+      checkSize( mean, 4UL );
+      checkSize( min , 4UL );
+      checkSize( max , 4UL );
+      checkSize( var , 3UL );
+
+      if( sum[0] != 8 || sum[1] != 13 || sum[2] != 16 ||
+          !isEqual( mean[0], 2.5 ) || !isEqual( mean[1], 3.5 ) ||
+          !isEqual( mean[2], 4.5 ) || !isEqual( mean[3], 6.5 ) ||
+          min[0] != 1 || min[1] != 3 || min[2] != 3 || min[3] != 6 ||
+          max[0] != 4 || max[1] != 4 || max[2] != 6 || max[3] != 7 ||
+          !isEqual( var[0], 7.0/3.0 ) || !isEqual( var[1], 7.0/3.0 ) ||
+          !isEqual( var[2], 13.0/3.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Rolling-window computation failed\n"
+             << " Details:\n"
+             << "   Sum : " << sum << "\n"
+             << "   Mean: " << mean << "\n"
+             << "   Min : " << min << "\n"
+             << "   Max : " << max << "\n"
+             << "   Var : " << var << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( blaze::rollingSum( vec, 3UL )[1] != 13 ||
+          !isEqual( blaze::rollingVar( vec, 3UL )[2], 13.0/3.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element access failed\n"
+             << " Details:\n"
+             << "   Result: " << blaze::rollingSum( vec, 3UL ) << "\n"
+             << "   Expected result: ( 8 13 16 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::DynamicVector<double,blaze::rowVector> mapped(
+         blaze::map( blaze::rollingMean( vec, 2UL ), []( double a ){ return 2.0*a; } ) );
+
+      if( !isEqual( mapped[0], 5.0 ) || !isEqual( mapped[3], 13.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping of a rolling-window operation failed\n"
+             << " Details:\n"
+             << "   Result: " << mapped << "\n"
+             << "   Expected result: ( 5 7 9 13 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   for( size_t n : { 1UL, 7UL, 1000UL, 25000UL } ) {
+      for( size_t w : { 1UL, 2UL, 5UL, 64UL, 2000UL } )
+      {
+         if( w > n ) continue;
+
+         blaze::DynamicVector<double,blaze::columnVector> vec( n );
+         randomize( vec, -1.0, 1.0 );
+
+         using RT = blaze::DynamicVector<double,blaze::columnVector>;
+
+         const RT sum ( blaze::rollingSum ( vec, w ) );
+         const RT mean( blaze::rollingMean( vec, w ) );
+         const RT min ( blaze::rollingMin ( vec, w ) );
+         const RT max ( blaze::rollingMax ( vec, w ) );
+
+         RT var;
+         if( w > 1UL ) var = blaze::rollingVar( vec, w );
+
+         for( size_t i=0UL; i<n-w+1UL; ++i )
+         {
+            const auto window( subvector( vec, i, w ) );
+
+            if( std::fabs( sum[i]  - blaze::sum ( window ) ) > 1E-10 ||
+                std::fabs( mean[i] - blaze::mean( window ) ) > 1E-10 ||
+                min[i] != blaze::min( window ) || max[i] != blaze::max( window ) ||
+                ( w > 1UL && std::fabs( var[i] - blaze::var( window ) ) > 1E-10 ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Rolling-window computation failed\n"
+                   << " Details:\n"
+                   << "   Size  : " << n << "\n"
+                   << "   Window: " << w << "\n"
+                   << "   Index : " << i << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   try {
+      blaze::DynamicVector<int,blaze::rowVector> vec( 5UL );
+
+      const blaze::DynamicVector<int,blaze::rowVector> sum( blaze::rollingSum( vec, 6UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Rolling-window computation with too large window succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << sum << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::DynamicVector<int,blaze::rowVector> vec( 5UL );
+
+      const blaze::DynamicVector<double,blaze::rowVector> var( blaze::rollingVar( vec, 1UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Rolling-window variance with window size 1 succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << var << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c softmax() function for dense vectors.
 //
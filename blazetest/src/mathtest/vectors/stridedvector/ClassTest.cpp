@@ -0,0 +1,611 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/vectors/stridedvector/ClassTest.cpp
+//  \brief Source file for the StridedVector class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blazetest/mathtest/vectors/stridedvector/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace vectors {
+
+namespace stridedvector {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the StridedVector class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testIterator();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testMultAssign();
+   testDivAssign();
+   testMultiplication();
+   testAliasing();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the StridedVector constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the StridedVector class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   std::vector<int> array( 12UL );
+   std::iota( array.begin(), array.end(), 0 );
+
+   {
+      test_ = "StridedVector constructor ( Type*, size_t )";
+
+      VT a( array.data(), 4UL );
+
+      if( a.stride() != 1L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid stride detected\n"
+             << " Details:\n"
+             << "   Result  : " << a.stride() << "\n"
+             << "   Expected: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkVector( a, RVT{ 0, 1, 2, 3 } );
+   }
+
+   {
+      test_ = "StridedVector constructor ( Type*, size_t, ptrdiff_t )";
+
+      VT a( array.data()+1UL, 4UL, 3L );
+
+      checkVector( a, RVT{ 1, 4, 7, 10 } );
+   }
+
+   {
+      test_ = "StridedVector constructor ( Type*, size_t, ptrdiff_t ) (negative stride)";
+
+      VT a( array.data()+11UL, 3UL, -5L );
+
+      checkVector( a, RVT{ 11, 6, 1 } );
+   }
+
+   {
+      test_ = "StridedVector constructor ( nullptr, size_t )";
+
+      try {
+         VT a( nullptr, 4UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with nullptr succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "StridedVector constructor ( Type*, size_t, 0 )";
+
+      try {
+         VT a( array.data(), 4UL, 0L );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with zero stride succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StridedVector iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the StridedVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   test_ = "StridedVector iterator";
+
+   std::vector<int> array( 12UL );
+   std::iota( array.begin(), array.end(), 0 );
+
+   VT a( array.data()+11UL, 3UL, -5L );
+
+   const ptrdiff_t number( a.end() - a.begin() );
+   int sum( 0 );
+   for( auto it=a.cbegin(); it!=a.cend(); ++it )
+      sum += *it;
+
+   if( number != 3L || sum != 18 || a.begin()[1] != 6 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid iteration detected\n"
+          << " Details:\n"
+          << "   Number of elements: " << number << " (expected 3)\n"
+          << "   Sum of elements   : " << sum << " (expected 18)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StridedVector assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the StridedVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   const RVT ref{ 1, 2, 3, 4 };
+
+   {
+      test_ = "StridedVector homogeneous assignment";
+
+      std::vector<int> array( 8UL, 0 );
+      VT a( array.data(), 4UL, 2L );
+      a = 5;
+
+      checkVector( a, RVT( 4UL, 5 ) );
+
+      if( array[1] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid assignment to unreferenced elements\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "StridedVector dense vector assignment";
+
+      std::vector<int> array( 8UL, 0 );
+      VT a( array.data()+7UL, 4UL, -2L );
+      a = ref;
+
+      checkVector( a, ref );
+
+      if( array[7] != 1 || array[1] != 4 || array[0] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid array layout detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "StridedVector dense vector assignment (size mismatch)";
+
+      std::vector<int> array( 8UL, 0 );
+      VT a( array.data(), 3UL, 2L );
+
+      try {
+         a = ref;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a vector with different size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "StridedVector sparse vector assignment";
+
+      blaze::CompressedVector<int> s( 4UL );
+      s[2] = 7;
+
+      std::vector<int> array( 8UL, 1 );
+      VT a( array.data(), 4UL, 2L );
+      a = s;
+
+      checkVector( a, s );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StridedVector addition assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operators of the StridedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   test_ = "StridedVector addition assignment";
+
+   const RVT ref{ 1, 2, 3, 4 };
+
+   std::vector<int> array( 8UL, 1 );
+   VT a( array.data(), 4UL, 2L );
+   a += ref;
+
+   checkVector( a, ref + 1 );
+
+   VT b( array.data(), 4UL );
+   b += ref;
+
+   checkVector( b, RVT{ 3, 3, 6, 5 } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StridedVector subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operators of the StridedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   test_ = "StridedVector subtraction assignment";
+
+   const RVT ref{ 1, 2, 3, 4 };
+
+   std::vector<int> array( 8UL, 1 );
+   VT a( array.data()+1UL, 4UL, 2L );
+   a -= ref;
+
+   checkVector( a, 1 - ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StridedVector multiplication assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication assignment operators of the StridedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultAssign()
+{
+   test_ = "StridedVector multiplication assignment";
+
+   const RVT ref{ 1, 2, 3, 4 };
+
+   std::vector<int> array( 8UL, 2 );
+   VT a( array.data(), 4UL, 2L );
+   a *= ref;
+
+   checkVector( a, 2 * ref );
+
+   a *= 3;
+
+   checkVector( a, 6 * ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StridedVector division assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the division assignment operators of the StridedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDivAssign()
+{
+   test_ = "StridedVector division assignment";
+
+   const RVT ref{ 1, 2, 3, 4 };
+
+   std::vector<int> array( 8UL, 12 );
+   VT a( array.data(), 4UL, 2L );
+   a /= ref;
+
+   checkVector( a, RVT{ 12, 6, 4, 3 } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of matrix/vector multiplications involving strided vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of dense matrix/vector multiplications involving strided
+// operands and strided targets. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   test_ = "StridedVector multiplication";
+
+   std::vector<int> array( 30UL );
+   std::iota( array.begin(), array.end(), -15 );
+
+   const blaze::DynamicMatrix<int> A{ { 1, 2, 0, -1 }, { 3, -2, 1, 0 }, { 0, 1, 4, 2 } };
+
+   const VT  x( array.data()+2UL, 4UL, 7L );
+   const TVT y( array.data()+29UL, 3UL, -3L );
+   const RVT rx( x );
+   const blaze::DynamicVector<int,blaze::rowVector> ry( y );
+
+   checkVector( RVT( A * x ), A * rx );
+   checkVector( blaze::DynamicVector<int,blaze::rowVector>( y * A ), ry * A );
+
+   std::vector<int> target( 9UL, 0 );
+   VT z( target.data()+8UL, 3UL, -4L );
+   z = A * x;
+
+   checkVector( z, A * rx );
+
+   if( target[8] != ( A * rx )[0] ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid array layout detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the aliasing detection of strided vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of (compound) assignments between strided vectors and custom
+// vectors referring to overlapping memory. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAliasing()
+{
+   using CVT = blaze::CustomVector<int,blaze::unaligned,blaze::unpadded,blaze::columnVector>;
+
+   {
+      test_ = "StridedVector assignment of a reversed view";
+
+      std::vector<int> array( 6UL );
+      std::iota( array.begin(), array.end(), 1 );
+
+      VT x( array.data()    , 6UL,  1L );
+      VT y( array.data()+5UL, 6UL, -1L );
+
+      if( !x.isAliased( &y ) || !y.canAlias( &x ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliasing of a reversed view not detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      x = y;
+      checkVector( x, RVT{ 6, 5, 4, 3, 2, 1 } );
+   }
+
+   {
+      test_ = "StridedVector assignment of a reversed view (non-unit stride)";
+
+      std::vector<int> array( 11UL );
+      std::iota( array.begin(), array.end(), 1 );
+
+      VT x( array.data()     , 6UL,  2L );
+      VT y( array.data()+10UL, 6UL, -2L );
+
+      x = y;
+      checkVector( x, RVT{ 11, 9, 7, 5, 3, 1 } );
+   }
+
+   {
+      test_ = "StridedVector compound assignment of a reversed view";
+
+      std::vector<int> array( 6UL );
+      std::iota( array.begin(), array.end(), 1 );
+
+      VT x( array.data()    , 6UL,  1L );
+      VT y( array.data()+5UL, 6UL, -1L );
+
+      x += y;
+      checkVector( x, RVT{ 7, 7, 7, 7, 7, 7 } );
+
+      std::iota( array.begin(), array.end(), 1 );
+      x -= y;
+      checkVector( x, RVT{ -5, -3, -1, 1, 3, 5 } );
+
+      std::iota( array.begin(), array.end(), 1 );
+      x *= y;
+      checkVector( x, RVT{ 6, 10, 12, 12, 10, 6 } );
+   }
+
+   {
+      test_ = "StridedVector assignment of a shifted view";
+
+      std::vector<int> array( 7UL );
+      std::iota( array.begin(), array.end(), 1 );
+
+      VT x( array.data()+1UL, 6UL );
+      VT y( array.data()    , 6UL );
+
+      x = y;
+      checkVector( x, RVT{ 1, 2, 3, 4, 5, 6 } );
+   }
+
+   {
+      test_ = "StridedVector assignment of a shifted CustomVector";
+
+      std::vector<int> array( 7UL );
+      std::iota( array.begin(), array.end(), 1 );
+
+      VT  x( array.data()+1UL, 6UL );
+      CVT c( array.data()    , 6UL );
+
+      if( !x.canAlias( &c ) || !x.isAliased( &c ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliasing of a shifted CustomVector not detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      x = c;
+      checkVector( x, RVT{ 1, 2, 3, 4, 5, 6 } );
+
+      std::iota( array.begin(), array.end(), 1 );
+      x += c;
+      checkVector( x, RVT{ 3, 5, 7, 9, 11, 13 } );
+   }
+
+   {
+      test_ = "StridedVector assignment of a shifted CustomVector (non-unit stride)";
+
+      std::vector<int> array( 12UL, 0 );
+      std::iota( array.begin(), array.begin()+6, 1 );
+
+      VT  x( array.data()+1UL, 6UL, 2L );
+      CVT c( array.data()    , 6UL );
+
+      x = c;
+      checkVector( x, RVT{ 1, 2, 3, 4, 5, 6 } );
+   }
+
+   {
+      test_ = "StridedVector aliasing of disjoint views";
+
+      std::vector<int> array( 16UL, 0 );
+
+      VT  x( array.data()     , 6UL, 2L );
+      VT  y( array.data()+13UL, 3UL, -1L );
+      CVT c( array.data()+14UL, 2UL );
+
+      if( x.isAliased( &y ) || y.isAliased( &x ) || x.isAliased( &c ) || y.isAliased( &c ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliasing of disjoint views detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace stridedvector
+
+} // namespace vectors
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running StridedVector class test..." << std::endl;
+
+   try
+   {
+      RUN_STRIDEDVECTOR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during StridedVector class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
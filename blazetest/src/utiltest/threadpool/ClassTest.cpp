@@ -0,0 +1,356 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadpool/ClassTest.cpp
+//  \brief Source file for the ThreadPool class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/system/SMP.h>
+#include <blazetest/utiltest/threadpool/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  DEFINITION OF THE TEST CONSTANTS
+//
+//=================================================================================================
+
+constexpr size_t ClassTest::number;
+constexpr std::chrono::milliseconds ClassTest::timeout;
+constexpr std::chrono::seconds ClassTest::deadline;
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadPool class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testIdleTimeout();
+   testSchedule();
+   testWarmup();
+   testLazyCreation();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the termination of idle threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the threads of a thread pool terminate as soon as they have been
+// idle for the given idle timeout without changing the size of the thread pool. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIdleTimeout()
+{
+   test_ = "Termination of idle threads";
+
+   Pool pool( number, timeout );
+
+   if( pool.size() != number || pool.running() > number ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of threads after construction\n"
+          << " Details:\n"
+          << "   Size              : " << pool.size() << "\n"
+          << "   Running threads   : " << pool.running() << "\n"
+          << "   Expected size     : " << number << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( !waitUntil( [&pool]() { return pool.running() == 0UL; } ) || pool.size() != number ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Idle threads have not been terminated\n"
+          << " Details:\n"
+          << "   Size              : " << pool.size() << "\n"
+          << "   Running threads   : " << pool.running() << "\n"
+          << "   Expected size     : " << number << "\n"
+          << "   Expected threads  : 0\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the restart of terminated threads by the schedule() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that scheduling a task restarts a thread after all threads of the thread
+// pool have been terminated due to the idle timeout. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSchedule()
+{
+   test_ = "Restart of terminated threads by schedule()";
+
+   Pool pool( number, timeout );
+
+   if( !waitUntil( [&pool]() { return pool.running() == 0UL; } ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Idle threads have not been terminated\n"
+          << " Details:\n"
+          << "   Running threads   : " << pool.running() << "\n"
+          << "   Expected threads  : 0\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::atomic<bool> release( false );
+   std::atomic<bool> executed( false );
+
+   pool.schedule( [&release,&executed]() {
+      while( !release.load() ) {
+         std::this_thread::yield();
+      }
+      executed.store( true );
+   } );
+
+   const size_t running( pool.running() );
+
+   release.store( true );
+   pool.wait();
+
+   if( running != 1UL || !executed.load() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Terminated thread has not been restarted\n"
+          << " Details:\n"
+          << "   Running threads   : " << running << "\n"
+          << "   Expected threads  : 1\n"
+          << "   Task executed     : " << executed.load() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the restart of terminated threads by the warmup() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the warmup() function restarts all threads that have been terminated
+// due to the idle timeout and that the restarted threads terminate again as soon as the idle
+// timeout is restored. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testWarmup()
+{
+   test_ = "Restart of terminated threads by warmup()";
+
+   Pool pool( number, timeout );
+
+   if( !waitUntil( [&pool]() { return pool.running() == 0UL; } ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Idle threads have not been terminated\n"
+          << " Details:\n"
+          << "   Running threads   : " << pool.running() << "\n"
+          << "   Expected threads  : 0\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Keeping the restarted threads alive until the number of running threads has been checked
+   pool.setIdleTimeout( std::chrono::milliseconds::zero() );
+   pool.warmup();
+
+   if( pool.running() != number ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Terminated threads have not been restarted\n"
+          << " Details:\n"
+          << "   Running threads   : " << pool.running() << "\n"
+          << "   Expected threads  : " << number << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   pool.setIdleTimeout( timeout );
+
+   if( !waitUntil( [&pool]() { return pool.running() == 0UL; } ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Restarted threads have not been terminated\n"
+          << " Details:\n"
+          << "   Running threads   : " << pool.running() << "\n"
+          << "   Expected threads  : 0\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the lazy creation of the built-in thread pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the number of threads and the idle timeout specified via the
+// setNumThreads() and setThreadIdleTimeout() functions before the first parallel operation
+// are applied to the lazily created built-in thread pool of the C++11 and Boost thread-based
+// parallelization. For all other parallelization modes the test has no effect. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLazyCreation()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+
+   test_ = "Lazy creation of the built-in thread pool";
+
+   using blaze::TheThreadBackend;
+
+   blaze::setNumThreads( number );
+   blaze::setThreadIdleTimeout( timeout );
+
+   if( TheThreadBackend::running() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Threads have been started before the first parallel operation\n"
+          << " Details:\n"
+          << "   Running threads   : " << TheThreadBackend::running() << "\n"
+          << "   Expected threads  : 0\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Executing one task per thread, each of which waits for all other tasks to be started.
+   // This is only possible in case the thread pool has been created with the given number
+   // of threads.
+   std::atomic<size_t> started( 0UL );
+   std::atomic<size_t> succeeded( 0UL );
+
+   TheThreadBackend::executor().execute( number, [this,&started,&succeeded]( size_t )
+   {
+      ++started;
+      if( waitUntil( [&started]() { return started.load() == number; } ) ) {
+         ++succeeded;
+      }
+   } );
+
+   if( succeeded.load() != number ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Number of threads has not been applied to the thread pool\n"
+          << " Details:\n"
+          << "   Concurrent tasks  : " << started.load() << "\n"
+          << "   Expected tasks    : " << number << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+   // The idle timeout has no effect on Boost threads (see ThreadPool::setIdleTimeout())
+   if( !waitUntil( []() { return TheThreadBackend::running() == 0UL; } ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Idle timeout has not been applied to the thread pool\n"
+          << " Details:\n"
+          << "   Running threads   : " << TheThreadBackend::running() << "\n"
+          << "   Expected threads  : 0\n";
+      throw std::runtime_error( oss.str() );
+   }
+#endif
+
+#endif
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThreadPool class test..." << std::endl;
+
+   try
+   {
+      RUN_THREADPOOL_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThreadPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************